@@ -22,6 +22,7 @@ DIAGNOSTIC_POP
 #include "common/type_list.h"
 #include "gutil/dynamic_annotations.h"
 #include "runtime/current_thread.h"
+#include "util/cpu_info.h"
 
 namespace starrocks::vectorized {
 
@@ -35,6 +36,7 @@ namespace starrocks::vectorized {
 inline bvar::Adder<uint64_t> g_column_pool_oversized_columns("column_pool", "oversized_columns");
 inline bvar::Adder<int64_t> g_column_pool_total_local_bytes("column_pool", "total_local_bytes");
 inline bvar::Adder<int64_t> g_column_pool_total_central_bytes("column_pool", "total_central_bytes");
+inline bvar::Adder<uint64_t> g_column_pool_remote_node_blocks("column_pool", "remote_node_blocks");
 
 #ifndef BE_TEST
 #define UPDATE_BVAR(bvar_name, value) (bvar_name) << (value)
@@ -250,9 +252,12 @@ public:
         if (now - _first_push_time > 3) {
             //    ^^^^^^^^^^^^^^^^ read without lock by intention.
             std::lock_guard<std::mutex> l(_free_blocks_lock);
-            int n = implicit_cast<int>(_free_blocks.size() * (1 - free_ratio));
-            tmp.insert(tmp.end(), _free_blocks.begin() + n, _free_blocks.end());
-            _free_blocks.resize(n);
+            for (auto& free_blocks : _free_blocks) {
+                int n = implicit_cast<int>(free_blocks.size() * (1 - free_ratio));
+                tmp.insert(tmp.end(), free_blocks.begin() + n, free_blocks.end());
+                free_blocks.resize(n);
+            }
+            _num_free_blocks -= tmp.size();
         }
         size_t freed_bytes = 0;
         for (DynamicFreeBlock* blk : tmp) {
@@ -288,13 +293,15 @@ public:
     inline ColumnPoolInfo describe_column_pool() {
         ColumnPoolInfo info;
         info.local_cnt = _nlocal.load(std::memory_order_relaxed);
-        if (_free_blocks.empty()) {
+        if (_num_free_blocks == 0) {
             return info;
         }
         std::lock_guard<std::mutex> l(_free_blocks_lock);
-        for (DynamicFreeBlock* blk : _free_blocks) {
-            info.central_free_items += blk->nfree;
-            info.central_free_bytes += blk->bytes;
+        for (const auto& free_blocks : _free_blocks) {
+            for (DynamicFreeBlock* blk : free_blocks) {
+                info.central_free_items += blk->nfree;
+                info.central_free_bytes += blk->bytes;
+            }
         }
         return info;
     }
@@ -356,34 +363,70 @@ private:
         p->nfree = blk.nfree;
         p->bytes = blk.bytes;
         memcpy(p->ptrs, blk.ptrs, sizeof(*blk.ptrs) * blk.nfree);
+        size_t node = _current_node();
         std::lock_guard<std::mutex> l(_free_blocks_lock);
-        _first_push_time = _free_blocks.empty() ? butil::gettimeofday_s() : _first_push_time;
-        _free_blocks.push_back(p);
+        _first_push_time = _num_free_blocks == 0 ? butil::gettimeofday_s() : _first_push_time;
+        _free_blocks[node].push_back(p);
+        _num_free_blocks++;
         return true;
     }
 
+    // The free blocks pushed by the threads of the same NUMA node are popped at first, whose columns are
+    // likely to be placed in the local memory.
     inline bool _pop_free_block(FreeBlock* blk) {
-        if (_free_blocks.empty()) {
+        if (_num_free_blocks == 0) {
             return false;
         }
+        size_t node = _current_node();
+        bool remote = false;
         _free_blocks_lock.lock();
-        if (_free_blocks.empty()) {
-            _free_blocks_lock.unlock();
-            return false;
+        if (_free_blocks[node].empty()) {
+            if (!config::reuse_remote_numa_node_memory) {
+                _free_blocks_lock.unlock();
+                return false;
+            }
+            for (size_t i = 1; i < _free_blocks.size(); i++) {
+                if (!_free_blocks[(node + i) % _free_blocks.size()].empty()) {
+                    node = (node + i) % _free_blocks.size();
+                    remote = true;
+                    break;
+                }
+            }
+            if (!remote) {
+                _free_blocks_lock.unlock();
+                return false;
+            }
         }
-        DynamicFreeBlock* p = _free_blocks.back();
-        _free_blocks.pop_back();
+        DynamicFreeBlock* p = _free_blocks[node].back();
+        _free_blocks[node].pop_back();
+        _num_free_blocks--;
         _free_blocks_lock.unlock();
         memcpy(blk->ptrs, p->ptrs, sizeof(*p->ptrs) * p->nfree);
         blk->nfree = p->nfree;
         blk->bytes = p->bytes;
         free(p);
         UPDATE_BVAR(g_column_pool_total_central_bytes, -blk->bytes);
+        if (remote) {
+            UPDATE_BVAR(g_column_pool_remote_node_blocks, 1);
+            tls_thread_status.add_remote_numa_node_bytes(blk->bytes);
+        }
         return true;
     }
 
+    inline size_t _current_node() const {
+        if (_free_blocks.size() == 1) {
+            return 0;
+        }
+        size_t node = CpuInfo::get_numa_node_of_core(CpuInfo::get_current_core());
+        return node < _free_blocks.size() ? node : 0;
+    }
+
 private:
-    ColumnPool() { _free_blocks.reserve(32); }
+    ColumnPool() : _free_blocks(std::max(CpuInfo::get_max_num_numa_nodes(), 1)) {
+        for (auto& free_blocks : _free_blocks) {
+            free_blocks.reserve(32);
+        }
+    }
 
     ~ColumnPool() = default;
 
@@ -394,7 +437,9 @@ private:
     static std::mutex _change_thread_mutex; // NOLINT
 
     mutable std::mutex _free_blocks_lock;
-    std::vector<DynamicFreeBlock*> _free_blocks;
+    // the central free blocks of each NUMA node
+    std::vector<std::vector<DynamicFreeBlock*>> _free_blocks;
+    size_t _num_free_blocks = 0;
     int64_t _first_push_time = 0;
 };
 
@@ -0,0 +1,112 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "column/vectorized_fwd.h"
+#include "util/slice.h"
+
+namespace starrocks::vectorized {
+
+// A 16 bytes view of a string, which keeps the length and the first 4 bytes of the string inline,
+// followed by the other bytes of a string of at most 12 bytes, or a pointer to the data of a longer
+// string. Most of the strings are different in their lengths or first bytes, so comparing them by
+// GermanString needn't access the data of the strings, which are likely to miss the cache when the
+// strings are accessed randomly, e.g. in a hash table or in sorting.
+//
+// The view doesn't own the data of the long strings, it's valid as long as the Slice it's built from.
+class GermanString {
+public:
+    static constexpr uint32_t PREFIX_SIZE = 4;
+    static constexpr uint32_t INLINE_SIZE = 12;
+
+    GermanString() { memset(this, 0, sizeof(GermanString)); }
+
+    explicit GermanString(const Slice& slice) {
+        _size = slice.size;
+        if (_size <= INLINE_SIZE) {
+            memset(_inlined, 0, INLINE_SIZE);
+            memcpy(_inlined, slice.data, _size);
+        } else {
+            memcpy(_long.prefix, slice.data, PREFIX_SIZE);
+            _long.data = slice.data;
+        }
+    }
+
+    uint32_t size() const { return _size; }
+
+    bool is_inline() const { return _size <= INLINE_SIZE; }
+
+    const char* data() const { return is_inline() ? _inlined : _long.data; }
+
+    Slice to_slice() const { return {data(), _size}; }
+
+    bool operator==(const GermanString& rhs) const {
+        // the size and the prefix are compared at once
+        if (_size_and_prefix() != rhs._size_and_prefix()) {
+            return false;
+        }
+        if (is_inline()) {
+            // the unused bytes are zero
+            return memcmp(_inlined + PREFIX_SIZE, rhs._inlined + PREFIX_SIZE, INLINE_SIZE - PREFIX_SIZE) == 0;
+        }
+        return memcmp(_long.data + PREFIX_SIZE, rhs._long.data + PREFIX_SIZE, _size - PREFIX_SIZE) == 0;
+    }
+
+    bool operator!=(const GermanString& rhs) const { return !(*this == rhs); }
+
+    // Same result as Slice::compare
+    int compare(const GermanString& rhs) const {
+        uint32_t min_size = std::min(_size, rhs._size);
+        if (min_size >= PREFIX_SIZE) {
+            uint32_t l = _prefix_as_big_endian();
+            uint32_t r = rhs._prefix_as_big_endian();
+            if (l != r) {
+                return l < r ? -1 : 1;
+            }
+        }
+        int res = memcmp(data(), rhs.data(), min_size);
+        if (res != 0) {
+            return res;
+        }
+        return _size < rhs._size ? -1 : (_size > rhs._size ? 1 : 0);
+    }
+
+private:
+    uint64_t _size_and_prefix() const {
+        uint64_t v;
+        memcpy(&v, this, sizeof(v));
+        return v;
+    }
+
+    uint32_t _prefix_as_big_endian() const {
+        uint32_t v;
+        memcpy(&v, _inlined, PREFIX_SIZE);
+        return __builtin_bswap32(v);
+    }
+
+    uint32_t _size;
+    union {
+        // the first PREFIX_SIZE bytes are the prefix of both inlined and long strings.
+        char _inlined[INLINE_SIZE];
+        struct {
+            char prefix[PREFIX_SIZE];
+            const char* data;
+        } __attribute__((packed)) _long;
+    };
+};
+
+static_assert(sizeof(GermanString) == 16);
+
+// Build the GermanString views of |slices|.
+inline void build_german_strings(const Buffer<Slice>& slices, Buffer<GermanString>* views) {
+    views->resize(slices.size());
+    for (size_t i = 0; i < slices.size(); i++) {
+        (*views)[i] = GermanString(slices[i]);
+    }
+}
+
+} // namespace starrocks::vectorized
@@ -121,6 +121,8 @@ CONF_mInt32(report_tablet_interval_seconds, "60");
 // CONF_Int32(release_snapshot_timeout_seconds, "600");
 // the max download speed(KB/s)
 CONF_mInt32(max_download_speed_kbps, "50000");
+// the max number of files downloaded concurrently by a clone task, they share max_download_speed_kbps
+CONF_mInt32(clone_download_max_parallel, "4");
 // download low speed limit(KB/s)
 CONF_mInt32(download_low_speed_limit_kbps, "50");
 // download low speed time(seconds)
@@ -224,10 +226,16 @@ CONF_mInt64(column_dictionary_key_size_threshold, "0");
 //CONF_String(module_output, "");
 // memory_limitation_per_thread_for_schema_change unit GB
 CONF_mInt32(memory_limitation_per_thread_for_schema_change, "2");
+// the max number of rowsets of a tablet converted concurrently by a schema change or rollup,
+// they share memory_limitation_per_thread_for_schema_change
+CONF_mInt32(schema_change_rowset_parallelism, "4");
 
 // CONF_Int64(max_unpacked_row_block_size, "104857600");
 
 CONF_mInt32(update_cache_expire_sec, "360");
+// The max number of threads used by one rowset commit apply of a primary key tablet, to load the
+// primary keys of the segments and to generate the delete vectors in parallel.
+CONF_mInt32(update_apply_parallelism, "4");
 CONF_mInt32(file_descriptor_cache_clean_interval, "3600");
 CONF_mInt32(disk_stat_monitor_interval, "5");
 CONF_mInt32(unused_rowset_monitor_interval, "30");
@@ -398,6 +406,14 @@ CONF_Bool(use_mmap_allocate_chunk, "false");
 // acquire more free memory which can not be used by other modules
 CONF_Int64(chunk_reserved_bytes_limit, "2147483648");
 
+// The free chunks cached by Chunk Allocator and the free columns cached by column pools are
+// handed out to the threads running on the same NUMA node at first. This is whether they can
+// be handed out to the threads on other NUMA nodes at last, whose accesses to the memory are
+// slower than to the local memory. If false, new memory is allocated instead, which is placed
+// on the node of the allocating thread by first touch. The bytes handed out to other nodes are
+// shown as RemoteNumaNodeBytes in the profile of pipeline drivers.
+CONF_mBool(reuse_remote_numa_node_memory, "true");
+
 // The probing algorithm of partitioned hash table.
 // Enable quadratic probing hash table
 CONF_Bool(enable_quadratic_probing, "false");
@@ -472,6 +488,9 @@ CONF_mInt32(tablet_stat_cache_update_interval_second, "300");
 // result buffer cancelled time (unit: second)
 CONF_mInt32(result_buffer_cancelled_interval_time, "300");
 
+// the max number of rows packed into one Arrow IPC stream sent to the client by arrow result sink
+CONF_mInt32(arrow_result_batch_max_rows, "65536");
+
 // the increased frequency of priority for remaining tasks in BlockingPriorityQueue
 CONF_mInt32(priority_queue_remaining_tasks_increased_frequency, "512");
 
@@ -489,6 +508,9 @@ CONF_Bool(enable_metric_calculator, "true");
 
 // max consumer num in one data consumer group, for routine load
 CONF_mInt32(max_consumer_num_per_group, "3");
+// the max number of pipes one routine load task fans kafka partitions out to.
+// each pipe is read and parsed by its own scanner.
+CONF_mInt32(max_pipe_num_per_routine_load_task, "3");
 
 // the size of thread pool for routine load task.
 // this should be larger than FE config 'max_concurrent_task_num_per_be' (default 5)
@@ -512,6 +534,10 @@ CONF_String(es_scroll_keepalive, "5m");
 // HTTP connection timeout for es
 CONF_Int32(es_http_timeout_ms, "5000");
 
+// The number of sliced scrolls that read an es shard in parallel. Slicing a single shard makes es
+// build a filter over the doc ids of each slice, so it only pays off for large shards.
+CONF_mInt32(es_scroll_slices_per_shard, "1");
+
 // the max client cache number per each host
 // There are variety of client cache in BE, but currently we use the
 // same cache size configuration.
@@ -592,6 +618,10 @@ CONF_Int16(bitmap_max_filter_ratio, "1");
 
 CONF_Bool(bitmap_filter_enable_not_equal, "false");
 
+// Whether to narrow the scan range of segments by evaluating the OR predicates,
+// e.g, `c1 = 1 OR c2 = 2`, on the bitmap indexes.
+CONF_mBool(bitmap_filter_enable_or, "true");
+
 // Only 1 and 2 is valid.
 // When storage_format_version is 1, use origin storage format for Date, Datetime and Decimal
 // type.
@@ -646,6 +676,12 @@ CONF_Int64(pipeline_scan_thread_pool_thread_num, "0");
 CONF_Int64(pipeline_scan_thread_pool_queue_size, "102400");
 // the number of execution threads for pipeline engine.
 CONF_Int64(pipeline_exec_thread_pool_thread_num, "0");
+// whether to share the execution time and the scan io time of pipeline engine among the resource groups
+// of queries in proportion to their shares.
+CONF_Bool(enable_pipeline_resource_group, "false");
+// the cpu share and the scan io share of the default resource group, which the queries without
+// resource group belong to.
+CONF_Int32(pipeline_default_resource_group_share, "1024");
 // the buffer size of io task
 CONF_Int64(pipeline_io_buffer_size, "64");
 // the buffer size of SinkBuffer
@@ -668,6 +704,15 @@ CONF_Int64(max_segment_file_size, "1073741824");
 // hdfsPreadFully() are always enabled for object storage.
 CONF_Bool(use_hdfs_pread, "true");
 
+// Whether the native parquet reader decodes the columns with conjuncts first, and only decodes the
+// rows of other columns that pass the conjuncts.
+CONF_mBool(parquet_late_materialization_enable, "true");
+// Whether the native parquet reader skips the pages filtered by the min/max values in page index.
+CONF_mBool(parquet_page_index_enable, "true");
+// Whether the ORC scanner reads the columns with conjuncts first, and only reads the rows of other
+// columns that pass the conjuncts.
+CONF_mBool(orc_late_materialization_enable, "true");
+
 } // namespace config
 
 } // namespace starrocks
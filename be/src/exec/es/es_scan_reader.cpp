@@ -118,7 +118,7 @@ Status ESScanReader::open() {
 }
 
 template <class T>
-Status ESScanReader::get_next(bool* scan_eos, std::unique_ptr<T>& scroll_parser) {
+Status ESScanReader::get_next(bool* scan_eos, T* scroll_parser) {
     std::string response;
     // if is first scroll request, should return the cached response
     *scan_eos = true;
@@ -127,7 +127,7 @@ Status ESScanReader::get_next(bool* scan_eos, std::unique_ptr<T>& scroll_parser)
     }
 
     if (_is_first) {
-        response = _cached_response;
+        response = std::move(_cached_response);
         _is_first = false;
     } else {
         if (_exactly_once) {
@@ -154,9 +154,8 @@ Status ESScanReader::get_next(bool* scan_eos, std::unique_ptr<T>& scroll_parser)
         }
     }
 
-    scroll_parser.reset(new T(_doc_value_mode));
     VLOG(1) << "get_next request ES, returned response: " << response;
-    Status status = scroll_parser->parse(response, _exactly_once);
+    Status status = scroll_parser->parse(&response, _exactly_once);
     if (!status.ok()) {
         _eos = true;
         LOG(WARNING) << status.get_error_msg();
@@ -179,8 +178,8 @@ Status ESScanReader::get_next(bool* scan_eos, std::unique_ptr<T>& scroll_parser)
     return Status::OK();
 }
 
-template Status ESScanReader::get_next<vectorized::ScrollParser>(
-        bool* scan_eos, std::unique_ptr<vectorized::ScrollParser>& scroll_parser);
+template Status ESScanReader::get_next<vectorized::ScrollParser>(bool* scan_eos,
+                                                                vectorized::ScrollParser* scroll_parser);
 
 Status ESScanReader::close() {
     if (_scroll_id.empty()) {
@@ -43,14 +43,17 @@ public:
     static constexpr const char* KEY_BATCH_SIZE = "batch_size";
     static constexpr const char* KEY_TERMINATE_AFTER = "limit";
     static constexpr const char* KEY_DOC_VALUES_MODE = "doc_values_mode";
+    // The shard is read by |KEY_SLICE_MAX| sliced scrolls, and this reader reads the |KEY_SLICE_ID|-th of them.
+    static constexpr const char* KEY_SLICE_ID = "slice_id";
+    static constexpr const char* KEY_SLICE_MAX = "slice_max";
     ESScanReader(const std::string& target, const std::map<std::string, std::string>& props, bool doc_value_mode);
     ~ESScanReader();
 
     // launch the first scroll request, this method will cache the first scroll response, and return the this cached response when invoke get_next
     Status open();
-    // invoke get_next to get next batch documents from elasticsearch
+    // invoke get_next to get next batch documents from elasticsearch, which are parsed by |parser|
     template <class T>
-    Status get_next(bool* eos, std::unique_ptr<T>& parser);
+    Status get_next(bool* eos, T* parser);
     // clear scroll context from elasticsearch
     Status close();
 
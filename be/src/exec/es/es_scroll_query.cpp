@@ -130,6 +130,16 @@ std::string ESScrollQueryBuilder::build(const std::map<std::string, std::string>
     es_query_dsl.AddMember("sort", sort_node, allocator);
     // number of docuements returned
     es_query_dsl.AddMember("size", size, allocator);
+    // read a slice of the shard by a sliced scroll
+    if (properties.find(ESScanReader::KEY_SLICE_MAX) != properties.end()) {
+        int slice_max = atoi(properties.at(ESScanReader::KEY_SLICE_MAX).c_str());
+        if (slice_max > 1) {
+            rapidjson::Value slice_node(rapidjson::kObjectType);
+            slice_node.AddMember("id", atoi(properties.at(ESScanReader::KEY_SLICE_ID).c_str()), allocator);
+            slice_node.AddMember("max", slice_max, allocator);
+            es_query_dsl.AddMember("slice", slice_node, allocator);
+        }
+    }
     rapidjson::StringBuffer buffer;
     rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
     es_query_dsl.Accept(writer);
@@ -108,6 +108,28 @@ Status ColumnChunkReader::next_page() {
     return Status::OK();
 }
 
+Status ColumnChunkReader::load_header() {
+    return _parse_page_header();
+}
+
+Status ColumnChunkReader::load_page() {
+    return _parse_page_data();
+}
+
+Status ColumnChunkReader::skip_page() {
+    if (_page_parse_state != PAGE_HEADER_PARSED) {
+        return Status::InternalError("Error state");
+    }
+    RETURN_IF_ERROR(_page_reader->skip_bytes(_page_reader->current_header()->compressed_page_size));
+    _opts.stats->skip_page_count += 1;
+    _page_parse_state = PAGE_DATA_PARSED;
+    return Status::OK();
+}
+
+const tparquet::PageHeader* ColumnChunkReader::current_page_header() const {
+    return _page_reader->current_header();
+}
+
 Status ColumnChunkReader::_parse_page_header() {
     DCHECK(_page_parse_state == INITIALIZED || _page_parse_state == PAGE_DATA_PARSED);
     RETURN_IF_ERROR(_page_reader->next_header());
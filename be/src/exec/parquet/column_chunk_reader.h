@@ -40,6 +40,14 @@ public:
 
     Status next_page();
 
+    // next_page() is split into load_header() and load_page(), so that caller can check the
+    // header and skip the page by skip_page() instead of reading and decompressing it.
+    Status load_header();
+    Status load_page();
+    Status skip_page();
+
+    const tparquet::PageHeader* current_page_header() const;
+
     uint32_t num_values() const { return _num_values; }
 
     // Try to decode n definition levels into 'levels'
@@ -82,6 +90,8 @@ public:
         return _cur_decoder->next_batch(n, content_type, dst);
     }
 
+    Status skip_values(size_t n) { return _cur_decoder->skip(n); }
+
     const tparquet::ColumnMetaData& metadata() const { return _chunk_metadata->meta_data; }
 
     Status get_dict_values(vectorized::Column* column) { return _cur_decoder->get_dict_values(column); }
@@ -0,0 +1,677 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/parquet/column_chunk_writer.h"
+
+#include <cmath>
+#include <functional>
+#include <type_traits>
+
+#include "column/binary_column.h"
+#include "column/column_hash.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "env/env.h"
+#include "exec/parquet/utils.h"
+#include "gutil/casts.h"
+#include "gutil/strings/substitute.h"
+#include "runtime/date_value.h"
+#include "runtime/decimalv2_value.h"
+#include "runtime/mem_pool.h"
+#include "runtime/timestamp_value.h"
+#include "util/bit_util.h"
+#include "util/block_compression.h"
+#include "util/coding.h"
+#include "util/phmap/phmap.h"
+#include "util/rle_encoding.h"
+#include "util/thrift_util.h"
+
+namespace starrocks::parquet {
+
+namespace {
+
+// Append the values of |data| whose null flags are not set to |values|, transformed by |func|.
+template <typename SourceType, typename ValueType, typename Func>
+void append_fixed_length_values(const vectorized::Column& data, const uint8_t* nulls, std::vector<ValueType>* values,
+                                Func&& func) {
+    const auto& src = down_cast<const vectorized::FixedLengthColumnBase<SourceType>*>(&data)->get_data();
+    size_t size = src.size();
+    values->reserve(values->size() + size);
+    if (nulls == nullptr) {
+        for (size_t i = 0; i < size; ++i) {
+            values->emplace_back(func(src[i]));
+        }
+    } else {
+        for (size_t i = 0; i < size; ++i) {
+            if (!nulls[i]) {
+                values->emplace_back(func(src[i]));
+            }
+        }
+    }
+}
+
+void append_binary_values(const vectorized::Column& data, const uint8_t* nulls, std::vector<Slice>* values) {
+    const auto* src = down_cast<const vectorized::BinaryColumn*>(&data);
+    size_t size = src->size();
+    values->reserve(values->size() + size);
+    for (size_t i = 0; i < size; ++i) {
+        if (nulls == nullptr || !nulls[i]) {
+            values->emplace_back(src->get_slice(i));
+        }
+    }
+}
+
+// Decimals stored in FIXED_LEN_BYTE_ARRAY are the two's complement of the unscaled values in
+// big-endian byte order, which are written to |buffer|.
+template <typename SourceType, typename Func>
+void append_decimal_values(const vectorized::Column& data, const uint8_t* nulls, int32_t type_length,
+                           std::vector<Slice>* values, faststring* buffer, Func&& to_int128) {
+    const auto& src = down_cast<const vectorized::FixedLengthColumnBase<SourceType>*>(&data)->get_data();
+    size_t size = src.size();
+    buffer->resize(size * type_length);
+    auto* dst = buffer->data();
+    values->reserve(values->size() + size);
+    for (size_t i = 0; i < size; ++i) {
+        if (nulls != nullptr && nulls[i]) {
+            continue;
+        }
+        int128_t value = BitUtil::big_endian_to_host(to_int128(src[i]));
+        memcpy(dst, reinterpret_cast<const uint8_t*>(&value) + sizeof(int128_t) - type_length, type_length);
+        values->emplace_back(dst, type_length);
+        dst += type_length;
+    }
+}
+
+// The minimal number of bytes holding any unscaled value of a decimal of |precision|.
+int32_t decimal_type_length(int32_t precision) {
+    int32_t length = 1;
+    while (length < static_cast<int32_t>(sizeof(int128_t)) &&
+           std::pow(2.0, 8 * length - 1) < std::pow(10.0, precision)) {
+        ++length;
+    }
+    return length;
+}
+
+template <tparquet::Type::type PT>
+class TypedColumnChunkWriter final : public ColumnChunkWriter {
+public:
+    // std::vector<bool> is not contiguous, so booleans are kept as bytes.
+    using ValueType = std::conditional_t<PT == tparquet::Type::BOOLEAN, uint8_t,
+                                         typename PhysicalTypeTraits<PT>::CppType>;
+    static constexpr bool IS_BINARY = std::is_same_v<ValueType, Slice>;
+    // The min and max values, which are copied since the binary values don't outlive the column.
+    using StatsType = std::conditional_t<IS_BINARY, std::string, ValueType>;
+    using DictMap = std::conditional_t<IS_BINARY, phmap::flat_hash_map<Slice, int32_t, SliceHash, SliceNormalEqual>,
+                                       phmap::flat_hash_map<ValueType, int32_t, vectorized::StdHash<ValueType>>>;
+
+    // Convert the non-null values of a column to physical values. The values of FIXED_LEN_BYTE_ARRAY
+    // are written to the buffer.
+    using Converter =
+            std::function<void(const vectorized::Column&, const uint8_t*, std::vector<ValueType>*, faststring*)>;
+
+    TypedColumnChunkWriter(tparquet::SchemaElement schema_element, const ColumnChunkWriterOptions& opts,
+                           Converter converter, bool has_min_max)
+            : ColumnChunkWriter(std::move(schema_element), opts),
+              _converter(std::move(converter)),
+              _has_min_max(has_min_max) {
+        _reset_dictionary();
+    }
+
+    ~TypedColumnChunkWriter() override = default;
+
+protected:
+    Status _append_values(const vectorized::Column& data, const uint8_t* nulls) override {
+        _values.clear();
+        _converter(data, nulls, &_values, &_converted_buffer);
+        if (_has_min_max) {
+            _update_min_max(_values, &_page_min_max);
+        }
+
+        if (!_use_dictionary) {
+            _encode_plain(_values, &_plain_values);
+            return Status::OK();
+        }
+        _dict_indexes.reserve(_dict_indexes.size() + _values.size());
+        for (const auto& value : _values) {
+            _dict_indexes.emplace_back(_dict_index(value));
+        }
+        if (_dict_size > _opts.dictionary_page_size) {
+            // The column is not low-cardinality, the following pages of the chunk are PLAIN encoded.
+            RETURN_IF_ERROR(_flush_page());
+            _use_dictionary = false;
+        }
+        return Status::OK();
+    }
+
+    bool _is_dictionary_encoded() const override { return _use_dictionary && !_dict_values.empty(); }
+
+    size_t _estimated_values_size() const override {
+        if (_use_dictionary) {
+            return _dict_indexes.size() * BitUtil::log2(_dict_values.size() + 1) / 8;
+        }
+        if constexpr (PT == tparquet::Type::BOOLEAN) {
+            return _plain_values.size() / 8;
+        }
+        return _plain_values.size();
+    }
+
+    size_t _estimated_dictionary_size() const override { return _dict_size; }
+
+    void _finish_page_values(faststring* values, tparquet::Statistics* stats) override {
+        if (_is_dictionary_encoded()) {
+            uint8_t bit_width = std::max(1, BitUtil::log2(_dict_values.size()));
+            _rle_buffer.clear();
+            RleEncoder<int32_t> encoder(&_rle_buffer, bit_width);
+            for (auto index : _dict_indexes) {
+                encoder.Put(index);
+            }
+            int length = encoder.Flush();
+            values->append(&bit_width, 1);
+            values->append(_rle_buffer.data(), length);
+        } else if constexpr (PT == tparquet::Type::BOOLEAN) {
+            // PLAIN encoded booleans are bit-packed, from the least significant bit.
+            size_t offset = values->size();
+            values->resize(offset + BitUtil::Ceil(_plain_values.size(), 8));
+            memset(values->data() + offset, 0, values->size() - offset);
+            for (size_t i = 0; i < _plain_values.size(); ++i) {
+                values->data()[offset + i / 8] |= (_plain_values[i] != 0) << (i % 8);
+            }
+        } else {
+            values->append(_plain_values.data(), _plain_values.size());
+        }
+        _dict_indexes.clear();
+        _plain_values.clear();
+
+        if (_page_min_max.has_value) {
+            _set_min_max(_page_min_max, stats);
+            _merge_min_max(_page_min_max, &_chunk_min_max);
+            _page_min_max = MinMax();
+        }
+    }
+
+    size_t _finish_chunk(faststring* dict, tparquet::Statistics* stats) override {
+        size_t num_dict_values = _dict_values.size();
+        _encode_plain(_dict_values, dict);
+        _reset_dictionary();
+
+        if (_chunk_min_max.has_value) {
+            _set_min_max(_chunk_min_max, stats);
+            _chunk_min_max = MinMax();
+        }
+        return num_dict_values;
+    }
+
+private:
+    struct MinMax {
+        bool has_value = false;
+        StatsType min{};
+        StatsType max{};
+    };
+
+    static void _encode_plain(const std::vector<ValueType>& values, faststring* buffer) {
+        if constexpr (PT == tparquet::Type::BYTE_ARRAY) {
+            for (const auto& value : values) {
+                put_fixed32_le(buffer, value.size);
+                buffer->append(value.data, value.size);
+            }
+        } else if constexpr (PT == tparquet::Type::FIXED_LEN_BYTE_ARRAY) {
+            for (const auto& value : values) {
+                buffer->append(value.data, value.size);
+            }
+        } else {
+            // booleans are kept one byte per value here and bit-packed when the page is finished.
+            buffer->append(values.data(), values.size() * sizeof(ValueType));
+        }
+    }
+
+    int32_t _dict_index(const ValueType& value) {
+        auto iter = _dict.find(value);
+        if (iter != _dict.end()) {
+            return iter->second;
+        }
+        ValueType key = value;
+        if constexpr (IS_BINARY) {
+            if (value.size > 0) {
+                auto* data = _dict_pool->allocate(value.size);
+                memcpy(data, value.data, value.size);
+                key = Slice(data, value.size);
+            }
+            _dict_size += sizeof(uint32_t) + value.size;
+        } else {
+            _dict_size += sizeof(ValueType);
+        }
+        auto index = static_cast<int32_t>(_dict_values.size());
+        _dict.emplace(key, index);
+        _dict_values.emplace_back(key);
+        return index;
+    }
+
+    void _reset_dictionary() {
+        _use_dictionary = _opts.use_dictionary && PT != tparquet::Type::BOOLEAN && PT != tparquet::Type::FLOAT &&
+                          PT != tparquet::Type::DOUBLE;
+        _dict.clear();
+        _dict_values.clear();
+        _dict_size = 0;
+        if constexpr (IS_BINARY) {
+            _dict_pool = std::make_unique<MemPool>();
+        }
+    }
+
+    static void _update_min_max(const std::vector<ValueType>& values, MinMax* min_max) {
+        for (const auto& value : values) {
+            if constexpr (IS_BINARY) {
+                // BYTE_ARRAY is compared as unsigned bytes.
+                if (!min_max->has_value) {
+                    min_max->min.assign(value.data, value.size);
+                    min_max->max.assign(value.data, value.size);
+                    min_max->has_value = true;
+                } else if (value.compare(Slice(min_max->min)) < 0) {
+                    min_max->min.assign(value.data, value.size);
+                } else if (value.compare(Slice(min_max->max)) > 0) {
+                    min_max->max.assign(value.data, value.size);
+                }
+            } else {
+                if constexpr (std::is_floating_point_v<ValueType>) {
+                    if (std::isnan(value)) {
+                        continue;
+                    }
+                }
+                if (!min_max->has_value) {
+                    min_max->min = min_max->max = value;
+                    min_max->has_value = true;
+                } else {
+                    min_max->min = std::min(min_max->min, value);
+                    min_max->max = std::max(min_max->max, value);
+                }
+            }
+        }
+    }
+
+    static void _merge_min_max(const MinMax& from, MinMax* to) {
+        if (!to->has_value) {
+            *to = from;
+        } else {
+            to->min = std::min(to->min, from.min);
+            to->max = std::max(to->max, from.max);
+        }
+    }
+
+    // The statistics are PLAIN encoded, without the length of binary values.
+    static void _set_min_max(const MinMax& min_max, tparquet::Statistics* stats) {
+        std::string min;
+        std::string max;
+        if constexpr (IS_BINARY) {
+            min = min_max.min;
+            max = min_max.max;
+        } else {
+            min.assign(reinterpret_cast<const char*>(&min_max.min), sizeof(ValueType));
+            max.assign(reinterpret_cast<const char*>(&min_max.max), sizeof(ValueType));
+        }
+        // min and max are deprecated, since they are compared as signed bytes for BYTE_ARRAY.
+        if constexpr (!IS_BINARY) {
+            stats->__set_min(min);
+            stats->__set_max(max);
+        }
+        stats->__set_min_value(std::move(min));
+        stats->__set_max_value(std::move(max));
+    }
+
+    Converter _converter;
+    const bool _has_min_max;
+
+    std::vector<ValueType> _values;
+    faststring _converted_buffer;
+
+    // The encoded values of the current page.
+    faststring _plain_values;
+    std::vector<int32_t> _dict_indexes;
+    faststring _rle_buffer;
+
+    bool _use_dictionary = false;
+    DictMap _dict;
+    std::vector<ValueType> _dict_values;
+    // The size of the PLAIN encoded dictionary.
+    size_t _dict_size = 0;
+    std::unique_ptr<MemPool> _dict_pool;
+
+    MinMax _page_min_max;
+    MinMax _chunk_min_max;
+};
+
+template <tparquet::Type::type PT>
+std::unique_ptr<ColumnChunkWriter> create_typed_writer(
+        tparquet::SchemaElement schema_element, const ColumnChunkWriterOptions& opts,
+        typename TypedColumnChunkWriter<PT>::Converter converter, bool has_min_max = true) {
+    return std::make_unique<TypedColumnChunkWriter<PT>>(std::move(schema_element), opts, std::move(converter),
+                                                        has_min_max);
+}
+
+template <typename SourceType, typename ValueType>
+auto plain_converter() {
+    return [](const vectorized::Column& data, const uint8_t* nulls, std::vector<ValueType>* values, faststring*) {
+        append_fixed_length_values<SourceType>(data, nulls, values, [](SourceType v) { return ValueType(v); });
+    };
+}
+
+void set_int_type(tparquet::SchemaElement* element, int8_t bit_width, tparquet::ConvertedType::type converted_type) {
+    tparquet::IntType int_type;
+    int_type.__set_bitWidth(bit_width);
+    int_type.__set_isSigned(true);
+    tparquet::LogicalType logical_type;
+    logical_type.__set_INTEGER(int_type);
+    element->__set_logicalType(logical_type);
+    element->__set_converted_type(converted_type);
+}
+
+void set_decimal_type(tparquet::SchemaElement* element, int32_t precision, int32_t scale) {
+    tparquet::DecimalType decimal_type;
+    decimal_type.__set_precision(precision);
+    decimal_type.__set_scale(scale);
+    tparquet::LogicalType logical_type;
+    logical_type.__set_DECIMAL(decimal_type);
+    element->__set_logicalType(logical_type);
+    element->__set_converted_type(tparquet::ConvertedType::DECIMAL);
+    element->__set_precision(precision);
+    element->__set_scale(scale);
+}
+
+} // namespace
+
+ColumnChunkWriter::ColumnChunkWriter(tparquet::SchemaElement schema_element, const ColumnChunkWriterOptions& opts)
+        : _opts(opts), _schema_element(std::move(schema_element)) {}
+
+ColumnChunkWriter::~ColumnChunkWriter() = default;
+
+Status ColumnChunkWriter::create(const std::string& name, const TypeDescriptor& type, bool is_nullable,
+                                 const ColumnChunkWriterOptions& opts, std::unique_ptr<ColumnChunkWriter>* writer) {
+    using namespace vectorized;
+
+    tparquet::SchemaElement element;
+    element.__set_name(name);
+    element.__set_repetition_type(is_nullable ? tparquet::FieldRepetitionType::OPTIONAL
+                                              : tparquet::FieldRepetitionType::REQUIRED);
+
+    switch (type.type) {
+    case TYPE_BOOLEAN:
+        element.__set_type(tparquet::Type::BOOLEAN);
+        *writer = create_typed_writer<tparquet::Type::BOOLEAN>(element, opts, plain_converter<uint8_t, uint8_t>());
+        break;
+    case TYPE_TINYINT:
+        element.__set_type(tparquet::Type::INT32);
+        set_int_type(&element, 8, tparquet::ConvertedType::INT_8);
+        *writer = create_typed_writer<tparquet::Type::INT32>(element, opts, plain_converter<int8_t, int32_t>());
+        break;
+    case TYPE_SMALLINT:
+        element.__set_type(tparquet::Type::INT32);
+        set_int_type(&element, 16, tparquet::ConvertedType::INT_16);
+        *writer = create_typed_writer<tparquet::Type::INT32>(element, opts, plain_converter<int16_t, int32_t>());
+        break;
+    case TYPE_INT:
+        element.__set_type(tparquet::Type::INT32);
+        *writer = create_typed_writer<tparquet::Type::INT32>(element, opts, plain_converter<int32_t, int32_t>());
+        break;
+    case TYPE_BIGINT:
+        element.__set_type(tparquet::Type::INT64);
+        *writer = create_typed_writer<tparquet::Type::INT64>(element, opts, plain_converter<int64_t, int64_t>());
+        break;
+    case TYPE_FLOAT:
+        element.__set_type(tparquet::Type::FLOAT);
+        *writer = create_typed_writer<tparquet::Type::FLOAT>(element, opts, plain_converter<float, float>());
+        break;
+    case TYPE_DOUBLE:
+        element.__set_type(tparquet::Type::DOUBLE);
+        *writer = create_typed_writer<tparquet::Type::DOUBLE>(element, opts, plain_converter<double, double>());
+        break;
+    case TYPE_DATE: {
+        element.__set_type(tparquet::Type::INT32);
+        tparquet::LogicalType logical_type;
+        logical_type.__set_DATE(tparquet::DateType());
+        element.__set_logicalType(logical_type);
+        element.__set_converted_type(tparquet::ConvertedType::DATE);
+        // the number of days since the unix epoch.
+        auto converter = [](const Column& data, const uint8_t* nulls, std::vector<int32_t>* values, faststring*) {
+            append_fixed_length_values<DateValue>(data, nulls, values, [](const DateValue& v) {
+                return static_cast<int32_t>(v.julian() - date::UNIX_EPOCH_JULIAN);
+            });
+        };
+        *writer = create_typed_writer<tparquet::Type::INT32>(element, opts, converter);
+        break;
+    }
+    case TYPE_DATETIME: {
+        // DATETIME has no time zone, so it's written as a local timestamp in microseconds, which is
+        // not annotated by the legacy converted type TIMESTAMP_MICROS adjusted to UTC.
+        element.__set_type(tparquet::Type::INT64);
+        tparquet::TimeUnit unit;
+        unit.__set_MICROS(tparquet::MicroSeconds());
+        tparquet::TimestampType timestamp_type;
+        timestamp_type.__set_isAdjustedToUTC(false);
+        timestamp_type.__set_unit(unit);
+        tparquet::LogicalType logical_type;
+        logical_type.__set_TIMESTAMP(timestamp_type);
+        element.__set_logicalType(logical_type);
+        auto converter = [](const Column& data, const uint8_t* nulls, std::vector<int64_t>* values, faststring*) {
+            append_fixed_length_values<TimestampValue>(data, nulls, values, [](const TimestampValue& v) {
+                Timestamp ts = v.timestamp();
+                return static_cast<int64_t>(timestamp::to_julian(ts) - date::UNIX_EPOCH_JULIAN) * USECS_PER_DAY +
+                       timestamp::to_time(ts);
+            });
+        };
+        *writer = create_typed_writer<tparquet::Type::INT64>(element, opts, converter);
+        break;
+    }
+    case TYPE_CHAR:
+    case TYPE_VARCHAR: {
+        element.__set_type(tparquet::Type::BYTE_ARRAY);
+        tparquet::LogicalType logical_type;
+        logical_type.__set_STRING(tparquet::StringType());
+        element.__set_logicalType(logical_type);
+        element.__set_converted_type(tparquet::ConvertedType::UTF8);
+        auto converter = [](const Column& data, const uint8_t* nulls, std::vector<Slice>* values, faststring*) {
+            append_binary_values(data, nulls, values);
+        };
+        *writer = create_typed_writer<tparquet::Type::BYTE_ARRAY>(element, opts, converter);
+        break;
+    }
+    case TYPE_DECIMAL32:
+        element.__set_type(tparquet::Type::INT32);
+        set_decimal_type(&element, type.precision, type.scale);
+        *writer = create_typed_writer<tparquet::Type::INT32>(element, opts, plain_converter<int32_t, int32_t>());
+        break;
+    case TYPE_DECIMAL64:
+        element.__set_type(tparquet::Type::INT64);
+        set_decimal_type(&element, type.precision, type.scale);
+        *writer = create_typed_writer<tparquet::Type::INT64>(element, opts, plain_converter<int64_t, int64_t>());
+        break;
+    case TYPE_DECIMALV2:
+    case TYPE_DECIMAL128:
+    case TYPE_LARGEINT: {
+        // LARGEINT is written as DECIMAL(38, 0), the values out of its range are kept as they are.
+        int32_t precision = type.type == TYPE_DECIMALV2 ? DecimalV2Value::PRECISION
+                                                        : (type.type == TYPE_LARGEINT ? 38 : type.precision);
+        int32_t scale = type.type == TYPE_DECIMALV2 ? DecimalV2Value::SCALE
+                                                    : (type.type == TYPE_LARGEINT ? 0 : type.scale);
+        int32_t type_length = decimal_type_length(precision);
+        element.__set_type(tparquet::Type::FIXED_LEN_BYTE_ARRAY);
+        element.__set_type_length(type_length);
+        set_decimal_type(&element, precision, scale);
+
+        TypedColumnChunkWriter<tparquet::Type::FIXED_LEN_BYTE_ARRAY>::Converter converter;
+        if (type.type == TYPE_DECIMALV2) {
+            converter = [type_length](const Column& data, const uint8_t* nulls, std::vector<Slice>* values,
+                                      faststring* buffer) {
+                append_decimal_values<DecimalV2Value>(data, nulls, type_length, values, buffer,
+                                                      [](const DecimalV2Value& v) { return v.value(); });
+            };
+        } else {
+            converter = [type_length](const Column& data, const uint8_t* nulls, std::vector<Slice>* values,
+                                      faststring* buffer) {
+                append_decimal_values<int128_t>(data, nulls, type_length, values, buffer,
+                                                [](int128_t v) { return v; });
+            };
+        }
+        // The min and max of decimals are compared as signed integers rather than the bytes, which
+        // are not collected.
+        *writer = create_typed_writer<tparquet::Type::FIXED_LEN_BYTE_ARRAY>(element, opts, converter, false);
+        break;
+    }
+    default:
+        return Status::NotSupported(
+                strings::Substitute("parquet writer: not supported type $0 of column $1", type.debug_string(), name));
+    }
+    return (*writer)->_init();
+}
+
+Status ColumnChunkWriter::_init() {
+    _serializer = std::make_unique<ThriftSerializer>(true, 1024);
+    CompressionTypePB compression = convert_compression_codec(_opts.codec);
+    if (compression == UNKNOWN_COMPRESSION) {
+        return Status::NotSupported(strings::Substitute("parquet writer: not supported compression codec $0",
+                                                        tparquet::to_string(_opts.codec)));
+    }
+    return get_block_compression_codec(compression, &_codec);
+}
+
+Status ColumnChunkWriter::append(const vectorized::Column& column) {
+    DCHECK(!column.is_constant());
+    const vectorized::Column* data = &column;
+    const uint8_t* nulls = nullptr;
+    if (column.is_nullable()) {
+        const auto* nullable_column = down_cast<const vectorized::NullableColumn*>(&column);
+        data = nullable_column->data_column().get();
+        if (nullable_column->has_null()) {
+            nulls = nullable_column->immutable_null_column_data().data();
+        }
+    }
+
+    size_t num_rows = column.size();
+    if (_is_nullable()) {
+        size_t offset = _def_levels.size();
+        _def_levels.resize(offset + num_rows, 1);
+        if (nulls != nullptr) {
+            for (size_t i = 0; i < num_rows; ++i) {
+                _def_levels[offset + i] = !nulls[i];
+                _page_null_count += nulls[i];
+            }
+        }
+    } else if (nulls != nullptr) {
+        return Status::InternalError(
+                strings::Substitute("parquet writer: null value in the required column $0", _schema_element.name));
+    }
+    _page_num_values += num_rows;
+
+    RETURN_IF_ERROR(_append_values(*data, nulls));
+    if (_estimated_page_size() >= _opts.page_size) {
+        RETURN_IF_ERROR(_flush_page());
+    }
+    return Status::OK();
+}
+
+Status ColumnChunkWriter::_flush_page() {
+    if (_page_num_values == 0) {
+        return Status::OK();
+    }
+
+    _page_buffer.clear();
+    if (_is_nullable()) {
+        // The definition levels of data page v1 are prefixed by their length.
+        _levels_buffer.clear();
+        RleEncoder<level_t> encoder(&_levels_buffer, 1);
+        for (auto level : _def_levels) {
+            encoder.Put(level);
+        }
+        int length = encoder.Flush();
+        put_fixed32_le(&_page_buffer, length);
+        _page_buffer.append(_levels_buffer.data(), length);
+        _encodings.insert(tparquet::Encoding::RLE);
+    }
+
+    auto encoding = _is_dictionary_encoded() ? tparquet::Encoding::PLAIN_DICTIONARY : tparquet::Encoding::PLAIN;
+    tparquet::Statistics stats;
+    _finish_page_values(&_page_buffer, &stats);
+    stats.__set_null_count(_page_null_count);
+
+    tparquet::DataPageHeader data_page_header;
+    data_page_header.__set_num_values(_page_num_values);
+    data_page_header.__set_encoding(encoding);
+    data_page_header.__set_definition_level_encoding(tparquet::Encoding::RLE);
+    data_page_header.__set_repetition_level_encoding(tparquet::Encoding::RLE);
+    data_page_header.__set_statistics(stats);
+    tparquet::PageHeader header;
+    header.__set_type(tparquet::PageType::DATA_PAGE);
+    header.__set_data_page_header(data_page_header);
+    RETURN_IF_ERROR(_append_page(&header, Slice(_page_buffer.data(), _page_buffer.size()), &_pages));
+    _encodings.insert(encoding);
+
+    _num_values += _page_num_values;
+    _null_count += _page_null_count;
+    _def_levels.clear();
+    _page_num_values = 0;
+    _page_null_count = 0;
+    return Status::OK();
+}
+
+Status ColumnChunkWriter::_append_page(tparquet::PageHeader* header, const Slice& body, faststring* out) {
+    Slice compressed_body = body;
+    if (_codec != nullptr) {
+        _compressed_buffer.resize(_codec->max_compressed_len(body.size));
+        compressed_body = Slice(_compressed_buffer.data(), _compressed_buffer.size());
+        RETURN_IF_ERROR(_codec->compress(body, &compressed_body));
+    }
+    header->__set_uncompressed_page_size(body.size);
+    header->__set_compressed_page_size(compressed_body.size);
+
+    uint32_t header_size = 0;
+    uint8_t* header_data = nullptr;
+    RETURN_IF_ERROR(_serializer->serialize(header, &header_size, &header_data));
+    out->append(header_data, header_size);
+    out->append(compressed_body.data, compressed_body.size);
+    _total_uncompressed_size += header_size + body.size;
+    return Status::OK();
+}
+
+Status ColumnChunkWriter::flush(WritableFile* file, int64_t* offset, tparquet::ColumnChunk* column_chunk) {
+    RETURN_IF_ERROR(_flush_page());
+
+    _page_buffer.clear();
+    _dict_page.clear();
+    tparquet::Statistics stats;
+    size_t num_dict_values = _finish_chunk(&_page_buffer, &stats);
+    stats.__set_null_count(_null_count);
+    if (num_dict_values > 0) {
+        tparquet::DictionaryPageHeader dict_page_header;
+        dict_page_header.__set_num_values(num_dict_values);
+        dict_page_header.__set_encoding(tparquet::Encoding::PLAIN_DICTIONARY);
+        tparquet::PageHeader header;
+        header.__set_type(tparquet::PageType::DICTIONARY_PAGE);
+        header.__set_dictionary_page_header(dict_page_header);
+        RETURN_IF_ERROR(_append_page(&header, Slice(_page_buffer.data(), _page_buffer.size()), &_dict_page));
+    }
+
+    tparquet::ColumnMetaData metadata;
+    metadata.__set_type(_schema_element.type);
+    metadata.__set_encodings(std::vector<tparquet::Encoding::type>(_encodings.begin(), _encodings.end()));
+    metadata.__set_path_in_schema({_schema_element.name});
+    metadata.__set_codec(_opts.codec);
+    metadata.__set_num_values(_num_values);
+    metadata.__set_total_uncompressed_size(_total_uncompressed_size);
+    metadata.__set_total_compressed_size(_dict_page.size() + _pages.size());
+    if (num_dict_values > 0) {
+        metadata.__set_dictionary_page_offset(*offset);
+    }
+    metadata.__set_data_page_offset(*offset + _dict_page.size());
+    metadata.__set_statistics(stats);
+    column_chunk->__set_file_offset(*offset);
+    column_chunk->__set_meta_data(metadata);
+
+    Slice data[2] = {Slice(_dict_page.data(), _dict_page.size()), Slice(_pages.data(), _pages.size())};
+    RETURN_IF_ERROR(file->appendv(data, 2));
+    *offset += _dict_page.size() + _pages.size();
+
+    _pages.clear();
+    _encodings.clear();
+    _num_values = 0;
+    _null_count = 0;
+    _total_uncompressed_size = 0;
+    return Status::OK();
+}
+
+} // namespace starrocks::parquet
@@ -0,0 +1,116 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "column/column.h"
+#include "common/status.h"
+#include "exec/parquet/types.h"
+#include "gen_cpp/parquet_types.h"
+#include "runtime/types.h"
+#include "util/faststring.h"
+
+namespace starrocks {
+class BlockCompressionCodec;
+class ThriftSerializer;
+class WritableFile;
+} // namespace starrocks
+
+namespace starrocks::parquet {
+
+struct ColumnChunkWriterOptions {
+    tparquet::CompressionCodec::type codec = tparquet::CompressionCodec::SNAPPY;
+    // A data page is finished once it exceeds this size before compression.
+    size_t page_size = 1024 * 1024;
+    bool use_dictionary = true;
+    // The column is not low-cardinality if its dictionary grows beyond this size, and the
+    // rest of the column chunk falls back to PLAIN encoding.
+    size_t dictionary_page_size = 1024 * 1024;
+};
+
+// Writes a column of chunks into a parquet file. The appended values are encoded and compressed
+// into pages buffered in memory, which are written out as a column chunk when the row group
+// is flushed.
+//
+// Only flat columns are supported, so there are no repetition levels and the definition level
+// of an OPTIONAL column is either 0 or 1.
+class ColumnChunkWriter {
+public:
+    virtual ~ColumnChunkWriter();
+
+    // Create the writer of a column of |type|, return NotSupported if the type can't be written.
+    static Status create(const std::string& name, const TypeDescriptor& type, bool is_nullable,
+                         const ColumnChunkWriterOptions& opts, std::unique_ptr<ColumnChunkWriter>* writer);
+
+    const tparquet::SchemaElement& schema_element() const { return _schema_element; }
+
+    // Append all rows of |column|, which may be nullable but not constant.
+    Status append(const vectorized::Column& column);
+
+    // The size of the buffered pages, including the dictionary and the page being built.
+    size_t estimated_size() const { return _pages.size() + _estimated_page_size() + _estimated_dictionary_size(); }
+
+    // Write the buffered pages to |file| as a column chunk starting at |*offset|, fill the metadata
+    // of the chunk in |column_chunk|, and advance |*offset|. The writer is reset for the next row group.
+    Status flush(WritableFile* file, int64_t* offset, tparquet::ColumnChunk* column_chunk);
+
+protected:
+    ColumnChunkWriter(tparquet::SchemaElement schema_element, const ColumnChunkWriterOptions& opts);
+
+    // Encode the values of |data| into the current page, skipping the ones whose null flag is set.
+    // |nulls| is nullptr if there is no null value.
+    virtual Status _append_values(const vectorized::Column& data, const uint8_t* nulls) = 0;
+    // Whether the values of the current page are encoded as dictionary codes.
+    virtual bool _is_dictionary_encoded() const = 0;
+    virtual size_t _estimated_values_size() const = 0;
+    virtual size_t _estimated_dictionary_size() const = 0;
+    // Append the encoded values of the current page to |values| and set the min and max of them
+    // in |stats|, then reset the values for the next page.
+    virtual void _finish_page_values(faststring* values, tparquet::Statistics* stats) = 0;
+    // Append the PLAIN encoded dictionary to |dict|, return the number of its entries, which is 0
+    // if dictionary encoding is not used, and set the min and max of the chunk in |stats|. Then
+    // reset the dictionary and the statistics for the next column chunk.
+    virtual size_t _finish_chunk(faststring* dict, tparquet::Statistics* stats) = 0;
+
+    // Finish the current page and append it to the buffered pages.
+    Status _flush_page();
+
+    const ColumnChunkWriterOptions _opts;
+
+private:
+    Status _init();
+
+    bool _is_nullable() const { return _schema_element.repetition_type == tparquet::FieldRepetitionType::OPTIONAL; }
+    size_t _estimated_page_size() const { return _def_levels.size() / 8 + _estimated_values_size(); }
+
+    // Compress |body| and append it along with |header| to |out|.
+    Status _append_page(tparquet::PageHeader* header, const Slice& body, faststring* out);
+
+    tparquet::SchemaElement _schema_element;
+    const BlockCompressionCodec* _codec = nullptr;
+    std::unique_ptr<ThriftSerializer> _serializer;
+
+    // The definition levels and the number of values of the current page.
+    std::vector<level_t> _def_levels;
+    int32_t _page_num_values = 0;
+    int64_t _page_null_count = 0;
+
+    // The buffered pages of the column chunk.
+    faststring _dict_page;
+    faststring _pages;
+    std::set<tparquet::Encoding::type> _encodings;
+    int64_t _num_values = 0;
+    int64_t _null_count = 0;
+    int64_t _total_uncompressed_size = 0;
+
+    faststring _levels_buffer;
+    faststring _page_buffer;
+    faststring _compressed_buffer;
+};
+
+} // namespace starrocks::parquet
@@ -348,7 +348,14 @@ public:
                 return status;
             }
 
-            RETURN_IF_ERROR(_converter->convert(column, dst));
+            if (dst->empty()) {
+                RETURN_IF_ERROR(_converter->convert(column, dst));
+            } else {
+                // converters overwrite dst, the rows are appended to dst when it's read by ranges.
+                auto converted = dst->clone_empty();
+                RETURN_IF_ERROR(_converter->convert(column, converted.get()));
+                dst->append(*converted);
+            }
 
             return Status::OK();
         }
@@ -356,6 +363,8 @@ public:
 
     Status finish_batch() override { return Status::OK(); }
 
+    Status skip(size_t num_records) override { return _reader->skip_records(num_records); }
+
     void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) override {
         _reader->get_levels(def_levels, rep_levels, num_levels);
     }
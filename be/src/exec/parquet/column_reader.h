@@ -45,6 +45,9 @@ public:
         return finish_batch();
     }
 
+    // Skip num_records records without materializing them.
+    virtual Status skip(size_t num_records) { return Status::NotSupported("skip is not supported"); }
+
     virtual void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) = 0;
 
     virtual Status get_dict_values(vectorized::Column* column) {
@@ -126,6 +126,18 @@ public:
         return Status::OK();
     }
 
+    Status skip(size_t count) override {
+        // the codes are decoded to find the end of the skipped run, but not looked up in the dictionary.
+        while (count > 0) {
+            size_t batch = std::min(count, _indexes.size());
+            if (_index_batch_decoder.GetBatch(&_indexes[0], batch) != static_cast<int32_t>(batch)) {
+                return Status::InternalError("going to skip out-of-bounds dict codes");
+            }
+            count -= batch;
+        }
+        return Status::OK();
+    }
+
 private:
     enum { SIZE_OF_TYPE = sizeof(T) };
 
@@ -229,6 +241,18 @@ public:
         return Status::OK();
     }
 
+    Status skip(size_t count) override {
+        // the codes are decoded to find the end of the skipped run, but not looked up in the dictionary.
+        while (count > 0) {
+            size_t batch = std::min(count, _indexes.size());
+            if (_index_batch_decoder.GetBatch(&_indexes[0], batch) != static_cast<int32_t>(batch)) {
+                return Status::InternalError("going to skip out-of-bounds dict codes");
+            }
+            count -= batch;
+        }
+        return Status::OK();
+    }
+
 private:
     enum { SIZE_OF_DICT_CODE_TYPE = sizeof(int32_t) };
     std::unordered_map<Slice, int32_t, SliceHasher> _dict_code_by_value;
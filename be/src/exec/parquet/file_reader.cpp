@@ -374,6 +374,8 @@ Status FileReader::_create_and_init_group_reader(int row_group_number) {
     param.tuple_desc = _param.tuple_desc;
     param.conjunct_ctxs_by_slot = _param.conjunct_ctxs_by_slot;
     param.read_cols = _read_cols;
+    param.min_max_tuple_desc = _param.min_max_tuple_desc;
+    param.min_max_conjunct_ctxs = _param.min_max_conjunct_ctxs;
     param.timezone = _param.timezone;
     param.stats = _param.stats;
 
@@ -0,0 +1,137 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/parquet/file_writer.h"
+
+#include "column/column.h"
+#include "column/column_helper.h"
+#include "env/env.h"
+#include "gutil/strings/substitute.h"
+#include "util/coding.h"
+#include "util/debug_util.h"
+#include "util/thrift_util.h"
+
+namespace starrocks::parquet {
+
+static const char* s_magic = "PAR1";
+static constexpr size_t kMagicSize = 4;
+
+FileWriter::FileWriter(WritableFile* file, FileWriterOptions opts) : _file(file), _opts(std::move(opts)) {}
+
+FileWriter::~FileWriter() = default;
+
+Status FileWriter::init(const std::vector<std::string>& column_names, const std::vector<TypeDescriptor>& types,
+                        const std::vector<bool>& nullables) {
+    DCHECK_EQ(column_names.size(), types.size());
+    DCHECK_EQ(nullables.size(), types.size());
+    _types = types;
+    _column_writers.resize(types.size());
+    for (size_t i = 0; i < types.size(); ++i) {
+        RETURN_IF_ERROR(ColumnChunkWriter::create(column_names[i], types[i], nullables[i],
+                                                  _opts.column_chunk_options, &_column_writers[i]));
+    }
+
+    RETURN_IF_ERROR(_file->append(Slice(s_magic, kMagicSize)));
+    _offset = kMagicSize;
+    return Status::OK();
+}
+
+Status FileWriter::write(const vectorized::Columns& columns) {
+    if (columns.size() != _column_writers.size()) {
+        return Status::InternalError(strings::Substitute(
+                "parquet writer: unmatched number of columns, expected=$0 real=$1", _column_writers.size(),
+                columns.size()));
+    }
+    if (columns.empty() || columns[0]->size() == 0) {
+        return Status::OK();
+    }
+
+    size_t num_rows = columns[0]->size();
+    for (size_t i = 0; i < columns.size(); ++i) {
+        auto column = vectorized::ColumnHelper::unfold_const_column(_types[i], num_rows, columns[i]);
+        RETURN_IF_ERROR(_column_writers[i]->append(*column));
+    }
+    _row_group_num_rows += num_rows;
+
+    size_t row_group_size = 0;
+    for (const auto& writer : _column_writers) {
+        row_group_size += writer->estimated_size();
+    }
+    if (row_group_size >= _opts.row_group_size) {
+        RETURN_IF_ERROR(_flush_row_group());
+    }
+    return Status::OK();
+}
+
+size_t FileWriter::file_size() const {
+    size_t size = _offset;
+    for (const auto& writer : _column_writers) {
+        size += writer->estimated_size();
+    }
+    return size;
+}
+
+Status FileWriter::_flush_row_group() {
+    if (_row_group_num_rows == 0) {
+        return Status::OK();
+    }
+
+    tparquet::RowGroup row_group;
+    row_group.__set_file_offset(_offset);
+    int64_t start_offset = _offset;
+    int64_t total_byte_size = 0;
+    std::vector<tparquet::ColumnChunk> column_chunks(_column_writers.size());
+    for (size_t i = 0; i < _column_writers.size(); ++i) {
+        RETURN_IF_ERROR(_column_writers[i]->flush(_file, &_offset, &column_chunks[i]));
+        total_byte_size += column_chunks[i].meta_data.total_uncompressed_size;
+    }
+    row_group.__set_columns(std::move(column_chunks));
+    row_group.__set_num_rows(_row_group_num_rows);
+    row_group.__set_total_byte_size(total_byte_size);
+    row_group.__set_total_compressed_size(_offset - start_offset);
+    _row_groups.emplace_back(std::move(row_group));
+
+    _num_rows += _row_group_num_rows;
+    _row_group_num_rows = 0;
+    return Status::OK();
+}
+
+Status FileWriter::close() {
+    if (_closed) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_flush_row_group());
+
+    std::vector<tparquet::SchemaElement> schema;
+    schema.reserve(_column_writers.size() + 1);
+    tparquet::SchemaElement root;
+    root.__set_name("schema");
+    root.__set_num_children(_column_writers.size());
+    schema.emplace_back(std::move(root));
+    for (const auto& writer : _column_writers) {
+        schema.emplace_back(writer->schema_element());
+    }
+
+    tparquet::FileMetaData metadata;
+    metadata.__set_version(1);
+    metadata.__set_schema(std::move(schema));
+    metadata.__set_num_rows(_num_rows);
+    metadata.__set_row_groups(std::move(_row_groups));
+    metadata.__set_created_by(strings::Substitute("StarRocks version $0", get_short_version()));
+
+    ThriftSerializer serializer(true, 64 * 1024);
+    uint32_t metadata_size = 0;
+    uint8_t* metadata_data = nullptr;
+    RETURN_IF_ERROR(serializer.serialize(&metadata, &metadata_size, &metadata_data));
+
+    // The footer ends with the length of the metadata and the magic number.
+    faststring footer;
+    put_fixed32_le(&footer, metadata_size);
+    footer.append(s_magic, kMagicSize);
+    Slice data[2] = {Slice(metadata_data, metadata_size), Slice(footer.data(), footer.size())};
+    RETURN_IF_ERROR(_file->appendv(data, 2));
+    _offset += metadata_size + footer.size();
+    _closed = true;
+    return Status::OK();
+}
+
+} // namespace starrocks::parquet
@@ -0,0 +1,66 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/status.h"
+#include "exec/parquet/column_chunk_writer.h"
+#include "gen_cpp/parquet_types.h"
+#include "runtime/types.h"
+
+namespace starrocks {
+class WritableFile;
+} // namespace starrocks
+
+namespace starrocks::parquet {
+
+struct FileWriterOptions {
+    ColumnChunkWriterOptions column_chunk_options;
+    // The row group is flushed once its buffered column chunks exceed this size.
+    size_t row_group_size = 128 * 1024 * 1024;
+};
+
+// Writes columns of chunks into a parquet file directly, without converting them to another
+// in-memory format. The rows are buffered as encoded and compressed pages of the row group, which
+// is written out when it's large enough, and the footer is written when the writer is closed.
+class FileWriter {
+public:
+    // |file| is not owned, and it's not closed by the writer.
+    FileWriter(WritableFile* file, FileWriterOptions opts);
+    ~FileWriter();
+
+    // Define the columns of the file, and write the header.
+    Status init(const std::vector<std::string>& column_names, const std::vector<TypeDescriptor>& types,
+                const std::vector<bool>& nullables);
+
+    // Append the rows of |columns|, one for each column of the file.
+    Status write(const vectorized::Columns& columns);
+
+    // The size of the written data, including the buffered row group.
+    size_t file_size() const;
+
+    // Write the buffered row group and the footer.
+    Status close();
+
+private:
+    Status _flush_row_group();
+
+    WritableFile* _file;
+    const FileWriterOptions _opts;
+
+    std::vector<TypeDescriptor> _types;
+    std::vector<std::unique_ptr<ColumnChunkWriter>> _column_writers;
+
+    int64_t _offset = 0;
+    int64_t _num_rows = 0;
+    int64_t _row_group_num_rows = 0;
+    std::vector<tparquet::RowGroup> _row_groups;
+    bool _closed = false;
+};
+
+} // namespace starrocks::parquet
@@ -3,12 +3,18 @@
 
 #include "exec/parquet/group_reader.h"
 
+#include <algorithm>
+
 #include "column/column_helper.h"
+#include "env/env.h"
 #include "exec/exec_node.h"
+#include "exec/parquet/encoding_plain.h"
 #include "exprs/expr.h"
+#include "exprs/expr_context.h"
 #include "runtime/types.h"
 #include "simd/simd.h"
 #include "storage/vectorized/chunk_helper.h"
+#include "util/thrift_util.h"
 
 namespace starrocks::parquet {
 
@@ -28,6 +34,7 @@ Status GroupReader::init(const GroupReaderParam& param) {
     _pre_process_columns_and_conjunct_ctxs();
     RETURN_IF_ERROR(_rewrite_dict_column_predicates());
     _init_read_chunk();
+    RETURN_IF_ERROR(_init_page_index_filter());
     return Status::OK();
 }
 
@@ -41,11 +48,12 @@ Status GroupReader::get_next(vectorized::ChunkPtr* chunk, size_t* row_count) {
     size_t count = *row_count;
     bool has_dict_filter = !_dict_filter_preds.empty();
     bool has_more_filter = !_left_conjunct_ctxs.empty();
+    bool has_lazy_columns = !_lazy_columns.empty();
     Status status;
 
     {
         SCOPED_RAW_TIMER(&_param.stats->group_chunk_read_ns);
-        // read data into _read_chunk
+        // read data of dict filter columns and active columns into _read_chunk
         status = _read(&count);
         _param.stats->raw_rows_read += count;
         if (!status.ok() && !status.is_end_of_file()) {
@@ -58,17 +66,24 @@ Status GroupReader::get_next(vectorized::ChunkPtr* chunk, size_t* row_count) {
         SCOPED_RAW_TIMER(&_param.stats->expr_filter_ns);
         SCOPED_RAW_TIMER(&_param.stats->group_dict_filter_ns);
         _dict_filter();
-        _read_chunk->check_or_die();
+        _active_chunk->check_or_die();
     }
 
     // other filter that not dict
+    vectorized::FilterPtr filter;
     if (has_more_filter) {
         SCOPED_RAW_TIMER(&_param.stats->expr_filter_ns);
-        ExecNode::eval_conjuncts(_left_conjunct_ctxs, _read_chunk.get());
+        ExecNode::eval_conjuncts(_left_conjunct_ctxs, _active_chunk.get(), has_lazy_columns ? &filter : nullptr);
+        _active_chunk->check_or_die();
+    }
+
+    if (has_lazy_columns) {
+        SCOPED_RAW_TIMER(&_param.stats->group_chunk_read_ns);
+        RETURN_IF_ERROR(_read_lazy_columns(count, filter.get()));
         _read_chunk->check_or_die();
     }
 
-    *row_count = _read_chunk->num_rows();
+    *row_count = _active_chunk->num_rows();
 
     SCOPED_RAW_TIMER(&_param.stats->group_dict_decode_ns);
     // convert from _read_chunk
@@ -120,6 +135,19 @@ void GroupReader::_pre_process_columns_and_conjunct_ctxs() {
             }
         }
     }
+
+    // The columns without conjuncts are read lazily if there are conjuncts to filter rows.
+    // Nested columns can't skip rows, they are always read with active columns.
+    bool late_materialization = config::parquet_late_materialization_enable &&
+                                (!_dict_filter_columns.empty() || !_left_conjunct_ctxs.empty());
+    for (const auto& column : _direct_read_columns) {
+        if (late_materialization && conjunct_ctxs_by_slot.find(column.slot_id) == conjunct_ctxs_by_slot.end() &&
+            !column.col_type_in_chunk.is_complex_type()) {
+            _lazy_columns.emplace_back(column);
+        } else {
+            _active_columns.emplace_back(column);
+        }
+    }
 }
 
 bool GroupReader::_can_using_dict_filter(const SlotDescriptor* slot, const SlotIdExprContextsMap& conjunct_ctxs_by_slot,
@@ -274,9 +302,211 @@ void GroupReader::_init_read_chunk() {
         dict_code_column->reserve(chunk_size);
         _read_chunk->update_column(dict_code_column, slot_id);
     }
+
+    // the columns are shared with _read_chunk
+    _active_chunk = std::make_shared<vectorized::Chunk>();
+    for (const auto& column : _dict_filter_columns) {
+        _active_chunk->append_column(_read_chunk->get_column_by_slot_id(column.slot_id), column.slot_id);
+    }
+    for (const auto& column : _active_columns) {
+        _active_chunk->append_column(_read_chunk->get_column_by_slot_id(column.slot_id), column.slot_id);
+    }
+}
+
+template <typename T>
+static Status read_thrift_at(RandomAccessFile* file, int64_t offset, int32_t length,
+                             vectorized::HdfsScanStats* stats, T* msg) {
+    std::vector<uint8_t> buffer(length);
+    {
+        SCOPED_RAW_TIMER(&stats->io_ns);
+        stats->io_count += 1;
+        RETURN_IF_ERROR(file->read_at(offset, Slice(buffer.data(), buffer.size())));
+        stats->bytes_read_from_disk += length;
+    }
+    uint32_t len = length;
+    return deserialize_thrift_msg(buffer.data(), &len, TProtocolType::COMPACT, msg);
+}
+
+// Append the PLAIN encoded min/max value in page index to column, return false if it's malformed.
+template <typename T>
+static bool append_page_index_value(const std::string& value, vectorized::Column* column) {
+    if constexpr (std::is_same_v<T, Slice>) {
+        Slice slice;
+        PlainDecoder<Slice>::decode(value, &slice);
+        column->append_strings(std::vector<Slice>{slice});
+    } else {
+        if (value.size() != sizeof(T)) {
+            return false;
+        }
+        T v;
+        PlainDecoder<T>::decode(value, &v);
+        column->append_numbers(&v, sizeof(T));
+    }
+    return true;
+}
+
+Status GroupReader::_init_page_index_filter() {
+    if (_is_group_filtered || !config::parquet_page_index_enable || _param.min_max_tuple_desc == nullptr ||
+        _param.min_max_conjunct_ctxs.empty()) {
+        return Status::OK();
+    }
+    // the filtered rows are skipped in all columns, however nested columns can't skip rows.
+    for (const auto& column : _param.read_cols) {
+        if (column.col_type_in_chunk.is_complex_type()) {
+            return Status::OK();
+        }
+    }
+
+    std::vector<std::pair<size_t, size_t>> ranges;
+    for (ExprContext* ctx : _param.min_max_conjunct_ctxs) {
+        // pages of different columns are not aligned, only conjuncts of one column are evaluated.
+        std::vector<SlotId> slot_ids;
+        ctx->root()->get_slot_ids(&slot_ids);
+        if (slot_ids.size() != 1) {
+            continue;
+        }
+        const SlotDescriptor* slot = nullptr;
+        for (const auto* min_max_slot : _param.min_max_tuple_desc->slots()) {
+            if (min_max_slot->id() == slot_ids[0]) {
+                slot = min_max_slot;
+                break;
+            }
+        }
+        if (slot == nullptr) {
+            continue;
+        }
+        // partition columns and the columns not in file are not found
+        const ParquetField* field = _file_metadata->schema().resolve_by_name(slot->col_name());
+        if (field == nullptr || field->type.is_complex_type()) {
+            continue;
+        }
+        RETURN_IF_ERROR(_filter_pages(ctx, slot, *field, &ranges));
+    }
+    if (ranges.empty()) {
+        return Status::OK();
+    }
+
+    std::sort(ranges.begin(), ranges.end());
+    for (const auto& range : ranges) {
+        if (!_page_index_filtered_ranges.empty() && range.first <= _page_index_filtered_ranges.back().second) {
+            auto& last = _page_index_filtered_ranges.back();
+            last.second = std::max(last.second, range.second);
+        } else {
+            _page_index_filtered_ranges.emplace_back(range);
+        }
+    }
+
+    size_t num_rows = _row_group_metadata->num_rows;
+    const auto& first = _page_index_filtered_ranges[0];
+    if (first.first == 0 && first.second >= num_rows) {
+        _param.stats->page_index_filter_rows += num_rows;
+        _is_group_filtered = true;
+    }
+    return Status::OK();
+}
+
+Status GroupReader::_filter_pages(ExprContext* ctx, const SlotDescriptor* slot, const ParquetField& field,
+                                  std::vector<std::pair<size_t, size_t>>* ranges) {
+    const auto& column_chunk = _row_group_metadata->columns[field.physical_column_index];
+    if (!column_chunk.__isset.column_index_offset || !column_chunk.__isset.column_index_length ||
+        !column_chunk.__isset.offset_index_offset || !column_chunk.__isset.offset_index_length) {
+        return Status::OK();
+    }
+
+    // Only the types whose min/max values in page index are the same as in memory are supported.
+    // Binary min/max values can be used only if they are ordered as unsigned bytes.
+    const auto& t_metadata = _file_metadata->t_metadata();
+    int column_idx = field.physical_column_index;
+    bool type_defined_order = t_metadata.__isset.column_orders &&
+                              static_cast<size_t>(column_idx) < t_metadata.column_orders.size() &&
+                              t_metadata.column_orders[column_idx].__isset.TYPE_ORDER;
+    PrimitiveType type = slot->type().type;
+    tparquet::Type::type physical_type = field.physical_type;
+    if (!(physical_type == tparquet::Type::INT32 && type == TYPE_INT) &&
+        !(physical_type == tparquet::Type::INT64 && type == TYPE_BIGINT) &&
+        !(physical_type == tparquet::Type::BYTE_ARRAY && type == TYPE_VARCHAR && type_defined_order)) {
+        return Status::OK();
+    }
+
+    tparquet::ColumnIndex column_index;
+    tparquet::OffsetIndex offset_index;
+    RETURN_IF_ERROR(_read_page_index(column_chunk, &column_index, &offset_index));
+    size_t num_pages = offset_index.page_locations.size();
+    if (column_index.null_pages.size() != num_pages || column_index.min_values.size() != num_pages ||
+        column_index.max_values.size() != num_pages) {
+        return Status::OK();
+    }
+
+    auto min_column = vectorized::ColumnHelper::create_column(slot->type(), false);
+    auto max_column = vectorized::ColumnHelper::create_column(slot->type(), false);
+    for (size_t i = 0; i < num_pages; ++i) {
+        // min/max values of the pages with only nulls are meaningless
+        if (column_index.null_pages[i]) {
+            min_column->append_default();
+            max_column->append_default();
+            continue;
+        }
+        bool valid = false;
+        const auto& min_value = column_index.min_values[i];
+        const auto& max_value = column_index.max_values[i];
+        switch (physical_type) {
+        case tparquet::Type::INT32:
+            valid = append_page_index_value<int32_t>(min_value, min_column.get()) &&
+                    append_page_index_value<int32_t>(max_value, max_column.get());
+            break;
+        case tparquet::Type::INT64:
+            valid = append_page_index_value<int64_t>(min_value, min_column.get()) &&
+                    append_page_index_value<int64_t>(max_value, max_column.get());
+            break;
+        default:
+            valid = append_page_index_value<Slice>(min_value, min_column.get()) &&
+                    append_page_index_value<Slice>(max_value, max_column.get());
+            break;
+        }
+        if (!valid) {
+            return Status::OK();
+        }
+    }
+
+    auto min_chunk = std::make_shared<vectorized::Chunk>();
+    min_chunk->append_column(min_column, slot->id());
+    auto max_chunk = std::make_shared<vectorized::Chunk>();
+    max_chunk->append_column(max_column, slot->id());
+    ColumnPtr min_result = ctx->evaluate(min_chunk.get());
+    ColumnPtr max_result = ctx->evaluate(max_chunk.get());
+
+    // same as row group filter, the page is filtered if the conjunct is false for both min and max values.
+    size_t num_rows = _row_group_metadata->num_rows;
+    for (size_t i = 0; i < num_pages; ++i) {
+        if (column_index.null_pages[i]) {
+            continue;
+        }
+        auto min = min_result->get(i);
+        auto max = max_result->get(i);
+        if (min.is_null() || max.is_null() || min.get_int8() != 0 || max.get_int8() != 0) {
+            continue;
+        }
+        size_t first_row = offset_index.page_locations[i].first_row_index;
+        size_t last_row = i + 1 < num_pages ? offset_index.page_locations[i + 1].first_row_index : num_rows;
+        ranges->emplace_back(first_row, last_row);
+    }
+    return Status::OK();
+}
+
+Status GroupReader::_read_page_index(const tparquet::ColumnChunk& column_chunk, tparquet::ColumnIndex* column_index,
+                                     tparquet::OffsetIndex* offset_index) {
+    RETURN_IF_ERROR(read_thrift_at(_file, column_chunk.column_index_offset, column_chunk.column_index_length,
+                                   _param.stats, column_index));
+    RETURN_IF_ERROR(read_thrift_at(_file, column_chunk.offset_index_offset, column_chunk.offset_index_length,
+                                   _param.stats, offset_index));
+    return Status::OK();
 }
 
 Status GroupReader::_read(size_t* row_count) {
+    RETURN_IF_ERROR(_skip_filtered_rows(row_count));
+    if (*row_count == 0) {
+        return Status::EndOfFile("");
+    }
     size_t count = *row_count;
 
     for (const auto& column : _dict_filter_columns) {
@@ -289,7 +519,7 @@ Status GroupReader::_read(size_t* row_count) {
         }
     }
 
-    for (const auto& column : _direct_read_columns) {
+    for (const auto& column : _active_columns) {
         SlotId slot_id = column.slot_id;
         count = *row_count;
         Status status = _column_readers[slot_id]->next_batch(&count, ColumnContentType::VALUE,
@@ -299,7 +529,8 @@ Status GroupReader::_read(size_t* row_count) {
         }
     }
 
-    if (count != *row_count) {
+    _row_group_pos += count;
+    if (count != *row_count || _row_group_pos >= static_cast<size_t>(_row_group_metadata->num_rows)) {
         *row_count = count;
         return Status::EndOfFile("");
     }
@@ -308,25 +539,141 @@ Status GroupReader::_read(size_t* row_count) {
     return Status::OK();
 }
 
+Status GroupReader::_skip_filtered_rows(size_t* row_count) {
+    size_t num_rows = _row_group_metadata->num_rows;
+    while (_next_filtered_range < _page_index_filtered_ranges.size()) {
+        const auto& range = _page_index_filtered_ranges[_next_filtered_range];
+        if (range.first > _row_group_pos) {
+            *row_count = std::min(*row_count, range.first - _row_group_pos);
+            break;
+        }
+        if (range.second > _row_group_pos) {
+            size_t rows_to_skip = range.second - _row_group_pos;
+            RETURN_IF_ERROR(_skip_rows(_param.read_cols, rows_to_skip));
+            _param.stats->page_index_filter_rows += rows_to_skip;
+            _row_group_pos = range.second;
+        }
+        _next_filtered_range++;
+    }
+    *row_count = std::min(*row_count, num_rows - std::min(num_rows, _row_group_pos));
+    return Status::OK();
+}
+
+Status GroupReader::_skip_rows(const std::vector<GroupReaderParam::Column>& columns, size_t row_count) {
+    for (const auto& column : columns) {
+        RETURN_IF_ERROR(_column_readers[column.slot_id]->skip(row_count));
+    }
+    return Status::OK();
+}
+
+Status GroupReader::_read_lazy_columns(size_t row_count, const vectorized::Column::Filter* filter) {
+    size_t hit_count = _active_chunk->num_rows();
+    if (hit_count == 0) {
+        _param.stats->late_materialize_skip_rows += row_count;
+        return _skip_rows(_lazy_columns, row_count);
+    }
+
+    // make up the selection of all rows read, from the results of dict filter and other conjuncts.
+    // filter is computed on the rows passed dict filter.
+    bool has_dict_filter = !_dict_filter_preds.empty();
+    if (filter == nullptr) {
+        if (!has_dict_filter) {
+            memset(_selection.data(), 1, row_count);
+        }
+    } else if (has_dict_filter) {
+        size_t j = 0;
+        for (size_t i = 0; i < row_count; ++i) {
+            if (_selection[i]) {
+                _selection[i] = (*filter)[j++];
+            }
+        }
+    } else {
+        memcpy(_selection.data(), filter->data(), row_count);
+    }
+
+    // The selected rows are read by ranges, and the rows between ranges are skipped. Short gaps are
+    // read and filtered later, because reading many tiny ranges costs more than the gaps.
+    constexpr size_t kMinSkipRows = 32;
+    std::vector<std::pair<size_t, size_t>> ranges;
+    size_t i = 0;
+    while (i < row_count) {
+        while (i < row_count && !_selection[i]) {
+            i++;
+        }
+        if (i == row_count) {
+            break;
+        }
+        size_t start = i;
+        while (i < row_count && _selection[i]) {
+            i++;
+        }
+        if (!ranges.empty() && start - ranges.back().second < kMinSkipRows) {
+            ranges.back().second = i;
+        } else {
+            ranges.emplace_back(start, i);
+        }
+    }
+
+    size_t read_count = 0;
+    for (const auto& range : ranges) {
+        read_count += range.second - range.first;
+    }
+    for (const auto& column : _lazy_columns) {
+        SlotId slot_id = column.slot_id;
+        ColumnReader* reader = _column_readers[slot_id].get();
+        vectorized::Column* dst = _read_chunk->get_column_by_slot_id(slot_id).get();
+        size_t pos = 0;
+        for (const auto& range : ranges) {
+            if (range.first > pos) {
+                RETURN_IF_ERROR(reader->skip(range.first - pos));
+            }
+            size_t count = range.second - range.first;
+            Status status = reader->next_batch(&count, ColumnContentType::VALUE, dst);
+            if (!status.ok() && !status.is_end_of_file()) {
+                return status;
+            }
+            pos = range.second;
+        }
+        if (row_count > pos) {
+            RETURN_IF_ERROR(reader->skip(row_count - pos));
+        }
+    }
+    _param.stats->late_materialize_skip_rows += row_count - read_count;
+
+    // filter the rows in the gaps read
+    if (read_count != hit_count) {
+        vectorized::Column::Filter read_selection;
+        read_selection.reserve(read_count);
+        for (const auto& range : ranges) {
+            read_selection.insert(read_selection.end(), _selection.data() + range.first,
+                                  _selection.data() + range.second);
+        }
+        for (const auto& column : _lazy_columns) {
+            _read_chunk->get_column_by_slot_id(column.slot_id)->filter(read_selection);
+        }
+    }
+    return Status::OK();
+}
+
 void GroupReader::_dict_filter() {
     DCHECK(!_dict_filter_preds.empty());
 
-    size_t count = _read_chunk->num_rows();
+    size_t count = _active_chunk->num_rows();
     auto iter = _dict_filter_preds.begin();
     SlotId slot_id = iter->first;
     auto pred = iter->second;
-    pred->evaluate(_read_chunk->get_column_by_slot_id(slot_id).get(), _selection.data());
+    pred->evaluate(_active_chunk->get_column_by_slot_id(slot_id).get(), _selection.data());
     while (++iter != _dict_filter_preds.end()) {
         slot_id = iter->first;
         pred = iter->second;
-        pred->evaluate_and(_read_chunk->get_column_by_slot_id(slot_id).get(), _selection.data());
+        pred->evaluate_and(_active_chunk->get_column_by_slot_id(slot_id).get(), _selection.data());
     }
 
     auto hit_count = SIMD::count_nonzero(_selection.data(), count);
     if (hit_count == 0) {
-        _read_chunk->set_num_rows(0);
+        _active_chunk->set_num_rows(0);
     } else if (hit_count != count) {
-        _read_chunk->filter_range(_selection, 0, count);
+        _active_chunk->filter_range(_selection, 0, count);
     }
 }
 
@@ -46,6 +46,10 @@ struct GroupReaderParam {
     // columns
     std::vector<Column> read_cols;
 
+    // conjunct_ctxs evaluated by the min/max values of pages to skip pages
+    const TupleDescriptor* min_max_tuple_desc = nullptr;
+    std::vector<ExprContext*> min_max_conjunct_ctxs;
+
     std::string timezone;
 
     vectorized::HdfsScanStats* stats = nullptr;
@@ -73,7 +77,23 @@ private:
     Status _rewrite_dict_column_predicates();
     void _init_read_chunk();
 
+    // Collect the row ranges of the pages that are filtered by min/max conjuncts with page index
+    Status _init_page_index_filter();
+    // Evaluate ctx by the min/max values of the pages of field's column chunk, and append the
+    // row ranges of the filtered pages to ranges.
+    Status _filter_pages(ExprContext* ctx, const SlotDescriptor* slot, const ParquetField& field,
+                         std::vector<std::pair<size_t, size_t>>* ranges);
+    Status _read_page_index(const tparquet::ColumnChunk& column_chunk, tparquet::ColumnIndex* column_index,
+                            tparquet::OffsetIndex* offset_index);
+
     Status _read(size_t* row_count);
+    // Skip the rows filtered by page index before _row_group_pos, and limit row_count to the
+    // rows before the next filtered range.
+    Status _skip_filtered_rows(size_t* row_count);
+    Status _skip_rows(const std::vector<GroupReaderParam::Column>& columns, size_t row_count);
+    // Read the rows of lazy columns that pass the filters. row_count is the number of rows read
+    // of active columns, and filter is the result of _left_conjunct_ctxs if not null.
+    Status _read_lazy_columns(size_t row_count, const vectorized::Column::Filter* filter);
     void _dict_filter();
     Status _dict_decode(vectorized::ChunkPtr* chunk);
 
@@ -101,13 +121,26 @@ private:
     std::vector<GroupReaderParam::Column> _dict_filter_columns;
     // direct read conlumns
     std::vector<GroupReaderParam::Column> _direct_read_columns;
+    // direct read columns that are read together with dict filter columns to evaluate conjuncts
+    std::vector<GroupReaderParam::Column> _active_columns;
+    // direct read columns without conjuncts, which are read after conjuncts are evaluated,
+    // only the rows that pass the conjuncts are decoded.
+    std::vector<GroupReaderParam::Column> _lazy_columns;
 
     // dict value is empty after conjunct eval, file group can be skipped
     bool _is_group_filtered = false;
 
     vectorized::ChunkPtr _read_chunk;
+    // the dict filter columns and active columns of _read_chunk, conjuncts are evaluated on it
+    vectorized::ChunkPtr _active_chunk;
     vectorized::Buffer<uint8_t> _selection;
 
+    // the sorted row ranges [first, second) of the pages filtered by page index
+    std::vector<std::pair<size_t, size_t>> _page_index_filtered_ranges;
+    size_t _next_filtered_range = 0;
+    // the row to read next in row group
+    size_t _row_group_pos = 0;
+
     // param for read row group
     GroupReaderParam _param;
 
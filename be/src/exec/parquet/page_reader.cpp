@@ -61,4 +61,13 @@ Status PageReader::read_bytes(const uint8_t** buffer, size_t size) {
     return Status::OK();
 }
 
+Status PageReader::skip_bytes(size_t size) {
+    if (_offset + size > _next_header_pos) {
+        return Status::InternalError("Size to skip exceede page size");
+    }
+    _stream.skip(size);
+    _offset += size;
+    return Status::OK();
+}
+
 } // namespace starrocks::parquet
@@ -93,6 +93,8 @@ public:
         }
     }
 
+    Status skip_records(size_t num_records) override;
+
     void set_needs_levels(bool needs_levels) override { _needs_levels = needs_levels; }
 
     void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) override {
@@ -151,6 +153,8 @@ public:
 
     Status read_records(size_t* num_rows, ColumnContentType content_type, vectorized::Column* dst) override;
 
+    Status skip_records(size_t num_rows) override;
+
     void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) override {
         *def_levels = nullptr;
         *rep_levels = nullptr;
@@ -431,6 +435,59 @@ Status OptionalStoredColumnReader::_read_records_only(size_t* num_records, Colum
     return Status::OK();
 }
 
+Status OptionalStoredColumnReader::skip_records(size_t num_records) {
+    // levels are decoded ahead of values when they are needed, skipping is not supported then.
+    if (_needs_levels) {
+        return Status::NotSupported("skip_records is not supported when levels are needed");
+    }
+    if (_eof) {
+        return Status::EndOfFile("");
+    }
+    SCOPED_RAW_TIMER(&_opts.stats->column_read_ns);
+    while (num_records > 0) {
+        if (_num_values_left_in_cur_page == 0) {
+            SCOPED_RAW_TIMER(&_opts.stats->page_read_ns);
+            RETURN_IF_ERROR(_skip_pages(&num_records, &_num_values_left_in_cur_page));
+            if (num_records == 0) {
+                break;
+            }
+        }
+
+        // only the non-null values are stored in page
+        size_t records_to_skip = std::min(num_records, _num_values_left_in_cur_page);
+        size_t values_to_skip = 0;
+        {
+            SCOPED_RAW_TIMER(&_opts.stats->level_decode_ns);
+            size_t repeated_count = _reader->def_level_decoder().next_repeated_count();
+            if (repeated_count > 0) {
+                records_to_skip = std::min(records_to_skip, repeated_count);
+                level_t def_level = _reader->def_level_decoder().get_repeated_value(records_to_skip);
+                values_to_skip = def_level >= _field->max_def_level() ? records_to_skip : 0;
+            } else {
+                size_t new_capacity = records_to_skip;
+                if (new_capacity > _levels_capacity) {
+                    new_capacity = BitUtil::next_power_of_two(new_capacity);
+                    _def_levels.resize(new_capacity);
+
+                    _levels_capacity = new_capacity;
+                }
+                _reader->decode_def_levels(records_to_skip, &_def_levels[0]);
+                for (size_t i = 0; i < records_to_skip; ++i) {
+                    values_to_skip += _def_levels[i] >= _field->max_def_level();
+                }
+            }
+        }
+        if (values_to_skip > 0) {
+            SCOPED_RAW_TIMER(&_opts.stats->value_decode_ns);
+            RETURN_IF_ERROR(_reader->skip_values(values_to_skip));
+        }
+
+        _num_values_left_in_cur_page -= records_to_skip;
+        num_records -= records_to_skip;
+    }
+    return Status::OK();
+}
+
 Status OptionalStoredColumnReader::_next_page() {
     do {
         RETURN_IF_ERROR(_reader->next_page());
@@ -484,6 +541,22 @@ Status RequiredStoredColumnReader::read_records(size_t* num_records, ColumnConte
     return Status::OK();
 }
 
+Status RequiredStoredColumnReader::skip_records(size_t num_records) {
+    while (num_records > 0) {
+        if (_num_values_left_in_cur_page == 0) {
+            RETURN_IF_ERROR(_skip_pages(&num_records, &_num_values_left_in_cur_page));
+            if (num_records == 0) {
+                break;
+            }
+        }
+        size_t records_to_skip = std::min(num_records, _num_values_left_in_cur_page);
+        RETURN_IF_ERROR(_reader->skip_values(records_to_skip));
+        _num_values_left_in_cur_page -= records_to_skip;
+        num_records -= records_to_skip;
+    }
+    return Status::OK();
+}
+
 Status RequiredStoredColumnReader::_next_page() {
     do {
         RETURN_IF_ERROR(_reader->next_page());
@@ -492,6 +565,24 @@ Status RequiredStoredColumnReader::_next_page() {
     return Status::OK();
 }
 
+Status StoredColumnReader::_skip_pages(size_t* num_rows, size_t* num_values_left_in_cur_page) {
+    while (*num_rows > 0) {
+        RETURN_IF_ERROR(_reader->load_header());
+        const auto* header = _reader->current_page_header();
+        // one value is one row for the columns that are not repeated
+        size_t num_values = header->data_page_header.num_values;
+        if (header->type == tparquet::PageType::DATA_PAGE && num_values <= *num_rows) {
+            *num_rows -= num_values;
+            RETURN_IF_ERROR(_reader->skip_page());
+            continue;
+        }
+        RETURN_IF_ERROR(_reader->load_page());
+        *num_values_left_in_cur_page = _reader->num_values();
+        break;
+    }
+    return Status::OK();
+}
+
 Status StoredColumnReader::create(RandomAccessFile* file, const ParquetField* field,
                                   const tparquet::ColumnChunk* chunk_metadata, const StoredColumnReaderOptions& opts,
                                   std::unique_ptr<StoredColumnReader>* out) {
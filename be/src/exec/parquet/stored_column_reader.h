@@ -50,6 +50,10 @@ public:
     // this function will fill (1, 2, 3, 4, 5, 6) into 'dst'.
     virtual Status read_records(size_t* num_rows, ColumnContentType content_type, vectorized::Column* dst) = 0;
 
+    // Skip num_rows rows without materializing them. The pages whose values are all skipped are
+    // not read and decompressed. Only supported by the columns that are not repeated.
+    virtual Status skip_records(size_t num_rows) { return Status::NotSupported("skip_records is not supported"); }
+
     // This function can only be called after calling read_values. This function returns the
     // levels for last read_values.
     virtual void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) = 0;
@@ -65,6 +69,10 @@ public:
     }
 
 protected:
+    // Skip the following pages while all of their values are skipped, and load the next page if
+    // there are still values to skip. num_rows is decreased by the number of skipped values.
+    Status _skip_pages(size_t* num_rows, size_t* num_values_left_in_cur_page);
+
     std::unique_ptr<ColumnChunkReader> _reader;
 };
 
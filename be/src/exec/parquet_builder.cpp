@@ -19,78 +19,71 @@
 // specific language governing permissions and limitations
 // under the License.
 
-#include "parquet_builder.h"
+#include "exec/parquet_builder.h"
 
-#include <arrow/array.h>
-#include <arrow/status.h>
-
-#include <ctime>
-
-#include "common/logging.h"
-#include "exec/file_writer.h"
-#include "gen_cpp/FileBrokerService_types.h"
-#include "gen_cpp/TFileBrokerService.h"
-#include "runtime/broker_mgr.h"
-#include "runtime/client_cache.h"
-#include "runtime/descriptors.h"
-#include "runtime/exec_env.h"
-#include "runtime/mem_pool.h"
-#include "runtime/tuple.h"
-#include "util/thrift_util.h"
+#include "column/chunk.h"
+#include "env/env.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
 
 namespace starrocks {
 
-/// ParquetOutputStream
-
-ParquetOutputStream::ParquetOutputStream(WritableFile* writable_file) : _writable_file(writable_file) {
-    set_mode(arrow::io::FileMode::WRITE);
-}
+ParquetBuilder::ParquetBuilder(ParquetBuilderOptions options, std::unique_ptr<WritableFile> writable_file,
+                               const std::vector<ExprContext*>& output_expr_ctxs)
+        : _options(std::move(options)),
+          _writable_file(std::move(writable_file)),
+          _output_expr_ctxs(output_expr_ctxs) {}
 
-ParquetOutputStream::~ParquetOutputStream() {
-    Close();
-}
+ParquetBuilder::~ParquetBuilder() = default;
 
-arrow::Status ParquetOutputStream::Write(const void* data, int64_t nbytes) {
-    Status st = _writable_file->append({reinterpret_cast<const uint8_t*>(data), static_cast<std::size_t>(nbytes)});
-    if (!st.ok()) {
-        return arrow::Status::IOError(st.get_error_msg());
+Status ParquetBuilder::_init() {
+    if (_init_done) {
+        return Status::OK();
+    }
+    std::vector<std::string> column_names;
+    std::vector<TypeDescriptor> types;
+    std::vector<bool> nullables;
+    for (size_t i = 0; i < _output_expr_ctxs.size(); ++i) {
+        auto* root = _output_expr_ctxs[i]->root();
+        column_names.emplace_back(i < _options.column_names.size() ? _options.column_names[i]
+                                                                   : "col" + std::to_string(i));
+        types.emplace_back(root->type());
+        nullables.emplace_back(root->is_nullable());
     }
-    _cur_pos += nbytes;
-    return arrow::Status::OK();
-}
 
-arrow::Result<int64_t> ParquetOutputStream::Tell() const {
-    return _cur_pos;
+    parquet::FileWriterOptions opts;
+    opts.column_chunk_options.codec = _options.compression_codec;
+    opts.column_chunk_options.use_dictionary = _options.use_dictionary;
+    opts.row_group_size = _options.row_group_max_size;
+    _file_writer = std::make_unique<parquet::FileWriter>(_writable_file.get(), opts);
+    RETURN_IF_ERROR(_file_writer->init(column_names, types, nullables));
+    _init_done = true;
+    return Status::OK();
 }
 
-arrow::Status ParquetOutputStream::Close() {
-    Status st = _writable_file->close();
-    if (!st.ok()) {
-        return arrow::Status::IOError(st.get_error_msg());
+Status ParquetBuilder::add_chunk(vectorized::Chunk* chunk) {
+    RETURN_IF_ERROR(_init());
+    if (chunk->num_rows() == 0) {
+        return Status::OK();
     }
-    _is_closed = true;
-    return arrow::Status::OK();
-}
 
-/// ParquetBuilder
-ParquetBuilder::ParquetBuilder(std::unique_ptr<WritableFile> writable_file,
-                               const std::vector<ExprContext*>& output_expr_ctxs)
-        : _outstream(new ParquetOutputStream(writable_file.get())),
-          _writable_file(std::move(writable_file)),
-          _output_expr_ctxs(output_expr_ctxs) {
-    // TODO(cmy): implement
+    vectorized::Columns columns;
+    columns.reserve(_output_expr_ctxs.size());
+    for (auto* ctx : _output_expr_ctxs) {
+        columns.emplace_back(ctx->evaluate(chunk));
+    }
+    return _file_writer->write(columns);
 }
 
-ParquetBuilder::~ParquetBuilder() = default;
-
-Status ParquetBuilder::add_chunk(vectorized::Chunk* chunk) {
-    // TODO(c1oudman): implement
-    return Status::NotSupported("Parquest builder not supported yet");
+std::size_t ParquetBuilder::file_size() {
+    return _file_writer != nullptr ? _file_writer->file_size() : 0;
 }
 
 Status ParquetBuilder::finish() {
-    // TODO(cmy): implement
-    return Status::NotSupported("Parquest builder not supported yet");
+    // a file without any row still has the schema.
+    RETURN_IF_ERROR(_init());
+    RETURN_IF_ERROR(_file_writer->close());
+    return _writable_file->close();
 }
 
 } // namespace starrocks
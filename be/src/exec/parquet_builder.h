@@ -21,66 +21,48 @@
 
 #pragma once
 
-#include <arrow/api.h>
-#include <arrow/buffer.h>
-#include <arrow/io/api.h>
-#include <arrow/io/file.h>
-#include <arrow/io/interfaces.h>
-#include <parquet/api/reader.h>
-#include <parquet/api/writer.h>
-#include <parquet/arrow/reader.h>
-#include <parquet/arrow/writer.h>
-#include <parquet/exception.h>
-
 #include <cstdint>
-#include <map>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "common/status.h"
 #include "exec/file_builder.h"
-#include "gen_cpp/FileBrokerService_types.h"
-#include "gen_cpp/PlanNodes_types.h"
-#include "gen_cpp/Types_types.h"
+#include "exec/parquet/file_writer.h"
 
 namespace starrocks {
 
 class ExprContext;
-class FileWriter;
-
-class ParquetOutputStream : public arrow::io::OutputStream {
-public:
-    ParquetOutputStream(WritableFile* _writable_file);
-    ~ParquetOutputStream() override;
-
-    arrow::Status Write(const void* data, int64_t nbytes) override;
-    // return the current write position of the stream
-    arrow::Result<int64_t> Tell() const override;
-    arrow::Status Close() override;
 
-    bool closed() const override { return _is_closed; }
-
-private:
-    WritableFile* _writable_file; // not owned
-    int64_t _cur_pos = 0;         // current write position
-    bool _is_closed = false;
+struct ParquetBuilderOptions {
+    tparquet::CompressionCodec::type compression_codec = tparquet::CompressionCodec::SNAPPY;
+    size_t row_group_max_size = 128 * 1024 * 1024;
+    bool use_dictionary = true;
+    // The names of the output columns, "col<i>" for the missing ones.
+    std::vector<std::string> column_names;
 };
 
-// a wrapper of parquet output stream
-class ParquetBuilder : public FileBuilder {
+// Builds a parquet file from the chunks, whose columns are written into parquet column chunks directly.
+class ParquetBuilder final : public FileBuilder {
 public:
-    ParquetBuilder(std::unique_ptr<WritableFile> writable_file, const std::vector<ExprContext*>& output_expr_ctxs);
+    ParquetBuilder(ParquetBuilderOptions options, std::unique_ptr<WritableFile> writable_file,
+                   const std::vector<ExprContext*>& output_expr_ctxs);
     ~ParquetBuilder() override;
 
     Status add_chunk(vectorized::Chunk* chunk) override;
 
-    std::size_t file_size() override { return 0; }
+    std::size_t file_size() override;
 
     Status finish() override;
 
 private:
-    ParquetOutputStream* _outstream;
+    Status _init();
+
+    const ParquetBuilderOptions _options;
     std::unique_ptr<WritableFile> _writable_file;
     const std::vector<ExprContext*>& _output_expr_ctxs;
+    std::unique_ptr<parquet::FileWriter> _file_writer;
+    bool _init_done = false;
 };
 
 } // namespace starrocks
@@ -89,10 +89,18 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const size_t chunk_si
     size_t real_capacity = _aggregator->hash_map_variant().capacity() - _aggregator->hash_map_variant().capacity() / 8;
     size_t remain_size = real_capacity - _aggregator->hash_map_variant().size();
     bool ht_needs_expansion = remain_size < chunk_size;
-    if (!ht_needs_expansion ||
-        _aggregator->should_expand_preagg_hash_tables(_aggregator->num_input_rows(), chunk_size,
-                                                      _aggregator->mem_pool()->total_allocated_bytes(),
-                                                      _aggregator->hash_map_variant().size())) {
+    auto decision = StreamingPreaggDecision::EXPAND;
+    if (ht_needs_expansion) {
+        decision = _aggregator->decide_streaming_preagg(_aggregator->num_input_rows(), chunk_size,
+                                                        _aggregator->mem_pool()->total_allocated_bytes(),
+                                                        _aggregator->hash_map_variant().size(), true);
+    }
+    if (decision == StreamingPreaggDecision::FLUSH) {
+        // output the hash table and aggregate this chunk into the empty one
+        SCOPED_TIMER(_aggregator->streaming_timer());
+        _aggregator->flush_hash_map_to_buffer();
+    }
+    if (decision != StreamingPreaggDecision::PASS_THROUGH) {
         // hash table is not full or allow expand the hash table according reduction rate
         SCOPED_TIMER(_aggregator->agg_compute_timer());
         if (false) {
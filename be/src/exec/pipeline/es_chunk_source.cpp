@@ -0,0 +1,95 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/pipeline/es_chunk_source.h"
+
+#include "exec/vectorized/es_http_scan_node.h"
+#include "exec/vectorized/es_http_scanner.h"
+#include "exprs/vectorized/runtime_filter_bank.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::pipeline {
+
+EsChunkSource::EsChunkSource(MorselPtr&& morsel, vectorized::EsHttpScanNode* es_scan_node,
+                             const std::vector<ExprContext*>& conjunct_ctxs,
+                             const std::vector<EsPredicate*>& predicates,
+                             const std::vector<ExprContext*>& runtime_in_filters, RuntimeProfile* runtime_profile)
+        : ChunkSource(std::move(morsel)),
+          _es_scan_node(es_scan_node),
+          _conjunct_ctxs(conjunct_ctxs),
+          _predicates(predicates),
+          _runtime_profile(runtime_profile) {
+    // The runtime in filters are evaluated by the scanner along with the conjuncts not pushed down to es.
+    _conjunct_ctxs.insert(_conjunct_ctxs.end(), runtime_in_filters.begin(), runtime_in_filters.end());
+}
+
+EsChunkSource::~EsChunkSource() = default;
+
+Status EsChunkSource::prepare(RuntimeState* state) {
+    _runtime_state = state;
+    auto* es_morsel = (EsMorsel*)_morsel.get();
+    _status = _es_scan_node->create_scanner(state, _runtime_profile, *es_morsel->get_scan_range(),
+                                            es_morsel->slice_id(), es_morsel->num_slices(), _conjunct_ctxs,
+                                            _predicates, &_scanner);
+    if (_status.ok()) {
+        _status = _scanner->open();
+    }
+    return Status::OK();
+}
+
+Status EsChunkSource::close(RuntimeState* state) {
+    if (_scanner != nullptr) {
+        _scanner->close();
+    }
+    return Status::OK();
+}
+
+bool EsChunkSource::has_next_chunk() const {
+    return _status.ok();
+}
+
+bool EsChunkSource::has_output() const {
+    return !_chunk_buffer.empty();
+}
+
+size_t EsChunkSource::get_buffer_size() const {
+    return _chunk_buffer.get_size();
+}
+
+StatusOr<vectorized::ChunkPtr> EsChunkSource::get_next_chunk_from_buffer() {
+    vectorized::ChunkPtr chunk = nullptr;
+    _chunk_buffer.try_get(&chunk);
+    return chunk;
+}
+
+Status EsChunkSource::buffer_next_batch_chunks_blocking(size_t batch_size, bool& can_finish) {
+    if (!_status.ok()) {
+        return _status;
+    }
+
+    for (size_t i = 0; i < batch_size && !can_finish; ++i) {
+        vectorized::ChunkPtr chunk;
+        _status = _read_chunk(&chunk);
+        if (!_status.ok()) {
+            break;
+        }
+        _chunk_buffer.put(std::move(chunk));
+    }
+    return _status;
+}
+
+// Read the next non-empty chunk, return EndOfFile if the scroll is finished.
+Status EsChunkSource::_read_chunk(vectorized::ChunkPtr* chunk) {
+    bool eos = false;
+    while (!eos) {
+        if (UNLIKELY(_runtime_state->is_cancelled())) {
+            return Status::Cancelled("canceled state");
+        }
+        RETURN_IF_ERROR(_scanner->get_next(_runtime_state, chunk, &eos));
+        if (*chunk != nullptr && (*chunk)->has_rows()) {
+            return Status::OK();
+        }
+    }
+    return Status::EndOfFile("EOF of es scroll");
+}
+
+} // namespace starrocks::pipeline
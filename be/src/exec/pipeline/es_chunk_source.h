@@ -0,0 +1,60 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "exec/pipeline/chunk_source.h"
+#include "exprs/expr_context.h"
+#include "util/blocking_queue.hpp"
+
+namespace starrocks {
+class EsPredicate;
+class RuntimeProfile;
+namespace vectorized {
+class EsHttpScanNode;
+class EsHttpScanner;
+} // namespace vectorized
+namespace pipeline {
+
+// Reads a slice of an es shard by a sliced scroll.
+class EsChunkSource final : public ChunkSource {
+public:
+    EsChunkSource(MorselPtr&& morsel, vectorized::EsHttpScanNode* es_scan_node,
+                  const std::vector<ExprContext*>& conjunct_ctxs, const std::vector<EsPredicate*>& predicates,
+                  const std::vector<ExprContext*>& runtime_in_filters, RuntimeProfile* runtime_profile);
+
+    ~EsChunkSource() override;
+
+    Status prepare(RuntimeState* state) override;
+
+    Status close(RuntimeState* state) override;
+
+    bool has_next_chunk() const override;
+
+    bool has_output() const override;
+
+    size_t get_buffer_size() const override;
+
+    StatusOr<vectorized::ChunkPtr> get_next_chunk_from_buffer() override;
+
+    Status buffer_next_batch_chunks_blocking(size_t batch_size, bool& can_finish) override;
+
+private:
+    Status _read_chunk(vectorized::ChunkPtr* chunk);
+
+    vectorized::EsHttpScanNode* _es_scan_node;
+    std::vector<ExprContext*> _conjunct_ctxs;
+    const std::vector<EsPredicate*>& _predicates;
+    RuntimeProfile* _runtime_profile;
+
+    RuntimeState* _runtime_state = nullptr;
+    std::unique_ptr<vectorized::EsHttpScanner> _scanner;
+
+    Status _status = Status::OK();
+    UnboundedBlockingQueue<vectorized::ChunkPtr> _chunk_buffer;
+};
+
+} // namespace pipeline
+} // namespace starrocks
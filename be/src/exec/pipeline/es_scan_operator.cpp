@@ -0,0 +1,29 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/pipeline/es_scan_operator.h"
+
+#include "exec/pipeline/es_chunk_source.h"
+#include "exec/vectorized/es_http_scan_node.h"
+#include "exprs/expr.h"
+
+namespace starrocks::pipeline {
+
+ChunkSourcePtr EsScanOperator::create_chunk_source(MorselPtr morsel) {
+    return std::make_shared<EsChunkSource>(std::move(morsel), _es_scan_node, _conjunct_ctxs, _predicates,
+                                           runtime_in_filters(), _runtime_profile.get());
+}
+
+Status EsScanOperatorFactory::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(OperatorFactory::prepare(state));
+    RETURN_IF_ERROR(Expr::prepare(_conjunct_ctxs, state, _row_desc));
+    RETURN_IF_ERROR(Expr::open(_conjunct_ctxs, state));
+    // The pushed down conjuncts are closed and removed from |_conjunct_ctxs|.
+    return _es_scan_node->push_down_conjuncts(state, &_conjunct_ctxs, &_predicates);
+}
+
+void EsScanOperatorFactory::close(RuntimeState* state) {
+    Expr::close(_conjunct_ctxs, state);
+    OperatorFactory::close(state);
+}
+
+} // namespace starrocks::pipeline
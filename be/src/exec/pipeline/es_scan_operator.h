@@ -0,0 +1,65 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include "exec/pipeline/scan_operator.h"
+
+namespace starrocks {
+class EsPredicate;
+namespace vectorized {
+class EsHttpScanNode;
+}
+namespace pipeline {
+
+class EsScanOperator final : public ScanOperator {
+public:
+    EsScanOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id,
+                   vectorized::EsHttpScanNode* es_scan_node, const std::vector<ExprContext*>& conjunct_ctxs,
+                   const std::vector<EsPredicate*>& predicates)
+            : ScanOperator(factory, id, "es_http_scan", plan_node_id),
+              _es_scan_node(es_scan_node),
+              _conjunct_ctxs(conjunct_ctxs),
+              _predicates(predicates) {}
+
+    ~EsScanOperator() override = default;
+
+protected:
+    ChunkSourcePtr create_chunk_source(MorselPtr morsel) override;
+
+private:
+    vectorized::EsHttpScanNode* _es_scan_node;
+    const std::vector<ExprContext*>& _conjunct_ctxs;
+    const std::vector<EsPredicate*>& _predicates;
+};
+
+class EsScanOperatorFactory final : public SourceOperatorFactory {
+public:
+    EsScanOperatorFactory(int32_t id, int32_t plan_node_id, vectorized::EsHttpScanNode* es_scan_node,
+                          std::vector<ExprContext*>&& conjunct_ctxs)
+            : SourceOperatorFactory(id, "es_http_scan", plan_node_id),
+              _es_scan_node(es_scan_node),
+              _conjunct_ctxs(std::move(conjunct_ctxs)) {}
+
+    ~EsScanOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        return std::make_shared<EsScanOperator>(this, _id, _plan_node_id, _es_scan_node, _conjunct_ctxs,
+                                                _predicates);
+    }
+
+    // ScanOperator needs to attach MorselQueue.
+    bool with_morsels() const override { return true; }
+
+    Status prepare(RuntimeState* state) override;
+    void close(RuntimeState* state) override;
+
+private:
+    vectorized::EsHttpScanNode* _es_scan_node;
+    // The conjuncts that are not pushed down to es.
+    std::vector<ExprContext*> _conjunct_ctxs;
+    // The predicates pushed down to es.
+    std::vector<EsPredicate*> _predicates;
+};
+
+} // namespace pipeline
+} // namespace starrocks
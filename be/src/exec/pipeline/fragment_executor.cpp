@@ -13,6 +13,7 @@
 #include "exec/pipeline/morsel.h"
 #include "exec/pipeline/pipeline_builder.h"
 #include "exec/pipeline/pipeline_driver_dispatcher.h"
+#include "exec/pipeline/resource_group.h"
 #include "exec/pipeline/result_sink_operator.h"
 #include "exec/pipeline/scan_operator.h"
 #include "exec/scan_node.h"
@@ -50,14 +51,6 @@ static void setup_profile_hierarchy(const PipelinePtr& pipeline, const DriverPtr
     }
 }
 
-Morsels convert_scan_range_to_morsel(const std::vector<TScanRangeParams>& scan_ranges, int node_id) {
-    Morsels morsels;
-    for (const auto& scan_range : scan_ranges) {
-        morsels.emplace_back(std::make_unique<OlapMorsel>(node_id, scan_range));
-    }
-    return morsels;
-}
-
 Status FragmentExecutor::prepare(ExecEnv* exec_env, const TExecPlanFragmentParams& request) {
     DCHECK(request.__isset.desc_tbl);
     DCHECK(request.__isset.fragment);
@@ -95,6 +88,13 @@ Status FragmentExecutor::prepare(ExecEnv* exec_env, const TExecPlanFragmentParam
     // initialize query's deadline
     _query_ctx->extend_lifetime();
 
+    if (config::enable_pipeline_resource_group) {
+        auto* group_mgr = ResourceGroupManager::instance();
+        _query_ctx->set_resource_group(query_options.__isset.resource_group
+                                               ? group_mgr->get_or_create(query_options.resource_group)
+                                               : group_mgr->default_group());
+    }
+
     auto fragment_ctx = std::make_unique<FragmentContext>();
     _fragment_ctx = fragment_ctx.get();
 
@@ -113,7 +113,7 @@ Status FragmentExecutor::prepare(ExecEnv* exec_env, const TExecPlanFragmentParam
             std::make_unique<RuntimeState>(query_id, fragment_instance_id, query_options, query_globals, exec_env));
     auto* runtime_state = _fragment_ctx->runtime_state();
     runtime_state->set_batch_size(config::vector_chunk_size);
-    runtime_state->init_mem_trackers(query_id);
+    runtime_state->init_mem_trackers(query_id, _query_ctx->resource_group_mem_tracker());
     runtime_state->set_be_number(backend_num);
 
     // RuntimeFilterWorker::open_query is idempotent
@@ -166,7 +166,7 @@ Status FragmentExecutor::prepare(ExecEnv* exec_env, const TExecPlanFragmentParam
         ScanNode* scan_node = down_cast<ScanNode*>(i);
         const std::vector<TScanRangeParams>& scan_ranges =
                 FindWithDefault(params.per_node_scan_ranges, scan_node->id(), no_scan_ranges);
-        Morsels morsels = convert_scan_range_to_morsel(scan_ranges, scan_node->id());
+        Morsels morsels = scan_node->convert_scan_range_to_morsel(scan_ranges, scan_node->id());
         morsel_queues.emplace(scan_node->id(), std::make_unique<MorselQueue>(std::move(morsels)));
     }
 
@@ -219,6 +219,7 @@ Status FragmentExecutor::prepare(ExecEnv* exec_env, const TExecPlanFragmentParam
                 driver->set_morsel_queue(morsel_queue.get());
                 auto* scan_operator = down_cast<ScanOperator*>(driver->source_operator());
                 scan_operator->set_io_threads(exec_env->pipeline_scan_io_thread_pool());
+                scan_operator->set_resource_group(_query_ctx->resource_group().get());
                 setup_profile_hierarchy(pipeline, driver);
                 drivers.emplace_back(std::move(driver));
             }
@@ -38,6 +38,25 @@ private:
     std::unique_ptr<TInternalScanRange> _scan_range;
 };
 
+// A slice of an ES shard, which is read by a sliced scroll.
+class EsMorsel final : public Morsel {
+public:
+    EsMorsel(int32_t plan_node_id, const TScanRangeParams& scan_range, int32_t slice_id, int32_t num_slices)
+            : Morsel(plan_node_id),
+              _scan_range(std::make_unique<TEsScanRange>(scan_range.scan_range.es_scan_range)),
+              _slice_id(slice_id),
+              _num_slices(num_slices) {}
+
+    const TEsScanRange* get_scan_range() const { return _scan_range.get(); }
+    int32_t slice_id() const { return _slice_id; }
+    int32_t num_slices() const { return _num_slices; }
+
+private:
+    std::unique_ptr<TEsScanRange> _scan_range;
+    int32_t _slice_id;
+    int32_t _num_slices;
+};
+
 class MorselQueue {
 public:
     MorselQueue(Morsels&& morsels) : _morsels(std::move(morsels)), _num_morsels(_morsels.size()), _pop_index(0) {}
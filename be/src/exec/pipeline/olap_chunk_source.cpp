@@ -36,6 +36,8 @@ Status OlapChunkSource::prepare(RuntimeState* state) {
     cm.key_column_names = &_key_column_names;
     cm.runtime_filters = &_runtime_bloom_filters;
     cm.runtime_state = state;
+    RETURN_IF_ERROR(_get_tablet(_scan_range));
+    cm.tablet_schema = &_tablet->tablet_schema();
 
     const TQueryOptions& query_options = state->query_options();
     int32_t max_scan_key_num;
@@ -75,6 +77,8 @@ void OlapChunkSource::_init_counter(RuntimeState* state) {
     _seg_init_timer = ADD_TIMER(_scan_profile, "SegmentInit");
     _bi_filter_timer = ADD_CHILD_TIMER(_scan_profile, "BitmapIndexFilter", "SegmentInit");
     _bi_filtered_counter = ADD_CHILD_COUNTER(_scan_profile, "BitmapIndexFilterRows", TUnit::UNIT, "SegmentInit");
+    _ii_filter_timer = ADD_CHILD_TIMER(_scan_profile, "InvertedIndexFilter", "SegmentInit");
+    _ii_filtered_counter = ADD_CHILD_COUNTER(_scan_profile, "InvertedIndexFilterRows", TUnit::UNIT, "SegmentInit");
     _bf_filtered_counter = ADD_CHILD_COUNTER(_scan_profile, "BloomFilterFilterRows", TUnit::UNIT, "SegmentInit");
     _zm_filtered_counter = ADD_CHILD_COUNTER(_scan_profile, "ZoneMapIndexFilterRows", TUnit::UNIT, "SegmentInit");
     _sk_filtered_counter = ADD_CHILD_COUNTER(_scan_profile, "ShortKeyFilterRows", TUnit::UNIT, "SegmentInit");
@@ -164,6 +168,7 @@ Status OlapChunkSource::_init_reader_params(const std::vector<OlapScanRange*>& k
         }
         _predicate_free_pool.emplace_back(std::move(p));
     }
+    _conjuncts_manager.get_predicate_trees(&parser, &_params.predicate_trees, &_predicate_free_pool);
 
     {
         vectorized::ConjunctivePredicatesRewriter not_pushdown_predicate_rewriter(_not_push_down_predicates,
@@ -248,7 +253,6 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
     // columns fetched from |_reader|.
     std::vector<uint32_t> reader_columns;
 
-    RETURN_IF_ERROR(_get_tablet(_scan_range));
     RETURN_IF_ERROR(_init_global_dicts(&_params));
     RETURN_IF_ERROR(_init_unused_output_columns(*_unused_output_columns));
     RETURN_IF_ERROR(_init_scanner_columns(scanner_columns));
@@ -436,6 +440,8 @@ void OlapChunkSource::_update_counter() {
 
     COUNTER_UPDATE(_bi_filtered_counter, _reader->stats().rows_bitmap_index_filtered);
     COUNTER_UPDATE(_bi_filter_timer, _reader->stats().bitmap_index_filter_timer);
+    COUNTER_UPDATE(_ii_filtered_counter, _reader->stats().rows_inverted_index_filtered);
+    COUNTER_UPDATE(_ii_filter_timer, _reader->stats().inverted_index_filter_timer);
     COUNTER_UPDATE(_block_seek_counter, _reader->stats().block_seek_num);
 
     COUNTER_UPDATE(_rowsets_read_count, _reader->stats().rowsets_read_count);
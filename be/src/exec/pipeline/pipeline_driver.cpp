@@ -8,8 +8,10 @@
 #include "column/chunk.h"
 #include "exec/pipeline/pipeline_driver_dispatcher.h"
 #include "exec/pipeline/source_operator.h"
+#include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
+#include "util/defer_op.h"
 
 namespace starrocks::pipeline {
 Status PipelineDriver::prepare(RuntimeState* runtime_state) {
@@ -32,6 +34,7 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
     _schedule_effective_counter = ADD_COUNTER(_runtime_profile, "ScheduleEffectiveCounter", TUnit::UNIT);
     _schedule_rows_per_chunk = ADD_COUNTER(_runtime_profile, "ScheduleAccumulatedRowsPerChunk", TUnit::UNIT);
     _schedule_accumulated_chunk_moved = ADD_COUNTER(_runtime_profile, "ScheduleAccumulatedChunkMoved", TUnit::UNIT);
+    _remote_numa_node_bytes_counter = ADD_COUNTER(_runtime_profile, "RemoteNumaNodeBytes", TUnit::BYTES);
 
     DCHECK(_state == DriverState::NOT_READY);
     // fill OperatorWithDependency instances into _dependencies from _operators.
@@ -89,6 +92,12 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
 
 StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state) {
     SCOPED_TIMER(_active_timer);
+    // the cached memory of other NUMA nodes handed out to the operators of this driver
+    int64_t remote_numa_node_bytes = tls_thread_status.remote_numa_node_bytes();
+    DeferOp update_remote_numa_node_bytes([&] {
+        COUNTER_UPDATE(_remote_numa_node_bytes_counter,
+                       tls_thread_status.remote_numa_node_bytes() - remote_numa_node_bytes);
+    });
     set_driver_state(DriverState::RUNNING);
     size_t total_chunks_moved = 0;
     size_t total_rows_moved = 0;
@@ -131,6 +140,7 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state) {
                 StatusOr<vectorized::ChunkPtr> maybe_chunk;
                 {
                     SCOPED_TIMER(curr_op->_pull_timer);
+                    SCOPED_SAMPLING_OPERATOR(curr_op->_name, curr_op->_plan_node_id);
                     maybe_chunk = curr_op->pull_chunk(runtime_state);
                 }
                 auto status = maybe_chunk.status();
@@ -150,6 +160,7 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state) {
                         total_rows_moved += row_num;
                         {
                             SCOPED_TIMER(next_op->_push_timer);
+                            SCOPED_SAMPLING_OPERATOR(next_op->_name, next_op->_plan_node_id);
                             status = next_op->push_chunk(runtime_state, maybe_chunk.value());
                         }
 
@@ -167,6 +167,9 @@ public:
     StatusOr<DriverState> process(RuntimeState* runtime_state);
     void finalize(RuntimeState* runtime_state, DriverState state);
     DriverAcct& driver_acct() { return _driver_acct; }
+    // The sub queue of DriverQueue which the driver is taken from.
+    size_t driver_queue_level() const { return _driver_queue_level; }
+    void set_driver_queue_level(size_t driver_queue_level) { _driver_queue_level = driver_queue_level; }
     DriverState driver_state() const { return _state; }
 
     void set_driver_state(DriverState state) {
@@ -351,6 +354,7 @@ private:
     int32_t _driver_id;
     const bool _is_root;
     DriverAcct _driver_acct;
+    size_t _driver_queue_level = 0;
     // The first one is source operator
     MorselQueue* _morsel_queue = nullptr;
     // _state must be set by set_driver_state() to record state timer.
@@ -378,6 +382,7 @@ private:
     RuntimeProfile::Counter* _schedule_effective_counter = nullptr;
     RuntimeProfile::Counter* _schedule_rows_per_chunk = nullptr;
     RuntimeProfile::Counter* _schedule_accumulated_chunk_moved = nullptr;
+    RuntimeProfile::Counter* _remote_numa_node_bytes_counter = nullptr;
 
     MonotonicStopWatch* _total_timer_sw = nullptr;
     MonotonicStopWatch* _pending_timer_sw = nullptr;
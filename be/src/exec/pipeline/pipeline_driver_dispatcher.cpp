@@ -4,15 +4,23 @@
 
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
+#include "runtime/sampling_profiler.h"
 #include "util/defer_op.h"
 
 namespace starrocks::pipeline {
 GlobalDriverDispatcher::GlobalDriverDispatcher(std::unique_ptr<ThreadPool> thread_pool)
-        : _driver_queue(new QuerySharedDriverQueue()),
+        : _driver_queue(create_driver_queue()),
           _thread_pool(std::move(thread_pool)),
           _blocked_driver_poller(new PipelineDriverPoller(_driver_queue.get())),
           _exec_state_reporter(new ExecStateReporter()) {}
 
+DriverQueue* GlobalDriverDispatcher::create_driver_queue() {
+    if (config::enable_pipeline_resource_group) {
+        return new ResourceGroupDriverQueue();
+    }
+    return new QuerySharedDriverQueue();
+}
+
 GlobalDriverDispatcher::~GlobalDriverDispatcher() {
     _driver_queue->close();
 }
@@ -51,8 +59,7 @@ void GlobalDriverDispatcher::run() {
             break;
         }
 
-        size_t queue_index;
-        auto maybe_driver = this->_driver_queue->take(&queue_index);
+        auto maybe_driver = this->_driver_queue->take();
         if (maybe_driver.status().is_cancelled()) {
             return;
         }
@@ -86,8 +93,10 @@ void GlobalDriverDispatcher::run() {
 
             // query context has ready drivers to run, so extend its lifetime.
             query_ctx->extend_lifetime();
+            tls_thread_status.set_query_id(query_ctx->query_id());
+            SamplingProfiler::maybe_update_current_thread();
             auto status = driver->process(runtime_state);
-            this->_driver_queue->get_sub_queue(queue_index)->update_accu_time(driver);
+            this->_driver_queue->update_statistics(driver);
 
             if (!status.ok()) {
                 LOG(WARNING) << "[Driver] Process error, query_id=" << print_id(driver->query_ctx()->query_id())
@@ -47,6 +47,7 @@ public:
     void report_exec_state(FragmentContext* fragment_ctx, const Status& status, bool done) override;
 
 private:
+    static DriverQueue* create_driver_queue();
     void run();
     void finalize_driver(DriverRawPtr driver, RuntimeState* runtime_state, DriverState state);
     void update_profile_by_mode(FragmentContext* fragment_ctx, bool done);
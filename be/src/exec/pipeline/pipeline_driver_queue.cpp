@@ -2,8 +2,37 @@
 
 #include "exec/pipeline/pipeline_driver_queue.h"
 
+#include <limits>
+
 #include "gutil/strings/substitute.h"
 namespace starrocks::pipeline {
+DriverRawPtr DriverLevelQueues::take() {
+    DCHECK(!empty());
+    // -1 means no candidates; else has candidate.
+    int queue_idx = -1;
+    double target_accu_time = 0;
+    for (int i = 0; i < QUEUE_SIZE; ++i) {
+        // we just search for queue has element
+        if (!_queues[i].queue.empty()) {
+            double local_target_time = _queues[i].accu_time_after_divisor();
+            // if this is first queue that has element, we select it;
+            // else we choose queue that the execution time is less sufficient,
+            // and record time.
+            if (queue_idx < 0 || local_target_time < target_accu_time) {
+                target_accu_time = local_target_time;
+                queue_idx = i;
+            }
+        }
+    }
+
+    DriverRawPtr driver_ptr = _queues[queue_idx].queue.front();
+    _queues[queue_idx].queue.pop();
+    --_num_drivers;
+    // record queue's index to accumulate time for it.
+    driver_ptr->set_driver_queue_level(queue_idx);
+    return driver_ptr;
+}
+
 void QuerySharedDriverQueue::close() {
     std::lock_guard<std::mutex> lock(_global_mutex);
     _is_closed = true;
@@ -14,7 +43,7 @@ void QuerySharedDriverQueue::put_back(const DriverRawPtr driver) {
     int level = driver->driver_acct().get_level();
     {
         std::lock_guard<std::mutex> lock(_global_mutex);
-        _queues[level % QUEUE_SIZE].queue.emplace(driver);
+        _queues.put(driver, level);
         _cv.notify_one();
     }
 }
@@ -27,55 +56,113 @@ void QuerySharedDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers)
 
     std::lock_guard<std::mutex> lock(_global_mutex);
     for (int i = 0; i < drivers.size(); i++) {
-        _queues[levels[i] % QUEUE_SIZE].queue.emplace(drivers[i]);
+        _queues.put(drivers[i], levels[i]);
         _cv.notify_one();
     }
 }
 
-StatusOr<DriverRawPtr> QuerySharedDriverQueue::take(size_t* queue_index) {
-    // -1 means no candidates; else has candidate.
-    int queue_idx = -1;
-    double target_accu_time = 0;
-    DriverRawPtr driver_ptr;
+StatusOr<DriverRawPtr> QuerySharedDriverQueue::take() {
+    std::unique_lock<std::mutex> lock(_global_mutex);
+    while (true) {
+        if (_is_closed) {
+            return Status::Cancelled("Shutdown");
+        }
+        if (!_queues.empty()) {
+            break;
+        }
+        _cv.wait(lock);
+    }
 
-    {
-        std::unique_lock<std::mutex> lock(_global_mutex);
-        while (true) {
-            if (_is_closed) {
-                return Status::Cancelled("Shutdown");
-            }
+    // next pipeline driver to execute.
+    return _queues.take();
+}
 
-            for (int i = 0; i < QUEUE_SIZE; ++i) {
-                // we just search for queue has element
-                if (!_queues[i].queue.empty()) {
-                    double local_target_time = _queues[i].accu_time_after_divisor();
-                    // if this is first queue that has element, we select it;
-                    // else we choose queue that the execution time is less sufficient,
-                    // and record time.
-                    if (queue_idx < 0 || local_target_time < target_accu_time) {
-                        target_accu_time = local_target_time;
-                        queue_idx = i;
-                    }
-                }
-            }
+void QuerySharedDriverQueue::update_statistics(const DriverRawPtr driver) {
+    _queues.update_accu_time(driver);
+}
+
+void ResourceGroupDriverQueue::close() {
+    std::lock_guard<std::mutex> lock(_global_mutex);
+    _is_closed = true;
+    _cv.notify_all();
+}
 
-            if (queue_idx >= 0) {
-                break;
+void ResourceGroupDriverQueue::put_back(const DriverRawPtr driver) {
+    std::lock_guard<std::mutex> lock(_global_mutex);
+    _put_back(driver);
+    _cv.notify_one();
+}
+
+void ResourceGroupDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers) {
+    std::lock_guard<std::mutex> lock(_global_mutex);
+    for (auto* driver : drivers) {
+        _put_back(driver);
+        _cv.notify_one();
+    }
+}
+
+StatusOr<DriverRawPtr> ResourceGroupDriverQueue::take() {
+    std::unique_lock<std::mutex> lock(_global_mutex);
+    while (true) {
+        if (_is_closed) {
+            return Status::Cancelled("Shutdown");
+        }
+
+        GroupQueue* target = nullptr;
+        double target_vruntime = 0;
+        for (auto& [_, group_queue] : _group_queues) {
+            if (group_queue->queues.empty()) {
+                continue;
+            }
+            double vruntime = group_queue->vruntime();
+            if (target == nullptr || vruntime < target_vruntime) {
+                target = group_queue.get();
+                target_vruntime = vruntime;
             }
-            _cv.wait(lock);
         }
-        // record queue's index to accumulate time for it.
-        *queue_index = queue_idx;
-        driver_ptr = _queues[queue_idx].queue.front();
-        _queues[queue_idx].queue.pop();
+        if (target != nullptr) {
+            return target->queues.take();
+        }
+        _cv.wait(lock);
     }
+}
 
-    // next pipeline driver to execute.
-    return driver_ptr;
+void ResourceGroupDriverQueue::update_statistics(const DriverRawPtr driver) {
+    std::lock_guard<std::mutex> lock(_global_mutex);
+    auto* group_queue = _get_group_queue(driver);
+    group_queue->accu_time += driver->driver_acct().get_last_time_spent();
+    group_queue->queues.update_accu_time(driver);
 }
 
-SubQuerySharedDriverQueue* QuerySharedDriverQueue::get_sub_queue(size_t index) {
-    return _queues + index;
+ResourceGroupDriverQueue::GroupQueue* ResourceGroupDriverQueue::_get_group_queue(const DriverRawPtr driver) {
+    auto group = driver->query_ctx()->resource_group();
+    if (group == nullptr) {
+        group = ResourceGroupManager::instance()->default_group();
+    }
+    auto& group_queue = _group_queues[group->id()];
+    if (group_queue == nullptr) {
+        group_queue = std::make_unique<GroupQueue>(std::move(group));
+    }
+    return group_queue.get();
+}
+
+void ResourceGroupDriverQueue::_put_back(const DriverRawPtr driver) {
+    auto* group_queue = _get_group_queue(driver);
+    if (group_queue->queues.empty()) {
+        // A group coming back from idle starts from the least vruntime of the busy groups, rather than
+        // taking all the execution threads until it catches up with the time they spent meanwhile.
+        double min_vruntime = std::numeric_limits<double>::max();
+        for (auto& [_, other] : _group_queues) {
+            if (other.get() != group_queue && !other->queues.empty()) {
+                min_vruntime = std::min(min_vruntime, other->vruntime());
+            }
+        }
+        if (min_vruntime != std::numeric_limits<double>::max()) {
+            group_queue->accu_time = std::max(group_queue->accu_time,
+                                              static_cast<int64_t>(min_vruntime * group_queue->group->cpu_share()));
+        }
+    }
+    group_queue->queues.put(driver, driver->driver_acct().get_level());
 }
 
 } // namespace starrocks::pipeline
@@ -3,8 +3,10 @@
 #pragma once
 
 #include <queue>
+#include <unordered_map>
 
 #include "exec/pipeline/pipeline_driver.h"
+#include "exec/pipeline/resource_group.h"
 #include "util/factory_method.h"
 namespace starrocks {
 namespace pipeline {
@@ -27,48 +29,114 @@ private:
     std::atomic<int64_t> _accu_consume_time = 0;
 };
 
+// The drivers are put into the sub queues by their levels, and a driver is taken from the sub queue
+// whose accumulated time normalized by its factor is the least. It's not thread-safe.
+class DriverLevelQueues {
+public:
+    static const size_t QUEUE_SIZE = 8;
+    // maybe other value for ratio.
+    static constexpr double RATIO_OF_ADJACENT_QUEUE = 1.2;
+
+    DriverLevelQueues() {
+        double factor = 1;
+        for (int i = QUEUE_SIZE - 1; i >= 0; --i) {
+            // initialize factor for every sub queue,
+            // Higher priority queues have more execution time,
+            // so they have a larger factor.
+            _queues[i].factor_for_normal = factor;
+            factor *= RATIO_OF_ADJACENT_QUEUE;
+        }
+    }
+
+    void put(const DriverRawPtr driver, int level) {
+        _queues[level % QUEUE_SIZE].queue.emplace(driver);
+        ++_num_drivers;
+    }
+
+    bool empty() const { return _num_drivers == 0; }
+
+    // Must not be empty. The sub queue of the driver is recorded to accumulate time for it.
+    DriverRawPtr take();
+
+    // Thread-safe.
+    void update_accu_time(const DriverRawPtr driver) {
+        _queues[driver->driver_queue_level()].update_accu_time(driver);
+    }
+
+private:
+    SubQuerySharedDriverQueue _queues[QUEUE_SIZE];
+    size_t _num_drivers = 0;
+};
+
 class DriverQueue {
 public:
     virtual void put_back(const DriverRawPtr driver) = 0;
     virtual void put_back(const std::vector<DriverRawPtr>& drivers) = 0;
-    virtual StatusOr<DriverRawPtr> take(size_t* queue_index) = 0;
+    // return Status::Cancelled if queue is closed.
+    virtual StatusOr<DriverRawPtr> take() = 0;
+    // Accumulate the time spent by |driver|, which is taken from this queue, in the last execution.
+    virtual void update_statistics(const DriverRawPtr driver) = 0;
     virtual ~DriverQueue() = default;
     virtual void close() = 0;
-    virtual SubQuerySharedDriverQueue* get_sub_queue(size_t) = 0;
 };
 
 class QuerySharedDriverQueue : public FactoryMethod<DriverQueue, QuerySharedDriverQueue> {
     friend class FactoryMethod<DriverQueue, QuerySharedDriverQueue>;
 
 public:
-    QuerySharedDriverQueue() : _is_closed(false) {
-        double factor = 1;
-        for (int i = QUEUE_SIZE - 1; i >= 0; --i) {
-            // initialize factor for every sub queue,
-            // Higher priority queues have more execution time,
-            // so they have a larger factor.
-            _queues[i].factor_for_normal = factor;
-            factor *= RATIO_OF_ADJACENT_QUEUE;
-        }
-    }
+    QuerySharedDriverQueue() : _is_closed(false) {}
     ~QuerySharedDriverQueue() override = default;
     void close() override;
 
-    static const size_t QUEUE_SIZE = 8;
-    // maybe other value for ratio.
-    static constexpr double RATIO_OF_ADJACENT_QUEUE = 1.2;
     void put_back(const DriverRawPtr driver) override;
     void put_back(const std::vector<DriverRawPtr>& drivers) override;
-    // return nullptr if queue is closed;
-    StatusOr<DriverRawPtr> take(size_t* queue_index) override;
-    SubQuerySharedDriverQueue* get_sub_queue(size_t) override;
+    StatusOr<DriverRawPtr> take() override;
+    void update_statistics(const DriverRawPtr driver) override;
 
 private:
-    SubQuerySharedDriverQueue _queues[QUEUE_SIZE];
+    DriverLevelQueues _queues;
     std::mutex _global_mutex;
     std::condition_variable _cv;
     bool _is_closed;
 };
 
+// The drivers are queued by the resource groups of their queries. The group which spent the least
+// execution time in proportion to its cpu share is chosen first, then a driver is taken from the level
+// queues of the group as QuerySharedDriverQueue does. So a group is guaranteed its share of the execution
+// time no matter how many drivers the other groups have.
+class ResourceGroupDriverQueue : public FactoryMethod<DriverQueue, ResourceGroupDriverQueue> {
+    friend class FactoryMethod<DriverQueue, ResourceGroupDriverQueue>;
+
+public:
+    ResourceGroupDriverQueue() = default;
+    ~ResourceGroupDriverQueue() override = default;
+    void close() override;
+
+    void put_back(const DriverRawPtr driver) override;
+    void put_back(const std::vector<DriverRawPtr>& drivers) override;
+    StatusOr<DriverRawPtr> take() override;
+    void update_statistics(const DriverRawPtr driver) override;
+
+private:
+    struct GroupQueue {
+        explicit GroupQueue(ResourceGroupPtr group) : group(std::move(group)) {}
+
+        // The execution time normalized by the cpu share.
+        double vruntime() const { return static_cast<double>(accu_time) / group->cpu_share(); }
+
+        ResourceGroupPtr group;
+        DriverLevelQueues queues;
+        int64_t accu_time = 0;
+    };
+
+    GroupQueue* _get_group_queue(const DriverRawPtr driver);
+    void _put_back(const DriverRawPtr driver);
+
+    std::mutex _global_mutex;
+    std::condition_variable _cv;
+    bool _is_closed = false;
+    std::unordered_map<int64_t, std::unique_ptr<GroupQueue>> _group_queues;
+};
+
 } // namespace pipeline
 } // namespace starrocks
@@ -9,8 +9,10 @@
 
 #include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/pipeline_fwd.h"
+#include "exec/pipeline/resource_group.h"
 #include "gen_cpp/InternalService_types.h" // for TQueryOptions
 #include "gen_cpp/Types_types.h"           // for TUniqueId
+#include "runtime/mem_tracker.h"
 #include "runtime/runtime_state.h"
 #include "util/hash_util.hpp"
 
@@ -59,9 +61,25 @@ public:
 
     void set_is_runtime_filter_coordinator(bool flag) { _is_runtime_filter_coordinator = flag; }
 
+    // All the fragments of a query belong to the same resource group, so only the first one takes effect.
+    void set_resource_group(ResourceGroupPtr resource_group) {
+        std::call_once(_resource_group_once, [&]() {
+            _resource_group = std::move(resource_group);
+            _resource_group_mem_tracker = _resource_group->mem_tracker();
+        });
+    }
+    // nullptr if resource groups are disabled.
+    const ResourceGroupPtr& resource_group() const { return _resource_group; }
+    // The MemTracker of the group when the query started, which is the parent of the query MemTrackers.
+    MemTracker* resource_group_mem_tracker() const { return _resource_group_mem_tracker.get(); }
+
 private:
     ExecEnv* _exec_env = nullptr;
     TUniqueId _query_id;
+    // Declared before _fragment_mgr, the MemTracker of the group outlives the MemTrackers of the fragments.
+    ResourceGroupPtr _resource_group;
+    std::shared_ptr<MemTracker> _resource_group_mem_tracker;
+    std::once_flag _resource_group_once;
     std::unique_ptr<FragmentContextManager> _fragment_mgr;
     size_t _total_fragments;
     std::atomic<size_t> _num_fragments;
@@ -0,0 +1,133 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/pipeline/resource_group.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "common/config.h"
+#include "runtime/exec_env.h"
+#include "runtime/mem_tracker.h"
+#include "util/time.h"
+
+namespace starrocks::pipeline {
+
+ResourceGroup::ResourceGroup(int64_t id, std::string name, int32_t cpu_share, int32_t scan_io_share,
+                             int64_t mem_limit, MemTracker* parent_mem_tracker)
+        : _id(id),
+          _name(std::move(name)),
+          _cpu_share(std::max(cpu_share, 1)),
+          _scan_io_share(std::max(scan_io_share, 1)),
+          _parent_mem_tracker(parent_mem_tracker),
+          _mem_tracker(_new_mem_tracker(mem_limit)) {}
+
+ResourceGroup::~ResourceGroup() = default;
+
+std::shared_ptr<MemTracker> ResourceGroup::_new_mem_tracker(int64_t mem_limit) const {
+    // the groups live until the process exits, so don't unregister from the parent, which may be gone.
+    return std::make_shared<MemTracker>(MemTracker::RESOURCE_GROUP, mem_limit > 0 ? mem_limit : -1,
+                                        "ResourceGroup=" + _name, _parent_mem_tracker, false);
+}
+
+std::shared_ptr<MemTracker> ResourceGroup::mem_tracker() const {
+    std::lock_guard lock(_mem_tracker_lock);
+    return _mem_tracker;
+}
+
+void ResourceGroup::update(const TResourceGroup& t_group) {
+    if (t_group.__isset.cpu_share) {
+        _cpu_share.store(std::max(t_group.cpu_share, 1), std::memory_order_relaxed);
+    }
+    if (t_group.__isset.scan_io_share) {
+        _scan_io_share.store(std::max(t_group.scan_io_share, 1), std::memory_order_relaxed);
+    }
+    if (t_group.__isset.mem_limit) {
+        int64_t mem_limit = t_group.mem_limit > 0 ? t_group.mem_limit : -1;
+        std::lock_guard lock(_mem_tracker_lock);
+        if (_mem_tracker->limit() != mem_limit) {
+            // The old MemTracker is released with the last running query using it, while the parent is alive.
+            if (_parent_mem_tracker != nullptr) {
+                _mem_tracker->unregister_from_parent();
+            }
+            _mem_tracker = _new_mem_tracker(mem_limit);
+        }
+    }
+}
+
+ResourceGroupManager::ResourceGroupManager() = default;
+ResourceGroupManager::~ResourceGroupManager() = default;
+
+ResourceGroupPtr ResourceGroupManager::get_or_create(const TResourceGroup& t_group) {
+    if (!t_group.__isset.id) {
+        return default_group();
+    }
+
+    std::lock_guard lock(_mutex);
+    auto it = _groups.find(t_group.id);
+    if (it != _groups.end()) {
+        it->second->update(t_group);
+        return it->second;
+    }
+    int32_t default_share = config::pipeline_default_resource_group_share;
+    return _create_group(t_group.id, t_group.__isset.name ? t_group.name : std::to_string(t_group.id),
+                         t_group.__isset.cpu_share ? t_group.cpu_share : default_share,
+                         t_group.__isset.scan_io_share ? t_group.scan_io_share : default_share,
+                         t_group.__isset.mem_limit ? t_group.mem_limit : -1);
+}
+
+ResourceGroupPtr ResourceGroupManager::default_group() {
+    std::lock_guard lock(_mutex);
+    auto it = _groups.find(DEFAULT_GROUP_ID);
+    if (it != _groups.end()) {
+        return it->second;
+    }
+    int32_t default_share = config::pipeline_default_resource_group_share;
+    return _create_group(DEFAULT_GROUP_ID, "default", default_share, default_share, -1);
+}
+
+ResourceGroupPtr ResourceGroupManager::_create_group(int64_t id, std::string name, int32_t cpu_share,
+                                                     int32_t scan_io_share, int64_t mem_limit) {
+    auto group = std::make_shared<ResourceGroup>(id, std::move(name), cpu_share, scan_io_share, mem_limit,
+                                                 ExecEnv::GetInstance()->query_pool_mem_tracker());
+    _groups.emplace(id, group);
+    return group;
+}
+
+int ResourceGroupManager::scan_io_priority(ResourceGroup* group) {
+    int64_t now = MonotonicNanos();
+    std::lock_guard lock(_mutex);
+
+    auto is_busy = [now](const ResourceGroup* g) { return now - g->_last_scan_io_ns < SCAN_IO_IDLE_NS; };
+
+    // A group coming back from idle starts from the least vruntime of the busy groups, rather than
+    // taking all the scan threads until it catches up with the time they spent while it was idle.
+    if (!is_busy(group)) {
+        double min_vruntime = std::numeric_limits<double>::max();
+        for (const auto& [_, g] : _groups) {
+            if (g.get() != group && is_busy(g.get())) {
+                min_vruntime = std::min(min_vruntime, g->scan_io_vruntime());
+            }
+        }
+        if (min_vruntime != std::numeric_limits<double>::max()) {
+            auto min_time = static_cast<int64_t>(min_vruntime * group->scan_io_share());
+            if (group->_scan_io_time.load() < min_time) {
+                group->_scan_io_time.store(min_time);
+            }
+        }
+    }
+    group->_last_scan_io_ns = now;
+
+    // The busy group with the least vruntime gets the highest priority.
+    double vruntime = group->scan_io_vruntime();
+    int num_busy_groups = 0;
+    int num_behind_groups = 0;
+    for (const auto& [_, g] : _groups) {
+        if (is_busy(g.get())) {
+            ++num_busy_groups;
+            num_behind_groups += g->scan_io_vruntime() < vruntime;
+        }
+    }
+    return BASE_SCAN_IO_PRIORITY + (num_busy_groups - 1 - num_behind_groups);
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,94 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "gen_cpp/InternalService_types.h" // for TResourceGroup
+#include "storage/olap_define.h"           // for DECLARE_SINGLETON
+
+namespace starrocks {
+class MemTracker;
+
+namespace pipeline {
+
+class ResourceGroup;
+using ResourceGroupPtr = std::shared_ptr<ResourceGroup>;
+
+// A group of queries sharing the resources of the BE. The pipeline engine shares the execution time
+// and the scan io time among the groups in proportion to their shares, so the short queries of a group
+// are not starved by the large queries of other groups. The memory of all the queries in a group is
+// limited by the MemTracker of the group.
+class ResourceGroup {
+public:
+    ResourceGroup(int64_t id, std::string name, int32_t cpu_share, int32_t scan_io_share, int64_t mem_limit,
+                  MemTracker* parent_mem_tracker);
+    ~ResourceGroup();
+
+    int64_t id() const { return _id; }
+    const std::string& name() const { return _name; }
+    int32_t cpu_share() const { return _cpu_share.load(std::memory_order_relaxed); }
+    int32_t scan_io_share() const { return _scan_io_share.load(std::memory_order_relaxed); }
+    // The parent of the query MemTrackers of the group. The limit cached by the descendants of a MemTracker
+    // can't be changed, so a new MemTracker is created when the limit is changed. Only the queries started
+    // after that are limited by the new one, the running queries keep the old one.
+    std::shared_ptr<MemTracker> mem_tracker() const;
+
+    // Apply the shares and the memory limit from FE, which may be changed by the administrator.
+    void update(const TResourceGroup& t_group);
+
+    void incr_scan_io_time(int64_t time_spent_ns) { _scan_io_time.fetch_add(time_spent_ns); }
+    // The scan io time normalized by scan_io_share.
+    double scan_io_vruntime() const { return static_cast<double>(_scan_io_time.load()) / scan_io_share(); }
+
+private:
+    friend class ResourceGroupManager;
+
+    std::shared_ptr<MemTracker> _new_mem_tracker(int64_t mem_limit) const;
+
+    const int64_t _id;
+    const std::string _name;
+    std::atomic<int32_t> _cpu_share;
+    std::atomic<int32_t> _scan_io_share;
+    MemTracker* const _parent_mem_tracker;
+    mutable std::mutex _mem_tracker_lock;
+    std::shared_ptr<MemTracker> _mem_tracker;
+
+    std::atomic<int64_t> _scan_io_time = 0;
+    // Protected by the mutex of ResourceGroupManager.
+    int64_t _last_scan_io_ns = 0;
+};
+
+class ResourceGroupManager {
+    DECLARE_SINGLETON(ResourceGroupManager);
+
+public:
+    static constexpr int64_t DEFAULT_GROUP_ID = 0;
+    // The priority of the scan io tasks in PriorityThreadPool when there is only one busy group.
+    static constexpr int BASE_SCAN_IO_PRIORITY = 20;
+    // A group without scan io tasks submitted in this period is idle.
+    static constexpr int64_t SCAN_IO_IDLE_NS = 1'000'000'000L;
+
+    // Return the group of |t_group|, which is created on the first access. Queries whose group is not
+    // set by FE belong to the default group.
+    ResourceGroupPtr get_or_create(const TResourceGroup& t_group);
+    ResourceGroupPtr default_group();
+
+    // The priority of the next scan io task of |group| in the scan thread pool. The busy groups which
+    // spent less scan io time in proportion to their shares get higher priorities.
+    int scan_io_priority(ResourceGroup* group);
+
+private:
+    ResourceGroupPtr _create_group(int64_t id, std::string name, int32_t cpu_share, int32_t scan_io_share,
+                                   int64_t mem_limit);
+
+    std::mutex _mutex;
+    std::unordered_map<int64_t, ResourceGroupPtr> _groups;
+};
+
+} // namespace pipeline
+} // namespace starrocks
@@ -4,6 +4,7 @@
 
 #include "column/chunk.h"
 #include "exprs/expr.h"
+#include "runtime/arrow_result_writer.h"
 #include "runtime/buffer_control_block.h"
 #include "runtime/exec_env.h"
 #include "runtime/mysql_result_writer.h"
@@ -22,6 +23,9 @@ Status ResultSinkOperator::prepare(RuntimeState* state) {
     case TResultSinkType::MYSQL_PROTOCAL:
         _writer = std::make_shared<MysqlResultWriter>(_sender.get(), _output_expr_ctxs, _profile.get());
         break;
+    case TResultSinkType::ARROW:
+        _writer = std::make_shared<ArrowResultWriter>(_sender.get(), _output_expr_ctxs, _profile.get());
+        break;
     default:
         return Status::InternalError("Unknown result sink type");
     }
@@ -71,13 +75,32 @@ bool ResultSinkOperator::need_input() const {
     if (!_fetch_data_result) {
         return true;
     }
-    auto* mysql_writer = down_cast<MysqlResultWriter*>(_writer.get());
-    auto status = mysql_writer->try_add_batch(_fetch_data_result);
+    auto status = _writer->try_add_batch(_fetch_data_result);
+    if (!status.ok()) {
+        _last_error = status.status();
+        return true;
+    }
+    if (status.value() && _is_finished) {
+        // The input is exhausted, send the data still buffered in the writer.
+        _flush_writer();
+    }
+    return status.value() && !_fetch_data_result;
+}
+
+void ResultSinkOperator::set_finishing(RuntimeState* state) {
+    _is_finished = true;
+    if (!_fetch_data_result) {
+        _flush_writer();
+    }
+}
+
+void ResultSinkOperator::_flush_writer() const {
+    DCHECK(!_fetch_data_result);
+    auto status = _writer->flush();
     if (status.ok()) {
-        return status.value();
+        _fetch_data_result = std::move(status.value());
     } else {
         _last_error = status.status();
-        return true;
     }
 }
 
@@ -86,14 +109,16 @@ Status ResultSinkOperator::push_chunk(RuntimeState* state, const vectorized::Chu
         return _last_error;
     }
     DCHECK(!_fetch_data_result);
-    auto* mysql_writer = down_cast<MysqlResultWriter*>(_writer.get());
-    auto status = mysql_writer->process_chunk(chunk.get());
-    if (status.ok()) {
-        _fetch_data_result = std::move(status.value());
-        return mysql_writer->try_add_batch(_fetch_data_result).status();
-    } else {
+    auto status = _writer->process_chunk(chunk.get());
+    if (!status.ok()) {
         return status.status();
     }
+    _fetch_data_result = std::move(status.value());
+    if (!_fetch_data_result) {
+        // the writer buffers the chunk to build a larger batch
+        return Status::OK();
+    }
+    return _writer->try_add_batch(_fetch_data_result).status();
 }
 
 Status ResultSinkOperatorFactory::prepare(RuntimeState* state) {
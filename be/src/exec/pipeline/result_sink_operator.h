@@ -43,13 +43,16 @@ public:
 
     bool is_finished() const override { return _is_finished && !_fetch_data_result; }
 
-    void set_finishing(RuntimeState* state) override { _is_finished = true; }
+    void set_finishing(RuntimeState* state) override;
 
     StatusOr<vectorized::ChunkPtr> pull_chunk(RuntimeState* state) override;
 
     Status push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) override;
 
 private:
+    // Take the data buffered in the writer as the pending _fetch_data_result.
+    void _flush_writer() const;
+
     TResultSinkType::type _sink_type;
     std::vector<ExprContext*> _output_expr_ctxs;
 
@@ -4,11 +4,14 @@
 
 #include "column/chunk.h"
 #include "exec/pipeline/olap_chunk_source.h"
+#include "exec/pipeline/resource_group.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
+#include "runtime/sampling_profiler.h"
 #include "util/defer_op.h"
+#include "util/time.h"
 
 namespace starrocks::pipeline {
 
@@ -24,11 +27,6 @@ Status ScanOperator::prepare(RuntimeState* state) {
                                     _io_threads->get_queue_capacity()));
     }
 
-    // init filtered_ouput_columns
-    for (const auto& col_name : _olap_scan_node.unused_output_column_name) {
-        _unused_output_columns.emplace_back(col_name);
-    }
-
     return Status::OK();
 }
 
@@ -87,6 +85,7 @@ void ScanOperator::set_finishing(RuntimeState* state) {
 }
 
 StatusOr<vectorized::ChunkPtr> ScanOperator::pull_chunk(RuntimeState* state) {
+    RETURN_IF_ERROR(_get_scan_status());
     if (!_chunk_source) {
         RETURN_IF_ERROR(_pickup_morsel(state));
         return nullptr;
@@ -123,12 +122,26 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state) {
     task.work_function = [this, state]() {
         {
             SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(state->instance_mem_tracker());
-            _chunk_source->buffer_next_batch_chunks_blocking(_batch_size, _is_finished);
+            SCOPED_SAMPLING_OPERATOR(_name, _plan_node_id);
+            tls_thread_status.set_query_id(state->query_id());
+            SamplingProfiler::maybe_update_current_thread();
+            int64_t start_ns = MonotonicNanos();
+            Status status = _chunk_source->buffer_next_batch_chunks_blocking(_batch_size, _is_finished);
+            if (!status.ok() && !status.is_end_of_file()) {
+                _set_scan_status(status);
+            }
+            if (_resource_group != nullptr) {
+                _resource_group->incr_scan_io_time(MonotonicNanos() - start_ns);
+            }
         }
         _is_io_task_active.store(false, std::memory_order_release);
     };
-    // TODO(by satanson): set a proper priority
-    task.priority = 20;
+    if (_resource_group != nullptr) {
+        task.priority = ResourceGroupManager::instance()->scan_io_priority(_resource_group);
+    } else {
+        // TODO(by satanson): set a proper priority
+        task.priority = ResourceGroupManager::BASE_SCAN_IO_PRIORITY;
+    }
     if (_io_threads->try_offer(task)) {
         _io_task_retry_cnt = 0;
     } else {
@@ -158,17 +171,44 @@ Status ScanOperator::_pickup_morsel(RuntimeState* state) {
     } else {
         auto morsel = std::move(maybe_morsel.value());
         DCHECK(morsel);
-        _chunk_source = std::make_shared<OlapChunkSource>(
-                std::move(morsel), _olap_scan_node.tuple_id, _conjunct_ctxs, runtime_in_filters(),
-                runtime_bloom_filters(), _olap_scan_node.key_column_name, _olap_scan_node.is_preaggregation,
-                &_unused_output_columns, _runtime_profile.get(), _limit);
+        _chunk_source = create_chunk_source(std::move(morsel));
         _chunk_source->prepare(state);
         RETURN_IF_ERROR(_trigger_next_scan(state));
     }
     return Status::OK();
 }
 
-Status ScanOperatorFactory::prepare(RuntimeState* state) {
+Status ScanOperator::_get_scan_status() const {
+    std::lock_guard<SpinLock> l(_scan_status_mutex);
+    return _scan_status;
+}
+
+void ScanOperator::_set_scan_status(const Status& status) {
+    std::lock_guard<SpinLock> l(_scan_status_mutex);
+    if (_scan_status.ok()) {
+        _scan_status = status;
+    }
+}
+
+Status OlapScanOperator::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(ScanOperator::prepare(state));
+
+    // init filtered_ouput_columns
+    for (const auto& col_name : _olap_scan_node.unused_output_column_name) {
+        _unused_output_columns.emplace_back(col_name);
+    }
+
+    return Status::OK();
+}
+
+ChunkSourcePtr OlapScanOperator::create_chunk_source(MorselPtr morsel) {
+    return std::make_shared<OlapChunkSource>(std::move(morsel), _olap_scan_node.tuple_id, _conjunct_ctxs,
+                                             runtime_in_filters(), runtime_bloom_filters(),
+                                             _olap_scan_node.key_column_name, _olap_scan_node.is_preaggregation,
+                                             &_unused_output_columns, _runtime_profile.get(), _limit);
+}
+
+Status OlapScanOperatorFactory::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(OperatorFactory::prepare(state));
     RETURN_IF_ERROR(Expr::prepare(_conjunct_ctxs, state, _row_desc));
     RETURN_IF_ERROR(Expr::open(_conjunct_ctxs, state));
@@ -179,7 +219,7 @@ Status ScanOperatorFactory::prepare(RuntimeState* state) {
     return Status::OK();
 }
 
-void ScanOperatorFactory::close(RuntimeState* state) {
+void OlapScanOperatorFactory::close(RuntimeState* state) {
     Expr::close(_conjunct_ctxs, state);
     OperatorFactory::close(state);
 }
@@ -9,21 +9,21 @@
 #include "runtime/global_dicts.h"
 #include "util/blocking_queue.hpp"
 #include "util/priority_thread_pool.hpp"
+#include "util/spinlock.h"
 
 namespace starrocks {
 namespace vectorized {
 class RuntimeFilterProbeCollector;
 }
 namespace pipeline {
+class ResourceGroup;
 
-class ScanOperator final : public SourceOperator {
+// The base of the source operators reading morsels. The chunks of a morsel are read by a ChunkSource
+// in the io threads, and buffered for the pipeline driver.
+class ScanOperator : public SourceOperator {
 public:
-    ScanOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, const TOlapScanNode& olap_scan_node,
-                 const std::vector<ExprContext*>& conjunct_ctxs, int64_t limit)
-            : SourceOperator(factory, id, "olap_scan", plan_node_id),
-              _olap_scan_node(olap_scan_node),
-              _conjunct_ctxs(conjunct_ctxs),
-              _limit(limit) {}
+    ScanOperator(OperatorFactory* factory, int32_t id, const std::string& name, int32_t plan_node_id)
+            : SourceOperator(factory, id, name, plan_node_id) {}
 
     ~ScanOperator() override = default;
 
@@ -41,6 +41,12 @@ public:
 
     StatusOr<vectorized::ChunkPtr> pull_chunk(RuntimeState* state) override;
     void set_io_threads(PriorityThreadPool* io_threads) { _io_threads = io_threads; }
+    // The io tasks are prioritized by the scan io share of |resource_group| if set.
+    void set_resource_group(ResourceGroup* resource_group) { _resource_group = resource_group; }
+
+protected:
+    // Create the chunk source reading |morsel|.
+    virtual ChunkSourcePtr create_chunk_source(MorselPtr morsel) = 0;
 
 private:
     // This method is only invoked when current morsel is reached eof
@@ -48,6 +54,9 @@ private:
     Status _pickup_morsel(RuntimeState* state);
     Status _trigger_next_scan(RuntimeState* state);
 
+    Status _get_scan_status() const;
+    void _set_scan_status(const Status& status);
+
 private:
     // TODO(hcf) ugly, remove this later
     RuntimeState* _state = nullptr;
@@ -56,28 +65,54 @@ private:
     mutable bool _is_finished = false;
     std::atomic_bool _is_io_task_active = false;
     int32_t _io_task_retry_cnt = 0;
+    PriorityThreadPool* _io_threads = nullptr;
+    ResourceGroup* _resource_group = nullptr;
+
+    // The error occurred in the io task, which fails the operator.
+    mutable SpinLock _scan_status_mutex;
+    Status _scan_status;
+};
+
+class OlapScanOperator final : public ScanOperator {
+public:
+    OlapScanOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id,
+                     const TOlapScanNode& olap_scan_node, const std::vector<ExprContext*>& conjunct_ctxs,
+                     int64_t limit)
+            : ScanOperator(factory, id, "olap_scan", plan_node_id),
+              _olap_scan_node(olap_scan_node),
+              _conjunct_ctxs(conjunct_ctxs),
+              _limit(limit) {}
+
+    ~OlapScanOperator() override = default;
+
+    Status prepare(RuntimeState* state) override;
+
+protected:
+    ChunkSourcePtr create_chunk_source(MorselPtr morsel) override;
+
+private:
     const TOlapScanNode& _olap_scan_node;
     const std::vector<ExprContext*>& _conjunct_ctxs;
-    PriorityThreadPool* _io_threads = nullptr;
     std::vector<std::string> _unused_output_columns;
     // Pass limit info to scan operator in order to improve sql:
     // select * from table limit x;
     int64_t _limit; // -1: no limit
 };
 
-class ScanOperatorFactory final : public SourceOperatorFactory {
+class OlapScanOperatorFactory final : public SourceOperatorFactory {
 public:
-    ScanOperatorFactory(int32_t id, int32_t plan_node_id, const TOlapScanNode& olap_scan_node,
-                        std::vector<ExprContext*>&& conjunct_ctxs, int64_t limit)
+    OlapScanOperatorFactory(int32_t id, int32_t plan_node_id, const TOlapScanNode& olap_scan_node,
+                            std::vector<ExprContext*>&& conjunct_ctxs, int64_t limit)
             : SourceOperatorFactory(id, "olap_scan", plan_node_id),
               _olap_scan_node(olap_scan_node),
               _conjunct_ctxs(std::move(conjunct_ctxs)),
               _limit(limit) {}
 
-    ~ScanOperatorFactory() override = default;
+    ~OlapScanOperatorFactory() override = default;
 
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
-        return std::make_shared<ScanOperator>(this, _id, _plan_node_id, _olap_scan_node, _conjunct_ctxs, _limit);
+        return std::make_shared<OlapScanOperator>(this, _id, _plan_node_id, _olap_scan_node, _conjunct_ctxs,
+                                                  _limit);
     }
 
     // ScanOperator needs to attach MorselQueue.
@@ -61,4 +61,13 @@ Status ScanNode::prepare(RuntimeState* state) {
     return Status::OK();
 }
 
+pipeline::Morsels ScanNode::convert_scan_range_to_morsel(const std::vector<TScanRangeParams>& scan_ranges,
+                                                         int node_id) {
+    pipeline::Morsels morsels;
+    for (const auto& scan_range : scan_ranges) {
+        morsels.emplace_back(std::make_unique<pipeline::OlapMorsel>(node_id, scan_range));
+    }
+    return morsels;
+}
+
 } // namespace starrocks
@@ -25,6 +25,7 @@
 #include <string>
 
 #include "exec/exec_node.h"
+#include "exec/pipeline/morsel.h"
 #include "gen_cpp/InternalService_types.h"
 #include "util/runtime_profile.h"
 
@@ -60,6 +61,10 @@ public:
     // called after prepare()
     virtual Status set_scan_ranges(const std::vector<TScanRangeParams>& scan_ranges) = 0;
 
+    // Convert scan_ranges into the morsels read by the source operators of pipeline engine.
+    virtual pipeline::Morsels convert_scan_range_to_morsel(const std::vector<TScanRangeParams>& scan_ranges,
+                                                           int node_id);
+
     bool is_scan_node() const override { return true; }
 
     RuntimeProfile::Counter* bytes_read_counter() const { return _bytes_read_counter; }
@@ -3,6 +3,8 @@
 #include "aggregator.h"
 
 #include "exprs/anyval_util.h"
+#include "storage/hll.h"
+#include "util/hash_util.hpp"
 
 namespace starrocks {
 
@@ -170,6 +172,9 @@ Status Aggregator::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile
     _input_row_count = ADD_COUNTER(_runtime_profile, "InputRowCount", TUnit::UNIT);
     _hash_table_size = ADD_COUNTER(_runtime_profile, "HashTableSize", TUnit::UNIT);
     _pass_through_row_count = ADD_COUNTER(_runtime_profile, "PassThroughRowCount", TUnit::UNIT);
+    _preagg_expand_count = ADD_COUNTER(_runtime_profile, "PreaggExpandCount", TUnit::UNIT);
+    _preagg_pass_through_count = ADD_COUNTER(_runtime_profile, "PreaggPassThroughCount", TUnit::UNIT);
+    _preagg_flush_count = ADD_COUNTER(_runtime_profile, "PreaggFlushCount", TUnit::UNIT);
 
     SCOPED_TIMER(_runtime_profile->total_time_counter());
 
@@ -280,37 +285,71 @@ void Aggregator::offer_chunk_to_buffer(const vectorized::ChunkPtr& chunk) {
 }
 
 bool Aggregator::should_expand_preagg_hash_tables(size_t prev_row_returned, size_t input_chunk_size, int64_t ht_mem,
-                                                  int64_t ht_rows) const {
-    // Need some rows in tables to have valid statistics.
-    if (ht_rows == 0) {
-        return true;
+                                                  int64_t ht_rows) {
+    return decide_streaming_preagg(prev_row_returned, input_chunk_size, ht_mem, ht_rows, false) ==
+           StreamingPreaggDecision::EXPAND;
+}
+
+StreamingPreaggDecision Aggregator::decide_streaming_preagg(size_t prev_row_returned, size_t input_chunk_size,
+                                                            int64_t ht_mem, int64_t ht_rows, bool allow_flush) {
+    // Compare the number of rows in the hash table with the number of input rows that
+    // were aggregated into it. Exclude passed through rows and the rows aggregated into
+    // the flushed hash tables from this calculation since they were not in hash tables.
+    const int64_t input_rows = prev_row_returned - input_chunk_size;
+    const int64_t aggregated_input_rows = input_rows - _num_pass_through_rows - _num_flushed_input_rows;
+    auto decision = decide_streaming_preagg_by_reduction(
+            aggregated_input_rows, input_chunk_size, ht_mem, ht_rows, allow_flush,
+            [this, input_chunk_size]() { return _estimate_group_by_cardinality(input_chunk_size); });
+    switch (decision) {
+    case StreamingPreaggDecision::EXPAND:
+        COUNTER_UPDATE(_preagg_expand_count, 1);
+        break;
+    case StreamingPreaggDecision::PASS_THROUGH:
+        COUNTER_UPDATE(_preagg_pass_through_count, 1);
+        break;
+    case StreamingPreaggDecision::FLUSH:
+        COUNTER_UPDATE(_preagg_flush_count, 1);
+        _num_flushed_input_rows += aggregated_input_rows;
+        break;
+    }
+    return decision;
+}
+
+int64_t Aggregator::_estimate_group_by_cardinality(size_t chunk_size) {
+    _group_by_hashes.assign(chunk_size, HashUtil::FNV_SEED);
+    for (const auto& group_by_column : _group_by_columns) {
+        group_by_column->fnv_hash(_group_by_hashes.data(), 0, chunk_size);
+    }
+    HyperLogLog hll;
+    for (uint32_t hash : _group_by_hashes) {
+        hll.update(HashUtil::murmur_hash64A(&hash, sizeof(hash), HashUtil::MURMUR_SEED));
     }
+    return std::max<int64_t>(hll.estimate_cardinality(), 1);
+}
 
-    // Find the appropriate reduction factor in our table for the current hash table sizes.
-    int cache_level = 0;
-    while (cache_level + 1 < STREAMING_HT_MIN_REDUCTION_SIZE &&
-           ht_mem >= STREAMING_HT_MIN_REDUCTION[cache_level + 1].min_ht_mem) {
-        cache_level++;
+void Aggregator::flush_hash_map_to_buffer() {
+    DCHECK(!_needs_finalize);
+    // The flushed groups are partial results which will be merged again by the next phase, they must
+    // not be accounted as returned rows, otherwise the limit would be reached too early.
+    const int64_t num_rows_returned = _num_rows_returned;
+    if (false) {
+    }
+#define HASH_MAP_METHOD(NAME)                                                  \
+    else if (_hash_map_variant.type == vectorized::HashMapVariant::Type::NAME) \
+            _flush_hash_map<decltype(_hash_map_variant.NAME)::element_type>(*_hash_map_variant.NAME);
+    APPLY_FOR_VARIANT_ALL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+    else {
+        DCHECK(false);
     }
 
-    // Compare the number of rows in the hash table with the number of input rows that
-    // were aggregated into it. Exclude passed through rows from this calculation since
-    // they were not in hash tables.
-    const int64_t input_rows = prev_row_returned - input_chunk_size;
-    const int64_t aggregated_input_rows = input_rows - _num_rows_returned;
-    double current_reduction = static_cast<double>(aggregated_input_rows) / ht_rows;
-
-    // inaccurate, which could lead to a divide by zero below.
-    if (aggregated_input_rows <= 0) {
-        return true;
-    }
-    // Extrapolate the current reduction factor (r) using the formula
-    // R = 1 + (N / n) * (r - 1), where R is the reduction factor over the full input data
-    // set, N is the number of input rows, excluding passed-through rows, and n is the
-    // number of rows inserted or merged into the hash tables. This is a very rough
-    // approximation but is good enough to be useful.
-    double min_reduction = STREAMING_HT_MIN_REDUCTION[cache_level].streaming_ht_min_reduction;
-    return current_reduction > min_reduction;
+    // the agg states are destroyed already, so the keys and states in mem pool can be freed.
+    _hash_map_variant = vectorized::HashMapVariant();
+    _init_agg_hash_variant(_hash_map_variant);
+    _mem_pool->free_all();
+    _it_hash.reset();
+    _is_ht_eos = false;
+    _num_rows_returned = num_rows_returned;
 }
 
 void Aggregator::compute_single_agg_state(size_t chunk_size) {
@@ -50,6 +50,16 @@ static const StreamingHtMinReductionEntry STREAMING_HT_MIN_REDUCTION[] = {
 static const int STREAMING_HT_MIN_REDUCTION_SIZE =
         sizeof(STREAMING_HT_MIN_REDUCTION) / sizeof(STREAMING_HT_MIN_REDUCTION[0]);
 
+// How the first phase aggregation handles an input chunk for which the hash table has to be expanded.
+enum class StreamingPreaggDecision {
+    // aggregate the whole chunk and expand the hash table.
+    EXPAND,
+    // aggregate the rows whose keys are in the hash table, and pass through the others.
+    PASS_THROUGH,
+    // output and clear the hash table, then aggregate the whole chunk from scratch.
+    FLUSH,
+};
+
 class Aggregator;
 using AggregatorPtr = std::shared_ptr<Aggregator>;
 
@@ -109,7 +119,62 @@ public:
     void offer_chunk_to_buffer(const vectorized::ChunkPtr& chunk);
 
     bool should_expand_preagg_hash_tables(size_t prev_row_returned, size_t input_chunk_size, int64_t ht_mem,
-                                          int64_t ht_rows) const;
+                                          int64_t ht_rows);
+
+    // The decision is made for every chunk, by the reduction of the hash table so far, and the
+    // reduction of the input chunk itself which is estimated by HyperLogLog on the group by keys,
+    // the reductions are compared with the threshold of the cache level the hash table fits in.
+    // FLUSH is only returned when |allow_flush| is true, the caller should call
+    // flush_hash_map_to_buffer() then.
+    StreamingPreaggDecision decide_streaming_preagg(size_t prev_row_returned, size_t input_chunk_size, int64_t ht_mem,
+                                                    int64_t ht_rows, bool allow_flush);
+
+    // The rule of decide_streaming_preagg(). |aggregated_input_rows| is the number of input rows aggregated
+    // into the hash table, |estimate_chunk_cardinality| is only called if the hash table doesn't reduce enough.
+    template <typename EstimateFunc>
+    static StreamingPreaggDecision decide_streaming_preagg_by_reduction(int64_t aggregated_input_rows,
+                                                                        size_t input_chunk_size, int64_t ht_mem,
+                                                                        int64_t ht_rows, bool allow_flush,
+                                                                        EstimateFunc&& estimate_chunk_cardinality) {
+        // Need some rows in tables to have valid statistics.
+        // The number of aggregated input rows may be inaccurate, which could lead to a divide by zero below.
+        if (ht_rows == 0 || aggregated_input_rows <= 0) {
+            return StreamingPreaggDecision::EXPAND;
+        }
+
+        // Find the appropriate reduction factor in our table for the current hash table sizes.
+        int cache_level = 0;
+        while (cache_level + 1 < STREAMING_HT_MIN_REDUCTION_SIZE &&
+               ht_mem >= STREAMING_HT_MIN_REDUCTION[cache_level + 1].min_ht_mem) {
+            cache_level++;
+        }
+        double min_reduction = STREAMING_HT_MIN_REDUCTION[cache_level].streaming_ht_min_reduction;
+
+        double ht_reduction = static_cast<double>(aggregated_input_rows) / ht_rows;
+        if (ht_reduction > min_reduction) {
+            return StreamingPreaggDecision::EXPAND;
+        }
+
+        // The keys don't repeat enough across the chunks aggregated so far, but the keys of this chunk
+        // may still repeat inside it, e.g. the input is clustered by the keys. It's estimated for every
+        // chunk, so the aggregation comes back once the input becomes reducible again.
+        double chunk_reduction = static_cast<double>(input_chunk_size) / estimate_chunk_cardinality();
+        if (chunk_reduction > min_reduction) {
+            // The hash table is out of the last level cache and is full of keys which are not hit any
+            // more, output them to the next phase rather than probing a larger and larger table.
+            if (allow_flush && cache_level == STREAMING_HT_MIN_REDUCTION_SIZE - 1) {
+                return StreamingPreaggDecision::FLUSH;
+            }
+            if (ht_rows < streaming_hash_table_size_threshold) {
+                return StreamingPreaggDecision::EXPAND;
+            }
+        }
+        return StreamingPreaggDecision::PASS_THROUGH;
+    }
+
+    // Output all groups of the hash table to the chunk buffer as intermediate results, and
+    // clear the hash table. Only for the first phase aggregation, whose results are merged later.
+    void flush_hash_map_to_buffer();
 
     // For aggregate without group by
     void compute_single_agg_state(size_t chunk_size);
@@ -179,6 +244,10 @@ private:
     bool _has_nullable_key = false;
     int64_t _num_input_rows = 0;
     int64_t _num_pass_through_rows = 0;
+    // number of input rows aggregated into the hash tables which are flushed
+    int64_t _num_flushed_input_rows = 0;
+    // hash values of group by keys of the input chunk, used to estimate its cardinality
+    std::vector<uint32_t> _group_by_hashes;
 
     TStreamingPreaggregationMode::type _streaming_preaggregation_mode;
 
@@ -242,6 +311,9 @@ private:
     RuntimeProfile::Counter* _agg_append_timer{};
     RuntimeProfile::Counter* _group_by_append_timer{};
     RuntimeProfile::Counter* _pass_through_row_count{};
+    RuntimeProfile::Counter* _preagg_expand_count{};
+    RuntimeProfile::Counter* _preagg_pass_through_count{};
+    RuntimeProfile::Counter* _preagg_flush_count{};
     RuntimeProfile::Counter* _expr_compute_timer{};
     RuntimeProfile::Counter* _expr_release_timer{};
 
@@ -465,10 +537,26 @@ private:
     void _evaluate_group_by_exprs(vectorized::Chunk* chunk);
     void _evaluate_agg_fn_exprs(vectorized::Chunk* chunk);
 
+    // Estimate the number of distinct group by keys of the input chunk.
+    int64_t _estimate_group_by_cardinality(size_t chunk_size);
+
     // Choose different agg hash map/set by different group by column's count, type, nullable
     template <typename HashVariantType>
     void _init_agg_hash_variant(HashVariantType& hash_variant);
 
+    template <typename HashMapWithKey>
+    void _flush_hash_map(HashMapWithKey& hash_map_with_key) {
+        _it_hash = hash_map_with_key.hash_map.begin();
+        do {
+            vectorized::ChunkPtr chunk;
+            convert_hash_map_to_chunk(hash_map_with_key, config::vector_chunk_size, &chunk);
+            if (chunk->num_rows() > 0) {
+                offer_chunk_to_buffer(chunk);
+            }
+        } while (!_is_ht_eos);
+        _release_agg_memory(hash_map_with_key);
+    }
+
     template <typename HashMapWithKey>
     void _release_agg_memory(HashMapWithKey& hash_map_with_key) {
         auto it = hash_map_with_key.hash_map.begin();
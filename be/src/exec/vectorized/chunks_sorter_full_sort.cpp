@@ -2,6 +2,7 @@
 
 #include "chunks_sorter_full_sort.h"
 
+#include "column/german_string.h"
 #include "column/type_traits.h"
 #include "exprs/expr.h"
 #include "gutil/casts.h"
@@ -137,18 +138,19 @@ private:
         uint32_t permutation_index; // sequence index for keeping sort stable.
     };
 
-    // Sort string
+    // Sort string, the strings are compared by their GermanString views, so the string data
+    // is accessed only when the prefixes are equal.
     template <bool stable>
     static Status sort_on_not_null_binary_column(RuntimeState* state, Column* column, bool is_asc_order,
                                                  Permutation& perm, size_t offset, size_t count = 0) {
         const size_t row_num = (count == 0 || offset + count > perm.size()) ? (perm.size() - offset) : count;
         auto* binary_column = reinterpret_cast<BinaryColumn*>(column);
         auto& data = binary_column->get_data();
-        std::vector<SortItem<Slice>> sort_items(row_num);
+        std::vector<SortItem<GermanString>> sort_items(row_num);
         for (uint32_t i = 0; i < row_num; ++i) {
-            sort_items[i] = {data[perm[i + offset].index_in_chunk], perm[i + offset].index_in_chunk, i};
+            sort_items[i] = {GermanString(data[perm[i + offset].index_in_chunk]), perm[i + offset].index_in_chunk, i};
         }
-        auto less_fn = [](const SortItem<Slice>& l, const SortItem<Slice>& r) -> bool {
+        auto less_fn = [](const SortItem<GermanString>& l, const SortItem<GermanString>& r) -> bool {
             if constexpr (stable) {
                 int res = l.value.compare(r.value);
                 if (res == 0) {
@@ -161,7 +163,7 @@ private:
                 return res < 0;
             }
         };
-        auto greater_fn = [](const SortItem<Slice>& l, const SortItem<Slice>& r) -> bool {
+        auto greater_fn = [](const SortItem<GermanString>& l, const SortItem<GermanString>& r) -> bool {
             if constexpr (stable) {
                 int res = l.value.compare(r.value);
                 if (res == 0) {
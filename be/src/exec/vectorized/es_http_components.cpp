@@ -5,540 +5,471 @@
 #include <fmt/format.h>
 
 #include "column/column_helper.h"
-#include "column/nullable_column.h"
 #include "common/config.h"
 #include "runtime/primitive_type.h"
 #include "runtime/timestamp_value.h"
+#include "util/string_parser.hpp"
 
 namespace starrocks::vectorized {
 
-static const char* FIELD_SCROLL_ID = "_scroll_id";
-static const char* FIELD_HITS = "hits";
-static const char* FIELD_INNER_HITS = "hits";
-static const char* FIELD_SOURCE = "_source";
-static const char* FIELD_ID = "_id";
+static constexpr std::string_view FIELD_SCROLL_ID = "_scroll_id";
+static constexpr std::string_view FIELD_HITS = "hits";
+static constexpr std::string_view FIELD_INNER_HITS = "hits";
+static constexpr std::string_view FIELD_SOURCE = "_source";
+static constexpr std::string_view FIELD_DOC_VALUES = "fields";
+static constexpr std::string_view FIELD_ID = "_id";
 
-const char* json_type_to_raw_str(rapidjson::Type type) {
+static const char* json_type_to_raw_str(simdjson::ondemand::json_type type) {
     switch (type) {
-    case rapidjson::kNumberType:
+    case simdjson::ondemand::json_type::number:
         return "Number";
-    case rapidjson::kStringType:
+    case simdjson::ondemand::json_type::string:
         return "Varchar/Char";
-    case rapidjson::kArrayType:
+    case simdjson::ondemand::json_type::array:
         return "Array";
-    case rapidjson::kObjectType:
+    case simdjson::ondemand::json_type::object:
         return "Object";
-    case rapidjson::kNullType:
+    case simdjson::ondemand::json_type::null:
         return "Null Type";
-    case rapidjson::kFalseType:
-    case rapidjson::kTrueType:
+    case simdjson::ondemand::json_type::boolean:
         return "True/False";
     default:
         return "Unknown Type";
     }
 }
 
-std::string json_value_to_string(const rapidjson::Value& value) {
-    rapidjson::StringBuffer scratch_buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> temp_writer(scratch_buffer);
-    value.Accept(temp_writer);
-    return scratch_buffer.GetString();
+static Status type_mismatch_error(PrimitiveType type, simdjson::ondemand::value& value) {
+    simdjson::ondemand::json_type json_type = value.type();
+    std::string_view json = simdjson::to_json_string(value);
+    return Status::RuntimeError(fmt::format("Expected value of type: {}; but found type: {}; Document slice is: {}",
+                                            type_to_string(type), json_type_to_raw_str(json_type), json));
 }
 
-#define RETURN_ERROR_IF_COL_IS_ARRAY(col, type)                               \
-    do {                                                                      \
-        if (col.IsArray()) {                                                  \
-            std::stringstream ss;                                             \
-            ss << "Expected value of type: " << type_to_string(type)          \
-               << "; but found type: " << json_type_to_raw_str(col.GetType()) \
-               << "; Docuemnt slice is : " << json_value_to_string(col);      \
-            return Status::RuntimeError(ss.str());                            \
-        }                                                                     \
-    } while (false)
-
-#define RETURN_ERROR_IF_COL_IS_NOT_STRING(col, type)                            \
-    do {                                                                        \
-        if (!col.IsString()) {                                                  \
-            std::stringstream ss;                                               \
-            ss << "Expected value of type: " << type_to_string(type)            \
-               << "; but found type: " << json_type_to_raw_str(col.GetType())   \
-               << "; Docuemnt source slice is : " << json_value_to_string(col); \
-            return Status::RuntimeError(ss.str());                              \
-        }                                                                       \
-    } while (false)
-
-#define RETURN_ERROR_IF_COL_IS_NOT_NUMBER(col, type)                          \
-    do {                                                                      \
-        if (!col.IsNumber()) {                                                \
-            std::stringstream ss;                                             \
-            ss << "Expected value of type: " << type_to_string(type)          \
-               << "; but found type: " << json_type_to_raw_str(col.GetType()) \
-               << "; Document value is: " << json_value_to_string(col);       \
-            return Status::RuntimeError(ss.str());                            \
-        }                                                                     \
-    } while (false)
-
-#define RETURN_ERROR_IF_PARSING_FAILED(result, col, type)                       \
-    do {                                                                        \
-        if (result != StringParser::PARSE_SUCCESS) {                            \
-            std::stringstream ss;                                               \
-            ss << "Expected value of type: " << type_to_string(type)            \
-               << "; but found type: " << json_type_to_raw_str(col.GetType())   \
-               << "; Docuemnt source slice is : " << json_value_to_string(col); \
-            return Status::RuntimeError(ss.str());                              \
-        }                                                                       \
-    } while (false)
-
-#define RETURN_ERROR_IF_CAST_FORMAT_ERROR(col, type)                      \
-    do {                                                                  \
-        std::stringstream ss;                                             \
-        ss << "Expected value of type: " << type_to_string(type)          \
-           << "; but found type: " << json_type_to_raw_str(col.GetType()) \
-           << "; Docuemnt slice is : " << json_value_to_string(col);      \
-        return Status::RuntimeError(ss.str());                            \
-    } while (false)
-
-template <typename T>
-static Status get_int_value(const rapidjson::Value& col, PrimitiveType type, void* slot, bool pure_doc_value) {
-    return Status::OK();
+static Status parse_error(PrimitiveType type, std::string_view str) {
+    return Status::RuntimeError(fmt::format("Expected value of type: {}; but found type: {}; Document slice is: {}",
+                                            type_to_string(type), "Varchar/Char", str));
 }
 
 ScrollParser::ScrollParser(bool doc_value_mode)
-        : _tuple_desc(nullptr),
-          _docvalue_context(nullptr),
-          _size(0),
-          _cur_line(0),
-          _doc_value_mode(doc_value_mode),
-          _temp_writer(_scratch_buffer) {}
-
-Status ScrollParser::parse(const std::string& scroll_result, bool exactly_once) {
+        : _tuple_desc(nullptr), _docvalue_context(nullptr), _size(0), _cur_line(0), _doc_value_mode(doc_value_mode) {}
+
+void ScrollParser::set_params(const TupleDescriptor* descs,
+                              const std::map<std::string, std::string>* docvalue_context) {
+    _tuple_desc = descs;
+    _docvalue_context = docvalue_context;
+
+    _columns.clear();
+    _source_field_indexes.clear();
+    _docvalue_field_indexes.clear();
+    _id_column_index = -1;
+    // because the fe planner filter the non_materialize column
+    for (SlotDescriptor* slot_desc : _tuple_desc->slots()) {
+        if (!slot_desc->is_materialized()) {
+            continue;
+        }
+        size_t index = _columns.size();
+        _columns.emplace_back().slot_desc = slot_desc;
+
+        const std::string& col_name = slot_desc->col_name();
+        // _id field must exists in every document, this is guaranteed by ES, and it's not in `_source`.
+        if (col_name == FIELD_ID) {
+            _id_column_index = index;
+            continue;
+        }
+        _source_field_indexes.emplace(col_name, index);
+        auto iter = _docvalue_context->find(col_name);
+        if (iter != _docvalue_context->end()) {
+            _docvalue_field_indexes.emplace(iter->second, index);
+        }
+    }
+    _filled.resize(_columns.size());
+}
+
+Status ScrollParser::parse(std::string* scroll_result, bool exactly_once) {
+    DCHECK(_tuple_desc != nullptr);
     _size = 0;
     _cur_line = 0;
-    _document_node.Parse(scroll_result.data(), scroll_result.size());
-    if (_document_node.HasParseError()) {
-        return Status::InternalError(fmt::format("Parsing json error, json is: {}", scroll_result));
-    }
 
-    if (!exactly_once && !_document_node.HasMember(FIELD_SCROLL_ID)) {
-        LOG(WARNING) << "Document has not a scroll id field scroll reponse:" << scroll_result;
-        return Status::InternalError("Document has not a scroll id field");
+    _chunk = std::make_shared<Chunk>();
+    for (SlotColumn& column : _columns) {
+        SlotDescriptor* slot_desc = column.slot_desc;
+        ColumnPtr col = ColumnHelper::create_column(slot_desc->type(), slot_desc->is_nullable());
+        column.column = col.get();
+        if (slot_desc->is_nullable()) {
+            auto* nullable_column = down_cast<NullableColumn*>(col.get());
+            column.data_column = nullable_column->data_column().get();
+            column.null_column = nullable_column->null_column().get();
+        } else {
+            column.data_column = col.get();
+            column.null_column = nullptr;
+        }
+        _chunk->append_column(std::move(col), slot_desc->id());
+    }
+
+    // simdjson reads SIMDJSON_PADDING bytes beyond the end of the document.
+    size_t length = scroll_result->size();
+    scroll_result->reserve(length + simdjson::SIMDJSON_PADDING);
+
+    bool has_scroll_id = false;
+    try {
+        simdjson::ondemand::document document =
+                _parser.iterate(scroll_result->data(), length, scroll_result->capacity());
+        // { _scroll_id : "xxx", hits: { total : 2, "hits" : [ {}, {}, {} ]}}
+        simdjson::ondemand::object root = document.get_object();
+        for (auto field : root) {
+            std::string_view key = field.unescaped_key();
+            if (key == FIELD_SCROLL_ID) {
+                std::string_view scroll_id = field.value().get_string();
+                _scroll_id.assign(scroll_id.data(), scroll_id.size());
+                has_scroll_id = true;
+            } else if (key == FIELD_HITS) {
+                simdjson::ondemand::object outer_hits = field.value().get_object();
+                for (auto hits_field : outer_hits) {
+                    if (std::string_view(hits_field.unescaped_key()) != FIELD_INNER_HITS) {
+                        continue;
+                    }
+                    simdjson::ondemand::value inner_hits = hits_field.value();
+                    // this happened just the end of scrolling
+                    if (inner_hits.type() != simdjson::ondemand::json_type::array) {
+                        continue;
+                    }
+                    simdjson::ondemand::array hits = inner_hits.get_array();
+                    RETURN_IF_ERROR(_parse_hits(hits));
+                }
+            }
+        }
+    } catch (simdjson::simdjson_error& e) {
+        return Status::InternalError(fmt::format("Parsing json error: {}, json is: {}",
+                                                 simdjson::error_message(e.error()), *scroll_result));
     }
 
-    if (!exactly_once) {
-        const rapidjson::Value& scroll_node = _document_node[FIELD_SCROLL_ID];
-        _scroll_id = scroll_node.GetString();
+    if (!exactly_once && !has_scroll_id) {
+        LOG(WARNING) << "Document has not a scroll id field scroll reponse:" << *scroll_result;
+        return Status::InternalError("Document has not a scroll id field");
     }
+    return Status::OK();
+}
 
-    // { hits: { total : 2, "hits" : [ {}, {}, {} ]}}
-    const rapidjson::Value& outer_hits_node = _document_node[FIELD_HITS];
-    // if has no inner hits, there has no data in this index
-    if (!outer_hits_node.HasMember(FIELD_INNER_HITS)) {
-        return Status::OK();
-    }
-    const rapidjson::Value& inner_hits_node = outer_hits_node[FIELD_INNER_HITS];
-    // this happened just the end of scrolling
-    if (!inner_hits_node.IsArray()) {
-        return Status::OK();
+Status ScrollParser::_parse_hits(simdjson::ondemand::array& hits) {
+    for (auto hit : hits) {
+        simdjson::ondemand::object document = hit.get_object();
+        RETURN_IF_ERROR(_append_document(document));
+        // how many documents contains in this batch
+        _size++;
     }
-    _inner_hits_node.CopyFrom(inner_hits_node, _document_node.GetAllocator());
-    // how many documents contains in this batch
-    _size = _inner_hits_node.Size();
-
     return Status::OK();
 }
 
-Status ScrollParser::fill_chunk(ChunkPtr* chunk, bool* line_eos) {
-    if (current_eos()) {
-        *line_eos = true;
-        return Status::OK();
+Status ScrollParser::_append_document(simdjson::ondemand::object& document) {
+    std::fill(_filled.begin(), _filled.end(), 0);
+    std::string_view id;
+    bool pure_doc_value = false;
+    // json-format response would like below:
+    //    "hits": {
+    //            "hits": [
+    //                {
+    //                    "_id": "UhHNc3IB8XwmcbhBk1ES",
+    //                    "_source": {
+    //                          "k": 201,
+    //                    }
+    //                }
+    //            ]
+    //        }
+    for (auto field : document) {
+        std::string_view key = field.unescaped_key();
+        if (key == FIELD_ID) {
+            id = field.value().get_string();
+        } else if (key == FIELD_SOURCE) {
+            simdjson::ondemand::object fields = field.value().get_object();
+            RETURN_IF_ERROR(_append_fields(fields, false));
+        } else if (key == FIELD_DOC_VALUES) {
+            pure_doc_value = true;
+            simdjson::ondemand::object fields = field.value().get_object();
+            RETURN_IF_ERROR(_append_fields(fields, true));
+        }
     }
-    *line_eos = false;
-
-    *chunk = std::make_shared<Chunk>();
-    std::vector<SlotDescriptor*> slot_descs = _tuple_desc->slots();
 
-    // init column information
-    for (auto& slot_desc : slot_descs) {
-        ColumnPtr column = ColumnHelper::create_column(slot_desc->type(), slot_desc->is_nullable());
-        (*chunk)->append_column(std::move(column), slot_desc->id());
+    if (_id_column_index >= 0) {
+        // actually this branch will not be reached, this is guaranteed by FE.
+        if (pure_doc_value) {
+            return Status::RuntimeError("obtain `_id` is not supported in doc_values mode");
+        }
+        DCHECK(_columns[_id_column_index].slot_desc->type().is_string_type());
+        _append_data<TYPE_VARCHAR>(_columns[_id_column_index], Slice(id.data(), id.size()));
+        _filled[_id_column_index] = 1;
     }
 
-    size_t left_sz = _size - _cur_line;
-    size_t fill_sz = std::min(left_sz, (size_t)config::vector_chunk_size);
-
-    auto slots = _tuple_desc->slots();
-
-    // TODO: we could fill chunk by column rather than row
-    for (size_t i = 0; i < fill_sz; ++i) {
-        const rapidjson::Value& obj = _inner_hits_node[_cur_line + i];
-        bool pure_doc_value = _pure_doc_value(obj);
-        const rapidjson::Value& line = obj.HasMember(FIELD_SOURCE) ? obj[FIELD_SOURCE] : obj["fields"];
-
-        for (size_t col_idx = 0; col_idx < slots.size(); ++col_idx) {
-            SlotDescriptor* slot_desc = slot_descs[col_idx];
-            ColumnPtr& column = (*chunk)->get_column_by_slot_id(slot_desc->id());
-
-            // because the fe planner filter the non_materialize column
-            if (!slot_desc->is_materialized()) {
-                continue;
-            }
-
-            // _id field must exists in every document, this is guaranteed by ES
-            // if _id was found in tuple, we would get `_id` value from inner-hit node
-            // json-format response would like below:
-            //    "hits": {
-            //            "hits": [
-            //                {
-            //                    "_id": "UhHNc3IB8XwmcbhBk1ES",
-            //                    "_source": {
-            //                          "k": 201,
-            //                    }
-            //                }
-            //            ]
-            //        }
-            if (slot_desc->col_name() == FIELD_ID) {
-                // actually this branch will not be reached, this is guaranteed by Doris FE.
-                if (pure_doc_value) {
-                    return Status::RuntimeError("obtain `_id` is not supported in doc_values mode");
-                }
-                PrimitiveType type = slot_desc->type().type;
-                DCHECK(type == TYPE_CHAR || type == TYPE_VARCHAR);
+    // if don't has col in ES, append a default value
+    for (size_t i = 0; i < _columns.size(); ++i) {
+        if (!_filled[i]) {
+            _append_default(_columns[i]);
+        }
+    }
+    return Status::OK();
+}
 
-                const auto& _id = obj[FIELD_ID];
-                Slice slice(_id.GetString(), _id.GetStringLength());
-                _append_data<TYPE_VARCHAR>(column.get(), slice);
+Status ScrollParser::_append_fields(simdjson::ondemand::object& fields, bool pure_doc_value) {
+    const auto& field_indexes = pure_doc_value ? _docvalue_field_indexes : _source_field_indexes;
+    for (auto field : fields) {
+        std::string_view key = field.unescaped_key();
+        auto iter = field_indexes.find(key);
+        if (iter == field_indexes.end() || _filled[iter->second]) {
+            continue;
+        }
+        simdjson::ondemand::value value = field.value();
+        RETURN_IF_ERROR(_append_field(_columns[iter->second], value, pure_doc_value));
+        _filled[iter->second] = 1;
+    }
+    return Status::OK();
+}
 
-                continue;
+Status ScrollParser::_append_field(SlotColumn& column, simdjson::ondemand::value& value, bool pure_doc_value) {
+    bool is_null = value.is_null();
+    if (!is_null && pure_doc_value && value.type() == simdjson::ondemand::json_type::array) {
+        // doc values are arrays, only the first value is used.
+        simdjson::ondemand::array values = value.get_array();
+        for (auto element : values) {
+            simdjson::ondemand::value first;
+            auto err = element.get(first);
+            if (err) {
+                return Status::DataQualityError(fmt::format("Failed to parse doc values. column={}, error={}",
+                                                            column.slot_desc->col_name(),
+                                                            simdjson::error_message(err)));
             }
-
-            // if pure_doc_value enabled, docvalue_context must contains the key
-            // todo: need move all `pure_docvalue` for every tuple outside fill_tuple
-            //  should check pure_docvalue for one table scan not every tuple
-            const char* col_name = pure_doc_value ? _docvalue_context->at(slot_desc->col_name()).c_str()
-                                                  : slot_desc->col_name().c_str();
-
-            auto has_col = line.HasMember(col_name);
-            if (has_col) {
-                const rapidjson::Value& col = line[col_name];
-                // doc value
-                bool is_null = (pure_doc_value && col.IsArray() && col[0].IsNull()) || col.IsNull();
-                if (!is_null) {
-                    // append value from ES to column
-                    RETURN_IF_ERROR(
-                            _append_value_from_json_val(column.get(), slot_desc->type().type, col, pure_doc_value));
-                    continue;
-                }
-                // handle null col
-                if (slot_desc->is_nullable()) {
-                    _append_null(column.get());
-                } else {
-                    return Status::DataQualityError(
-                            fmt::format("col `{}` is not null, but value from ES is null", slot_desc->col_name()));
-                }
-            } else {
-                // if don't has col in ES , append a default value
-                _append_null(column.get());
+            if (first.is_null()) {
+                break;
             }
+            return _append_value(column, first);
         }
+        is_null = true;
     }
-    _cur_line += fill_sz;
-    return Status::OK();
-}
 
-void ScrollParser::set_params(const TupleDescriptor* descs,
-                              const std::map<std::string, std::string>* docvalue_context) {
-    _tuple_desc = descs;
-    _docvalue_context = docvalue_context;
+    if (!is_null) {
+        return _append_value(column, value);
+    }
+    // handle null col
+    if (column.null_column == nullptr) {
+        return Status::DataQualityError(
+                fmt::format("col `{}` is not null, but value from ES is null", column.slot_desc->col_name()));
+    }
+    column.column->append_nulls(1);
+    return Status::OK();
 }
 
-bool ScrollParser::_pure_doc_value(const rapidjson::Value& obj) {
-    if (obj.HasMember("fields")) {
-        return true;
+Status ScrollParser::_append_value(SlotColumn& column, simdjson::ondemand::value& value) {
+    PrimitiveType type = column.slot_desc->type().type;
+    switch (type) {
+    case TYPE_CHAR:
+    case TYPE_VARCHAR:
+        return _append_string_val(column, value);
+    case TYPE_TINYINT:
+        return _append_int_val<TYPE_TINYINT>(column, value);
+    case TYPE_SMALLINT:
+        return _append_int_val<TYPE_SMALLINT>(column, value);
+    case TYPE_INT:
+        return _append_int_val<TYPE_INT>(column, value);
+    case TYPE_BIGINT:
+        return _append_int_val<TYPE_BIGINT>(column, value);
+    case TYPE_LARGEINT:
+        return _append_int_val<TYPE_LARGEINT>(column, value);
+    case TYPE_FLOAT:
+        return _append_float_val<TYPE_FLOAT>(column, value);
+    case TYPE_DOUBLE:
+        return _append_float_val<TYPE_DOUBLE>(column, value);
+    case TYPE_BOOLEAN:
+        return _append_bool_val(column, value);
+    case TYPE_DATE:
+        return _append_date_val<TYPE_DATE>(column, value);
+    case TYPE_DATETIME:
+        return _append_date_val<TYPE_DATETIME>(column, value);
+    default:
+        DCHECK(false) << "unknown type:" << type;
+        return Status::InvalidArgument(fmt::format("unknown type {}", type));
     }
-    return false;
 }
 
-template <PrimitiveType type, typename CppType>
-void ScrollParser::_append_data(Column* column, CppType& value) {
-    auto appender = [](auto* column, CppType& value) {
-        using ColumnType = typename vectorized::RunTimeColumnType<type>;
-        ColumnType* runtime_column = down_cast<ColumnType*>(column);
-        runtime_column->append(value);
-    };
-
-    if (column->is_nullable()) {
-        auto* nullable_column = down_cast<NullableColumn*>(column);
-        auto* data_column = nullable_column->data_column().get();
-        NullData& null_data = nullable_column->null_column_data();
-        null_data.push_back(0);
-        appender(data_column, value);
-    } else {
-        appender(column, value);
+template <PrimitiveType type, typename T>
+void ScrollParser::_append_data(SlotColumn& column, const T& value) {
+    using ColumnType = RunTimeColumnType<type>;
+    down_cast<ColumnType*>(column.data_column)->append(value);
+    if (column.null_column != nullptr) {
+        column.null_column->append(0);
     }
 }
 
-void ScrollParser::_append_null(Column* column) {
-    column->append_default();
+void ScrollParser::_append_default(SlotColumn& column) {
+    column.column->append_default();
 }
 
-Status ScrollParser::_append_value_from_json_val(Column* column, PrimitiveType type, const rapidjson::Value& col,
-                                                 bool pure_doc_value) {
-    switch (type) {
-    case TYPE_CHAR:
-    case TYPE_VARCHAR: {
-        Slice slice;
-        auto get_slice = [this](auto& val) {
-            if (!val.IsString()) {
-                return _json_val_to_slice(val);
-            } else {
-                return Slice{val.GetString(), val.GetStringLength()};
-            }
-        };
-
-        if (pure_doc_value) {
-            slice = get_slice(col[0]);
-        } else {
-            RETURN_ERROR_IF_COL_IS_ARRAY(col, type);
-            slice = get_slice(col);
-        }
-        _append_data<TYPE_VARCHAR>(column, slice);
-        break;
-    }
-    case TYPE_INT: {
-        RETURN_IF_ERROR(_append_int_val<TYPE_INT>(col, column, pure_doc_value));
+Status ScrollParser::_append_string_val(SlotColumn& column, simdjson::ondemand::value& value) {
+    std::string_view str;
+    switch (value.type()) {
+    case simdjson::ondemand::json_type::string:
+        str = value.get_string();
         break;
-    }
-    case TYPE_TINYINT: {
-        RETURN_IF_ERROR(_append_int_val<TYPE_TINYINT>(col, column, pure_doc_value));
-        break;
-    }
-    case TYPE_SMALLINT: {
-        RETURN_IF_ERROR(_append_int_val<TYPE_SMALLINT>(col, column, pure_doc_value));
-        break;
-    }
-    case TYPE_BIGINT: {
-        RETURN_IF_ERROR(_append_int_val<TYPE_BIGINT>(col, column, pure_doc_value));
-        break;
-    }
-    case TYPE_LARGEINT: {
-        RETURN_IF_ERROR(_append_int_val<TYPE_LARGEINT>(col, column, pure_doc_value));
-        break;
-    }
-    case TYPE_DOUBLE: {
-        RETURN_IF_ERROR(_append_float_val<TYPE_DOUBLE>(col, column, pure_doc_value));
-        break;
-    }
-    case TYPE_FLOAT: {
-        RETURN_IF_ERROR(_append_float_val<TYPE_FLOAT>(col, column, pure_doc_value));
+    case simdjson::ondemand::json_type::number:
+    case simdjson::ondemand::json_type::boolean: {
+        str = value.raw_json_token();
+        // the raw token includes the trailing whitespaces
+        size_t length = str.size();
+        while (length > 0 && isspace(static_cast<unsigned char>(str[length - 1]))) {
+            --length;
+        }
+        str = str.substr(0, length);
         break;
     }
-    case TYPE_BOOLEAN: {
-        RETURN_IF_ERROR(_append_bool_val(col, column, pure_doc_value));
+    case simdjson::ondemand::json_type::object: {
+        std::string_view json = simdjson::to_json_string(value);
+        _scratch_buffer.resize(json.size());
+        size_t new_length = 0;
+        auto err = simdjson::minify(json.data(), json.size(), _scratch_buffer.data(), new_length);
+        if (err) {
+            return Status::DataQualityError(fmt::format("Failed to minify object as string. column={}, error={}",
+                                                        column.slot_desc->col_name(), simdjson::error_message(err)));
+        }
+        str = std::string_view(_scratch_buffer.data(), new_length);
         break;
     }
-    case TYPE_DATE: {
-        RETURN_IF_ERROR(_append_date_val<TYPE_DATE>(col, column, pure_doc_value));
-        break;
+    default:
+        return type_mismatch_error(column.slot_desc->type().type, value);
     }
-    case TYPE_DATETIME: {
-        RETURN_IF_ERROR(_append_date_val<TYPE_DATETIME>(col, column, pure_doc_value));
+    _append_data<TYPE_VARCHAR>(column, Slice(str.data(), str.size()));
+    return Status::OK();
+}
+
+template <PrimitiveType type, typename T>
+Status ScrollParser::_append_int_val(SlotColumn& column, simdjson::ondemand::value& value) {
+    T result;
+    switch (value.type()) {
+    case simdjson::ondemand::json_type::number: {
+        switch (value.get_number_type()) {
+        case simdjson::ondemand::number_type::signed_integer:
+            result = static_cast<T>(int64_t(value.get_int64()));
+            break;
+        case simdjson::ondemand::number_type::unsigned_integer:
+            result = static_cast<T>(uint64_t(value.get_uint64()));
+            break;
+        case simdjson::ondemand::number_type::floating_point_number:
+            result = static_cast<T>(double(value.get_double()));
+            break;
+        }
         break;
     }
-    default: {
-        DCHECK(false) << "unknown type:" << type;
-        return Status::InvalidArgument(fmt::format("unknown type {}", type));
+    case simdjson::ondemand::json_type::string: {
+        std::string_view str = value.get_string();
+        StringParser::ParseResult parse_result;
+        result = StringParser::string_to_int<T>(str.data(), str.size(), &parse_result);
+        if (parse_result != StringParser::PARSE_SUCCESS) {
+            return parse_error(type, str);
+        }
         break;
     }
+    default:
+        return type_mismatch_error(type, value);
     }
+    _append_data<type>(column, result);
     return Status::OK();
 }
 
-Slice ScrollParser::_json_val_to_slice(const rapidjson::Value& val) {
-    _scratch_buffer.Clear();
-    _temp_writer.Reset(_scratch_buffer);
-    val.Accept(_temp_writer);
-    return {_scratch_buffer.GetString(), _scratch_buffer.GetSize()};
-}
-
 template <PrimitiveType type, typename T>
-Status ScrollParser::_append_int_val(const rapidjson::Value& col, Column* column, bool pure_doc_value) {
-    T value;
-    if (col.IsNumber()) {
-        // TODO: performance ?
-        if (col.IsInt()) {
-            value = static_cast<T>(col.GetInt());
-        } else if (col.IsInt64()) {
-            value = static_cast<T>(col.GetInt64());
-        } else if (col.IsUint()) {
-            value = static_cast<T>(col.GetUint());
-        } else if (col.IsUint64()) {
-            value = static_cast<T>(col.GetUint64());
-        } else if (col.IsDouble()) {
-            value = static_cast<T>(col.GetDouble());
-        } else if (col.IsFloat()) {
-            value = static_cast<T>(col.GetFloat());
-        } else {
-            value = (T)(sizeof(T) < 8 ? col.GetInt() : col.GetInt64());
+Status ScrollParser::_append_float_val(SlotColumn& column, simdjson::ondemand::value& value) {
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>);
+    T result;
+    switch (value.type()) {
+    case simdjson::ondemand::json_type::number:
+        result = static_cast<T>(double(value.get_double()));
+        break;
+    case simdjson::ondemand::json_type::string: {
+        std::string_view str = value.get_string();
+        StringParser::ParseResult parse_result;
+        result = StringParser::string_to_float<T>(str.data(), str.size(), &parse_result);
+        if (parse_result != StringParser::PARSE_SUCCESS) {
+            return parse_error(type, str);
         }
-        _append_data<type>(column, value);
-        return Status::OK();
+        break;
     }
-
-    if (pure_doc_value && col.IsArray()) {
-        RETURN_ERROR_IF_COL_IS_NOT_NUMBER(col[0], type);
-        value = (T)(sizeof(T) < 8 ? col[0].GetInt() : col[0].GetInt64());
-        _append_data<type>(column, value);
-        return Status::OK();
+    default:
+        return type_mismatch_error(type, value);
     }
-
-    RETURN_ERROR_IF_COL_IS_ARRAY(col, type);
-    RETURN_ERROR_IF_COL_IS_NOT_STRING(col, type);
-
-    StringParser::ParseResult result;
-    const char* raw_str = col.GetString();
-    size_t len = col.GetStringLength();
-    value = StringParser::string_to_int<T>(raw_str, len, &result);
-    RETURN_ERROR_IF_PARSING_FAILED(result, col, type);
-
-    _append_data<type>(column, value);
+    _append_data<type>(column, result);
     return Status::OK();
 }
 
-template <PrimitiveType type, typename T>
-Status ScrollParser::_append_float_val(const rapidjson::Value& col, Column* column, bool pure_doc_value) {
-    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>);
-    T value;
-
-    auto get_value = [](const auto& col) {
-        T v;
-        if constexpr (std::is_same_v<T, float>) {
-            v = col.GetFloat();
-        } else if constexpr (std::is_same_v<T, double>) {
-            v = col.GetDouble();
+Status ScrollParser::_append_bool_val(SlotColumn& column, simdjson::ondemand::value& value) {
+    uint8_t result;
+    switch (value.type()) {
+    case simdjson::ondemand::json_type::boolean:
+        result = bool(value.get_bool());
+        break;
+    case simdjson::ondemand::json_type::number:
+        result = double(value.get_double()) != 0;
+        break;
+    case simdjson::ondemand::json_type::string: {
+        std::string_view str = value.get_string();
+        StringParser::ParseResult parse_result;
+        result = StringParser::string_to_bool(str.data(), str.size(), &parse_result);
+        if (parse_result != StringParser::PARSE_SUCCESS) {
+            return parse_error(TYPE_BOOLEAN, str);
         }
-        return v;
-    };
-
-    if (col.IsNumber()) {
-        value = get_value(col);
-        _append_data<type>(column, value);
-        return Status::OK();
+        break;
     }
-
-    if (pure_doc_value && col.IsArray()) {
-        value = get_value(col[0]);
-        _append_data<type>(column, value);
-        return Status::OK();
+    default:
+        return type_mismatch_error(TYPE_BOOLEAN, value);
     }
-
-    RETURN_ERROR_IF_COL_IS_ARRAY(col, type);
-    RETURN_ERROR_IF_COL_IS_NOT_STRING(col, type);
-
-    StringParser::ParseResult result;
-    const char* raw_str = col.GetString();
-    size_t len = col.GetStringLength();
-    value = StringParser::string_to_float<T>(raw_str, len, &result);
-    RETURN_ERROR_IF_PARSING_FAILED(result, col, type);
-    _append_data<type>(column, value);
-
+    _append_data<TYPE_BOOLEAN>(column, result);
     return Status::OK();
 }
 
-Status ScrollParser::_append_bool_val(const rapidjson::Value& col, Column* column, bool pure_doc_value) {
-    PrimitiveType type = TYPE_BOOLEAN;
-    uint8_t value;
-    if (col.IsBool()) {
-        value = col.GetBool();
-        _append_data<TYPE_BOOLEAN>(column, value);
-        return Status::OK();
-    }
-
-    if (col.IsNumber()) {
-        if (col.IsInt()) {
-            value = static_cast<int8_t>(col.GetInt() != 0);
-        } else if (col.IsInt64()) {
-            value = static_cast<int8_t>(col.GetInt64() != 0);
-        } else if (col.IsUint()) {
-            value = static_cast<int8_t>(col.GetUint() != 0);
-        } else if (col.IsUint64()) {
-            value = static_cast<int8_t>(col.GetUint64() != 0);
-        } else if (col.IsDouble()) {
-            value = static_cast<int8_t>(col.GetDouble() != 0);
+template <PrimitiveType type>
+Status ScrollParser::_append_date_val(SlotColumn& column, simdjson::ondemand::value& value) {
+    static_assert(type == TYPE_DATE || type == TYPE_DATETIME);
+    switch (value.type()) {
+    case simdjson::ondemand::json_type::number: {
+        // milliseconds since the epoch
+        int64_t millis = value.get_number_type() == simdjson::ondemand::number_type::floating_point_number
+                                 ? static_cast<int64_t>(double(value.get_double()))
+                                 : int64_t(value.get_int64());
+        TimestampValue timestamp;
+        timestamp.from_unixtime(millis / 1000, "+08:00");
+        if constexpr (type == TYPE_DATE) {
+            _append_data<TYPE_DATE>(column, DateValue(timestamp));
         } else {
-            value = static_cast<int8_t>(col.GetInt() != 0);
+            _append_data<TYPE_DATETIME>(column, timestamp);
         }
-        _append_data<TYPE_BOOLEAN>(column, value);
         return Status::OK();
     }
-
-    if (pure_doc_value && col.IsArray()) {
-        value = col[0].GetBool();
-        _append_data<TYPE_BOOLEAN>(column, value);
+    case simdjson::ondemand::json_type::string: {
+        std::string_view str = value.get_string();
+        RunTimeCppType<type> result;
+        if (!result.from_string(str.data(), str.size())) {
+            return parse_error(type, str);
+        }
+        _append_data<type>(column, result);
         return Status::OK();
     }
-
-    RETURN_ERROR_IF_COL_IS_ARRAY(col, type);
-    RETURN_ERROR_IF_COL_IS_NOT_STRING(col, type);
-
-    const char* raw_string = col.GetString();
-    size_t val_size = col.GetStringLength();
-    StringParser::ParseResult result;
-    value = StringParser::string_to_bool(raw_string, val_size, &result);
-    RETURN_ERROR_IF_PARSING_FAILED(result, col, type);
-    _append_data<TYPE_BOOLEAN>(column, value);
-
-    return Status::OK();
+    default:
+        return type_mismatch_error(type, value);
+    }
 }
-// TODO: test here
-template <PrimitiveType type, typename T>
-Status ScrollParser::_append_date_val(const rapidjson::Value& col, Column* column, bool pure_doc_value) {
-    auto append_timestamp = [](auto& col, Column* column) {
-        TimestampValue value;
-        value.from_unixtime(col.GetInt64() / 1000, "+08:00");
-        if constexpr (type == TYPE_DATE) {
-            DateValue date_val = DateValue(value);
-            _append_data<TYPE_DATE>(column, date_val);
-        } else if constexpr (type == TYPE_DATETIME) {
-            _append_data<TYPE_DATETIME>(column, value);
-        }
-    };
-
-    auto append_strval = [](auto& col, Column* column) {
-        const char* raw_str = col.GetString();
-        size_t val_size = col.GetStringLength();
-
-        if constexpr (type == TYPE_DATE) {
-            DateValue value;
-            if (!value.from_string(raw_str, val_size)) {
-                RETURN_ERROR_IF_CAST_FORMAT_ERROR(col, type);
-            }
-            _append_data<TYPE_DATE>(column, value);
-        } else if constexpr (type == TYPE_DATETIME) {
-            TimestampValue value;
-            if (!value.from_string(raw_str, val_size)) {
-                RETURN_ERROR_IF_CAST_FORMAT_ERROR(col, type);
-            }
-            _append_data<TYPE_DATETIME>(column, value);
-        }
 
+Status ScrollParser::fill_chunk(ChunkPtr* chunk, bool* line_eos) {
+    if (current_eos()) {
+        *line_eos = true;
         return Status::OK();
-    };
-
-    if (col.IsNumber()) {
-        append_timestamp(col, column);
-    } else if (col.IsArray() && pure_doc_value) {
-        if (col[0].IsString()) {
-            RETURN_IF_ERROR(append_strval(col[0], column));
-        } else {
-            append_timestamp(col[0], column);
-        }
+    }
+    *line_eos = false;
 
+    size_t left_sz = _size - _cur_line;
+    size_t fill_sz = std::min(left_sz, (size_t)config::vector_chunk_size);
+    if (fill_sz == _size) {
+        // all documents fit in one chunk
+        *chunk = std::move(_chunk);
     } else {
-        RETURN_ERROR_IF_COL_IS_ARRAY(col, type);
-        RETURN_ERROR_IF_COL_IS_NOT_STRING(col, type);
-        RETURN_IF_ERROR(append_strval(col, column));
+        *chunk = _chunk->clone_empty_with_slot(fill_sz);
+        (*chunk)->append(*_chunk, _cur_line, fill_sz);
     }
+    _cur_line += fill_sz;
     return Status::OK();
 }
 
-} // namespace starrocks::vectorized
\ No newline at end of file
+} // namespace starrocks::vectorized
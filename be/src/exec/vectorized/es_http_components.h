@@ -1,73 +1,92 @@
 // This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
 
 #pragma once
+#include <map>
 #include <string>
-
-#include "common/compiler_util.h"
-DIAGNOSTIC_PUSH
-DIAGNOSTIC_IGNORE("-Wclass-memaccess")
-#include <rapidjson/document.h>
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
-DIAGNOSTIC_POP
+#include <string_view>
+#include <vector>
 
 #include "column/chunk.h"
+#include "column/nullable_column.h"
 #include "column/type_traits.h"
-#include "http/http_client.h"
 #include "runtime/descriptors.h"
 #include "runtime/primitive_type.h"
+#include "simdjson.h"
+#include "util/phmap/phmap.h"
 
 namespace starrocks::vectorized {
+// Parses the scroll responses of ES into chunks.
+//
+// A response is parsed by simdjson on-demand in one pass, and the values of the documents are appended to the
+// columns of the slots directly, without building a DOM of the response.
 class ScrollParser {
 public:
     ScrollParser(bool doc_value_mode);
     ~ScrollParser() = default;
 
-    Status parse(const std::string& scroll_result, bool exactly_once = false);
+    // Must be called before parsing any response.
+    void set_params(const TupleDescriptor* descs, const std::map<std::string, std::string>* docvalue_context);
+
+    // Parse all documents of |scroll_result|, which may be padded for simdjson.
+    Status parse(std::string* scroll_result, bool exactly_once = false);
+    // Return the parsed documents by chunks of at most vector_chunk_size rows.
     Status fill_chunk(ChunkPtr* chunk, bool* line_eos);
 
     const std::string& get_scroll_id() { return _scroll_id; }
     int get_size() { return _size; }
     bool current_eos() { return _cur_line == _size; }
 
-    void set_params(const TupleDescriptor* descs, const std::map<std::string, std::string>* docvalue_context);
-
 private:
-    static bool _pure_doc_value(const rapidjson::Value& obj);
-
-    template <PrimitiveType type, class CppType = RunTimeCppType<type>>
-    static void _append_data(Column* column, CppType& value);
-
-    static void _append_null(Column* column);
-
-    Status _append_value_from_json_val(Column* column, PrimitiveType type, const rapidjson::Value& col,
-                                       bool pure_doc_value);
-
-    Slice _json_val_to_slice(const rapidjson::Value& val);
+    // The columns of a materialized slot in |_chunk|.
+    struct SlotColumn {
+        SlotDescriptor* slot_desc = nullptr;
+        Column* column = nullptr;
+        Column* data_column = nullptr;
+        // nullptr if the slot is not nullable.
+        NullColumn* null_column = nullptr;
+    };
+
+    Status _parse_hits(simdjson::ondemand::array& hits);
+    Status _append_document(simdjson::ondemand::object& doc);
+    Status _append_fields(simdjson::ondemand::object& fields, bool pure_doc_value);
+    Status _append_field(SlotColumn& column, simdjson::ondemand::value& value, bool pure_doc_value);
+    // Append |value| to the data column of |column|, which is not null.
+    Status _append_value(SlotColumn& column, simdjson::ondemand::value& value);
 
     template <PrimitiveType type, typename T = RunTimeCppType<type>>
-    Status _append_int_val(const rapidjson::Value& col, Column* column, bool pure_doc_value);
+    static void _append_data(SlotColumn& column, const T& value);
+    static void _append_default(SlotColumn& column);
 
+    Status _append_string_val(SlotColumn& column, simdjson::ondemand::value& value);
     template <PrimitiveType type, typename T = RunTimeCppType<type>>
-    Status _append_float_val(const rapidjson::Value& col, Column* column, bool pure_doc_value);
-
-    Status _append_bool_val(const rapidjson::Value& col, Column* column, bool pure_doc_value);
-
+    Status _append_int_val(SlotColumn& column, simdjson::ondemand::value& value);
     template <PrimitiveType type, typename T = RunTimeCppType<type>>
-    Status _append_date_val(const rapidjson::Value& col, Column* column, bool pure_doc_value);
+    Status _append_float_val(SlotColumn& column, simdjson::ondemand::value& value);
+    Status _append_bool_val(SlotColumn& column, simdjson::ondemand::value& value);
+    template <PrimitiveType type>
+    Status _append_date_val(SlotColumn& column, simdjson::ondemand::value& value);
 
-private:
     const TupleDescriptor* _tuple_desc;
     const std::map<std::string, std::string>* _docvalue_context;
 
+    // The columns of the materialized slots, and the indexes of them by the names of the fields
+    // in `_source` and `fields` of the documents.
+    std::vector<SlotColumn> _columns;
+    phmap::flat_hash_map<std::string, size_t> _source_field_indexes;
+    phmap::flat_hash_map<std::string, size_t> _docvalue_field_indexes;
+    // The index of the `_id` slot, or -1 if `_id` is not selected.
+    int _id_column_index = -1;
+    // Whether a column has got its value of the current document.
+    std::vector<uint8_t> _filled;
+
     std::string _scroll_id;
     size_t _size;
-    rapidjson::SizeType _cur_line;
-    rapidjson::Document _document_node;
-    rapidjson::Value _inner_hits_node;
+    size_t _cur_line;
     bool _doc_value_mode;
 
-    rapidjson::StringBuffer _scratch_buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> _temp_writer;
+    simdjson::ondemand::parser _parser;
+    // All documents of the current response.
+    ChunkPtr _chunk;
+    std::string _scratch_buffer;
 };
-} // namespace starrocks::vectorized
\ No newline at end of file
+} // namespace starrocks::vectorized
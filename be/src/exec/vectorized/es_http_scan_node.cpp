@@ -12,6 +12,10 @@
 #include "exec/es/es_query_builder.h"
 #include "exec/es/es_scan_reader.h"
 #include "exec/es/es_scroll_query.h"
+#include "exec/pipeline/es_scan_operator.h"
+#include "exec/pipeline/limit_operator.h"
+#include "exec/pipeline/pipeline_builder.h"
+#include "exprs/vectorized/runtime_filter_bank.h"
 #include "runtime/current_thread.h"
 #include "util/defer_op.h"
 #include "util/spinlock.h"
@@ -62,14 +66,6 @@ Status EsHttpScanNode::prepare(RuntimeState* state) {
         return Status::InternalError(fmt::format("Failed to get tuple descriptor, _tuple_id={}", _tuple_id));
     }
 
-    _column_names.reserve(_tuple_desc->slots().size());
-    for (auto slot_desc : _tuple_desc->slots()) {
-        if (!slot_desc->is_materialized()) {
-            continue;
-        }
-        _column_names.push_back(slot_desc->col_name());
-    }
-
     _wait_scanner_timer = ADD_TIMER(runtime_profile(), "WaitScannerTime");
 
     return Status::OK();
@@ -82,8 +78,7 @@ Status EsHttpScanNode::open(RuntimeState* state) {
     RETURN_IF_ERROR(exec_debug_action(TExecNodePhase::OPEN));
     RETURN_IF_CANCELLED(state);
 
-    RETURN_IF_ERROR(_build_conjuncts());
-    RETURN_IF_ERROR(_normalize_conjuncts());
+    RETURN_IF_ERROR(push_down_conjuncts(state, &_conjunct_ctxs, &_predicates));
     RETURN_IF_ERROR(_start_scan_thread(state));
 
     return Status::OK();
@@ -160,20 +155,30 @@ void EsHttpScanNode::_update_status(const Status& new_status) {
     }
 }
 
-Status EsHttpScanNode::_build_conjuncts() {
+Status EsHttpScanNode::push_down_conjuncts(RuntimeState* state, std::vector<ExprContext*>* conjunct_ctxs,
+                                           std::vector<EsPredicate*>* predicates) {
+    // predicate index in the conjuncts
+    std::vector<int> predicate_idx;
+    RETURN_IF_ERROR(_build_conjuncts(state, *conjunct_ctxs, predicates, &predicate_idx));
+    return _normalize_conjuncts(state, conjunct_ctxs, predicates, &predicate_idx);
+}
+
+Status EsHttpScanNode::_build_conjuncts(RuntimeState* state, const std::vector<ExprContext*>& conjunct_ctxs,
+                                        std::vector<EsPredicate*>* predicates, std::vector<int>* predicate_idx) {
     Status status = Status::OK();
 
-    size_t conjunct_sz = _conjunct_ctxs.size();
-    _predicates.reserve(conjunct_sz);
-    _predicate_idx.reserve(conjunct_sz);
+    const TupleDescriptor* tuple_desc = state->desc_tbl().get_tuple_descriptor(_tuple_id);
+    size_t conjunct_sz = conjunct_ctxs.size();
+    predicates->reserve(conjunct_sz);
+    predicate_idx->reserve(conjunct_sz);
 
-    for (int i = 0; i < _conjunct_ctxs.size(); ++i) {
-        EsPredicate* predicate = _pool->add(new EsPredicate(_conjunct_ctxs[i], _tuple_desc, _pool));
+    for (int i = 0; i < conjunct_ctxs.size(); ++i) {
+        EsPredicate* predicate = _pool->add(new EsPredicate(conjunct_ctxs[i], tuple_desc, _pool));
         predicate->set_field_context(_fields_context);
         status = predicate->build_disjuncts_list(true);
         if (status.ok()) {
-            _predicates.push_back(predicate);
-            _predicate_idx.push_back(i);
+            predicates->push_back(predicate);
+            predicate_idx->push_back(i);
         } else {
             status = predicate->get_es_query_status();
             if (!status.ok()) {
@@ -185,9 +190,9 @@ Status EsHttpScanNode::_build_conjuncts() {
     return status;
 }
 
-void EsHttpScanNode::_try_skip_constant_conjuncts() {
+void EsHttpScanNode::_try_skip_constant_conjuncts(const std::vector<ExprContext*>& conjunct_ctxs) {
     // TODO: skip constant true
-    for (auto& _conjunct_ctx : _conjunct_ctxs) {
+    for (auto& _conjunct_ctx : conjunct_ctxs) {
         if (_conjunct_ctx->root()->is_constant()) {
             // unreachable path
             // The new optimizer will rewrite `where always false` to `EMPTY_SET`
@@ -200,43 +205,58 @@ void EsHttpScanNode::_try_skip_constant_conjuncts() {
     }
 }
 
-Status EsHttpScanNode::_normalize_conjuncts() {
-    _try_skip_constant_conjuncts();
+Status EsHttpScanNode::_normalize_conjuncts(RuntimeState* state, std::vector<ExprContext*>* conjunct_ctxs,
+                                            std::vector<EsPredicate*>* predicates, std::vector<int>* predicate_idx) {
+    _try_skip_constant_conjuncts(*conjunct_ctxs);
 
     std::vector<bool> validate_res;
-    BooleanQueryBuilder::validate(_predicates, &validate_res);
-    DCHECK(validate_res.size() == _predicates.size());
+    BooleanQueryBuilder::validate(*predicates, &validate_res);
+    DCHECK(validate_res.size() == predicates->size());
 
     int counter = 0;
-    for (int i = 0; i < _predicates.size(); ++i) {
+    for (int i = 0; i < predicates->size(); ++i) {
         if (validate_res[i]) {
-            _predicate_idx[counter] = _predicate_idx[i];
-            _predicates[counter++] = _predicates[i];
+            (*predicate_idx)[counter] = (*predicate_idx)[i];
+            (*predicates)[counter++] = (*predicates)[i];
         }
     }
-    _predicates.erase(_predicates.begin() + counter, _predicates.end());
+    predicates->erase(predicates->begin() + counter, predicates->end());
+    predicate_idx->resize(counter);
 
-    for (int i = _predicate_idx.size() - 1; i >= 0; i--) {
-        int conjunct_index = _predicate_idx[i];
-        _conjunct_ctxs[conjunct_index]->close(runtime_state());
-        _conjunct_ctxs.erase(_conjunct_ctxs.begin() + conjunct_index);
+    for (int i = predicate_idx->size() - 1; i >= 0; i--) {
+        int conjunct_index = (*predicate_idx)[i];
+        (*conjunct_ctxs)[conjunct_index]->close(state);
+        conjunct_ctxs->erase(conjunct_ctxs->begin() + conjunct_index);
     }
     return Status::OK();
 }
 
+// The number of sliced scrolls of a shard. A query with limit usually stops long before a shard is read up,
+// so the shard is not sliced then.
+static int num_slices_per_shard(int64_t limit) {
+    if (limit != -1) {
+        return 1;
+    }
+    return std::max(1, config::es_scroll_slices_per_shard);
+}
+
 Status EsHttpScanNode::_start_scan_thread(RuntimeState* state) {
-    _num_running_scanners = _scan_ranges.size();
-    _scanners_status.resize(_scan_ranges.size());
+    int num_slices = num_slices_per_shard(limit());
+    size_t num_scanners = _scan_ranges.size() * num_slices;
+    _num_running_scanners = num_scanners;
+    _scanners_status.resize(num_scanners);
 
     // create scanner
-    std::vector<std::unique_ptr<EsHttpScanner>> scanners(_scan_ranges.size());
-    for (int i = 0; i < _scan_ranges.size(); i++) {
-        RETURN_IF_ERROR(_create_scanner(i, &scanners[i]));
+    std::vector<std::unique_ptr<EsHttpScanner>> scanners(num_scanners);
+    for (int i = 0; i < num_scanners; i++) {
+        const TEsScanRange& es_scan_range = _scan_ranges[i / num_slices].scan_range.es_scan_range;
+        RETURN_IF_ERROR(create_scanner(state, runtime_profile(), es_scan_range, i % num_slices, num_slices,
+                                       _conjunct_ctxs, _predicates, &scanners[i]));
     }
 
     // start scan
     // TODO: use thread pool instead of new thread
-    for (int i = 0; i < _scan_ranges.size(); i++) {
+    for (int i = 0; i < num_scanners; i++) {
         _scanner_threads.emplace_back(&EsHttpScanNode::_scanner_scan, this, std::move(scanners[i]),
                                       std::ref(_scanners_status[i]));
     }
@@ -258,12 +278,22 @@ static std::string get_host_port(const std::vector<TNetworkAddress>& es_hosts) {
     return fmt::format("{}:{}", host.hostname, host.port);
 }
 
-Status EsHttpScanNode::_create_scanner(int scanner_idx, std::unique_ptr<EsHttpScanner>* res) {
+Status EsHttpScanNode::create_scanner(RuntimeState* state, RuntimeProfile* profile, const TEsScanRange& es_scan_range,
+                                      int slice_id, int num_slices, const std::vector<ExprContext*>& conjunct_ctxs,
+                                      const std::vector<EsPredicate*>& predicates,
+                                      std::unique_ptr<EsHttpScanner>* res) {
     std::vector<ExprContext*> scanner_expr_ctxs;
-    auto status = Expr::clone_if_not_exists(_conjunct_ctxs, runtime_state(), &scanner_expr_ctxs);
+    auto status = Expr::clone_if_not_exists(conjunct_ctxs, state, &scanner_expr_ctxs);
     RETURN_IF_ERROR(status);
 
-    const TEsScanRange& es_scan_range = _scan_ranges[scanner_idx].scan_range.es_scan_range;
+    std::vector<std::string> column_names;
+    for (auto slot_desc : state->desc_tbl().get_tuple_descriptor(_tuple_id)->slots()) {
+        if (!slot_desc->is_materialized()) {
+            continue;
+        }
+        column_names.push_back(slot_desc->col_name());
+    }
+
     std::map<std::string, std::string> properties(_properties);
 
     properties[ESScanReader::KEY_INDEX] = es_scan_range.index;
@@ -271,22 +301,63 @@ Status EsHttpScanNode::_create_scanner(int scanner_idx, std::unique_ptr<EsHttpSc
         properties[ESScanReader::KEY_TYPE] = es_scan_range.type;
     }
     properties[ESScanReader::KEY_SHARD] = std::to_string(es_scan_range.shard_id);
-    properties[ESScanReader::KEY_BATCH_SIZE] = std::to_string(runtime_state()->batch_size());
+    properties[ESScanReader::KEY_BATCH_SIZE] = std::to_string(state->batch_size());
     properties[ESScanReader::KEY_HOST_PORT] = get_host_port(es_scan_range.es_hosts);
     // push down limit to Elasticsearch
-    if (limit() != -1 && limit() <= runtime_state()->batch_size()) {
+    if (limit() != -1 && limit() <= state->batch_size()) {
         properties[ESScanReader::KEY_TERMINATE_AFTER] = std::to_string(limit());
+    } else if (num_slices > 1) {
+        properties[ESScanReader::KEY_SLICE_ID] = std::to_string(slice_id);
+        properties[ESScanReader::KEY_SLICE_MAX] = std::to_string(num_slices);
     }
 
     bool doc_value_mode = false;
     properties[ESScanReader::KEY_QUERY] =
-            ESScrollQueryBuilder::build(properties, _column_names, _predicates, _docvalue_context, &doc_value_mode);
+            ESScrollQueryBuilder::build(properties, column_names, predicates, _docvalue_context, &doc_value_mode);
 
-    *res = std::make_unique<EsHttpScanner>(runtime_state(), runtime_profile(), _tuple_id, std::move(properties),
-                                           scanner_expr_ctxs, _docvalue_context, doc_value_mode);
+    *res = std::make_unique<EsHttpScanner>(state, profile, _tuple_id, std::move(properties), scanner_expr_ctxs,
+                                           _docvalue_context, doc_value_mode);
     return Status::OK();
 }
 
+pipeline::Morsels EsHttpScanNode::convert_scan_range_to_morsel(const std::vector<TScanRangeParams>& scan_ranges,
+                                                               int node_id) {
+    int num_slices = num_slices_per_shard(limit());
+    pipeline::Morsels morsels;
+    for (const auto& scan_range : scan_ranges) {
+        for (int i = 0; i < num_slices; ++i) {
+            morsels.emplace_back(std::make_unique<pipeline::EsMorsel>(node_id, scan_range, i, num_slices));
+        }
+    }
+    return morsels;
+}
+
+pipeline::OpFactories EsHttpScanNode::decompose_to_pipeline(pipeline::PipelineBuilderContext* context) {
+    auto scan_operator = std::make_shared<pipeline::EsScanOperatorFactory>(context->next_operator_id(), id(), this,
+                                                                         std::move(_conjunct_ctxs));
+    // Initialize OperatorFactory's fields involving runtime filters.
+    auto rc_rf_probe_collector = std::make_shared<RcRfProbeCollector>(1, std::move(this->runtime_filter_collector()));
+    this->init_runtime_filter_for_operator(scan_operator.get(), context, rc_rf_probe_collector);
+
+    auto& morsel_queues = context->fragment_context()->morsel_queues();
+    auto source_id = scan_operator->plan_node_id();
+    DCHECK(morsel_queues.count(source_id));
+    auto& morsel_queue = morsel_queues[source_id];
+    // ScanOperator's degree_of_parallelism is not more than the number of morsels
+    // If table is empty, then morsel size is zero and we still set degree of parallelism to 1
+    const auto degree_of_parallelism =
+            std::min<size_t>(std::max<size_t>(1, morsel_queue->num_morsels()), context->degree_of_parallelism());
+    scan_operator->set_degree_of_parallelism(degree_of_parallelism);
+
+    pipeline::OpFactories operators;
+    operators.emplace_back(std::move(scan_operator));
+    if (limit() != -1) {
+        operators.emplace_back(
+                std::make_shared<pipeline::LimitOperatorFactory>(context->next_operator_id(), id(), limit()));
+    }
+    return operators;
+}
+
 void EsHttpScanNode::_scanner_scan(std::unique_ptr<EsHttpScanner> scanner, std::promise<Status>& p_status) {
     MemTracker* prev_tracker = tls_thread_status.set_mem_tracker(scanner->runtime_state()->instance_mem_tracker());
     DeferOp op([&] {
@@ -30,21 +30,37 @@ public:
 
     Status set_scan_ranges(const std::vector<TScanRangeParams>& scan_ranges) override;
 
+    // Each shard is split into es_scroll_slices_per_shard morsels, which are read by sliced scrolls.
+    pipeline::Morsels convert_scan_range_to_morsel(const std::vector<TScanRangeParams>& scan_ranges,
+                                                   int node_id) override;
+    pipeline::OpFactories decompose_to_pipeline(pipeline::PipelineBuilderContext* context) override;
+
+    // Push down the conjuncts that can be translated to ES query DSL to |predicates|, the pushed down
+    // ones are closed and removed from |conjunct_ctxs|.
+    Status push_down_conjuncts(RuntimeState* state, std::vector<ExprContext*>* conjunct_ctxs,
+                               std::vector<EsPredicate*>* predicates);
+    // Create the scanner reading the |slice_id|-th of the |num_slices| slices of |es_scan_range|,
+    // the conjuncts that are not pushed down are evaluated by the scanner.
+    Status create_scanner(RuntimeState* state, RuntimeProfile* profile, const TEsScanRange& es_scan_range,
+                          int slice_id, int num_slices, const std::vector<ExprContext*>& conjunct_ctxs,
+                          const std::vector<EsPredicate*>& predicates, std::unique_ptr<EsHttpScanner>* res);
+
 private:
     Status _acquire_status();
     void _update_status(const Status& new_status);
     Status start_scanners();
 
-    Status _build_conjuncts();
+    Status _build_conjuncts(RuntimeState* state, const std::vector<ExprContext*>& conjunct_ctxs,
+                            std::vector<EsPredicate*>* predicates, std::vector<int>* predicate_idx);
     // try to skip constant conjuncts is constant conjuncts
     // we will set eos to true if always false
-    void _try_skip_constant_conjuncts();
+    void _try_skip_constant_conjuncts(const std::vector<ExprContext*>& conjunct_ctxs);
 
     // validate predicate and remove expr that have been push down
-    Status _normalize_conjuncts();
+    Status _normalize_conjuncts(RuntimeState* state, std::vector<ExprContext*>* conjunct_ctxs,
+                                std::vector<EsPredicate*>* predicates, std::vector<int>* predicate_idx);
 
     Status _start_scan_thread(RuntimeState* state);
-    Status _create_scanner(int scanner_idx, std::unique_ptr<EsHttpScanner>* res);
     void _scanner_scan(std::unique_ptr<EsHttpScanner> scanner, std::promise<Status>& p_status);
     Status _acquire_chunks(EsHttpScanner* scanner);
 
@@ -68,10 +84,6 @@ private:
     std::map<std::string, std::string> _docvalue_context;
     std::map<std::string, std::string> _fields_context;
 
-    std::vector<std::string> _column_names;
-
-    // predicate index in the conjuncts
-    std::vector<int> _predicate_idx;
     // Predicates will push down to ES
     std::vector<EsPredicate*> _predicates;
 
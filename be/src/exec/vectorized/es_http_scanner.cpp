@@ -44,6 +44,8 @@ Status EsHttpScanner::open() {
     const std::string& host = _properties.at(ESScanReader::KEY_HOST_PORT);
     _es_reader = std::make_unique<ESScanReader>(host, _properties, _doc_value_mode);
     RETURN_IF_ERROR(_es_reader->open());
+    _es_scroll_parser = std::make_unique<ScrollParser>(_doc_value_mode);
+    _es_scroll_parser->set_params(_tuple_desc, &_docvalue_context);
 
     _rows_read_counter = ADD_COUNTER(_profile, "RowsRead", TUnit::UNIT);
     _read_timer = ADD_TIMER(_profile, "TotalRawReadTime(*)");
@@ -60,9 +62,8 @@ Status EsHttpScanner::get_next(RuntimeState* runtime_state, ChunkPtr* chunk, boo
 
     while (!_batch_eof) {
         RETURN_IF_CANCELLED(runtime_state);
-        if (_line_eof || _es_scroll_parser == nullptr) {
-            RETURN_IF_ERROR(_es_reader->get_next(&_batch_eof, _es_scroll_parser));
-            _es_scroll_parser->set_params(_tuple_desc, &_docvalue_context);
+        if (_line_eof) {
+            RETURN_IF_ERROR(_es_reader->get_next(&_batch_eof, _es_scroll_parser.get()));
             if (_batch_eof) {
                 *eos = true;
                 return Status::OK();
@@ -84,8 +84,17 @@ Status FileScanNode::start_scanners() {
     {
         std::unique_lock<std::mutex> l(_chunk_queue_lock);
 
-        _num_running_scanners = 1;
-        _scanner_threads.emplace_back(&FileScanNode::scanner_worker, this, 0, _scan_ranges.size());
+        if (_scan_ranges.size() > 1 && _all_stream_ranges()) {
+            // Stream ranges are pipes fed concurrently (e.g. routine load partitions fanned out to several
+            // pipes), they must be read in parallel, one scanner for each.
+            _num_running_scanners = _scan_ranges.size();
+            for (int i = 0; i < _scan_ranges.size(); ++i) {
+                _scanner_threads.emplace_back(&FileScanNode::scanner_worker, this, i, 1);
+            }
+        } else {
+            _num_running_scanners = 1;
+            _scanner_threads.emplace_back(&FileScanNode::scanner_worker, this, 0, _scan_ranges.size());
+        }
     }
     return Status::OK();
 }
@@ -188,6 +197,16 @@ Status FileScanNode::set_scan_ranges(const std::vector<TScanRangeParams>& scan_r
     return Status::OK();
 }
 
+bool FileScanNode::_all_stream_ranges() const {
+    for (const auto& scan_range : _scan_ranges) {
+        const auto& ranges = scan_range.scan_range.broker_scan_range.ranges;
+        if (ranges.empty() || ranges[0].file_type != TFileType::FILE_STREAM) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void FileScanNode::debug_string(int ident_level, std::stringstream* out) const {
     (*out) << "FileScanNode";
 }
@@ -69,6 +69,9 @@ private:
     // Create scanners to do scan job
     Status start_scanners();
 
+    // Whether all scan ranges are read from stream load pipes
+    bool _all_stream_ranges() const;
+
     // One scanner worker, This scanner will handle 'length' ranges start from start_idx
     void scanner_worker(int start_idx, int length);
 
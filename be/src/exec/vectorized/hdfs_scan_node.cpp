@@ -664,6 +664,11 @@ void HdfsScanNode::_init_counter(RuntimeState* state) {
     _group_chunk_read_timer = ADD_TIMER(_runtime_profile, "GroupChunkRead");
     _group_dict_filter_timer = ADD_TIMER(_runtime_profile, "GroupDictFilter");
     _group_dict_decode_timer = ADD_TIMER(_runtime_profile, "GroupDictDecode");
+
+    // late materialization and page index
+    _late_materialize_skip_rows = ADD_COUNTER(_runtime_profile, "LateMaterializeSkipRows", TUnit::UNIT);
+    _page_index_filter_rows = ADD_COUNTER(_runtime_profile, "PageIndexFilterRows", TUnit::UNIT);
+    _skip_page_counter = ADD_COUNTER(_runtime_profile, "SkipPageCount", TUnit::UNIT);
 }
 
 } // namespace starrocks::vectorized
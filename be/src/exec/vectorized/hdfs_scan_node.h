@@ -186,5 +186,10 @@ private:
     RuntimeProfile::Counter* _group_chunk_read_timer = nullptr;
     RuntimeProfile::Counter* _group_dict_filter_timer = nullptr;
     RuntimeProfile::Counter* _group_dict_decode_timer = nullptr;
+
+    // late materialization and page index
+    RuntimeProfile::Counter* _late_materialize_skip_rows = nullptr;
+    RuntimeProfile::Counter* _page_index_filter_rows = nullptr;
+    RuntimeProfile::Counter* _skip_page_counter = nullptr;
 };
 } // namespace starrocks::vectorized
@@ -244,6 +244,9 @@ void HdfsParquetScanner::update_counter() {
     COUNTER_UPDATE(_scanner_params.parent->_group_chunk_read_timer, _stats.group_chunk_read_ns);
     COUNTER_UPDATE(_scanner_params.parent->_group_dict_filter_timer, _stats.group_dict_filter_ns);
     COUNTER_UPDATE(_scanner_params.parent->_group_dict_decode_timer, _stats.group_dict_decode_ns);
+    COUNTER_UPDATE(_scanner_params.parent->_late_materialize_skip_rows, _stats.late_materialize_skip_rows);
+    COUNTER_UPDATE(_scanner_params.parent->_page_index_filter_rows, _stats.page_index_filter_rows);
+    COUNTER_UPDATE(_scanner_params.parent->_skip_page_counter, _stats.skip_page_count);
 #endif
 }
 
@@ -36,6 +36,10 @@ struct HdfsScanStats {
     int64_t group_chunk_read_ns = 0;
     int64_t group_dict_filter_ns = 0;
     int64_t group_dict_decode_ns = 0;
+    // late materialization and page index
+    int64_t late_materialize_skip_rows = 0;
+    int64_t page_index_filter_rows = 0;
+    int64_t skip_page_count = 0;
 };
 
 struct HdfsScannerParams {
@@ -327,6 +327,7 @@ void HdfsOrcScanner::update_counter() {
     COUNTER_UPDATE(_scanner_params.parent->_column_convert_timer, _stats.column_convert_ns);
     COUNTER_UPDATE(_scanner_params.parent->_value_decode_timer, _stats.value_decode_ns);
     COUNTER_UPDATE(_scanner_params.parent->_level_decode_timer, _stats.level_decode_ns);
+    COUNTER_UPDATE(_scanner_params.parent->_late_materialize_skip_rows, _stats.late_materialize_skip_rows);
 #endif
 }
 
@@ -380,6 +381,22 @@ Status HdfsOrcScanner::do_open(RuntimeState* runtime_state) {
         _orc_adapter->set_conjuncts_and_runtime_filters(conjuncts, _scanner_params.runtime_filter_collector);
     }
     _orc_adapter->set_hive_column_names(_scanner_params.hive_column_names);
+    if (config::orc_late_materialization_enable) {
+        // the columns without conjuncts are only read for the rows that pass the conjuncts.
+        // complex columns are always read, because their column vector batches can't be filtered.
+        std::unordered_set<SlotId> lazy_load_slot_ids;
+        bool has_conjunct_slot = false;
+        for (SlotDescriptor* slot : _src_slot_descriptors) {
+            if (_file_read_param.conjunct_ctxs_by_slot.count(slot->id()) > 0) {
+                has_conjunct_slot = true;
+            } else if (!slot->type().is_complex_type()) {
+                lazy_load_slot_ids.insert(slot->id());
+            }
+        }
+        if (has_conjunct_slot) {
+            _orc_adapter->set_lazy_load_slot_ids(lazy_load_slot_ids);
+        }
+    }
     RETURN_IF_ERROR(_orc_adapter->init(std::move(reader)));
     return Status::OK();
 }
@@ -426,6 +443,9 @@ Status HdfsOrcScanner::do_get_next(RuntimeState* runtime_state, ChunkPtr* chunk)
     _file_read_param.append_partition_column_to_chunk(chunk, ck->num_rows());
     // do stats before we filter rows which does not match.
     _stats.raw_rows_read += ck->num_rows();
+    if (_orc_adapter->has_lazy_load_columns()) {
+        return _filter_and_lazy_read(chunk);
+    }
     for (auto& it : _file_read_param.conjunct_ctxs_by_slot) {
         // do evaluation.
         SCOPED_RAW_TIMER(&_stats.expr_filter_ns);
@@ -440,6 +460,27 @@ Status HdfsOrcScanner::do_get_next(RuntimeState* runtime_state, ChunkPtr* chunk)
     return Status::OK();
 }
 
+Status HdfsOrcScanner::_filter_and_lazy_read(ChunkPtr* chunk) {
+    // evaluate all conjuncts to get the filter of rows, and read the lazy load columns of the selected rows.
+    std::vector<ExprContext*> conjunct_ctxs;
+    for (auto& it : _file_read_param.conjunct_ctxs_by_slot) {
+        if (!_orc_row_reader_filter->is_slot_evaluated(it.first)) {
+            conjunct_ctxs.insert(conjunct_ctxs.end(), it.second.begin(), it.second.end());
+        }
+    }
+    FilterPtr filter;
+    if (!conjunct_ctxs.empty()) {
+        SCOPED_RAW_TIMER(&_stats.expr_filter_ns);
+        ExecNode::eval_conjuncts(conjunct_ctxs, chunk->get(), &filter);
+    }
+    {
+        SCOPED_RAW_TIMER(&_stats.column_read_ns);
+        RETURN_IF_ERROR(_orc_adapter->lazy_read_next(chunk, filter.get()));
+    }
+    _stats.late_materialize_skip_rows += _orc_adapter->get_lazy_load_skip_rows();
+    return Status::OK();
+}
+
 Status HdfsOrcScanner::do_init(RuntimeState* runtime_state, const HdfsScannerParams& scanner_params) {
     _should_skip_file = false;
     _use_orc_sargs = true;
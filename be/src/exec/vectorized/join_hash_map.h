@@ -11,6 +11,7 @@
 #include "column/chunk.h"
 #include "column/column_hash.h"
 #include "column/column_helper.h"
+#include "column/german_string.h"
 #include "util/phmap/phmap.h"
 
 #if defined(__aarch64__)
@@ -88,6 +89,8 @@ struct JoinHashTableItems {
     Buffer<uint32_t> first;
     Buffer<uint32_t> next;
     Buffer<Slice> build_slice;
+    // the GermanString views of the single string key column
+    Buffer<GermanString> build_german_keys;
     ColumnPtr build_key_column;
     uint32_t bucket_size = 0;
     uint32_t row_count = 0; // real row count
@@ -117,6 +120,7 @@ struct HashTableProbeState {
     Buffer<uint32_t> probe_index;
     Buffer<uint32_t> next;
     Buffer<Slice> probe_slice;
+    Buffer<GermanString> probe_german_keys;
     Buffer<uint8_t>* null_array = nullptr;
     ColumnPtr probe_key_column;
     const Columns* key_columns = nullptr;
@@ -203,6 +207,7 @@ struct JoinKeyEqual<Slice> {
     bool operator()(const Slice& x, const Slice& y) const {
         return (x.size == y.size) && (memcmp(x.data, y.data, x.size) == 0);
     }
+    bool operator()(const GermanString& x, const GermanString& y) const { return x == y; }
 };
 
 class JoinHashMapHelper {
@@ -285,6 +290,29 @@ public:
     static Status construct_hash_table(JoinHashTableItems* table_items, HashTableProbeState* probe_state);
 };
 
+// The keys of a single string key column are compared by their GermanString views, so that most of
+// the mismatched keys in a bucket are skipped without accessing the string data of the build side.
+template <PrimitiveType PT>
+class StringJoinBuildFunc {
+public:
+    using CppType = typename RunTimeTypeTraits<PT>::CppType;
+    using ColumnType = typename RunTimeTypeTraits<PT>::ColumnType;
+
+    static Status prepare(RuntimeState* runtime, JoinHashTableItems* table_items, HashTableProbeState* probe_state) {
+        return JoinBuildFunc<PT>::prepare(runtime, table_items, probe_state);
+    }
+
+    static const Buffer<GermanString>& get_key_data(const JoinHashTableItems& table_items) {
+        return table_items.build_german_keys;
+    }
+
+    static Status construct_hash_table(JoinHashTableItems* table_items, HashTableProbeState* probe_state) {
+        RETURN_IF_ERROR(JoinBuildFunc<PT>::construct_hash_table(table_items, probe_state));
+        build_german_strings(JoinBuildFunc<PT>::get_key_data(*table_items), &table_items->build_german_keys);
+        return Status::OK();
+    }
+};
+
 template <PrimitiveType PT>
 class FixedSizeJoinBuildFunc {
 public:
@@ -335,6 +363,27 @@ public:
     static const Buffer<CppType>& get_key_data(const HashTableProbeState& probe_state);
 };
 
+template <PrimitiveType PT>
+class StringJoinProbeFunc {
+public:
+    using CppType = typename RunTimeTypeTraits<PT>::CppType;
+    using ColumnType = typename RunTimeTypeTraits<PT>::ColumnType;
+
+    static void prepare(JoinHashTableItems* table_items, HashTableProbeState* probe_state) {
+        JoinProbeFunc<PT>::prepare(table_items, probe_state);
+    }
+
+    static Status lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state) {
+        RETURN_IF_ERROR(JoinProbeFunc<PT>::lookup_init(table_items, probe_state));
+        build_german_strings(JoinProbeFunc<PT>::get_key_data(*probe_state), &probe_state->probe_german_keys);
+        return Status::OK();
+    }
+
+    static const Buffer<GermanString>& get_key_data(const HashTableProbeState& probe_state) {
+        return probe_state.probe_german_keys;
+    }
+};
+
 template <PrimitiveType PT>
 class FixedSizeJoinProbeFunc {
 public:
@@ -384,6 +433,8 @@ template <PrimitiveType PT, class BuildFunc, class ProbeFunc>
 class JoinHashMap {
 public:
     using CppType = typename RunTimeTypeTraits<PT>::CppType;
+    // the buffer of the keys compared in the hash table, which is Buffer<CppType> except for string keys
+    using KeyBuffer = std::decay_t<decltype(BuildFunc::get_key_data(std::declval<const JoinHashTableItems&>()))>;
 
     explicit JoinHashMap(JoinHashTableItems* table_items, HashTableProbeState* probe_state)
             : _table_items(table_items), _probe_state(probe_state) {}
@@ -413,80 +464,81 @@ private:
     void _search_ht_remain();
 
     template <bool first_probe>
-    void _search_ht_impl(const Buffer<CppType>& build_data, const Buffer<CppType>& data);
+    void _search_ht_impl(const KeyBuffer& build_data, const KeyBuffer& data);
 
     // for one key inner join
     template <bool first_probe>
-    void _probe_from_ht(const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
+    void _probe_from_ht(const KeyBuffer& build_data, const KeyBuffer& probe_data);
 
     // for one key left outer join
     template <bool first_probe>
-    void _probe_from_ht_for_left_outer_join(const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_left_outer_join(const KeyBuffer& build_data, const KeyBuffer& probe_data);
 
     // for one key left semi join
     template <bool first_probe>
-    void _probe_from_ht_for_left_semi_join(const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_left_semi_join(const KeyBuffer& build_data, const KeyBuffer& probe_data);
 
     // for one key left anti join
     template <bool first_probe>
-    void _probe_from_ht_for_left_anti_join(const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_left_anti_join(const KeyBuffer& build_data, const KeyBuffer& probe_data);
 
     // for one key right outer join
     template <bool first_probe>
-    void _probe_from_ht_for_right_outer_join(const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_right_outer_join(const KeyBuffer& build_data, const KeyBuffer& probe_data);
 
     // for one key right semi join
     template <bool first_probe>
-    void _probe_from_ht_for_right_semi_join(const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_right_semi_join(const KeyBuffer& build_data, const KeyBuffer& probe_data);
 
     // for one key right anti join
     template <bool first_probe>
-    void _probe_from_ht_for_right_anti_join(const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_right_anti_join(const KeyBuffer& build_data, const KeyBuffer& probe_data);
 
     // for one key full outer join
     template <bool first_probe>
-    void _probe_from_ht_for_full_outer_join(const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_full_outer_join(const KeyBuffer& build_data, const KeyBuffer& probe_data);
 
     // for left outer join with other join conjunct
     template <bool first_probe>
-    void _probe_from_ht_for_left_outer_join_with_other_conjunct(const Buffer<CppType>& build_data,
-                                                                const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_left_outer_join_with_other_conjunct(const KeyBuffer& build_data,
+                                                                const KeyBuffer& probe_data);
 
     // for left semi join with other join conjunct
     template <bool first_probe>
-    void _probe_from_ht_for_left_semi_join_with_other_conjunct(const Buffer<CppType>& build_data,
-                                                               const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_left_semi_join_with_other_conjunct(const KeyBuffer& build_data,
+                                                               const KeyBuffer& probe_data);
 
     // for left anti join with other join conjunct
     template <bool first_probe>
-    void _probe_from_ht_for_left_anti_join_with_other_conjunct(const Buffer<CppType>& build_data,
-                                                               const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_left_anti_join_with_other_conjunct(const KeyBuffer& build_data,
+                                                               const KeyBuffer& probe_data);
 
     // for one key right outer join with other conjunct
     template <bool first_probe>
-    void _probe_from_ht_for_right_outer_join_with_other_conjunct(const Buffer<CppType>& build_data,
-                                                                 const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_right_outer_join_with_other_conjunct(const KeyBuffer& build_data,
+                                                                 const KeyBuffer& probe_data);
 
     // for one key right semi join with other join conjunct
     template <bool first_probe>
-    void _probe_from_ht_for_right_semi_join_with_other_conjunct(const Buffer<CppType>& build_data,
-                                                                const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_right_semi_join_with_other_conjunct(const KeyBuffer& build_data,
+                                                                const KeyBuffer& probe_data);
 
     // for one key right anti join with other join conjunct
     template <bool first_probe>
-    void _probe_from_ht_for_right_anti_join_with_other_conjunct(const Buffer<CppType>& build_data,
-                                                                const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_right_anti_join_with_other_conjunct(const KeyBuffer& build_data,
+                                                                const KeyBuffer& probe_data);
 
     // for one key full outer join with other join conjunct
     template <bool first_probe>
-    void _probe_from_ht_for_full_outer_join_with_other_conjunct(const Buffer<CppType>& build_data,
-                                                                const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_full_outer_join_with_other_conjunct(const KeyBuffer& build_data,
+                                                                const KeyBuffer& probe_data);
 
     JoinHashTableItems* _table_items = nullptr;
     HashTableProbeState* _probe_state = nullptr;
 };
 
 #define JoinHashMapForOneKey(PT) JoinHashMap<PT, JoinBuildFunc<PT>, JoinProbeFunc<PT>>
+#define JoinHashMapForStringKey(PT) JoinHashMap<PT, StringJoinBuildFunc<PT>, StringJoinProbeFunc<PT>>
 #define JoinHashMapForFixedSizeKey(PT) JoinHashMap<PT, FixedSizeJoinBuildFunc<PT>, FixedSizeJoinProbeFunc<PT>>
 #define JoinHashMapForSerializedKey(PT) JoinHashMap<PT, SerializedJoinBuildFunc, SerializedJoinProbeFunc>
 
@@ -529,6 +581,7 @@ public:
             usage += _table_items.build_key_column->memory_usage();
         }
         usage += _table_items.build_slice.size() * sizeof(Slice);
+        usage += _table_items.build_german_keys.size() * sizeof(GermanString);
         return usage;
     }
 
@@ -552,7 +605,7 @@ private:
     std::unique_ptr<JoinHashMapForOneKey(TYPE_LARGEINT)> _key128 = nullptr;
     std::unique_ptr<JoinHashMapForOneKey(TYPE_FLOAT)> _keyfloat = nullptr;
     std::unique_ptr<JoinHashMapForOneKey(TYPE_DOUBLE)> _keydouble = nullptr;
-    std::unique_ptr<JoinHashMapForOneKey(TYPE_VARCHAR)> _keystring = nullptr;
+    std::unique_ptr<JoinHashMapForStringKey(TYPE_VARCHAR)> _keystring = nullptr;
     std::unique_ptr<JoinHashMapForOneKey(TYPE_DATE)> _keydate = nullptr;
     std::unique_ptr<JoinHashMapForOneKey(TYPE_DATETIME)> _keydatetime = nullptr;
     std::unique_ptr<JoinHashMapForOneKey(TYPE_DECIMALV2)> _keydecimal = nullptr;
@@ -20,6 +20,7 @@
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
 #include "runtime/primitive_type.h"
+#include "storage/storage_engine.h"
 #include "storage/vectorized/chunk_helper.h"
 #include "util/defer_op.h"
 #include "util/priority_thread_pool.hpp"
@@ -340,6 +341,13 @@ Status OlapScanNode::_start_scan(RuntimeState* state) {
     cm.key_column_names = &_olap_scan_node.key_column_name;
     cm.runtime_filters = &_runtime_filter_collector;
     cm.runtime_state = state;
+    if (!_scan_ranges.empty()) {
+        std::string err;
+        TTabletId tablet_id = _scan_ranges[0]->tablet_id;
+        _schema_tablet = StorageEngine::instance()->tablet_manager()->get_tablet(tablet_id, true, &err);
+        // LIKE isn't pushed down without the schema, and the scanners will report the error.
+        cm.tablet_schema = _schema_tablet != nullptr ? &_schema_tablet->tablet_schema() : nullptr;
+    }
 
     const TQueryOptions& query_options = state->query_options();
     int32_t max_scan_key_num;
@@ -378,6 +386,8 @@ void OlapScanNode::_init_counter(RuntimeState* state) {
     _seg_init_timer = ADD_TIMER(_scan_profile, "SegmentInit");
     _bi_filter_timer = ADD_CHILD_TIMER(_scan_profile, "BitmapIndexFilter", "SegmentInit");
     _bi_filtered_counter = ADD_CHILD_COUNTER(_scan_profile, "BitmapIndexFilterRows", TUnit::UNIT, "SegmentInit");
+    _ii_filter_timer = ADD_CHILD_TIMER(_scan_profile, "InvertedIndexFilter", "SegmentInit");
+    _ii_filtered_counter = ADD_CHILD_COUNTER(_scan_profile, "InvertedIndexFilterRows", TUnit::UNIT, "SegmentInit");
     _bf_filtered_counter = ADD_CHILD_COUNTER(_scan_profile, "BloomFilterFilterRows", TUnit::UNIT, "SegmentInit");
     _seg_zm_filtered_counter = ADD_CHILD_COUNTER(_scan_profile, "SegmentZoneMapFilterRows", TUnit::UNIT, "SegmentInit");
     _zm_filtered_counter = ADD_CHILD_COUNTER(_scan_profile, "ZoneMapIndexFilterRows", TUnit::UNIT, "SegmentInit");
@@ -549,8 +559,8 @@ pipeline::OpFactories OlapScanNode::decompose_to_pipeline(pipeline::PipelineBuil
     OpFactories operators;
     // Create a shared RefCountedRuntimeFilterCollector
     auto&& rc_rf_probe_collector = std::make_shared<RcRfProbeCollector>(1, std::move(this->runtime_filter_collector()));
-    auto scan_operator = std::make_shared<ScanOperatorFactory>(context->next_operator_id(), id(), _olap_scan_node,
-                                                               std::move(_conjunct_ctxs), limit());
+    auto scan_operator = std::make_shared<OlapScanOperatorFactory>(
+            context->next_operator_id(), id(), _olap_scan_node, std::move(_conjunct_ctxs), limit());
     // Initialize OperatorFactory's fields involving runtime filters.
     this->init_runtime_filter_for_operator(scan_operator.get(), context, rc_rf_probe_collector);
     auto& morsel_queues = context->fragment_context()->morsel_queues();
@@ -112,6 +112,8 @@ private:
     RuntimeState* _runtime_state = nullptr;
     TupleDescriptor* _tuple_desc = nullptr;
     OlapScanConjunctsManager _conjuncts_manager;
+    // The tablet whose schema is referenced by |_conjuncts_manager|, all the scanned tablets share the schema.
+    TabletSharedPtr _schema_tablet;
     DictOptimizeParser _dict_optimize_parser;
     const Schema* _chunk_schema = nullptr;
     ObjectPool _obj_pool;
@@ -167,6 +169,8 @@ private:
     RuntimeProfile::Counter* _cached_pages_num_counter = nullptr;
     RuntimeProfile::Counter* _bi_filtered_counter = nullptr;
     RuntimeProfile::Counter* _bi_filter_timer = nullptr;
+    RuntimeProfile::Counter* _ii_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _ii_filter_timer = nullptr;
     RuntimeProfile::Counter* _pushdown_predicates_counter = nullptr;
     RuntimeProfile::Counter* _rowsets_read_count = nullptr;
     RuntimeProfile::Counter* _segments_read_count = nullptr;
@@ -6,8 +6,10 @@
 #include "exprs/vectorized/in_const_predicate.hpp"
 #include "gutil/map_util.h"
 #include "runtime/date_value.hpp"
+#include "storage/tablet_schema.h"
 #include "storage/vectorized/column_predicate.h"
 #include "storage/vectorized/predicate_parser.h"
+#include "storage/vectorized/predicate_tree.h"
 
 namespace starrocks {
 namespace vectorized {
@@ -464,6 +466,218 @@ void OlapScanConjunctsManager::normalize_is_null_predicate(const SlotDescriptor&
     }
 }
 
+void OlapScanConjunctsManager::normalize_match_predicate(const SlotDescriptor& slot) {
+    const auto& conjunct_ctxs = (*conjunct_ctxs_ptr);
+
+    for (size_t i = 0; i < conjunct_ctxs.size(); i++) {
+        if (normalized_conjuncts[i]) {
+            continue;
+        }
+        Expr* root_expr = conjunct_ctxs[i]->root();
+        if (TExprNodeType::FUNCTION_CALL != root_expr->node_type() || root_expr->get_num_children() != 2) {
+            continue;
+        }
+        const std::string& fn_name = root_expr->fn().name.function_name;
+        if (fn_name != "match_any" && fn_name != "match_all") {
+            continue;
+        }
+        Expr* l = root_expr->get_child(0);
+        Expr* r = root_expr->get_child(1);
+        if (l->node_type() != TExprNodeType::SLOT_REF || !r->is_constant()) {
+            continue;
+        }
+        std::vector<SlotId> slot_ids;
+        if (1 != l->get_slot_ids(&slot_ids) || slot_ids[0] != slot.id()) {
+            continue;
+        }
+        ColumnPtr column_ptr = conjunct_ctxs[i]->evaluate(r, nullptr);
+        if (column_ptr == nullptr || column_ptr->only_null() || column_ptr->is_null(0)) {
+            continue;
+        }
+        ColumnPtr data = column_ptr;
+        if (column_ptr->is_nullable()) {
+            data = down_cast<NullableColumn*>(column_ptr.get())->data_column();
+        } else if (column_ptr->is_constant()) {
+            data = down_cast<ConstColumn*>(column_ptr.get())->data_column();
+        }
+        const Slice* query = reinterpret_cast<const Slice*>(data->raw_data());
+
+        TCondition match;
+        match.column_name = slot.col_name();
+        match.condition_op = fn_name;
+        match.condition_values.emplace_back(query->data, query->size);
+        match_vector.emplace_back(std::move(match));
+        normalized_conjuncts[i] = true;
+    }
+}
+
+template <PrimitiveType SlotType, typename RangeValueType>
+bool OlapScanConjunctsManager::normalize_index_condition(const SlotDescriptor& slot, const Expr* expr,
+                                                         ExprContext* ctx, TCondition* condition) {
+    using ValueType = typename RunTimeTypeTraits<SlotType>::CppType;
+    const TypeDescriptor& type = slot.type();
+    condition->column_name = slot.col_name();
+
+    // `col op value`, `NE` is not supported by bitmap indexes.
+    if (TExprNodeType::BINARY_PRED == expr->node_type()) {
+        if (expr->op() == TExprOpcode::NE || expr->op() == TExprOpcode::EQ_FOR_NULL) {
+            return false;
+        }
+        Status status;
+        SQLFilterOp op;
+        ValueType value;
+        if (!get_predicate_value(obj_pool, slot, expr, ctx, &value, &op, &status)) {
+            return false;
+        }
+        switch (op) {
+        case FILTER_IN:
+            condition->condition_op = "*=";
+            break;
+        case FILTER_LARGER:
+            condition->condition_op = ">>";
+            break;
+        case FILTER_LARGER_OR_EQUAL:
+            condition->condition_op = ">=";
+            break;
+        case FILTER_LESS:
+            condition->condition_op = "<<";
+            break;
+        case FILTER_LESS_OR_EQUAL:
+            condition->condition_op = "<=";
+            break;
+        default:
+            return false;
+        }
+        condition->condition_values.emplace_back(
+                cast_to_string(static_cast<RangeValueType>(value), type.type, type.precision, type.scale));
+        return true;
+    }
+
+    // `col IN (v1, v2, v3)`
+    if (TExprNodeType::IN_PRED == expr->node_type() && TExprOpcode::FILTER_IN == expr->op()) {
+        const Expr* l = expr->get_child(0);
+        if (l->node_type() != TExprNodeType::SLOT_REF || (l->type().type != type.type && !ignore_cast(slot, *l))) {
+            return false;
+        }
+        const auto* pred = down_cast<const VectorizedInConstPredicate<SlotType>*>(expr);
+        if (pred->is_not_in() || pred->null_in_set() || pred->hash_set().empty() ||
+            pred->hash_set().size() > config::max_pushdown_conditions_per_column) {
+            return false;
+        }
+        condition->condition_op = "*=";
+        for (const auto& value : pred->hash_set()) {
+            condition->condition_values.emplace_back(
+                    cast_to_string(static_cast<RangeValueType>(value), type.type, type.precision, type.scale));
+        }
+        return true;
+    }
+
+    // `col IS NULL`, `IS NOT NULL` is not supported by bitmap indexes.
+    std::string is_null_str;
+    if (TExprNodeType::FUNCTION_CALL == expr->node_type() && expr->is_null_scalar_function(is_null_str)) {
+        if (is_null_str != "null" || expr->get_child(0)->node_type() != TExprNodeType::SLOT_REF) {
+            return false;
+        }
+        condition->condition_op = "is";
+        condition->condition_values.emplace_back(std::move(is_null_str));
+        return true;
+    }
+    return false;
+}
+
+bool OlapScanConjunctsManager::normalize_index_condition(const Expr* expr, ExprContext* ctx,
+                                                         TCondition* condition) {
+    std::vector<SlotId> slot_ids;
+    if (expr->get_slot_ids(&slot_ids) != 1) {
+        return false;
+    }
+    const SlotDescriptor* slot = nullptr;
+    for (const SlotDescriptor* s : tuple_desc->decoded_slots()) {
+        if (s->id() == slot_ids[0]) {
+            slot = s;
+            break;
+        }
+    }
+    if (slot == nullptr) {
+        return false;
+    }
+
+    // the same value types as `normalize_conjuncts`.
+    switch (slot->type().type) {
+    case TYPE_TINYINT:
+        return normalize_index_condition<TYPE_TINYINT, int32_t>(*slot, expr, ctx, condition);
+    case TYPE_BOOLEAN:
+        return normalize_index_condition<TYPE_BOOLEAN, int32_t>(*slot, expr, ctx, condition);
+    case TYPE_SMALLINT:
+        return normalize_index_condition<TYPE_SMALLINT, int16_t>(*slot, expr, ctx, condition);
+    case TYPE_INT:
+        return normalize_index_condition<TYPE_INT, int32_t>(*slot, expr, ctx, condition);
+    case TYPE_BIGINT:
+        return normalize_index_condition<TYPE_BIGINT, int64_t>(*slot, expr, ctx, condition);
+    case TYPE_LARGEINT:
+        return normalize_index_condition<TYPE_LARGEINT, int128_t>(*slot, expr, ctx, condition);
+    case TYPE_CHAR:
+        [[fallthrough]];
+    case TYPE_VARCHAR:
+        return normalize_index_condition<TYPE_VARCHAR, Slice>(*slot, expr, ctx, condition);
+    case TYPE_DATE:
+        return normalize_index_condition<TYPE_DATE, DateValue>(*slot, expr, ctx, condition);
+    case TYPE_DATETIME:
+        return normalize_index_condition<TYPE_DATETIME, TimestampValue>(*slot, expr, ctx, condition);
+    case TYPE_DECIMALV2:
+        return normalize_index_condition<TYPE_DECIMALV2, DecimalV2Value>(*slot, expr, ctx, condition);
+    case TYPE_DECIMAL32:
+        return normalize_index_condition<TYPE_DECIMAL32, int32_t>(*slot, expr, ctx, condition);
+    case TYPE_DECIMAL64:
+        return normalize_index_condition<TYPE_DECIMAL64, int64_t>(*slot, expr, ctx, condition);
+    case TYPE_DECIMAL128:
+        return normalize_index_condition<TYPE_DECIMAL128, int128_t>(*slot, expr, ctx, condition);
+    default:
+        return false;
+    }
+}
+
+bool OlapScanConjunctsManager::normalize_condition_tree(const Expr* expr, ExprContext* ctx, ConditionTree* tree) {
+    if (TExprNodeType::COMPOUND_PRED != expr->node_type()) {
+        return normalize_index_condition(expr, ctx, &tree->condition);
+    }
+    if (expr->op() != TExprOpcode::COMPOUND_AND && expr->op() != TExprOpcode::COMPOUND_OR) {
+        return false;
+    }
+    tree->is_or = (expr->op() == TExprOpcode::COMPOUND_OR);
+    for (int i = 0; i < expr->get_num_children(); i++) {
+        ConditionTree child;
+        if (normalize_condition_tree(expr->get_child(i), ctx, &child)) {
+            tree->children.emplace_back(std::move(child));
+        } else if (tree->is_or) {
+            return false;
+        }
+        // Dropping a child of AND makes the tree select more rows, which is fine for index filtering.
+    }
+    if (tree->children.empty()) {
+        return false;
+    }
+    if (tree->children.size() == 1) {
+        ConditionTree child = std::move(tree->children[0]);
+        *tree = std::move(child);
+    }
+    return true;
+}
+
+void OlapScanConjunctsManager::normalize_or_predicates() {
+    or_condition_trees.clear();
+    for (ExprContext* ctx : *conjunct_ctxs_ptr) {
+        const Expr* root_expr = ctx->root();
+        if (TExprNodeType::COMPOUND_PRED != root_expr->node_type() || TExprOpcode::COMPOUND_OR != root_expr->op()) {
+            continue;
+        }
+        ConditionTree tree;
+        if (normalize_condition_tree(root_expr, ctx, &tree)) {
+            or_condition_trees.emplace_back(std::move(tree));
+        }
+    }
+}
+
 template <PrimitiveType SlotType, typename RangeValueType>
 void OlapScanConjunctsManager::normalize_predicate(const SlotDescriptor& slot,
                                                    ColumnValueRange<RangeValueType>* range) {
@@ -557,6 +771,7 @@ Status OlapScanConjunctsManager::normalize_conjuncts() {
             ColumnValueRangeType& v = LookupOrInsert(&column_value_ranges, col_name, full_range);
             RangeType& range = boost::get<ColumnValueRange<Slice>>(v);
             normalize_predicate<TYPE_VARCHAR, Slice>(*slot, &range);
+            normalize_match_predicate(*slot);
             break;
         }
         case TYPE_DATE: {
@@ -727,6 +942,10 @@ void OlapScanConjunctsManager::get_column_predicates(PredicateParser* parser,
         std::unique_ptr<ColumnPredicate> p(parser->parse_thrift_cond(f));
         preds->emplace_back(std::move(p));
     }
+    for (auto& f : match_vector) {
+        std::unique_ptr<ColumnPredicate> p(parser->parse_thrift_cond(f));
+        preds->emplace_back(std::move(p));
+    }
 
     const auto& slots = tuple_desc->decoded_slots();
     for (auto& iter : slot_index_to_expr_ctxs) {
@@ -740,6 +959,52 @@ void OlapScanConjunctsManager::get_column_predicates(PredicateParser* parser,
     }
 }
 
+static bool build_predicate_tree(PredicateParser* parser, const ConditionTree& cond_tree, PredicateTree* tree,
+                                 std::vector<std::unique_ptr<ColumnPredicate>>* preds) {
+    if (cond_tree.is_leaf()) {
+        std::unique_ptr<ColumnPredicate> p(parser->parse_thrift_cond(cond_tree.condition));
+        // the value columns of aggregate tables can't be filtered before aggregation.
+        if (p == nullptr || !parser->can_pushdown(p.get())) {
+            return false;
+        }
+        *tree = PredicateTree(p.get());
+        preds->emplace_back(std::move(p));
+        return true;
+    }
+    std::vector<PredicateTree> children;
+    for (const ConditionTree& cond_child : cond_tree.children) {
+        PredicateTree child;
+        if (build_predicate_tree(parser, cond_child, &child, preds)) {
+            children.emplace_back(std::move(child));
+        } else if (cond_tree.is_or) {
+            return false;
+        }
+    }
+    if (children.empty()) {
+        return false;
+    }
+    if (children.size() == 1) {
+        *tree = std::move(children[0]);
+    } else {
+        auto type = cond_tree.is_or ? PredicateTree::Type::kOr : PredicateTree::Type::kAnd;
+        *tree = PredicateTree(type, std::move(children));
+    }
+    return true;
+}
+
+void OlapScanConjunctsManager::get_predicate_trees(PredicateParser* parser, std::vector<PredicateTree>* trees,
+                                                   std::vector<std::unique_ptr<ColumnPredicate>>* preds) {
+    if (!config::bitmap_filter_enable_or) {
+        return;
+    }
+    for (const ConditionTree& cond_tree : or_condition_trees) {
+        PredicateTree tree;
+        if (build_predicate_tree(parser, cond_tree, &tree, preds)) {
+            trees->emplace_back(std::move(tree));
+        }
+    }
+}
+
 void OlapScanConjunctsManager::eval_const_conjuncts(const std::vector<ExprContext*>& conjunct_ctxs, Status* status) {
     *status = Status::OK();
     for (const auto& ctx_iter : conjunct_ctxs) {
@@ -775,7 +1040,19 @@ void OlapScanConjunctsManager::get_not_push_down_conjuncts(std::vector<ExprConte
     }
 }
 
-void OlapScanConjunctsManager::build_column_expr_predicates() {
+static bool is_like_constant_pattern(const Expr* root) {
+    return root->node_type() == TExprNodeType::FUNCTION_CALL && root->fn().name.function_name == "like" &&
+           root->get_num_children() == 2 && root->get_child(0)->node_type() == TExprNodeType::SLOT_REF &&
+           root->get_child(1)->is_constant();
+}
+
+bool OlapScanConjunctsManager::has_ngram_bf_index(const std::string& col_name) const {
+    if (tablet_schema == nullptr) return false;
+    int32_t index = tablet_schema->field_index(col_name);
+    return index >= 0 && tablet_schema->column(index).has_ngram_bf_index();
+}
+
+void OlapScanConjunctsManager::build_column_expr_predicates(bool like_only) {
     std::map<SlotId, int> slot_id_to_index;
     const auto& slots = tuple_desc->decoded_slots();
     for (int i = 0; i < slots.size(); i++) {
@@ -803,6 +1080,10 @@ void OlapScanConjunctsManager::build_column_expr_predicates() {
         const SlotDescriptor* slot_desc = slots[index];
         PrimitiveType ptype = slot_desc->type().type;
         if (!is_scalar_primitive_type(ptype)) continue;
+        if (like_only && (ptype != TYPE_VARCHAR || !is_like_constant_pattern(ctx->root()) ||
+                          !has_ngram_bf_index(slot_desc->col_name()))) {
+            continue;
+        }
         {
             auto iter = slot_index_to_expr_ctxs.find(index);
             if (iter == slot_index_to_expr_ctxs.end()) {
@@ -818,11 +1099,17 @@ void OlapScanConjunctsManager::build_column_expr_predicates() {
 Status OlapScanConjunctsManager::parse_conjuncts(bool scan_keys_unlimited, int32_t max_scan_key_num,
                                                  bool enable_column_expr_predicate) {
     normalize_conjuncts();
+    normalize_or_predicates();
     RETURN_IF_ERROR(build_olap_filters());
     build_scan_keys(scan_keys_unlimited, max_scan_key_num);
     if (enable_column_expr_predicate) {
         VLOG_FILE << "OlapScanConjunctsManager: enable_column_expr_predicate = true. push down column expr predicates";
-        build_column_expr_predicates();
+        build_column_expr_predicates(false);
+    } else {
+        // LIKE on a column with an n-gram bloom filter index is always pushed down, otherwise the index is
+        // never used. It's still evaluated by the scan node for the other columns, which is cheaper than
+        // the late materialization of `ColumnExprPredicate`.
+        build_column_expr_predicates(true);
     }
     return Status::OK();
 }
@@ -9,11 +9,23 @@
 
 namespace starrocks {
 class RuntimeState;
+class TabletSchema;
 namespace vectorized {
 
 class RuntimeFilterProbeCollector;
 class PredicateParser;
 class ColumnPredicate;
+class PredicateTree;
+
+// An AND/OR tree of conditions normalized from an OR conjunct, e.g, `c1 = 1 OR (c2 > 10 AND c3 IS NULL)`.
+// A leaf holds a condition on a single column, and an inner node holds at least two children.
+struct ConditionTree {
+    bool is_or = false;
+    TCondition condition;
+    std::vector<ConditionTree> children;
+
+    bool is_leaf() const { return children.empty(); }
+};
 
 class OlapScanConjunctsManager {
 public:
@@ -24,6 +36,9 @@ public:
     const std::vector<std::string>* key_column_names;
     const RuntimeFilterProbeCollector* runtime_filters;
     RuntimeState* runtime_state;
+    // Schema of the scanned tablet. `LIKE` is pushed down only for the columns with an n-gram bloom filter
+    // index in it, and never pushed down if it's null.
+    const TabletSchema* tablet_schema = nullptr;
 
 private:
     // fields generated by parsing conjunct ctxs.
@@ -33,6 +48,8 @@ private:
     OlapScanKeys scan_keys;                                           // from _column_value_ranges
     std::vector<TCondition> olap_filters;                             // from _column_value_ranges
     std::vector<TCondition> is_null_vector;                           // from conjunct_ctxs
+    std::vector<TCondition> match_vector;                             // from conjunct_ctxs
+    std::vector<ConditionTree> or_condition_trees;                    // from conjunct_ctxs
     std::map<int, std::vector<ExprContext*>> slot_index_to_expr_ctxs; // from conjunct_ctxs
 
 public:
@@ -40,6 +57,11 @@ public:
 
     void get_column_predicates(PredicateParser* parser, std::vector<std::unique_ptr<ColumnPredicate>>* preds);
 
+    // The trees of the OR conjuncts, which are only used to narrow the scan range by bitmap indexes.
+    // The leaf predicates are appended to |preds|, which owns them.
+    void get_predicate_trees(PredicateParser* parser, std::vector<PredicateTree>* trees,
+                             std::vector<std::unique_ptr<ColumnPredicate>>* preds);
+
     Status get_key_ranges(std::vector<std::unique_ptr<OlapScanRange>>* key_ranges);
 
     void get_not_push_down_conjuncts(std::vector<ExprContext*>* predicates);
@@ -69,10 +91,31 @@ private:
 
     void normalize_is_null_predicate(const SlotDescriptor& slot);
 
+    // `match_any(column, 'query')` and `match_all(column, 'query')` on a string column are pushed down
+    // as MATCH predicates, which are evaluated by the full-text inverted index of the column.
+    void normalize_match_predicate(const SlotDescriptor& slot);
+
+    // The OR conjuncts, e.g, `c1 = 1 OR c2 = 2`, can't be pushed down as column predicates, but they can be
+    // evaluated by the bitmap indexes of the columns. Unlike the other normalizations, the conjuncts are
+    // still evaluated by the scan node, so they are not marked as normalized.
+    void normalize_or_predicates();
+
+    bool normalize_condition_tree(const Expr* expr, ExprContext* ctx, ConditionTree* tree);
+
+    bool normalize_index_condition(const Expr* expr, ExprContext* ctx, TCondition* condition);
+
+    template <PrimitiveType SlotType, typename RangeValueType>
+    bool normalize_index_condition(const SlotDescriptor& slot, const Expr* expr, ExprContext* ctx,
+                                   TCondition* condition);
+
     // To build `ColumnExprPredicate`s from conjuncts passed from olap scan node.
     // `ColumnExprPredicate` would be used in late materialization, zone map filtering,
     // dict encoded column filtering and bitmap value column filtering etc.
-    void build_column_expr_predicates();
+    // If |like_only| is true, only `varchar_column LIKE <constant>` on a column with an n-gram bloom filter
+    // index in |tablet_schema| is pushed down, which can filter pages by the index.
+    void build_column_expr_predicates(bool like_only);
+
+    bool has_ngram_bf_index(const std::string& col_name) const;
 };
 
 } // namespace vectorized
@@ -4,9 +4,11 @@
 
 #include <glog/logging.h>
 
+#include <cstring>
 #include <exception>
 #include <limits>
 #include <set>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 
@@ -60,6 +62,29 @@ static inline size_t remove_trailing_spaces(const char* s, size_t size) {
     return size;
 }
 
+// Copy the values of orc column vector batch to column, in bulk if they have the same layout.
+template <typename DstType, typename SrcType>
+static inline void copy_values(DstType* dst, const SrcType* src, int size) {
+    if constexpr (std::is_same_v<DstType, SrcType>) {
+        memcpy(dst, src, size * sizeof(SrcType));
+    } else {
+        for (int i = 0; i < size; ++i) {
+            dst[i] = src[i];
+        }
+    }
+}
+
+// Whether the strings are stored back to back, which is true if they are read from a direct
+// encoded column and not filtered. Then they can be copied in bulk.
+static inline bool is_contiguous_strings(const orc::StringVectorBatch* data, int from, int size) {
+    for (int i = from; i + 1 < from + size; ++i) {
+        if (data->data[i] + data->length[i] != data->data[i + 1]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 static void fill_boolean_column(orc::ColumnVectorBatch* cvb, ColumnPtr& col, int from, int size,
                                 const TypeDescriptor& type_desc, void* ctx) {
     auto* data = down_cast<orc::LongVectorBatch*>(cvb);
@@ -111,11 +136,7 @@ static void fill_int_column_from_cvb(OrcColumnVectorBatch* data, ColumnPtr& col,
     auto* values = ColumnHelper::cast_to_raw<Type>(col)->get_data().data();
 
     auto* cvbd = data->data.data();
-
-    auto pos = from;
-    for (int i = col_start; i < col_start + size; ++i, ++pos) {
-        values[i] = cvbd[pos];
-    }
+    copy_values(values + col_start, cvbd + from, size);
 
     // col_start == 0 and from == 0 means it's at top level of fill chunk, not in the middle of array
     // otherwise `broker_load_filter` does not work.
@@ -162,10 +183,7 @@ static void fill_int_column_with_null_from_cvb(OrcColumnVectorBatch* data, Colum
             nulls[i] = !cvbn[pos];
         }
     }
-    pos = from;
-    for (int i = col_start; i < col_start + size; ++i, ++pos) {
-        values[i] = cvbd[pos];
-    }
+    copy_values(values + col_start, cvbd + from, size);
 
     // col_start == 0 and from == 0 means it's at top level of fill chunk, not in the middle of array
     // otherwise `broker_load_filter` does not work.
@@ -258,9 +276,7 @@ static void fill_float_column(orc::ColumnVectorBatch* cvb, ColumnPtr& col, int f
     auto* values = ColumnHelper::cast_to_raw<Type>(col)->get_data().data();
 
     auto* cvbd = data->data.data();
-    for (int i = col_start; i < col_start + size; ++i, ++from) {
-        values[i] = cvbd[from];
-    }
+    copy_values(values + col_start, cvbd + from, size);
 }
 
 template <PrimitiveType Type>
@@ -282,10 +298,7 @@ static void fill_float_column_with_null(orc::ColumnVectorBatch* cvb, ColumnPtr&
             nulls[i] = !cvbn[pos];
         }
     }
-    pos = from;
-    for (int i = col_start; i < col_start + size; ++i, ++pos) {
-        values[i] = cvbd[pos];
-    }
+    copy_values(values + col_start, cvbd + from, size);
     c->update_has_null();
 }
 
@@ -557,6 +570,13 @@ static void fill_string_column(orc::ColumnVectorBatch* cvb, ColumnPtr& col, int
             vb.insert(vb.end(), data->data[pos], data->data[pos] + str_size);
             vo.emplace_back(vb.size());
         }
+    } else if (size > 0 && is_contiguous_strings(data, from, size)) {
+        size_t offset = vb.size();
+        vb.insert(vb.end(), data->data[from], data->data[from] + len);
+        for (int i = col_start; i < col_start + size; ++i, ++pos) {
+            offset += data->length[pos];
+            vo.emplace_back(offset);
+        }
     } else {
         for (int i = col_start; i < col_start + size; ++i, ++pos) {
             vb.insert(vb.end(), data->data[pos], data->data[pos] + data->length[pos]);
@@ -645,6 +665,13 @@ static void fill_string_column_with_null(orc::ColumnVectorBatch* cvb, ColumnPtr&
                 vb.insert(vb.end(), data->data[pos], data->data[pos] + str_size);
                 vo.emplace_back(vb.size());
             }
+        } else if (size > 0 && is_contiguous_strings(data, from, size)) {
+            size_t offset = vb.size();
+            vb.insert(vb.end(), data->data[from], data->data[from] + len);
+            for (int i = col_start; i < col_start + size; ++i, ++pos) {
+                offset += data->length[pos];
+                vo.emplace_back(offset);
+            }
         } else {
             for (int i = col_start; i < col_start + size; ++i, ++pos) {
                 vb.insert(vb.end(), data->data[pos], data->data[pos] + data->length[pos]);
@@ -1061,7 +1088,10 @@ Status OrcScannerAdapter::_init_include_columns() {
         column_id_to_orc_name.emplace(sub_type->getColumnId(), root_type.getFieldName(i));
     }
 
-    for (SlotDescriptor* desc : _src_slot_descriptors) {
+    std::list<std::string> lazy_load_column_names;
+    _is_lazy_load_column.assign(_src_slot_descriptors.size(), false);
+    for (size_t i = 0; i < _src_slot_descriptors.size(); i++) {
+        SlotDescriptor* desc = _src_slot_descriptors[i];
         if (desc == nullptr) continue;
         auto it = _name_to_column_id.find(desc->col_name());
         if (it == _name_to_column_id.end()) {
@@ -1076,8 +1106,14 @@ Status OrcScannerAdapter::_init_include_columns() {
             return Status::NotFound(s);
         }
         orc_column_names.push_back(it2->second);
+        if (_lazy_load_slot_ids.count(desc->id()) > 0) {
+            _is_lazy_load_column[i] = true;
+            lazy_load_column_names.push_back(it2->second);
+        }
     }
+    _has_lazy_load_columns = !lazy_load_column_names.empty();
     _row_reader_options.include(orc_column_names);
+    _row_reader_options.includeLazyLoadColumnNames(lazy_load_column_names);
     return Status::OK();
 }
 
@@ -1293,6 +1329,9 @@ Status OrcScannerAdapter::read_next() {
         if (!_row_reader->next(*_batch)) {
             return Status::EndOfFile("");
         }
+        if (_has_lazy_load_columns) {
+            _active_selection.assign(_batch->numElements, 1);
+        }
     } catch (std::exception& e) {
         auto s = strings::Substitute("OrcScannerAdpater::read_next failed. reason = $0", e.what());
         LOG(WARNING) << s;
@@ -1301,6 +1340,17 @@ Status OrcScannerAdapter::read_next() {
     return Status::OK();
 }
 
+Status OrcScannerAdapter::seek_to_row(uint64_t row) {
+    try {
+        _row_reader->seekToRow(row);
+    } catch (std::exception& e) {
+        auto s = strings::Substitute("OrcScannerAdapter::seek_to_row failed. reason = $0", e.what());
+        LOG(WARNING) << s;
+        return Status::InternalError(s);
+    }
+    return Status::OK();
+}
+
 size_t OrcScannerAdapter::get_cvb_size() {
     return _batch->numElements;
 }
@@ -1318,7 +1368,7 @@ Status OrcScannerAdapter::fill_chunk(ChunkPtr* chunk) {
     }
     for (int column_pos = 0; column_pos < column_size; ++column_pos) {
         SlotDescriptor* slot_desc = _src_slot_descriptors[column_pos];
-        if (slot_desc == nullptr) {
+        if (slot_desc == nullptr || _is_lazy_load_column[column_pos]) {
             continue;
         }
         set_current_slot(slot_desc);
@@ -1357,13 +1407,17 @@ Status OrcScannerAdapter::fill_chunk(ChunkPtr* chunk) {
 }
 
 ChunkPtr OrcScannerAdapter::create_chunk() {
+    return _create_chunk(false);
+}
+
+ChunkPtr OrcScannerAdapter::_create_chunk(bool lazy_load) {
     auto chunk = std::make_shared<Chunk>();
     int column_size = _src_slot_descriptors.size();
     chunk->columns().reserve(column_size);
 
     for (int column_pos = 0; column_pos < column_size; ++column_pos) {
         auto slot_desc = _src_slot_descriptors[column_pos];
-        if (slot_desc == nullptr) {
+        if (slot_desc == nullptr || _is_lazy_load_column[column_pos] != lazy_load) {
             continue;
         }
         auto col = ColumnHelper::create_column(_src_types[column_pos], slot_desc->is_nullable());
@@ -1373,12 +1427,16 @@ ChunkPtr OrcScannerAdapter::create_chunk() {
 }
 
 ChunkPtr OrcScannerAdapter::cast_chunk(ChunkPtr* chunk) {
+    return _cast_chunk(chunk, false);
+}
+
+ChunkPtr OrcScannerAdapter::_cast_chunk(ChunkPtr* chunk, bool lazy_load) {
     ChunkPtr cast_chunk = std::make_shared<Chunk>();
     ChunkPtr& src = (*chunk);
     int column_size = _src_slot_descriptors.size();
     for (int column_pos = 0; column_pos < column_size; ++column_pos) {
         auto slot = _src_slot_descriptors[column_pos];
-        if (slot == nullptr) {
+        if (slot == nullptr || _is_lazy_load_column[column_pos] != lazy_load) {
             continue;
         }
         ColumnPtr col = _cast_exprs[column_pos]->evaluate(nullptr, src.get());
@@ -1388,6 +1446,117 @@ ChunkPtr OrcScannerAdapter::cast_chunk(ChunkPtr* chunk) {
     return cast_chunk;
 }
 
+// Gaps between the selected rows shorter than this are read and filtered, rather than skipped.
+static const size_t kMinLazyLoadSkipRows = 32;
+
+Status OrcScannerAdapter::lazy_read_next(ChunkPtr* chunk, const Column::Filter* filter) {
+    DCHECK(_has_lazy_load_columns);
+    DCHECK(!_broker_load_mode);
+    // map the filter over the filled rows back to all rows of the batch.
+    Column::Filter& selection = _active_selection;
+    const size_t num_rows = selection.size();
+    if ((*chunk)->num_rows() == 0) {
+        selection.assign(num_rows, 0);
+    } else if (filter != nullptr) {
+        size_t j = 0;
+        for (size_t i = 0; i < num_rows; i++) {
+            if (selection[i]) {
+                selection[i] = (*filter)[j++];
+            }
+        }
+        DCHECK_EQ(j, filter->size());
+    }
+
+    ChunkPtr lazy_chunk = _create_chunk(true);
+    _lazy_load_skip_rows = 0;
+    size_t pos = 0;
+    try {
+        while (pos < num_rows) {
+            size_t start = pos;
+            while (start < num_rows && !selection[start]) {
+                start++;
+            }
+            if (start == num_rows) {
+                break;
+            }
+            // read the selected rows along with the short gaps between them.
+            size_t end = start;
+            size_t i = start;
+            while (i < num_rows) {
+                if (selection[i]) {
+                    end = ++i;
+                    continue;
+                }
+                size_t gap_end = i;
+                while (gap_end < num_rows && !selection[gap_end]) {
+                    gap_end++;
+                }
+                if (gap_end == num_rows || gap_end - i >= kMinLazyLoadSkipRows) {
+                    break;
+                }
+                i = gap_end;
+            }
+
+            if (start > pos) {
+                _row_reader->lazyLoadSkip(start - pos);
+                _lazy_load_skip_rows += start - pos;
+            }
+            _row_reader->lazyLoadNext(*_batch, end - start);
+            uint8_t* range_filter = selection.data() + start;
+            size_t true_size = SIMD::count_nonzero(range_filter, end - start);
+            if (true_size != end - start) {
+                int column_size = _src_slot_descriptors.size();
+                const auto& batch_vec = down_cast<orc::StructVectorBatch*>(_batch.get())->fields;
+                for (int column_pos = 0; column_pos < column_size; ++column_pos) {
+                    if (_src_slot_descriptors[column_pos] != nullptr && _is_lazy_load_column[column_pos]) {
+                        batch_vec[_position_in_orc[column_pos]]->filter(range_filter, end - start, true_size);
+                    }
+                }
+            }
+            RETURN_IF_ERROR(_fill_lazy_load_columns(lazy_chunk.get(), true_size));
+            pos = end;
+        }
+    } catch (std::exception& e) {
+        auto s = strings::Substitute("OrcScannerAdapter::lazy_read_next failed. reason = $0", e.what());
+        LOG(WARNING) << s;
+        return Status::InternalError(s);
+    }
+    // the rest rows are skipped by the next read_next().
+    _lazy_load_skip_rows += num_rows - pos;
+
+    DCHECK_EQ((*chunk)->num_rows(), lazy_chunk->num_rows());
+    ChunkPtr cast_chunk = _cast_chunk(&lazy_chunk, true);
+    int column_size = _src_slot_descriptors.size();
+    for (int column_pos = 0; column_pos < column_size; ++column_pos) {
+        SlotDescriptor* slot_desc = _src_slot_descriptors[column_pos];
+        if (slot_desc != nullptr && _is_lazy_load_column[column_pos]) {
+            (*chunk)->append_column(cast_chunk->get_column_by_slot_id(slot_desc->id()), slot_desc->id());
+        }
+    }
+    return Status::OK();
+}
+
+Status OrcScannerAdapter::_fill_lazy_load_columns(Chunk* chunk, size_t num_rows) {
+    int column_size = _src_slot_descriptors.size();
+    const auto& batch_vec = down_cast<orc::StructVectorBatch*>(_batch.get())->fields;
+    for (int column_pos = 0; column_pos < column_size; ++column_pos) {
+        SlotDescriptor* slot_desc = _src_slot_descriptors[column_pos];
+        if (slot_desc == nullptr || !_is_lazy_load_column[column_pos]) {
+            continue;
+        }
+        set_current_slot(slot_desc);
+        orc::ColumnVectorBatch* cvb = batch_vec[_position_in_orc[column_pos]];
+        DCHECK_EQ(num_rows, cvb->numElements);
+        if (!slot_desc->is_nullable() && cvb->hasNulls) {
+            auto s = strings::Substitute("column '$0' is not nullable", slot_desc->col_name());
+            return Status::InternalError(s);
+        }
+        ColumnPtr& col = chunk->get_column_by_slot_id(slot_desc->id());
+        _fill_functions[column_pos](cvb, col, 0, num_rows, slot_desc->type(), this);
+    }
+    return Status::OK();
+}
+
 void OrcScannerAdapter::set_row_reader_filter(std::shared_ptr<orc::RowReaderFilter> filter) {
     _row_reader_options.rowReaderFilter(std::move(filter));
 }
@@ -2034,14 +2203,33 @@ Status OrcScannerAdapter::apply_dict_filter_eval_cache(
     if (!filter_all) {
         uint32_t one_count = filter.size() - SIMD::count_zero(filter);
         if (one_count != filter.size()) {
-            _batch->filter(filter.data(), filter.size(), one_count);
+            _filter_batch(filter, one_count);
         }
     } else {
         _batch->numElements = 0;
+        if (_has_lazy_load_columns) {
+            _active_selection.assign(size, 0);
+        }
     }
     return Status::OK();
 }
 
+void OrcScannerAdapter::_filter_batch(Column::Filter& filter, uint32_t true_size) {
+    if (!_has_lazy_load_columns) {
+        _batch->filter(filter.data(), filter.size(), true_size);
+        return;
+    }
+    int column_size = _src_slot_descriptors.size();
+    auto* batch = down_cast<orc::StructVectorBatch*>(_batch.get());
+    batch->ColumnVectorBatch::filter(filter.data(), filter.size(), true_size);
+    for (int column_pos = 0; column_pos < column_size; ++column_pos) {
+        if (_src_slot_descriptors[column_pos] != nullptr && !_is_lazy_load_column[column_pos]) {
+            batch->fields[_position_in_orc[column_pos]]->filter(filter.data(), filter.size(), true_size);
+        }
+    }
+    _active_selection = filter;
+}
+
 Status OrcScannerAdapter::set_timezone(const std::string& tz) {
     if (!TimezoneUtils::find_cctz_time_zone(tz, _tzinfo)) {
         return Status::InternalError(strings::Substitute("can not find cctz time zone $0", tz));
@@ -45,9 +45,22 @@ public:
     Status fill_chunk(ChunkPtr* chunk);
     // some type cast & conversion.
     ChunkPtr cast_chunk(ChunkPtr* chunk);
+    // The lazy load columns are not read by read_next(), and create_chunk(), fill_chunk() and cast_chunk()
+    // only handle the other columns. Once the rows are filtered, this reads the lazy load columns of the
+    // selected rows, which are the ones filled by fill_chunk() and selected by |filter|, or all of them if
+    // |filter| is nullptr. The casted lazy load columns are appended to |chunk|.
+    Status lazy_read_next(ChunkPtr* chunk, const Column::Filter* filter);
+    bool has_lazy_load_columns() const { return _has_lazy_load_columns; }
+    // the next read_next() reads from the |row|-th row of the file, along with the following
+    // lazy_read_next().
+    Status seek_to_row(uint64_t row);
+    // the number of rows of the lazy load columns skipped by the last lazy_read_next().
+    size_t get_lazy_load_skip_rows() const { return _lazy_load_skip_rows; }
     // call them before calling init.
     void set_read_chunk_size(uint64_t v) { _read_chunk_size = v; }
     void set_row_reader_filter(std::shared_ptr<orc::RowReaderFilter> filter);
+    // the columns of these slots are lazy loaded.
+    void set_lazy_load_slot_ids(const std::unordered_set<SlotId>& slot_ids) { _lazy_load_slot_ids = slot_ids; }
     void set_conjuncts(const std::vector<Expr*>& conjuncts);
     void set_conjuncts_and_runtime_filters(const std::vector<Expr*>& conjuncts,
                                            RuntimeFilterProbeCollector* rf_collector);
@@ -118,6 +131,11 @@ private:
     Status _init_src_types();
     Status _init_cast_exprs();
     Status _init_fill_functions();
+    ChunkPtr _create_chunk(bool lazy_load);
+    ChunkPtr _cast_chunk(ChunkPtr* chunk, bool lazy_load);
+    // filter the rows of the batch, except the lazy load columns which are not read yet.
+    void _filter_batch(Column::Filter& filter, uint32_t true_size);
+    Status _fill_lazy_load_columns(Chunk* chunk, size_t num_rows);
     // holding Expr* in cast_exprs;
     ObjectPool _pool;
     uint64_t _read_chunk_size;
@@ -136,6 +154,15 @@ private:
     SlotDescriptor* _current_slot;
     std::string _current_file_name;
     int _error_message_counter;
+
+    // fields related to lazy load.
+    std::unordered_set<SlotId> _lazy_load_slot_ids;
+    bool _has_lazy_load_columns = false;
+    // _src_slot index to whether it's lazy loaded.
+    std::vector<bool> _is_lazy_load_column;
+    // the rows of the batch filled by fill_chunk(), the others are filtered by dict filter.
+    Column::Filter _active_selection;
+    size_t _lazy_load_skip_rows = 0;
 };
 
 } // namespace starrocks::vectorized
\ No newline at end of file
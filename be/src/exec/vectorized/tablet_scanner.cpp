@@ -144,6 +144,7 @@ Status TabletScanner::_init_reader_params(const std::vector<OlapScanRange*>* key
         }
         _predicate_free_pool.emplace_back(std::move(p));
     }
+    _parent->_conjuncts_manager.get_predicate_trees(&parser, &_params.predicate_trees, &_predicate_free_pool);
 
     ConjunctivePredicatesRewriter not_pushdown_predicate_rewriter(_predicates, *_params.global_dictmaps);
     not_pushdown_predicate_rewriter.rewrite_predicate(&_parent->_obj_pool);
@@ -328,6 +329,8 @@ void TabletScanner::update_counter() {
 
     COUNTER_UPDATE(_parent->_bi_filtered_counter, _reader->stats().rows_bitmap_index_filtered);
     COUNTER_UPDATE(_parent->_bi_filter_timer, _reader->stats().bitmap_index_filter_timer);
+    COUNTER_UPDATE(_parent->_ii_filtered_counter, _reader->stats().rows_inverted_index_filtered);
+    COUNTER_UPDATE(_parent->_ii_filter_timer, _reader->stats().inverted_index_filter_timer);
     COUNTER_UPDATE(_parent->_block_seek_counter, _reader->stats().block_seek_num);
 
     COUNTER_UPDATE(_parent->_rowsets_read_count, _reader->stats().rowsets_read_count);
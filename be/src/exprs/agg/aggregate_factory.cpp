@@ -69,7 +69,7 @@ AggregateFunctionPtr AggregateFactory::MakeCountDistinctAggregateFunction() {
 
 template <PrimitiveType PT>
 AggregateFunctionPtr AggregateFactory::MakeCountDistinctAggregateFunctionV2() {
-    return std::make_shared<DistinctAggregateFunctionV2<PT, AggDistinctType::COUNT>>();
+    return std::make_shared<MultiDistinctAggregateFunctionV2<PT, AggDistinctType::COUNT>>();
 }
 
 template <PrimitiveType PT>
@@ -131,7 +131,7 @@ AggregateFunctionPtr AggregateFactory::MakeSumDistinctAggregateFunction() {
 
 template <PrimitiveType PT>
 AggregateFunctionPtr AggregateFactory::MakeSumDistinctAggregateFunctionV2() {
-    return std::make_shared<DistinctAggregateFunctionV2<PT, AggDistinctType::SUM>>();
+    return std::make_shared<MultiDistinctAggregateFunctionV2<PT, AggDistinctType::SUM>>();
 }
 
 AggregateFunctionPtr AggregateFactory::MakeDictMergeAggregateFunction() {
@@ -361,13 +361,15 @@ public:
                 return AggregateFactory::MakeNullableAggregateFunctionUnary<DistinctAggregateState<ArgPT>>(distinct);
             } else if (name == "multi_distinct_count2") {
                 auto distinct = AggregateFactory::MakeCountDistinctAggregateFunctionV2<ArgPT>();
-                return AggregateFactory::MakeNullableAggregateFunctionUnary<DistinctAggregateStateV2<ArgPT>>(distinct);
+                return AggregateFactory::MakeNullableAggregateFunctionUnary<MultiDistinctAggregateStateV2<ArgPT>>(
+                        distinct);
             } else if (name == "multi_distinct_sum") {
                 auto distinct = AggregateFactory::MakeSumDistinctAggregateFunction<ArgPT>();
                 return AggregateFactory::MakeNullableAggregateFunctionUnary<DistinctAggregateState<ArgPT>>(distinct);
             } else if (name == "multi_distinct_sum2") {
                 auto distinct = AggregateFactory::MakeSumDistinctAggregateFunctionV2<ArgPT>();
-                return AggregateFactory::MakeNullableAggregateFunctionUnary<DistinctAggregateStateV2<ArgPT>>(distinct);
+                return AggregateFactory::MakeNullableAggregateFunctionUnary<MultiDistinctAggregateStateV2<ArgPT>>(
+                        distinct);
             } else if (name == "group_concat") {
                 auto group_count = AggregateFactory::MakeGroupConcatAggregateFunction<ArgPT>();
                 return AggregateFactory::MakeNullableAggregateFunctionVariadic<GroupConcatAggregateState>(group_count);
@@ -446,7 +448,8 @@ public:
                 return AggregateFactory::MakeNullableAggregateFunctionUnary<DistinctAggregateState<ArgPT>>(distinct);
             } else if (name == "multi_distinct_count2") {
                 auto distinct = AggregateFactory::MakeCountDistinctAggregateFunctionV2<ArgPT>();
-                return AggregateFactory::MakeNullableAggregateFunctionUnary<DistinctAggregateStateV2<ArgPT>>(distinct);
+                return AggregateFactory::MakeNullableAggregateFunctionUnary<MultiDistinctAggregateStateV2<ArgPT>>(
+                        distinct);
             } else if (name == "group_concat") {
                 auto group_count = AggregateFactory::MakeGroupConcatAggregateFunction<ArgPT>();
                 return AggregateFactory::MakeNullableAggregateFunctionVariadic<GroupConcatAggregateState>(group_count);
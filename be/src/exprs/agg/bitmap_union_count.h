@@ -23,6 +23,17 @@ public:
         this->data(state) |= *(col->get_object(row_num));
     }
 
+    // The frozen bitmaps of the whole batch are unioned at once, see BitmapValue::union_many.
+    void update_batch_single_state(FunctionContext* ctx, size_t batch_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        _union_batch(down_cast<const BitmapColumn*>(columns[0]), batch_size, state);
+    }
+
+    void merge_batch_single_state(FunctionContext* ctx, size_t batch_size, const Column* column,
+                                  AggDataPtr __restrict state) const override {
+        _union_batch(down_cast<const BitmapColumn*>(column), batch_size, state);
+    }
+
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         BitmapColumn* col = down_cast<BitmapColumn*>(to);
         auto& value = const_cast<BitmapValue&>(this->data(state));
@@ -39,6 +50,15 @@ public:
     }
 
     std::string get_name() const override { return "bitmap_union_count"; }
+
+private:
+    void _union_batch(const BitmapColumn* col, size_t batch_size, AggDataPtr __restrict state) const {
+        std::vector<const BitmapValue*> values(batch_size);
+        for (size_t i = 0; i < batch_size; i++) {
+            values[i] = col->get_object(i);
+        }
+        this->data(state).union_many(values);
+    }
 };
 
 } // namespace starrocks::vectorized
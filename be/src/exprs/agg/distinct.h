@@ -5,6 +5,8 @@
 #include <cstring>
 #include <limits>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "column/array_column.h"
 #include "column/binary_column.h"
@@ -257,6 +259,145 @@ struct DistinctAggregateStateV2<PT, FixedLengthPTGuard<PT>> {
 template <PrimitiveType PT>
 struct DistinctAggregateStateV2<PT, BinaryPTGuard<PT>> : public DistinctAggregateState<PT> {};
 
+// The distinct values of all the groups of a multi distinct function in one hash set keyed by (group, value),
+// instead of one hash set per group. A query like `count(distinct a), count(distinct b) ... group by c` with
+// high-cardinality groups would otherwise create millions of small hash sets, each of which has its own
+// allocations and is probed in a different memory area.
+//
+// Groups get ids from 1 when they see their first value, and the ids are never reused until all the groups are
+// released, e.g. after the hash map of a streaming pre-aggregation is flushed, when the whole set is cleared.
+// It's owned by the FunctionContext of the aggregate function, so it's accessed by one thread at a time.
+template <typename T>
+class GroupDistinctHashSet {
+public:
+    using GroupId = uint32_t;
+
+    struct Key {
+        GroupId group;
+        T value;
+
+        bool operator==(const Key& rhs) const { return group == rhs.group && value == rhs.value; }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            return phmap_mix<sizeof(size_t)>()(std::hash<T>()(key.value) ^ (key.group * 0x9E3779B97F4A7C15ULL));
+        }
+    };
+
+    using Set = phmap::flat_hash_set<Key, KeyHash>;
+
+    static constexpr size_t item_size = sizeof(Key);
+
+    GroupId new_group() {
+        DCHECK_LT(_next_group, std::numeric_limits<GroupId>::max());
+        _live_groups++;
+        return ++_next_group;
+    }
+
+    void release_group() {
+        DCHECK_GT(_live_groups, 0);
+        if (--_live_groups == 0) {
+            Set().swap(_set);
+            std::vector<T>().swap(_values);
+            std::vector<size_t>().swap(_offsets);
+            _next_group = 0;
+            _indexed = false;
+        }
+    }
+
+    size_t hash(GroupId group, T value) const { return _set.hash_function()(Key{group, value}); }
+
+    void prefetch_hash(size_t hash) const { _set.prefetch_hash(hash); }
+
+    // Returns true if |value| is new to |group|.
+    bool insert_with_hash(GroupId group, T value, size_t hash) {
+        bool inserted = _set.emplace_with_hash(hash, Key{group, value}).second;
+        _indexed &= !inserted;
+        return inserted;
+    }
+
+    void reserve(size_t n) { _set.reserve(n); }
+
+    size_t size() const { return _set.size(); }
+
+    // The distinct values of |group|, which are valid until the next insertion.
+    // The values of all the groups are bucketed at once on the first call after insertions, so serializing
+    // the groups one by one costs a single pass over the set.
+    std::pair<const T*, size_t> values(GroupId group) {
+        if (group == 0) {
+            return {nullptr, 0};
+        }
+        if (!_indexed) {
+            _build_index();
+        }
+        DCHECK_LE(group, _next_group);
+        return {_values.data() + _offsets[group], _offsets[group + 1] - _offsets[group]};
+    }
+
+private:
+    void _build_index() {
+        _offsets.assign(_next_group + 2, 0);
+        for (const auto& key : _set) {
+            _offsets[key.group + 1]++;
+        }
+        for (size_t i = 1; i < _offsets.size(); i++) {
+            _offsets[i] += _offsets[i - 1];
+        }
+        _values.resize(_set.size());
+        std::vector<size_t> cursors(_offsets.begin(), _offsets.end() - 1);
+        for (const auto& key : _set) {
+            _values[cursors[key.group]++] = key.value;
+        }
+        _indexed = true;
+    }
+
+    Set _set;
+    GroupId _next_group = 0;
+    size_t _live_groups = 0;
+
+    // the values of group i are _values[_offsets[i], _offsets[i + 1])
+    std::vector<T> _values;
+    std::vector<size_t> _offsets;
+    bool _indexed = false;
+};
+
+// The state of a group of multi distinct functions backed by GroupDistinctHashSet, which keeps the count and
+// the sum of the distinct values only, the values themselves are in the shared set.
+template <PrimitiveType PT, typename = guard::Guard>
+struct GroupDistinctAggregateState {};
+
+template <PrimitiveType PT>
+struct GroupDistinctAggregateState<PT, FixedLengthPTGuard<PT>> {
+    using T = RunTimeCppType<PT>;
+    using SumType = RunTimeCppType<SumResultPT<PT>>;
+    using DistinctSet = GroupDistinctHashSet<T>;
+
+    ~GroupDistinctAggregateState() {
+        if (set != nullptr) {
+            set->release_group();
+        }
+    }
+
+    void bind(DistinctSet* distinct_set) {
+        if (set == nullptr) {
+            set = distinct_set;
+            group = distinct_set->new_group();
+        }
+        DCHECK_EQ(set, distinct_set);
+    }
+
+    DistinctSet* set = nullptr;
+    typename DistinctSet::GroupId group = 0;
+    int64_t count = 0;
+    SumType sum{};
+};
+
+// The state of multi_distinct_count2 and multi_distinct_sum2 of type PT.
+template <PrimitiveType PT>
+using MultiDistinctAggregateStateV2 = std::conditional_t<pt_is_fixedlength<PT>, GroupDistinctAggregateState<PT>,
+                                                         DistinctAggregateStateV2<PT>>;
+
 // Dear god this template class as template parameter kills me!
 template <PrimitiveType PT, template <PrimitiveType X, typename = guard::Guard> class TDistinctAggState,
           AggDistinctType DistinctType, typename T = RunTimeCppType<PT>>
@@ -440,6 +581,190 @@ class DistinctAggregateFunction : public TDistinctAggregateFunction<PT, Distinct
 template <PrimitiveType PT, AggDistinctType DistinctType, typename T = RunTimeCppType<PT>>
 class DistinctAggregateFunctionV2 : public TDistinctAggregateFunction<PT, DistinctAggregateStateV2, DistinctType, T> {};
 
+// Multi distinct functions of fixed-length types whose distinct values of all the groups are kept in one
+// GroupDistinctHashSet. The serialized format is the same as DistinctAggregateStateV2's.
+template <PrimitiveType PT, AggDistinctType DistinctType, typename T = RunTimeCppType<PT>>
+class GroupDistinctAggregateFunction final
+        : public AggregateFunctionBatchHelper<GroupDistinctAggregateState<PT>,
+                                              GroupDistinctAggregateFunction<PT, DistinctType, T>> {
+public:
+    using ColumnType = RunTimeColumnType<PT>;
+    using State = GroupDistinctAggregateState<PT>;
+    using DistinctSet = GroupDistinctHashSet<T>;
+
+    void update(FunctionContext* ctx, const Column** columns, AggDataPtr __restrict state,
+                size_t row_num) const override {
+        const auto* column = down_cast<const ColumnType*>(columns[0]);
+        auto& agg_state = this->data(state);
+        agg_state.bind(_distinct_set(ctx));
+        T value = column->get_data()[row_num];
+        size_t mem_usage = _insert(&agg_state, value, agg_state.set->hash(agg_state.group, value));
+        ctx->impl()->add_mem_usage(mem_usage);
+    }
+
+    void update_batch_single_state(FunctionContext* ctx, size_t batch_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        const auto* column = down_cast<const ColumnType*>(columns[0]);
+        const auto& container_data = column->get_data();
+        auto& agg_state = this->data(state);
+        DistinctSet* set = _distinct_set(ctx);
+        agg_state.bind(set);
+
+        std::vector<size_t> hashes(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            hashes[i] = set->hash(agg_state.group, container_data[i]);
+        }
+        size_t mem_usage = 0;
+        size_t prefetch_index = PREFETCH_DISTANCE;
+        for (size_t i = 0; i < batch_size; ++i) {
+            if (prefetch_index < batch_size) {
+                set->prefetch_hash(hashes[prefetch_index++]);
+            }
+            mem_usage += _insert(&agg_state, container_data[i], hashes[i]);
+        }
+        ctx->impl()->add_mem_usage(mem_usage);
+    }
+
+    // All the rows are probed in the same hash set whatever their groups are, so the hashes of a batch are
+    // computed at first and the slots are prefetched ahead of the probes.
+    void update_batch(FunctionContext* ctx, size_t batch_size, size_t state_offset, const Column** columns,
+                      AggDataPtr* states) const override {
+        const auto* column = down_cast<const ColumnType*>(columns[0]);
+        const auto& container_data = column->get_data();
+        DistinctSet* set = _distinct_set(ctx);
+
+        struct CacheEntry {
+            State* agg_state;
+            size_t hash_value;
+        };
+
+        std::vector<CacheEntry> cache(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            auto& agg_state = this->data(states[i] + state_offset);
+            agg_state.bind(set);
+            cache[i] = CacheEntry{&agg_state, set->hash(agg_state.group, container_data[i])};
+        }
+        size_t mem_usage = 0;
+        size_t prefetch_index = PREFETCH_DISTANCE;
+        for (size_t i = 0; i < batch_size; ++i) {
+            if (prefetch_index < batch_size) {
+                set->prefetch_hash(cache[prefetch_index++].hash_value);
+            }
+            mem_usage += _insert(cache[i].agg_state, container_data[i], cache[i].hash_value);
+        }
+        ctx->impl()->add_mem_usage(mem_usage);
+    }
+
+    void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
+        DCHECK(column->is_binary());
+        const auto* input_column = down_cast<const BinaryColumn*>(column);
+        Slice slice = input_column->get_slice(row_num);
+        auto& agg_state = this->data(state);
+        DistinctSet* set = _distinct_set(ctx);
+        agg_state.bind(set);
+
+        size_t mem_usage = 0;
+        // see TDistinctAggregateFunction::merge, a shorter slice is a single value from convert_to_serialize_format
+        if (slice.size >= MIN_SIZE_OF_HASH_SET_SERIALIZED_DATA) {
+            const auto* src = reinterpret_cast<const uint8_t*>(slice.data);
+            size_t size = 0;
+            memcpy(&size, src, sizeof(size));
+            src += sizeof(size);
+            set->reserve(set->size() + size);
+            for (size_t i = 0; i < size; i++) {
+                T value;
+                memcpy(&value, src + i * sizeof(T), sizeof(T));
+                mem_usage += _insert(&agg_state, value, set->hash(agg_state.group, value));
+            }
+        } else {
+            T value;
+            memcpy(&value, slice.data, sizeof(T));
+            mem_usage += _insert(&agg_state, value, set->hash(agg_state.group, value));
+        }
+        ctx->impl()->add_mem_usage(mem_usage);
+    }
+
+    void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
+        auto* column = down_cast<BinaryColumn*>(to);
+        const auto& agg_state = this->data(state);
+        auto [values, size] = agg_state.set != nullptr ? agg_state.set->values(agg_state.group)
+                                                       : std::pair<const T*, size_t>(nullptr, 0);
+        DCHECK_EQ(size, static_cast<size_t>(agg_state.count));
+
+        size_t old_size = column->get_bytes().size();
+        size_t serialize_size = std::max(size * sizeof(T) + sizeof(size_t), MIN_SIZE_OF_HASH_SET_SERIALIZED_DATA);
+        column->get_bytes().resize(old_size + serialize_size);
+        uint8_t* dst = column->get_bytes().data() + old_size;
+        memcpy(dst, &size, sizeof(size));
+        if (size > 0) {
+            memcpy(dst + sizeof(size), values, size * sizeof(T));
+        }
+        column->get_offset().emplace_back(old_size + serialize_size);
+    }
+
+    void convert_to_serialize_format(const Columns& src, size_t chunk_size, ColumnPtr* dst) const override {
+        DCHECK((*dst)->is_binary());
+        auto* dst_column = down_cast<BinaryColumn*>((*dst).get());
+        Bytes& bytes = dst_column->get_bytes();
+        const auto* src_column = down_cast<const ColumnType*>(src[0].get());
+
+        size_t old_size = bytes.size();
+        bytes.resize(old_size + chunk_size * sizeof(T));
+        dst_column->get_offset().resize(chunk_size + 1);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            T key = src_column->get_data()[i];
+            memcpy(bytes.data() + old_size, &key, sizeof(T));
+            old_size += sizeof(T);
+            dst_column->get_offset()[i + 1] = old_size;
+        }
+    }
+
+    void finalize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
+        DCHECK(!to->is_nullable());
+        if constexpr (DistinctType == AggDistinctType::COUNT) {
+            down_cast<Int64Column*>(to)->append(this->data(state).count);
+        } else if constexpr (DistinctType == AggDistinctType::SUM && is_starrocks_arithmetic<T>::value) {
+            to->append_datum(Datum(this->data(state).sum));
+        }
+    }
+
+    std::string get_name() const override {
+        if constexpr (DistinctType == AggDistinctType::COUNT) {
+            return "count-distinct";
+        } else {
+            return "sum-distinct";
+        }
+    }
+
+private:
+    // This is just an empirical value based on benchmark, the same as TDistinctAggregateFunction's.
+    static constexpr size_t PREFETCH_DISTANCE = 16;
+
+    DistinctSet* _distinct_set(FunctionContext* ctx) const {
+        std::shared_ptr<void>& shared_state = ctx->impl()->shared_agg_state(this);
+        if (shared_state == nullptr) {
+            shared_state = std::make_shared<DistinctSet>();
+        }
+        return static_cast<DistinctSet*>(shared_state.get());
+    }
+
+    static size_t _insert(State* agg_state, T value, size_t hash) {
+        if (!agg_state->set->insert_with_hash(agg_state->group, value, hash)) {
+            return 0;
+        }
+        agg_state->count++;
+        if constexpr (DistinctType == AggDistinctType::SUM && is_starrocks_arithmetic<T>::value) {
+            agg_state->sum += value;
+        }
+        return DistinctSet::item_size;
+    }
+};
+
+template <PrimitiveType PT, AggDistinctType DistinctType>
+using MultiDistinctAggregateFunctionV2 =
+        std::conditional_t<pt_is_fixedlength<PT>, GroupDistinctAggregateFunction<PT, DistinctType>,
+                           DistinctAggregateFunctionV2<PT, DistinctType>>;
+
 // now we only support String
 struct DictMergeState : DistinctAggregateStateV2<TYPE_VARCHAR> {
     DictMergeState() = default;
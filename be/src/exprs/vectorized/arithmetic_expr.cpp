@@ -7,6 +7,7 @@
 #include "exprs/vectorized/binary_function.h"
 #include "exprs/vectorized/decimal_binary_function.h"
 #include "exprs/vectorized/decimal_cast_expr.h"
+#include "exprs/vectorized/fused_expr.h"
 #include "exprs/vectorized/unary_function.h"
 #include "runtime/decimalv3.h"
 
@@ -21,10 +22,19 @@ namespace starrocks::vectorized {
     virtual bool is_vectorized() const override { return true; };
 
 template <PrimitiveType Type, typename OP>
-class VectorizedArithmeticExpr final : public Expr {
+class VectorizedArithmeticExpr final : public Expr, public FusableArithmeticBase<Type, OP> {
 public:
     DEFINE_CLASS_CONSTRUCTOR(VectorizedArithmeticExpr);
     ColumnPtr evaluate(ExprContext* context, vectorized::Chunk* ptr) override {
+        if constexpr (is_fusable_arithmetic<Type, OP>) {
+            if (has_fusable_child<Type>(this)) {
+                return evaluate_fused_binary<Type, Type>(
+                        this, context, ptr,
+                        [this](const auto* l, const auto* r, auto* out, size_t count) {
+                            this->apply_tile(l, r, out, count);
+                        });
+            }
+        }
         auto l = _children[0]->evaluate(context, ptr);
         auto r = _children[1]->evaluate(context, ptr);
         if constexpr (pt_is_decimal<Type>) {
@@ -5,6 +5,7 @@
 #include "column/column_builder.h"
 #include "column/column_viewer.h"
 #include "exprs/vectorized/binary_function.h"
+#include "exprs/vectorized/fused_expr.h"
 
 namespace starrocks::vectorized {
 
@@ -36,6 +37,18 @@ public:
     bool is_vectorized() const override { return true; }
 
     ColumnPtr evaluate(ExprContext* context, vectorized::Chunk* ptr) override {
+        if constexpr (is_fusable_type<Type>) {
+            if (has_fusable_child<Type>(this)) {
+                using CppType = RunTimeCppType<Type>;
+                using ResultCppType = RunTimeCppType<TYPE_BOOLEAN>;
+                return evaluate_fused_binary<Type, TYPE_BOOLEAN>(
+                        this, context, ptr, [](const CppType* l, const CppType* r, ResultCppType* out, size_t count) {
+                            for (size_t i = 0; i < count; i++) {
+                                out[i] = OP::template apply<CppType, CppType, ResultCppType>(l[i], r[i]);
+                            }
+                        });
+            }
+        }
         auto l = _children[0]->evaluate(context, ptr);
         auto r = _children[1]->evaluate(context, ptr);
         return VectorizedStrictBinaryFunction<OP>::template evaluate<Type, TYPE_BOOLEAN>(l, r);
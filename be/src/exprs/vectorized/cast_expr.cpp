@@ -14,7 +14,9 @@
 #include "exprs/vectorized/unary_function.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/runtime_state.h"
+#include "simd/simd.h"
 #include "storage/hll.h"
+#include "util/batch_string_parser.h"
 #include "util/date_func.h"
 
 namespace starrocks::vectorized {
@@ -178,8 +180,36 @@ DEFINE_UNARY_FN_WITH_IMPL(TimestampToNumber, value) {
     return value.to_timestamp_literal();
 }
 
+// Parse all the strings of a non-constant column at once by |parse|, which is one of the batch functions of
+// BatchStringParser.
+template <PrimitiveType ToType, typename ParseFunc>
+ColumnPtr cast_from_string_by_batch(const ColumnPtr& column, ParseFunc&& parse) {
+    const auto* binary = down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(column.get()));
+    size_t num_rows = binary->size();
+    auto data = RunTimeColumnType<ToType>::create(num_rows);
+    auto nulls = NullColumn::create(num_rows);
+    parse(binary->get_bytes().data(), binary->get_offset().data(), num_rows, data->get_data().data(),
+          nulls->get_data().data());
+
+    if (column->is_nullable()) {
+        const auto& input_nulls = down_cast<const NullableColumn*>(column.get())->immutable_null_column_data();
+        auto& output_nulls = nulls->get_data();
+        for (size_t i = 0; i < num_rows; ++i) {
+            output_nulls[i] |= input_nulls[i];
+        }
+    }
+    if (SIMD::count_nonzero(nulls->get_data()) == 0) {
+        return data;
+    }
+    return NullableColumn::create(data, nulls);
+}
+
 template <PrimitiveType FromType, PrimitiveType ToType>
 ColumnPtr cast_int_from_string_fn(ColumnPtr& column) {
+    if (!column->is_constant()) {
+        return cast_from_string_by_batch<ToType>(column, BatchStringParser::parse_ints<RunTimeCppType<ToType>>);
+    }
+
     ColumnBuilder<ToType> builder;
     ColumnViewer<TYPE_VARCHAR> viewer(column);
 
@@ -204,6 +234,10 @@ ColumnPtr cast_int_from_string_fn(ColumnPtr& column) {
 
 template <PrimitiveType FromType, PrimitiveType ToType>
 ColumnPtr cast_float_from_string_fn(ColumnPtr& column) {
+    if (!column->is_constant()) {
+        return cast_from_string_by_batch<ToType>(column, BatchStringParser::parse_floats<RunTimeCppType<ToType>>);
+    }
+
     ColumnBuilder<ToType> builder;
     ColumnViewer<TYPE_VARCHAR> viewer(column);
 
@@ -444,6 +478,17 @@ CUSTOMIZE_FN_CAST(TYPE_DECIMALV2, TYPE_DATE, cast_to_date_fn);
 UNARY_FN_CAST(TYPE_DATETIME, TYPE_DATE, TimestampToDate);
 // Time to date need rewrite CastExpr
 
+static inline bool date_from_string(DateValue* v, const Slice& value) {
+    int year, month, day;
+    // fast path for YYYY-MM-DD
+    if (BatchStringParser::try_parse_iso_date(value.data, value.size, &year, &month, &day) &&
+        date::check(year, month, day)) {
+        v->from_date(year, month, day);
+        return true;
+    }
+    return v->from_string(value.data, value.size);
+}
+
 template <>
 ColumnPtr cast_fn<TYPE_VARCHAR, TYPE_DATE>(ColumnPtr& column) {
     ColumnBuilder<TYPE_DATE> builder;
@@ -454,7 +499,7 @@ ColumnPtr cast_fn<TYPE_VARCHAR, TYPE_DATE>(ColumnPtr& column) {
             auto value = viewer.value(row);
             DateValue v;
 
-            bool right = v.from_string(value.data, value.size);
+            bool right = date_from_string(&v, value);
             builder.append(v, !right);
         }
     } else {
@@ -467,7 +512,7 @@ ColumnPtr cast_fn<TYPE_VARCHAR, TYPE_DATE>(ColumnPtr& column) {
             auto value = viewer.value(row);
             DateValue v;
 
-            bool right = v.from_string(value.data, value.size);
+            bool right = date_from_string(&v, value);
             builder.append(v, !right);
         }
     }
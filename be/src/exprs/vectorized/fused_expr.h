@@ -0,0 +1,334 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "column/column_helper.h"
+#include "column/const_column.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "column/type_traits.h"
+#include "exprs/expr.h"
+#include "exprs/vectorized/arithmetic_operation.h"
+
+namespace starrocks::vectorized {
+
+// Fused evaluation of the expression trees made of arithmetic on numbers, e.g. `a * b + c * d > e`.
+//
+// Evaluated node by node, every arithmetic node materializes a chunk-sized column and merges the
+// null columns of its children. Instead, the topmost node of such a tree only evaluates the leaves,
+// i.e. the nodes which can't be fused such as column refs, literals and casts, then computes the
+// tree tile by tile. The intermediate results of a tile are kept in buffers small enough to stay in
+// L1 cache, and only the result of the topmost node is written out.
+
+static constexpr size_t FUSED_TILE_SIZE = 256;
+
+template <PrimitiveType Type>
+constexpr bool is_fusable_type = pt_is_integer<Type> || pt_is_float<Type>;
+
+// The operators applied on a tile without any check, so an expr tree made of them can be computed
+// tile by tile with the same result.
+template <PrimitiveType Type, typename OP>
+constexpr bool is_fusable_arithmetic =
+        is_fusable_type<Type> && (is_add_op<OP> || is_sub_op<OP> || is_mul_op<OP> || is_bitand_op<OP> ||
+                                  is_bitor_op<OP> || is_bitxor_op<OP>);
+
+// Implemented by the arithmetic exprs which can be fused into the tree of their parent.
+template <PrimitiveType Type>
+class FusableArithmeticExpr {
+public:
+    using CppType = RunTimeCppType<Type>;
+
+    virtual ~FusableArithmeticExpr() = default;
+
+    virtual void apply_tile(const CppType* l, const CppType* r, CppType* out, size_t count) const = 0;
+};
+
+template <PrimitiveType Type, typename OP>
+class FusableArithmetic : public FusableArithmeticExpr<Type> {
+public:
+    using CppType = RunTimeCppType<Type>;
+
+    void apply_tile(const CppType* l, const CppType* r, CppType* out, size_t count) const override {
+        using ArithmeticOp = ArithmeticBinaryOperator<OP, Type>;
+        for (size_t i = 0; i < count; i++) {
+            out[i] = ArithmeticOp::template apply<CppType, CppType, CppType>(l[i], r[i]);
+        }
+    }
+};
+
+struct NonFusableArithmetic {};
+
+template <PrimitiveType Type, typename OP>
+using FusableArithmeticBase =
+        std::conditional_t<is_fusable_arithmetic<Type, OP>, FusableArithmetic<Type, OP>, NonFusableArithmetic>;
+
+template <PrimitiveType Type>
+bool is_fusable_expr(const Expr* expr) {
+    return dynamic_cast<const FusableArithmeticExpr<Type>*>(expr) != nullptr;
+}
+
+// Whether |expr| is the root of a tree worth fusing, i.e. at least one child is fusable.
+template <PrimitiveType Type>
+bool has_fusable_child(const Expr* expr) {
+    if constexpr (is_fusable_type<Type>) {
+        const auto& children = expr->children();
+        return std::any_of(children.begin(), children.end(), [](const Expr* e) { return is_fusable_expr<Type>(e); });
+    } else {
+        return false;
+    }
+}
+
+// A fusable subtree flattened into post order, with its leaves evaluated.
+template <PrimitiveType Type>
+class FusedTree {
+public:
+    using CppType = RunTimeCppType<Type>;
+    using ColumnType = RunTimeColumnType<Type>;
+
+    void prepare(Expr* root, ExprContext* context, Chunk* chunk) {
+        int depth = 0;
+        _flatten(root, context, chunk, &depth);
+        _values.resize(_max_depth * FUSED_TILE_SIZE);
+        _nulls.resize(_max_depth * FUSED_TILE_SIZE);
+    }
+
+    size_t num_rows() const {
+        size_t rows = 0;
+        for (const auto& leaf : _leaves) {
+            rows = std::max(rows, leaf.column->size());
+        }
+        return rows;
+    }
+
+    bool all_const() const {
+        return std::all_of(_leaves.begin(), _leaves.end(), [](const Leaf& leaf) { return leaf.is_const; });
+    }
+
+    bool is_nullable() const {
+        return std::any_of(_leaves.begin(), _leaves.end(), [](const Leaf& leaf) { return leaf.is_nullable; });
+    }
+
+    bool may_have_null() const {
+        return std::any_of(_leaves.begin(), _leaves.end(), [](const Leaf& leaf) { return leaf.nulls != nullptr; });
+    }
+
+    // Compute the rows [offset, offset + count) of the tree, the results are valid until the next call.
+    // |*nulls| is set to nullptr if no row is null. The values are not computed if |with_values| is false.
+    void evaluate_tile(size_t offset, size_t count, bool with_values, const CppType** values, const uint8_t** nulls) {
+        DCHECK_LE(count, FUSED_TILE_SIZE);
+        size_t sp = 0;
+        for (const Step& step : _steps) {
+            if (step.op == nullptr) {
+                const Leaf& leaf = _leaves[step.leaf];
+                size_t pos = leaf.is_const ? 0 : offset;
+                _stack[sp].values = leaf.values + pos;
+                _stack[sp].nulls = leaf.nulls != nullptr ? leaf.nulls + pos : nullptr;
+                sp++;
+                continue;
+            }
+            DCHECK_GE(sp, 2);
+            Operand& l = _stack[sp - 2];
+            const Operand& r = _stack[sp - 1];
+            // the result replaces the left operand, which may be in the same buffer.
+            CppType* out_values = _values.data() + (sp - 2) * FUSED_TILE_SIZE;
+            uint8_t* out_nulls = _nulls.data() + (sp - 2) * FUSED_TILE_SIZE;
+            if (with_values) {
+                step.op->apply_tile(l.values, r.values, out_values, count);
+            }
+            if (l.nulls != nullptr && r.nulls != nullptr) {
+                for (size_t i = 0; i < count; i++) {
+                    out_nulls[i] = l.nulls[i] | r.nulls[i];
+                }
+                l.nulls = out_nulls;
+            } else if (l.nulls != nullptr || r.nulls != nullptr) {
+                const uint8_t* src = l.nulls != nullptr ? l.nulls : r.nulls;
+                if (src != out_nulls) {
+                    memcpy(out_nulls, src, count);
+                }
+                l.nulls = out_nulls;
+            }
+            l.values = out_values;
+            sp--;
+        }
+        DCHECK_EQ(1, sp);
+        *values = _stack[0].values;
+        *nulls = _stack[0].nulls;
+    }
+
+private:
+    struct Leaf {
+        ColumnPtr column;
+        const CppType* values = nullptr;
+        const uint8_t* nulls = nullptr;
+        bool is_const = false;
+        bool is_nullable = false;
+        // a const value broadcast to a tile
+        std::vector<CppType> const_values;
+        std::vector<uint8_t> const_nulls;
+    };
+
+    struct Step {
+        const FusableArithmeticExpr<Type>* op = nullptr;
+        size_t leaf = 0;
+    };
+
+    struct Operand {
+        const CppType* values = nullptr;
+        const uint8_t* nulls = nullptr;
+    };
+
+    void _flatten(Expr* expr, ExprContext* context, Chunk* chunk, int* depth) {
+        const auto* op = dynamic_cast<const FusableArithmeticExpr<Type>*>(expr);
+        if (op != nullptr) {
+            _flatten(expr->get_child(0), context, chunk, depth);
+            _flatten(expr->get_child(1), context, chunk, depth);
+            _steps.push_back({op, 0});
+            (*depth)--;
+            return;
+        }
+        _steps.push_back({nullptr, _leaves.size()});
+        _add_leaf(expr->evaluate(context, chunk));
+        _max_depth = std::max(_max_depth, ++(*depth));
+        _stack.resize(_max_depth);
+    }
+
+    void _add_leaf(ColumnPtr column) {
+        Leaf& leaf = _leaves.emplace_back();
+        leaf.is_nullable = column->is_nullable();
+        if (column->only_null()) {
+            leaf.is_const = true;
+            leaf.const_values.assign(FUSED_TILE_SIZE, CppType());
+            leaf.const_nulls.assign(FUSED_TILE_SIZE, 1);
+        } else if (column->is_constant()) {
+            leaf.is_const = true;
+            leaf.const_values.assign(FUSED_TILE_SIZE, ColumnHelper::get_const_value<Type>(column));
+        } else if (column->is_nullable()) {
+            const auto* nullable = down_cast<const NullableColumn*>(column.get());
+            leaf.values = down_cast<const ColumnType*>(nullable->data_column().get())->get_data().data();
+            if (nullable->has_null()) {
+                leaf.nulls = nullable->null_column()->get_data().data();
+            }
+        } else {
+            leaf.values = down_cast<const ColumnType*>(column.get())->get_data().data();
+        }
+        if (leaf.is_const) {
+            leaf.values = leaf.const_values.data();
+            leaf.nulls = leaf.const_nulls.empty() ? nullptr : leaf.const_nulls.data();
+        }
+        leaf.column = std::move(column);
+    }
+
+    std::vector<Leaf> _leaves;
+    std::vector<Step> _steps;
+    std::vector<Operand> _stack;
+    int _max_depth = 0;
+    // the buffers of the intermediate results, one tile for each level of the stack
+    std::vector<CppType> _values;
+    std::vector<uint8_t> _nulls;
+};
+
+// Evaluate a binary expr whose children are computed as fused trees, |op| computes a tile of
+// the result from the tiles of the children.
+template <PrimitiveType Type, PrimitiveType ResultType, typename TileOp>
+ColumnPtr evaluate_fused_binary(Expr* expr, ExprContext* context, Chunk* chunk, TileOp&& op) {
+    FusedTree<Type> lhs;
+    FusedTree<Type> rhs;
+    lhs.prepare(expr->get_child(0), context, chunk);
+    rhs.prepare(expr->get_child(1), context, chunk);
+
+    size_t num_rows = std::max(lhs.num_rows(), rhs.num_rows());
+    bool all_const = lhs.all_const() && rhs.all_const();
+    size_t result_rows = all_const ? std::min<size_t>(num_rows, 1) : num_rows;
+
+    auto result = RunTimeColumnType<ResultType>::create();
+    result->resize_uninitialized(result_rows);
+    auto* result_data = result->get_data().data();
+    NullColumnPtr null_column;
+    if (lhs.is_nullable() || rhs.is_nullable()) {
+        null_column = NullColumn::create(result_rows, 0);
+    }
+
+    const RunTimeCppType<Type>* l_values = nullptr;
+    const RunTimeCppType<Type>* r_values = nullptr;
+    const uint8_t* l_nulls = nullptr;
+    const uint8_t* r_nulls = nullptr;
+    for (size_t offset = 0; offset < result_rows; offset += FUSED_TILE_SIZE) {
+        size_t count = std::min(FUSED_TILE_SIZE, result_rows - offset);
+        lhs.evaluate_tile(offset, count, true, &l_values, &l_nulls);
+        rhs.evaluate_tile(offset, count, true, &r_values, &r_nulls);
+        op(l_values, r_values, result_data + offset, count);
+        if (null_column != nullptr) {
+            uint8_t* nulls = null_column->get_data().data() + offset;
+            for (size_t i = 0; i < count; i++) {
+                nulls[i] = (l_nulls != nullptr && l_nulls[i]) | (r_nulls != nullptr && r_nulls[i]);
+            }
+        }
+    }
+
+    ColumnPtr column = result;
+    if (null_column != nullptr) {
+        auto nullable = NullableColumn::create(result, null_column);
+        nullable->update_has_null();
+        column = nullable;
+    }
+    if (all_const) {
+        if (column->is_null(0)) {
+            return ColumnHelper::create_const_null_column(num_rows);
+        }
+        return ConstColumn::create(result, num_rows);
+    }
+    return column;
+}
+
+// Evaluate whether the rows of a fused tree are null, the values of the tree are not computed.
+template <PrimitiveType Type>
+ColumnPtr evaluate_fused_is_null(Expr* child, ExprContext* context, Chunk* chunk, bool is_null) {
+    FusedTree<Type> tree;
+    tree.prepare(child, context, chunk);
+    size_t num_rows = tree.num_rows();
+    if (!tree.may_have_null()) {
+        return ColumnHelper::create_const_column<TYPE_BOOLEAN>(!is_null, num_rows);
+    }
+
+    auto result = BooleanColumn::create();
+    result->resize_uninitialized(num_rows);
+    auto* result_data = result->get_data().data();
+    const RunTimeCppType<Type>* values = nullptr;
+    const uint8_t* nulls = nullptr;
+    for (size_t offset = 0; offset < num_rows; offset += FUSED_TILE_SIZE) {
+        size_t count = std::min(FUSED_TILE_SIZE, num_rows - offset);
+        tree.evaluate_tile(offset, count, false, &values, &nulls);
+        for (size_t i = 0; i < count; i++) {
+            result_data[offset + i] = (nulls != nullptr && nulls[i]) == is_null;
+        }
+    }
+    return result;
+}
+
+// Evaluate `child IS NULL` or `child IS NOT NULL` as a fused tree, return nullptr if |child| can't be fused.
+inline ColumnPtr try_evaluate_fused_is_null(Expr* child, ExprContext* context, Chunk* chunk, bool is_null) {
+    switch (child->type().type) {
+#define CASE_FUSED_IS_NULL(TYPE)                                                 \
+    case TYPE:                                                                   \
+        if (is_fusable_expr<TYPE>(child)) {                                      \
+            return evaluate_fused_is_null<TYPE>(child, context, chunk, is_null); \
+        }                                                                        \
+        return nullptr;
+        CASE_FUSED_IS_NULL(TYPE_TINYINT)
+        CASE_FUSED_IS_NULL(TYPE_SMALLINT)
+        CASE_FUSED_IS_NULL(TYPE_INT)
+        CASE_FUSED_IS_NULL(TYPE_BIGINT)
+        CASE_FUSED_IS_NULL(TYPE_LARGEINT)
+        CASE_FUSED_IS_NULL(TYPE_FLOAT)
+        CASE_FUSED_IS_NULL(TYPE_DOUBLE)
+#undef CASE_FUSED_IS_NULL
+    default:
+        return nullptr;
+    }
+}
+
+} // namespace starrocks::vectorized
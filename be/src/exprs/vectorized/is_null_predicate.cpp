@@ -4,6 +4,7 @@
 
 #include "column/column_builder.h"
 #include "column/column_helper.h"
+#include "exprs/vectorized/fused_expr.h"
 #include "exprs/vectorized/unary_function.h"
 
 namespace starrocks::vectorized {
@@ -24,6 +25,10 @@ public:
     DEFINE_CLASS_CONSTRUCT_FN(VectorizedIsNullPredicate);
 
     ColumnPtr evaluate(ExprContext* context, vectorized::Chunk* ptr) override {
+        // the nulls of an arithmetic tree come from its leaves, so its values needn't be computed.
+        if (ColumnPtr fused = try_evaluate_fused_is_null(_children[0], context, ptr, true); fused != nullptr) {
+            return fused;
+        }
         ColumnPtr column = _children[0]->evaluate(context, ptr);
 
         if (column->only_null()) {
@@ -48,6 +53,9 @@ public:
     DEFINE_CLASS_CONSTRUCT_FN(VectorizedIsNotNullPredicate);
 
     ColumnPtr evaluate(ExprContext* context, vectorized::Chunk* ptr) override {
+        if (ColumnPtr fused = try_evaluate_fused_is_null(_children[0], context, ptr, false); fused != nullptr) {
+            return fused;
+        }
         ColumnPtr column = _children[0]->evaluate(context, ptr);
 
         if (column->only_null()) {
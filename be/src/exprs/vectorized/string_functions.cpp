@@ -19,6 +19,7 @@
 #include "storage/olap_define.h"
 #include "util/raw_container.h"
 #include "util/sm3.h"
+#include "util/text_tokenizer.h"
 #include "util/utf8.h"
 
 namespace starrocks::vectorized {
@@ -797,6 +798,45 @@ ColumnPtr StringFunctions::ends_with(FunctionContext* context, const Columns& co
     return VectorizedStrictBinaryFunction<ends_withImpl>::evaluate<TYPE_VARCHAR, TYPE_BOOLEAN>(columns[0], columns[1]);
 }
 
+// match_any, match_all
+template <bool match_all>
+static ColumnPtr match_terms(const Columns& columns) {
+    auto str_viewer = ColumnViewer<TYPE_VARCHAR>(columns[0]);
+    auto query_viewer = ColumnViewer<TYPE_VARCHAR>(columns[1]);
+
+    // the query is split into terms only once if it's constant.
+    std::unique_ptr<TextMatcher> const_matcher;
+    if (columns[1]->is_constant() && !query_viewer.is_null(0)) {
+        const_matcher = std::make_unique<TextMatcher>(std::vector<std::string>{query_viewer.value(0).to_string()},
+                                                      match_all);
+    }
+
+    TextMatcher::Context ctx;
+    ColumnBuilder<TYPE_BOOLEAN> result;
+    auto size = columns[0]->size();
+    for (int row = 0; row < size; ++row) {
+        if (str_viewer.is_null(row) || query_viewer.is_null(row)) {
+            result.append_null();
+            continue;
+        }
+        if (const_matcher != nullptr) {
+            result.append(const_matcher->match(str_viewer.value(row), &ctx));
+        } else {
+            TextMatcher matcher({query_viewer.value(row).to_string()}, match_all);
+            result.append(matcher.match(str_viewer.value(row), &ctx));
+        }
+    }
+    return result.build(ColumnHelper::is_all_const(columns));
+}
+
+ColumnPtr StringFunctions::match_any(FunctionContext* context, const Columns& columns) {
+    return match_terms<false>(columns);
+}
+
+ColumnPtr StringFunctions::match_all(FunctionContext* context, const Columns& columns) {
+    return match_terms<true>(columns);
+}
+
 struct SpaceFunction {
 public:
     template <PrimitiveType Type, PrimitiveType ResultType>
@@ -71,6 +71,17 @@ public:
      */
     DEFINE_VECTORIZED_FN(ends_with);
 
+    /**
+     * Whether string_value contains any/all of the terms of query, see TextMatcher.
+     * On a column of the OLAP table, it's pushed down to the storage and evaluated by the inverted index.
+     *
+     * @param: [string_value, query]
+     * @paramType: [BinaryColumn, BinaryColumn]
+     * @return: BooleanColumn
+     */
+    DEFINE_VECTORIZED_FN(match_any);
+    DEFINE_VECTORIZED_FN(match_all);
+
     /**
      * Return a string of the specified number of spaces
      *
@@ -133,6 +133,8 @@ Status TimeFunctions::convert_tz_prepare(starrocks_udf::FunctionContext* context
         return Status::OK();
     }
 
+    ctc->from_table.init(ctc->from_tz);
+    ctc->to_table.init(ctc->to_tz);
     ctc->is_valid = true;
     return Status::OK();
 }
@@ -193,40 +195,24 @@ ColumnPtr TimeFunctions::convert_tz_general(FunctionContext* context, const Colu
     return result.build(ColumnHelper::is_all_const(columns));
 }
 
-ColumnPtr TimeFunctions::convert_tz_const(FunctionContext* context, const Columns& columns, const cctz::time_zone& from,
-                                          const cctz::time_zone& to) {
+ColumnPtr TimeFunctions::convert_tz_const(FunctionContext* context, const Columns& columns,
+                                          const TimezoneOffsetTable& from, const TimezoneOffsetTable& to) {
     auto time_viewer = ColumnViewer<TYPE_DATETIME>(columns[0]);
 
     ColumnBuilder<TYPE_DATETIME> result;
     auto size = columns[0]->size();
+    size_t from_hint = 0;
+    size_t to_hint = 0;
     for (int row = 0; row < size; ++row) {
         if (time_viewer.is_null(row)) {
             result.append_null();
             continue;
         }
 
-        auto datetime_value = time_viewer.value(row);
-
-        int year, month, day, hour, minute, second, usec;
-        datetime_value.to_timestamp(&year, &month, &day, &hour, &minute, &second, &usec);
-        DateTimeValue ts_value(TIME_DATETIME, year, month, day, hour, minute, second, usec);
-
-        int64_t timestamp;
-        // TODO find a better approach to replace datetime_value.unix_timestamp
-        if (!ts_value.unix_timestamp(&timestamp, from)) {
-            result.append_null();
-            continue;
-        }
-        DateTimeValue ts_value2;
-        // TODO find a better approach to replace datetime_value.from_unixtime
-        if (!ts_value2.from_unixtime(timestamp, to)) {
-            result.append_null();
-            continue;
-        }
-
+        // The microseconds are truncated, same as converting by DateTimeValue.
+        int64_t utc_seconds = from.local_to_utc(time_viewer.value(row).to_unix_second(), &from_hint);
         TimestampValue ts;
-        ts.from_timestamp(ts_value2.year(), ts_value2.month(), ts_value2.day(), ts_value2.hour(), ts_value2.minute(),
-                          ts_value2.second(), 0);
+        ts.from_unix_second(to.utc_to_local(utc_seconds, &to_hint));
         result.append(ts);
     }
 
@@ -243,7 +229,7 @@ ColumnPtr TimeFunctions::convert_tz(FunctionContext* context, const Columns& col
         return ColumnHelper::create_const_null_column(columns[0]->size());
     }
 
-    return convert_tz_const(context, columns, ctc->from_tz, ctc->to_tz);
+    return convert_tz_const(context, columns, ctc->from_table, ctc->to_table);
 }
 
 ColumnPtr TimeFunctions::utc_timestamp(FunctionContext* context, const Columns& columns) {
@@ -612,30 +598,22 @@ DEFINE_TIME_BINARY_FN(seconds_diff, TYPE_DATETIME, TYPE_DATETIME, TYPE_BIGINT);
 ColumnPtr TimeFunctions::to_unix_from_datetime(FunctionContext* context, const Columns& columns) {
     DCHECK_EQ(columns.size(), 1);
 
+    auto* ctx = reinterpret_cast<UnixTimestampCtx*>(context->get_function_state(FunctionContext::FRAGMENT_LOCAL));
     auto date_viewer = ColumnViewer<TYPE_DATETIME>(columns[0]);
 
     ColumnBuilder<TYPE_INT> result;
     auto size = columns[0]->size();
+    size_t hint = 0;
     for (int row = 0; row < size; ++row) {
         if (date_viewer.is_null(row)) {
             result.append_null();
             continue;
         }
 
-        auto date = date_viewer.value(row);
-
-        int year, month, day, hour, minute, second, usec;
-        date.to_timestamp(&year, &month, &day, &hour, &minute, &second, &usec);
-        DateTimeValue tv(TIME_DATETIME, year, month, day, hour, minute, second, usec);
-
-        int64_t timestamp;
-        if (!tv.unix_timestamp(&timestamp, context->impl()->state()->timezone_obj())) {
-            result.append_null();
-        } else {
-            timestamp = timestamp < 0 ? 0 : timestamp;
-            timestamp = timestamp > INT_MAX ? 0 : timestamp;
-            result.append(timestamp);
-        }
+        int64_t timestamp = ctx->timezone_table.local_to_utc(date_viewer.value(row).to_unix_second(), &hint);
+        timestamp = timestamp < 0 ? 0 : timestamp;
+        timestamp = timestamp > INT_MAX ? 0 : timestamp;
+        result.append(timestamp);
     }
 
     return result.build(ColumnHelper::is_all_const(columns));
@@ -647,30 +625,23 @@ ColumnPtr TimeFunctions::to_unix_from_datetime(FunctionContext* context, const C
 ColumnPtr TimeFunctions::to_unix_from_date(FunctionContext* context, const Columns& columns) {
     DCHECK_EQ(columns.size(), 1);
 
+    auto* ctx = reinterpret_cast<UnixTimestampCtx*>(context->get_function_state(FunctionContext::FRAGMENT_LOCAL));
     auto date_viewer = ColumnViewer<TYPE_DATE>(columns[0]);
 
     ColumnBuilder<TYPE_INT> result;
     auto size = columns[0]->size();
+    size_t hint = 0;
     for (int row = 0; row < size; ++row) {
         if (date_viewer.is_null(row)) {
             result.append_null();
             continue;
         }
 
-        auto date = date_viewer.value(row);
-
-        int year, month, day;
-        date.to_date(&year, &month, &day);
-        DateTimeValue tv(TIME_DATE, year, month, day, 0, 0, 0, 0);
-
-        int64_t timestamp;
-        if (!tv.unix_timestamp(&timestamp, context->impl()->state()->timezone_obj())) {
-            result.append_null();
-        } else {
-            timestamp = timestamp < 0 ? 0 : timestamp;
-            timestamp = timestamp > INT_MAX ? 0 : timestamp;
-            result.append(timestamp);
-        }
+        TimestampValue ts = date_viewer.value(row);
+        int64_t timestamp = ctx->timezone_table.local_to_utc(ts.to_unix_second(), &hint);
+        timestamp = timestamp < 0 ? 0 : timestamp;
+        timestamp = timestamp > INT_MAX ? 0 : timestamp;
+        result.append(timestamp);
     }
 
     return result.build(ColumnHelper::is_all_const(columns));
@@ -680,11 +651,13 @@ ColumnPtr TimeFunctions::to_unix_from_datetime_with_format(FunctionContext* cont
     DCHECK_EQ(columns.size(), 2);
     RETURN_IF_COLUMNS_ONLY_NULL(columns);
 
+    auto* ctx = reinterpret_cast<UnixTimestampCtx*>(context->get_function_state(FunctionContext::FRAGMENT_LOCAL));
     auto date_viewer = ColumnViewer<TYPE_VARCHAR>(columns[0]);
     auto formatViewer = ColumnViewer<TYPE_VARCHAR>(columns[1]);
 
     ColumnBuilder<TYPE_INT> result;
     auto size = columns[0]->size();
+    size_t hint = 0;
     for (int row = 0; row < size; ++row) {
         if (date_viewer.is_null(row) || formatViewer.is_null(row)) {
             result.append_null();
@@ -697,17 +670,21 @@ ColumnPtr TimeFunctions::to_unix_from_datetime_with_format(FunctionContext* cont
             result.append_null();
             continue;
         }
-        DateTimeValue tv;
-        if (!tv.from_date_format_str(format.data, format.size, date.data, date.size)) {
-            result.append_null();
-            continue;
-        }
         int64_t timestamp;
-        if (!tv.unix_timestamp(&timestamp, context->impl()->state()->timezone_obj())) {
-            result.append_null();
-            continue;
+        TimestampValue ts;
+        if (ctx->format.can_parse() && ctx->format.parse(date.data, date.size, &ts)) {
+            timestamp = ctx->timezone_table.local_to_utc(ts.to_unix_second(), &hint);
+        } else {
+            DateTimeValue tv;
+            if (!tv.from_date_format_str(format.data, format.size, date.data, date.size)) {
+                result.append_null();
+                continue;
+            }
+            if (!tv.unix_timestamp(&timestamp, context->impl()->state()->timezone_obj())) {
+                result.append_null();
+                continue;
+            }
         }
-
         timestamp = timestamp < 0 ? 0 : timestamp;
         timestamp = timestamp > INT_MAX ? 0 : timestamp;
         result.append(timestamp);
@@ -716,6 +693,38 @@ ColumnPtr TimeFunctions::to_unix_from_datetime_with_format(FunctionContext* cont
     return result.build(ColumnHelper::is_all_const(columns));
 }
 
+Status TimeFunctions::unix_timestamp_prepare(starrocks_udf::FunctionContext* context,
+                                             starrocks_udf::FunctionContext::FunctionStateScope scope) {
+    if (scope != FunctionContext::FRAGMENT_LOCAL) {
+        return Status::OK();
+    }
+
+    auto* ctx = new UnixTimestampCtx();
+    context->set_function_state(scope, ctx);
+    ctx->timezone_table.init(context->impl()->state()->timezone_obj());
+
+    // The format of unix_timestamp(VARCHAR, VARCHAR)
+    if (!context->is_constant_column(1)) {
+        return Status::OK();
+    }
+    auto column = context->get_constant_column(1);
+    if (column->only_null() || column->is_null(0)) {
+        return Status::OK();
+    }
+    auto format = ColumnHelper::get_const_value<TYPE_VARCHAR>(column);
+    ctx->format.compile(format.data, format.size);
+    return Status::OK();
+}
+
+Status TimeFunctions::unix_timestamp_close(starrocks_udf::FunctionContext* context,
+                                           starrocks_udf::FunctionContext::FunctionStateScope scope) {
+    if (scope == FunctionContext::FRAGMENT_LOCAL) {
+        auto* ctx = reinterpret_cast<UnixTimestampCtx*>(context->get_function_state(scope));
+        delete ctx;
+    }
+    return Status::OK();
+}
+
 ColumnPtr TimeFunctions::to_unix_for_now(FunctionContext* context, const Columns& columns) {
     DCHECK_EQ(columns.size(), 0);
     auto result = Int32Column::create();
@@ -734,10 +743,12 @@ ColumnPtr TimeFunctions::from_unix_to_datetime(FunctionContext* context, const C
 
     RETURN_IF_COLUMNS_ONLY_NULL(columns);
 
+    auto* state = reinterpret_cast<FromUnixState*>(context->get_function_state(FunctionContext::FRAGMENT_LOCAL));
     ColumnViewer<TYPE_INT> data_column(columns[0]);
 
     ColumnBuilder<TYPE_VARCHAR> result;
     auto size = columns[0]->size();
+    size_t hint = 0;
     for (int row = 0; row < size; ++row) {
         if (data_column.is_null(row)) {
             result.append_null();
@@ -750,14 +761,11 @@ ColumnPtr TimeFunctions::from_unix_to_datetime(FunctionContext* context, const C
             continue;
         }
 
-        DateTimeValue dtv;
-        if (!dtv.from_unixtime(date, context->impl()->state()->timezone_obj())) {
-            result.append_null();
-            continue;
-        }
+        TimestampValue ts;
+        ts.from_unix_second(state->timezone_table.utc_to_local(date, &hint));
         char buf[64];
-        dtv.to_string(buf);
-        result.append(Slice(buf));
+        int len = ts.to_string(buf, sizeof(buf));
+        result.append(Slice(buf, len));
     }
 
     return result.build(ColumnHelper::is_all_const(columns));
@@ -798,7 +806,9 @@ Status TimeFunctions::from_unix_prepare(starrocks_udf::FunctionContext* context,
 
     FromUnixState* state = new FromUnixState();
     context->set_function_state(scope, state);
+    state->timezone_table.init(context->impl()->state()->timezone_obj());
 
+    // The format of from_unixtime(INT, VARCHAR)
     if (!context->is_constant_column(1)) {
         return Status::OK();
     }
@@ -816,6 +826,7 @@ Status TimeFunctions::from_unix_prepare(starrocks_udf::FunctionContext* context,
     }
 
     state->format_content = convert_format(format);
+    state->format_compiled = state->format.compile(state->format_content.data(), state->format_content.size());
     return Status::OK();
 }
 
@@ -875,7 +886,7 @@ ColumnPtr TimeFunctions::from_unix_with_format_general(FunctionContext* context,
     return result.build(ColumnHelper::is_all_const(columns));
 }
 
-ColumnPtr TimeFunctions::from_unix_with_format_const(std::string& format_content, FunctionContext* context,
+ColumnPtr TimeFunctions::from_unix_with_format_const(const FromUnixState& state, FunctionContext* context,
                                                      const Columns& columns) {
     DCHECK_EQ(columns.size(), 2);
 
@@ -884,7 +895,9 @@ ColumnPtr TimeFunctions::from_unix_with_format_const(std::string& format_content
     ColumnBuilder<TYPE_VARCHAR> result;
     ColumnViewer<TYPE_INT> data_column(columns[0]);
 
+    const std::string& format_content = state.format_content;
     auto size = columns[0]->size();
+    size_t hint = 0;
     for (int row = 0; row < size; ++row) {
         if (data_column.is_null(row)) {
             result.append_null();
@@ -897,13 +910,20 @@ ColumnPtr TimeFunctions::from_unix_with_format_const(std::string& format_content
             continue;
         }
 
+        char buf[DateTimeFormat::MAX_FORMAT_LENGTH];
+        if (state.format_compiled) {
+            TimestampValue ts;
+            ts.from_unix_second(state.timezone_table.utc_to_local(date, &hint));
+            char* end = state.format.format(ts, buf);
+            result.append(Slice(buf, end - buf));
+            continue;
+        }
+
         DateTimeValue dtv;
         if (!dtv.from_unixtime(date, context->impl()->state()->timezone_obj())) {
             result.append_null();
             continue;
         }
-
-        char buf[128];
         if (!dtv.to_format_string((const char*)format_content.c_str(), format_content.size(), buf)) {
             result.append_null();
             continue;
@@ -921,8 +941,7 @@ ColumnPtr TimeFunctions::from_unix_to_datetime_with_format(FunctionContext* cont
             reinterpret_cast<FromUnixState*>(context->get_function_state(FunctionContext::FRAGMENT_LOCAL));
 
     if (state->const_format) {
-        std::string format_content = state->format_content;
-        return from_unix_with_format_const(format_content, context, columns);
+        return from_unix_with_format_const(*state, context, columns);
     }
 
     return from_unix_with_format_general(context, columns);
@@ -1026,6 +1045,16 @@ Status TimeFunctions::str_to_date_prepare(starrocks_udf::FunctionContext* contex
         fc->fmt_type = yyyycMMcddcHHcmmcss;
         fc->fmt = start;
         context->set_function_state(scope, fc);
+    } else {
+        DateTimeFormat format;
+        format.compile(slice.data, slice.size);
+        if (format.can_parse()) {
+            StrToDateCtx* fc = new StrToDateCtx();
+            fc->fmt_type = None;
+            fc->fmt = nullptr;
+            fc->format = std::move(format);
+            context->set_function_state(scope, fc);
+        }
     }
     return Status::OK();
 }
@@ -1116,6 +1145,35 @@ ColumnPtr TimeFunctions::str_to_date_from_datetime_format(FunctionContext* conte
     return result.build(ColumnHelper::is_all_const(columns));
 }
 
+// try to transfer content by the compiled format, which consists of only the numeric fields and the literals,
+// if successful, return result TimestampValue
+// else take a uncommon approach to process this content.
+ColumnPtr TimeFunctions::str_to_date_from_compiled_format(FunctionContext* context,
+                                                          const starrocks::vectorized::Columns& columns,
+                                                          const DateTimeFormat& format) {
+    ColumnBuilder<TYPE_DATETIME> result;
+    size_t size = columns[0]->size();
+    result.reserve(size);
+
+    TimestampValue ts;
+    auto str_viewer = ColumnViewer<TYPE_VARCHAR>(columns[0]);
+    auto fmt_viewer = ColumnViewer<TYPE_VARCHAR>(columns[1]);
+    for (size_t i = 0; i < size; ++i) {
+        if (str_viewer.is_null(i)) {
+            result.append_null();
+            continue;
+        }
+        const Slice& str = str_viewer.value(i);
+        if (format.parse(str.get_data(), str.get_size(), &ts)) {
+            result.append(ts);
+        } else {
+            const Slice& fmt = fmt_viewer.value(i);
+            str_to_date_internal(&ts, fmt, str, &result);
+        }
+    }
+    return result.build(ColumnHelper::is_all_const(columns));
+}
+
 // uncommon approach to process string content, based on uncommon string format.
 void TimeFunctions::str_to_date_internal(TimestampValue* ts, const Slice& fmt, const Slice& str,
                                          ColumnBuilder<TYPE_DATETIME>* result) {
@@ -1158,6 +1216,8 @@ ColumnPtr TimeFunctions::str_to_date(FunctionContext* context, const Columns& co
         return str_to_date_uncommon(context, columns);
     } else if (ctx->fmt_type == yyyycMMcdd) { // for string format like "%Y-%m-%d"
         return str_to_date_from_date_format(context, columns, ctx->fmt);
+    } else if (ctx->fmt_type == None) { // for string format like "%Y%m%d%H%i%s"
+        return str_to_date_from_compiled_format(context, columns, ctx->format);
     } else { // for string format like "%Y-%m-%d %H:%i:%s"
         return str_to_date_from_datetime_format(context, columns, ctx->fmt);
     }
@@ -1229,6 +1289,7 @@ Status TimeFunctions::format_prepare(starrocks_udf::FunctionContext* context,
         fc->fmt_type = TimeFunctions::yyyy;
     } else {
         fc->fmt_type = TimeFunctions::None;
+        fc->format_compiled = fc->format.compile(slice.data, slice.size);
     }
 
     fc->is_valid = true;
@@ -1401,6 +1462,25 @@ ColumnPtr standard_format(const std::string& fmt, int len, const starrocks::vect
     return result.build(ColumnHelper::is_all_const(columns));
 }
 
+template <PrimitiveType Type>
+ColumnPtr compiled_format(const DateTimeFormat& format, const starrocks::vectorized::Columns& columns) {
+    ColumnBuilder<TYPE_VARCHAR> result;
+    auto ts_viewer = ColumnViewer<Type>(columns[0]);
+
+    size_t size = columns[0]->size();
+
+    char buf[DateTimeFormat::MAX_FORMAT_LENGTH];
+    for (size_t i = 0; i < size; ++i) {
+        if (ts_viewer.is_null(i)) {
+            result.append_null();
+        } else {
+            char* end = format.format((TimestampValue)ts_viewer.value(i), buf);
+            result.append(Slice(buf, end - buf));
+        }
+    }
+    return result.build(ColumnHelper::is_all_const(columns));
+}
+
 template <PrimitiveType Type>
 ColumnPtr do_format(const TimeFunctions::FormatCtx* ctx, const Columns& cols) {
     if (ctx->fmt_type == TimeFunctions::yyyyMMdd) {
@@ -1415,6 +1495,8 @@ ColumnPtr do_format(const TimeFunctions::FormatCtx* ctx, const Columns& cols) {
         return date_format_func<yyyyMMImpl, Type>(cols, 6);
     } else if (ctx->fmt_type == TimeFunctions::yyyy) {
         return date_format_func<yyyyImpl, Type>(cols, 4);
+    } else if (ctx->format_compiled) {
+        return compiled_format<Type>(ctx->format, cols);
     } else {
         return standard_format<Type>(ctx->fmt, 128, cols);
     }
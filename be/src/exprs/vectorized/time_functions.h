@@ -7,7 +7,9 @@
 #include "column/column_viewer.h"
 #include "exprs/vectorized/builtin_functions.h"
 #include "exprs/vectorized/function_helper.h"
+#include "runtime/datetime_format.h"
 #include "udf/udf.h"
+#include "util/timezone_offset_table.h"
 
 namespace starrocks {
 namespace vectorized {
@@ -407,6 +409,13 @@ public:
                                                       const starrocks::vectorized::Columns& columns,
                                                       const char* str_format);
 
+    // try to transfer content by |format| compiled from the constant string format,
+    // if successful, return result TimestampValue
+    // else take a uncommon approach to process this content.
+    static ColumnPtr str_to_date_from_compiled_format(FunctionContext* context,
+                                                      const starrocks::vectorized::Columns& columns,
+                                                      const DateTimeFormat& format);
+
     // Try to process string content, based on uncommon string format
     static ColumnPtr str_to_date_uncommon(FunctionContext* context, const starrocks::vectorized::Columns& columns);
     /**
@@ -484,6 +493,11 @@ public:
      */
     DEFINE_VECTORIZED_FN(to_unix_for_now);
 
+    static Status unix_timestamp_prepare(starrocks_udf::FunctionContext* context,
+                                         starrocks_udf::FunctionContext::FunctionStateScope scope);
+    static Status unix_timestamp_close(starrocks_udf::FunctionContext* context,
+                                       starrocks_udf::FunctionContext::FunctionStateScope scope);
+
     /**
      * @param: [timestmap]
      * @paramType columns: [IntColumn]
@@ -522,13 +536,14 @@ private:
 
     static ColumnPtr from_unix_with_format_general(FunctionContext* context,
                                                    const starrocks::vectorized::Columns& columns);
-    static ColumnPtr from_unix_with_format_const(std::string& format_content, FunctionContext* context,
+    struct FromUnixState;
+    static ColumnPtr from_unix_with_format_const(const FromUnixState& state, FunctionContext* context,
                                                  const starrocks::vectorized::Columns& columns);
 
     static ColumnPtr convert_tz_general(FunctionContext* context, const Columns& columns);
 
-    static ColumnPtr convert_tz_const(FunctionContext* context, const Columns& columns, const cctz::time_zone& from,
-                                      const cctz::time_zone& to);
+    static ColumnPtr convert_tz_const(FunctionContext* context, const Columns& columns,
+                                      const TimezoneOffsetTable& from, const TimezoneOffsetTable& to);
 
 public:
     enum FormatType {
@@ -549,15 +564,28 @@ private:
     struct FromUnixState {
         bool const_format{false};
         std::string format_content;
+        // |format_content| compiled, used if |format_compiled| is true.
+        DateTimeFormat format;
+        bool format_compiled{false};
+        TimezoneOffsetTable timezone_table;
         FromUnixState() {}
     };
 
+    // The context used for unix_timestamp
+    struct UnixTimestampCtx {
+        TimezoneOffsetTable timezone_table;
+        // The constant format of unix_timestamp(VARCHAR, VARCHAR) if it can be parsed by DateTimeFormat.
+        DateTimeFormat format;
+    };
+
     // The context used for convert tz
     struct ConvertTzCtx {
         // false means the format is invalid, and the function always return null
         bool is_valid = false;
         cctz::time_zone from_tz;
         cctz::time_zone to_tz;
+        TimezoneOffsetTable from_table;
+        TimezoneOffsetTable to_table;
     };
 
     struct FormatCtx {
@@ -565,12 +593,17 @@ private:
         std::string fmt;
         int len;
         FormatType fmt_type;
+        // |fmt| compiled if |fmt_type| is None, used if |format_compiled| is true.
+        DateTimeFormat format;
+        bool format_compiled = false;
     };
 
     // fmt for string format like "%Y-%m-%d" and "%Y-%m-%d %H:%i:%s"
     struct StrToDateCtx {
         FormatType fmt_type;
         char* fmt;
+        // The compiled format if |fmt_type| is None.
+        DateTimeFormat format;
     };
 
     // method for datetime_trunc
@@ -6,6 +6,7 @@
 #include "common/logging.h"
 #include "gutil/casts.h"
 #include "runtime/date_value.hpp"
+#include "util/batch_string_parser.h"
 
 namespace starrocks::vectorized::csv {
 
@@ -24,7 +25,15 @@ Status DateConverter::write_quoted_string(OutputStream* os, const Column& column
 
 bool DateConverter::read_string(Column* column, Slice s, const Options& options) const {
     DateValue v{};
-    bool r = v.from_string(s.data, s.size);
+    int year, month, day;
+    bool r;
+    // fast path for YYYY-MM-DD
+    if (BatchStringParser::try_parse_iso_date(s.data, s.size, &year, &month, &day) && date::check(year, month, day)) {
+        v.from_date(year, month, day);
+        r = true;
+    } else {
+        r = v.from_string(s.data, s.size);
+    }
     if (r) {
         down_cast<FixedLengthColumn<DateValue>*>(column)->append(v);
     }
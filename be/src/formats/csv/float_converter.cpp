@@ -4,6 +4,7 @@
 
 #include "column/fixed_length_column.h"
 #include "common/logging.h"
+#include "util/batch_string_parser.h"
 #include "util/string_parser.hpp"
 
 namespace starrocks::vectorized::csv {
@@ -23,8 +24,14 @@ Status FloatConverter<T>::write_quoted_string(OutputStream* os, const Column& co
 
 template <typename T>
 bool FloatConverter<T>::read_string(Column* column, Slice s, const Options& options) const {
+    DataType v;
+    if (BatchStringParser::try_parse_float(s.data, s.size, &v)) {
+        down_cast<FixedLengthColumn<DataType>*>(column)->append_numbers(&v, sizeof(v));
+        return true;
+    }
+
     StringParser::ParseResult r;
-    DataType v = StringParser::string_to_float<DataType>(s.data, s.size, &r);
+    v = StringParser::string_to_float<DataType>(s.data, s.size, &r);
     if (r == StringParser::PARSE_SUCCESS) {
         down_cast<FixedLengthColumn<DataType>*>(column)->append_numbers(&v, sizeof(v));
     }
@@ -4,6 +4,7 @@
 
 #include "column/fixed_length_column.h"
 #include "common/logging.h"
+#include "util/batch_string_parser.h"
 #include "util/string_parser.hpp"
 
 namespace starrocks::vectorized::csv {
@@ -27,8 +28,14 @@ Status NumericConverter<T>::write_quoted_string(OutputStream* os, const Column&
 
 template <typename T>
 bool NumericConverter<T>::read_string(Column* column, Slice s, const Options& options) const {
+    DataType v;
+    if (BatchStringParser::try_parse_int(s.data, s.size, &v)) {
+        down_cast<FixedLengthColumn<DataType>*>(column)->append(v);
+        return true;
+    }
+
     StringParser::ParseResult r;
-    DataType v = StringParser::string_to_int<DataType>(s.data, s.size, &r);
+    v = StringParser::string_to_int<DataType>(s.data, s.size, &r);
     if (r == StringParser::PARSE_SUCCESS) {
         down_cast<FixedLengthColumn<DataType>*>(column)->append(v);
         return true;
@@ -4,6 +4,7 @@
 
 #include "column/fixed_length_column.h"
 #include "gutil/strings/substitute.h"
+#include "util/batch_string_parser.h"
 #include "util/string_parser.hpp"
 
 namespace starrocks::vectorized {
@@ -77,8 +78,16 @@ static Status add_column_with_string_value(FixedLengthColumn<T>* column, const T
 
     T v{};
     if constexpr (std::is_floating_point<T>::value) {
+        if (BatchStringParser::try_parse_float(sv.data(), sv.length(), &v)) {
+            column->append_numbers(&v, sizeof(v));
+            return Status::OK();
+        }
         v = StringParser::string_to_float<T>(sv.data(), sv.length(), &parse_result);
     } else {
+        if (BatchStringParser::try_parse_int(sv.data(), sv.length(), &v)) {
+            column->append_numbers(&v, sizeof(v));
+            return Status::OK();
+        }
         v = StringParser::string_to_int<T>(sv.data(), sv.length(), &parse_result);
     }
 
@@ -154,6 +154,15 @@ namespace orc {
      */
     RowReaderOptions& includeTypes(const std::list<uint64_t>& types);
 
+    /**
+     * Set the top-level columns to be lazy loaded, which must be selected by
+     * include(). They are not read by RowReader::next(), but by
+     * RowReader::lazyLoadNext() and RowReader::lazyLoadSkip() after it.
+     * @param include a list of the top-level field names
+     * @return this
+     */
+    RowReaderOptions& includeLazyLoadColumnNames(const std::list<std::string>& include);
+
     /**
      * Set the section of the file to process.
      * @param offset the starting byte offset
@@ -234,6 +243,11 @@ namespace orc {
      */
     const std::list<std::string>& getIncludeNames() const;
 
+    /**
+     * Get the list of top-level columns to be lazy loaded.
+     */
+    const std::list<std::string>& getLazyLoadColumnNames() const;
+
     /**
      * Get the start of the range for the data being processed.
      * @return if not set, return 0
@@ -570,6 +584,23 @@ namespace orc {
      */
     virtual void seekToRow(uint64_t rowNumber) = 0;
 
+    /**
+     * Read the next rows of the lazy load columns into their fields of the
+     * row batch. The rows must be within the batch returned by the last call
+     * of next(), and the rows of the batch which are neither read nor skipped
+     * are skipped by the next call of next().
+     * @param data the row batch returned by next()
+     * @param numValues the number of rows to read
+     */
+    virtual void lazyLoadNext(ColumnVectorBatch& data, uint64_t numValues) = 0;
+
+    /**
+     * Skip the next rows of the lazy load columns. The row index is used to
+     * seek to the target row group if the rows span several row groups.
+     * @param numValues the number of rows to skip
+     */
+    virtual void lazyLoadSkip(uint64_t numValues) = 0;
+
   };
 }
 
@@ -117,6 +117,22 @@ void ColumnReader::seekToRowGroup(std::unordered_map<uint64_t, PositionProvider>
     }
 }
 
+void ColumnReader::lazyLoadNext(ColumnVectorBatch& rowBatch, uint64_t numValues) {
+    throw NotImplementedYet("lazy load is only supported by struct column");
+}
+
+void ColumnReader::lazyLoadNextEncoded(ColumnVectorBatch& rowBatch, uint64_t numValues) {
+    throw NotImplementedYet("lazy load is only supported by struct column");
+}
+
+void ColumnReader::lazyLoadSkip(uint64_t numValues) {
+    throw NotImplementedYet("lazy load is only supported by struct column");
+}
+
+void ColumnReader::lazyLoadSeekToRowGroup(std::unordered_map<uint64_t, PositionProvider>& positions) {
+    throw NotImplementedYet("lazy load is only supported by struct column");
+}
+
 /**
    * Expand an array of bytes in place to the corresponding array of longs.
    * Has to work backwards so that they data isn't clobbered during the
@@ -954,6 +970,11 @@ void StringDirectColumnReader::seekToRowGroup(std::unordered_map<uint64_t, Posit
 class StructColumnReader : public ColumnReader {
 private:
     std::vector<std::unique_ptr<ColumnReader>> children;
+    // the lazy load children are only read by lazyLoadNext() and lazyLoadSkip().
+    std::vector<std::unique_ptr<ColumnReader>> lazyLoadChildren;
+    // the position of each child in the fields of StructVectorBatch.
+    std::vector<size_t> fieldIndexes;
+    std::vector<size_t> lazyLoadFieldIndexes;
 
 public:
     StructColumnReader(const Type& type, StripeStreams& stipe);
@@ -966,23 +987,44 @@ public:
 
     void seekToRowGroup(std::unordered_map<uint64_t, PositionProvider>& positions) override;
 
+    void lazyLoadNext(ColumnVectorBatch& rowBatch, uint64_t numValues) override;
+
+    void lazyLoadNextEncoded(ColumnVectorBatch& rowBatch, uint64_t numValues) override;
+
+    void lazyLoadSkip(uint64_t numValues) override;
+
+    void lazyLoadSeekToRowGroup(std::unordered_map<uint64_t, PositionProvider>& positions) override;
+
     const size_t size() { return children.size(); }
     ColumnReader* childReaderAt(size_t idx) { return children[idx].get(); }
 
 private:
     template <bool encoded>
     void nextInternal(ColumnVectorBatch& rowBatch, uint64_t numValues, char* notNull);
+
+    template <bool encoded>
+    void lazyLoadNextInternal(ColumnVectorBatch& rowBatch, uint64_t numValues);
 };
 
 StructColumnReader::StructColumnReader(const Type& type, StripeStreams& stripe) : ColumnReader(type, stripe) {
     // count the number of selected sub-columns
     const std::vector<bool> selectedColumns = stripe.getSelectedColumns();
+    const std::vector<bool> lazyLoadColumns = stripe.getLazyLoadColumns();
     switch (static_cast<int64_t>(stripe.getEncoding(columnId).kind())) {
     case proto::ColumnEncoding_Kind_DIRECT:
         for (unsigned int i = 0; i < type.getSubtypeCount(); ++i) {
             const Type& child = *type.getSubtype(i);
-            if (selectedColumns[static_cast<uint64_t>(child.getColumnId())]) {
+            auto childId = static_cast<uint64_t>(child.getColumnId());
+            if (!selectedColumns[childId]) {
+                continue;
+            }
+            size_t fieldIndex = children.size() + lazyLoadChildren.size();
+            if (childId < lazyLoadColumns.size() && lazyLoadColumns[childId]) {
+                lazyLoadChildren.push_back(buildReader(child, stripe));
+                lazyLoadFieldIndexes.push_back(fieldIndex);
+            } else {
                 children.push_back(buildReader(child, stripe));
+                fieldIndexes.push_back(fieldIndex);
             }
         }
         break;
@@ -992,6 +1034,10 @@ StructColumnReader::StructColumnReader(const Type& type, StripeStreams& stripe)
     default:
         throw ParseError("Unknown encoding for StructColumnReader");
     }
+    // the null flags of the struct would be read twice.
+    if (notNullDecoder != nullptr && !lazyLoadChildren.empty()) {
+        throw NotImplementedYet("lazy load is not supported by struct column with nulls");
+    }
 }
 
 uint64_t StructColumnReader::skip(uint64_t numValues) {
@@ -1013,13 +1059,13 @@ void StructColumnReader::nextEncoded(ColumnVectorBatch& rowBatch, uint64_t numVa
 template <bool encoded>
 void StructColumnReader::nextInternal(ColumnVectorBatch& rowBatch, uint64_t numValues, char* notNull) {
     ColumnReader::next(rowBatch, numValues, notNull);
-    uint64_t i = 0;
     notNull = rowBatch.hasNulls ? rowBatch.notNull.data() : nullptr;
-    for (auto iter = children.begin(); iter != children.end(); ++iter, ++i) {
+    auto& fields = dynamic_cast<StructVectorBatch&>(rowBatch).fields;
+    for (size_t i = 0; i < children.size(); ++i) {
         if (encoded) {
-            (*iter)->nextEncoded(*(dynamic_cast<StructVectorBatch&>(rowBatch).fields[i]), numValues, notNull);
+            children[i]->nextEncoded(*fields[fieldIndexes[i]], numValues, notNull);
         } else {
-            (*iter)->next(*(dynamic_cast<StructVectorBatch&>(rowBatch).fields[i]), numValues, notNull);
+            children[i]->next(*fields[fieldIndexes[i]], numValues, notNull);
         }
     }
 }
@@ -1032,6 +1078,38 @@ void StructColumnReader::seekToRowGroup(std::unordered_map<uint64_t, PositionPro
     }
 }
 
+void StructColumnReader::lazyLoadNext(ColumnVectorBatch& rowBatch, uint64_t numValues) {
+    lazyLoadNextInternal<false>(rowBatch, numValues);
+}
+
+void StructColumnReader::lazyLoadNextEncoded(ColumnVectorBatch& rowBatch, uint64_t numValues) {
+    lazyLoadNextInternal<true>(rowBatch, numValues);
+}
+
+template <bool encoded>
+void StructColumnReader::lazyLoadNextInternal(ColumnVectorBatch& rowBatch, uint64_t numValues) {
+    auto& fields = dynamic_cast<StructVectorBatch&>(rowBatch).fields;
+    for (size_t i = 0; i < lazyLoadChildren.size(); ++i) {
+        if (encoded) {
+            lazyLoadChildren[i]->nextEncoded(*fields[lazyLoadFieldIndexes[i]], numValues, nullptr);
+        } else {
+            lazyLoadChildren[i]->next(*fields[lazyLoadFieldIndexes[i]], numValues, nullptr);
+        }
+    }
+}
+
+void StructColumnReader::lazyLoadSkip(uint64_t numValues) {
+    for (auto& ptr : lazyLoadChildren) {
+        ptr->skip(numValues);
+    }
+}
+
+void StructColumnReader::lazyLoadSeekToRowGroup(std::unordered_map<uint64_t, PositionProvider>& positions) {
+    for (auto& ptr : lazyLoadChildren) {
+        ptr->seekToRowGroup(positions);
+    }
+}
+
 class ListColumnReader : public ColumnReader {
 private:
     std::unique_ptr<ColumnReader> child;
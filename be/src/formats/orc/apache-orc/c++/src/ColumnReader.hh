@@ -96,6 +96,11 @@ public:
     virtual bool getUseWriterTimezone() const { return false; }
 
     virtual DataBuffer<char>* getSharedBuffer() const { return nullptr; }
+
+    /**
+     * Get the array of booleans for which top-level columns are lazy loaded.
+     */
+    virtual const std::vector<bool> getLazyLoadColumns() const { return {}; }
 };
 
 /**
@@ -148,6 +153,32 @@ public:
      */
     virtual void seekToRowGroup(std::unordered_map<uint64_t, PositionProvider>& positions);
 
+    /**
+     * Read the next group of values of the lazy load children, which are not
+     * read by next(), into their fields of this rowBatch.
+     * Only supported by the struct reader.
+     * @param rowBatch the memory to read into.
+     * @param numValues the number of values to read
+     */
+    virtual void lazyLoadNext(ColumnVectorBatch& rowBatch, uint64_t numValues);
+
+    /**
+     * Read the next group of values of the lazy load children without decoding.
+     */
+    virtual void lazyLoadNextEncoded(ColumnVectorBatch& rowBatch, uint64_t numValues);
+
+    /**
+     * Skip number of specified rows of the lazy load children.
+     * @param numValues the number of values to skip
+     */
+    virtual void lazyLoadSkip(uint64_t numValues);
+
+    /**
+     * Seek the lazy load children to beginning of a row group in the current stripe
+     * @param positions a list of PositionProviders storing the positions
+     */
+    virtual void lazyLoadSeekToRowGroup(std::unordered_map<uint64_t, PositionProvider>& positions);
+
     uint64_t getColumnId() { return columnId; }
 };
 
@@ -129,6 +129,7 @@ namespace orc {
     ColumnSelection selection;
     std::list<uint64_t> includedColumnIndexes;
     std::list<std::string> includedColumnNames;
+    std::list<std::string> lazyLoadColumnNames;
     uint64_t dataStart;
     uint64_t dataLength;
     bool throwOnHive11DecimalOverflow;
@@ -226,6 +227,15 @@ namespace orc {
     return privateBits->includedColumnNames;
   }
 
+  RowReaderOptions& RowReaderOptions::includeLazyLoadColumnNames(const std::list<std::string>& include) {
+    privateBits->lazyLoadColumnNames.assign(include.begin(), include.end());
+    return *this;
+  }
+
+  const std::list<std::string>& RowReaderOptions::getLazyLoadColumnNames() const {
+    return privateBits->lazyLoadColumnNames;
+  }
+
   uint64_t RowReaderOptions::getOffset() const {
     return privateBits->dataStart;
   }
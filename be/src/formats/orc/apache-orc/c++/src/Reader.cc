@@ -230,6 +230,25 @@ RowReaderImpl::RowReaderImpl(const std::shared_ptr<FileContents>& _contents, con
     ColumnSelector column_selector(contents.get());
     column_selector.updateSelected(selectedColumns, opts);
 
+    // mark the lazy load columns by their top-level field names.
+    lazyLoadRowInStripe = 0;
+    lazyLoadEndRowInStripe = 0;
+    const std::list<std::string>& lazyLoadNames = opts.getLazyLoadColumnNames();
+    if (!lazyLoadNames.empty()) {
+        const Type& schema = *contents->schema;
+        lazyLoadColumns.assign(selectedColumns.size(), false);
+        for (const auto& name : lazyLoadNames) {
+            uint64_t i = 0;
+            while (i < schema.getSubtypeCount() && schema.getFieldName(i) != name) {
+                ++i;
+            }
+            if (i == schema.getSubtypeCount()) {
+                throw ParseError("Invalid lazy load column selected " + name);
+            }
+            lazyLoadColumns[schema.getSubtype(i)->getColumnId()] = true;
+        }
+    }
+
     // prepare SargsApplier if SearchArgument is available
     if (opts.getSearchArgument() && footer->rowindexstride() > 0) {
         sargs = opts.getSearchArgument();
@@ -318,6 +337,14 @@ void RowReaderImpl::seekToRow(uint64_t rowNumber) {
 
         reader->skip(rowsToSkip);
     }
+
+    // the lazy load columns must not keep the position of the batch before the seek,
+    // move them to the row along with the others.
+    if (!lazyLoadColumns.empty() && currentStripe < lastStripe) {
+        lazyLoadRowInStripe = 0;
+        lazyLoadSeekTo(currentRowInStripe);
+        lazyLoadEndRowInStripe = currentRowInStripe;
+    }
 }
 
 void RowReaderImpl::loadStripeIndex() {
@@ -364,7 +391,7 @@ void RowReaderImpl::loadStripeIndex() {
     }
 }
 
-void RowReaderImpl::seekToRowGroup(uint32_t rowGroupEntryId) {
+void RowReaderImpl::seekToRowGroup(uint32_t rowGroupEntryId, bool forLazyLoad) {
     // store positions for selected columns
     std::vector<std::list<uint64_t>> positions;
     // store position providers for selected colimns
@@ -383,7 +410,48 @@ void RowReaderImpl::seekToRowGroup(uint32_t rowGroupEntryId) {
         positionProviders.insert(std::make_pair(colId, PositionProvider(position)));
     }
 
-    reader->seekToRowGroup(positionProviders);
+    if (forLazyLoad) {
+        reader->lazyLoadSeekToRowGroup(positionProviders);
+    } else {
+        reader->seekToRowGroup(positionProviders);
+    }
+}
+
+void RowReaderImpl::lazyLoadSeekTo(uint64_t rowInStripe) {
+    if (rowInStripe <= lazyLoadRowInStripe) {
+        return;
+    }
+    uint64_t rowIndexStride = footer->rowindexstride();
+    if (rowIndexStride > 0 && !rowIndexes.empty()) {
+        uint64_t rowGroupId = rowInStripe / rowIndexStride;
+        if (rowGroupId > lazyLoadRowInStripe / rowIndexStride) {
+            seekToRowGroup(static_cast<uint32_t>(rowGroupId), true);
+            lazyLoadRowInStripe = rowGroupId * rowIndexStride;
+        }
+    }
+    if (rowInStripe > lazyLoadRowInStripe) {
+        reader->lazyLoadSkip(rowInStripe - lazyLoadRowInStripe);
+    }
+    lazyLoadRowInStripe = rowInStripe;
+}
+
+void RowReaderImpl::lazyLoadNext(ColumnVectorBatch& data, uint64_t numValues) {
+    if (lazyLoadRowInStripe + numValues > lazyLoadEndRowInStripe) {
+        throw InvalidArgument("Lazy load beyond the last batch");
+    }
+    if (enableEncodedBlock) {
+        reader->lazyLoadNextEncoded(data, numValues);
+    } else {
+        reader->lazyLoadNext(data, numValues);
+    }
+    lazyLoadRowInStripe += numValues;
+}
+
+void RowReaderImpl::lazyLoadSkip(uint64_t numValues) {
+    if (lazyLoadRowInStripe + numValues > lazyLoadEndRowInStripe) {
+        throw InvalidArgument("Lazy load beyond the last batch");
+    }
+    lazyLoadSeekTo(lazyLoadRowInStripe + numValues);
 }
 
 const FileContents& RowReaderImpl::getFileContents() const {
@@ -922,6 +990,8 @@ void RowReaderImpl::startNextStripe() {
                                             currentStripeInfo.offset(), *contents->stream, writerTimezone,
                                             readerTimezone);
             reader = buildReader(*contents->schema, stripeStreams);
+            lazyLoadRowInStripe = 0;
+            lazyLoadEndRowInStripe = 0;
 
             if (sargsApplier) {
                 if (sargsApplier->getRowReaderFilter()) {
@@ -983,6 +1053,11 @@ bool RowReaderImpl::next(ColumnVectorBatch& data) {
                                                 footer->stripes(static_cast<int>(lastStripe - 1)).numberofrows();
         return false;
     }
+    if (!lazyLoadColumns.empty()) {
+        // skip the rows of the last batch which are not read by lazy load.
+        lazyLoadSeekTo(currentRowInStripe);
+        lazyLoadEndRowInStripe = currentRowInStripe + rowsToRead;
+    }
     if (enableEncodedBlock) {
         reader->nextEncoded(data, rowsToRead, nullptr);
     } else {
@@ -121,6 +121,8 @@ private:
 
     // inputs
     std::vector<bool> selectedColumns;
+    // top-level columns which are lazy loaded, indexed by column id.
+    std::vector<bool> lazyLoadColumns;
 
     // footer
     proto::Footer* footer;
@@ -138,6 +140,11 @@ private:
     proto::StripeFooter currentStripeFooter;
     std::unique_ptr<ColumnReader> reader;
 
+    // the lazy load columns lag behind the others. They are at lazyLoadRowInStripe,
+    // and can be read up to lazyLoadEndRowInStripe, the end of the last batch.
+    uint64_t lazyLoadRowInStripe;
+    uint64_t lazyLoadEndRowInStripe;
+
     bool enableEncodedBlock;
     // internal methods
     void startNextStripe();
@@ -179,8 +186,16 @@ private:
     /**
      * Seek to the start of a row group in the current stripe
      * @param rowGroupEntryId the row group id to seek to
+     * @param forLazyLoad seek the lazy load columns instead of the others
+     */
+    void seekToRowGroup(uint32_t rowGroupEntryId, bool forLazyLoad = false);
+
+    /**
+     * Move the lazy load columns forward to a row of the current stripe,
+     * seeking to the row group of the row if it's beyond the current one.
+     * @param rowInStripe the row to move to
      */
-    void seekToRowGroup(uint32_t rowGroupEntryId);
+    void lazyLoadSeekTo(uint64_t rowInStripe);
 
 public:
     /**
@@ -207,6 +222,12 @@ public:
 
     void seekToRow(uint64_t rowNumber) override;
 
+    void lazyLoadNext(ColumnVectorBatch& data, uint64_t numValues) override;
+
+    void lazyLoadSkip(uint64_t numValues) override;
+
+    const std::vector<bool> getLazyLoadColumns() const { return lazyLoadColumns; }
+
     const FileContents& getFileContents() const;
     bool getThrowOnHive11DecimalOverflow() const;
     int32_t getForcedScaleOnHive11Decimal() const;
@@ -83,6 +83,10 @@ DataBuffer<char>* StripeStreamsImpl::getSharedBuffer() const {
     return reader.getSharedBuffer();
 }
 
+const std::vector<bool> StripeStreamsImpl::getLazyLoadColumns() const {
+    return reader.getLazyLoadColumns();
+}
+
 std::ostream* StripeStreamsImpl::getErrorStream() const {
     return reader.getFileContents().errorStream;
 }
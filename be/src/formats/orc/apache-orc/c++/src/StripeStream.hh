@@ -77,6 +77,8 @@ public:
     bool getUseWriterTimezone() const override;
 
     DataBuffer<char>* getSharedBuffer() const override;
+
+    const std::vector<bool> getLazyLoadColumns() const override;
 };
 
 /**
@@ -0,0 +1,93 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "http/action/query_cpu_profile_action.h"
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "common/logging.h"
+#include "http/http_channel.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "runtime/sampling_profiler.h"
+#include "util/bfd_parser.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+static const std::string SECONDS_KEY = "seconds";
+static const std::string INTERVAL_US_KEY = "interval_us";
+static const std::string QUERY_ID_KEY = "query_id";
+static const int DEFAULT_SAMPLE_SECONDS = 10;
+static const int MAX_SAMPLE_SECONDS = 600;
+static const int64_t DEFAULT_SAMPLE_INTERVAL_US = 10000;
+// How often the samples are drained from the buffers of SamplingProfiler.
+static const int64_t COLLECT_INTERVAL_MS = 100;
+
+void QueryCpuProfileAction::handle(HttpRequest* req) {
+    int seconds = DEFAULT_SAMPLE_SECONDS;
+    const std::string& seconds_str = req->param(SECONDS_KEY);
+    if (!seconds_str.empty()) {
+        seconds = std::atoi(seconds_str.c_str());
+    }
+    if (seconds <= 0 || seconds > MAX_SAMPLE_SECONDS) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                "seconds must be in (0, " + std::to_string(MAX_SAMPLE_SECONDS) + "]");
+        return;
+    }
+    int64_t interval_us = DEFAULT_SAMPLE_INTERVAL_US;
+    const std::string& interval_us_str = req->param(INTERVAL_US_KEY);
+    if (!interval_us_str.empty()) {
+        interval_us = std::atoll(interval_us_str.c_str());
+    }
+    const std::string& query_id = req->param(QUERY_ID_KEY);
+
+    auto* profiler = SamplingProfiler::instance();
+    Status status = profiler->start(interval_us);
+    if (!status.ok()) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST, status.to_string());
+        return;
+    }
+    SamplingProfiler::Samples samples;
+    int64_t deadline_ms = MonotonicMillis() + seconds * 1000L;
+    while (MonotonicMillis() < deadline_ms) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(COLLECT_INTERVAL_MS));
+        profiler->collect(&samples);
+    }
+    profiler->stop();
+    profiler->collect(&samples);
+    LOG(INFO) << "sampled query cpu for " << seconds << " seconds, stacks=" << samples.size()
+              << ", dropped_samples=" << profiler->num_dropped_samples();
+
+    if (!query_id.empty()) {
+        for (auto it = samples.begin(); it != samples.end();) {
+            it = it->first.query_id == query_id ? std::next(it) : samples.erase(it);
+        }
+    }
+
+    std::unordered_map<uintptr_t, std::string> symbols;
+    auto symbolize = [&](uintptr_t address) -> const std::string& {
+        auto [it, inserted] = symbols.try_emplace(address);
+        if (inserted) {
+            std::ostringstream address_str;
+            address_str << std::hex << address;
+            std::string file_name;
+            std::string func_name;
+            unsigned int lineno = 0;
+            const char* end = nullptr;
+            if (_parser != nullptr &&
+                _parser->decode_address(address_str.str().c_str(), &end, &file_name, &func_name, &lineno) == 0) {
+                it->second = std::move(func_name);
+            } else {
+                it->second = "0x" + address_str.str();
+            }
+        }
+        return it->second;
+    };
+    HttpChannel::send_reply(req, SamplingProfiler::to_folded_stacks(samples, symbolize));
+}
+
+} // namespace starrocks
@@ -0,0 +1,29 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include "http/http_handler.h"
+
+namespace starrocks {
+
+class BfdParser;
+
+// Sample the CPU of the running queries by SamplingProfiler for a while, and reply the samples
+// as folded stacks, which can be rendered by flamegraph.pl, e.g.
+//   curl "http://be:8040/api/query_cpu_profile?seconds=30&query_id=xxx" | flamegraph.pl > query.svg
+// Parameters:
+//   seconds: how long to sample, 10 by default.
+//   interval_us: the sampling interval of the CPU time of each thread, 10000 by default.
+//   query_id: only reply the samples of this query if set.
+class QueryCpuProfileAction : public HttpHandler {
+public:
+    explicit QueryCpuProfileAction(BfdParser* parser) : _parser(parser) {}
+    ~QueryCpuProfileAction() override = default;
+
+    void handle(HttpRequest* req) override;
+
+private:
+    BfdParser* _parser;
+};
+
+} // namespace starrocks
@@ -45,6 +45,7 @@ const std::string FILE_PARAMETER = "file";
 const std::string DB_PARAMETER = "db";
 const std::string LABEL_PARAMETER = "label";
 const std::string TOKEN_PARAMETER = "token";
+const std::string WITH_SIZE_PARAMETER = "with_size";
 
 DownloadAction::DownloadAction(ExecEnv* exec_env, const std::vector<std::string>& allow_dirs)
         : _exec_env(exec_env), _download_type(NORMAL) {
@@ -81,7 +82,7 @@ void DownloadAction::handle_normal(HttpRequest* req, const std::string& file_par
     }
 
     if (FileUtils::is_dir(file_param)) {
-        do_dir_response(file_param, req);
+        do_dir_response(file_param, req, req->param(WITH_SIZE_PARAMETER) == "true");
     } else {
         do_file_response(file_param, req);
     }
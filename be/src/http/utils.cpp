@@ -156,19 +156,32 @@ void do_file_response(const std::string& file_path, HttpRequest* req) {
     HttpChannel::send_file(req, fd, 0, file_size);
 }
 
-void do_dir_response(const std::string& dir_path, HttpRequest* req) {
+void do_dir_response(const std::string& dir_path, HttpRequest* req, bool with_size) {
     std::vector<std::string> files;
     Status status = FileUtils::list_files(Env::Default(), dir_path, &files);
     if (!status.ok()) {
         LOG(WARNING) << "Failed to scan dir. dir=" << dir_path;
         HttpChannel::send_error(req, HttpStatus::INTERNAL_SERVER_ERROR);
+        return;
     }
 
     const std::string FILE_DELIMETER_IN_DIR_RESPONSE = "\n";
+    const std::string SIZE_DELIMETER_IN_DIR_RESPONSE = "\t";
 
     std::stringstream result;
     for (const std::string& file_name : files) {
-        result << file_name << FILE_DELIMETER_IN_DIR_RESPONSE;
+        result << file_name;
+        if (with_size) {
+            uint64_t file_size = 0;
+            status = Env::Default()->get_file_size(dir_path + "/" + file_name, &file_size);
+            if (!status.ok()) {
+                LOG(WARNING) << "Failed to get file size. file=" << dir_path << "/" << file_name;
+                HttpChannel::send_error(req, HttpStatus::INTERNAL_SERVER_ERROR);
+                return;
+            }
+            result << SIZE_DELIMETER_IN_DIR_RESPONSE << file_size;
+        }
+        result << FILE_DELIMETER_IN_DIR_RESPONSE;
     }
 
     std::string result_str = result.str();
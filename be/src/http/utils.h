@@ -41,7 +41,9 @@ bool parse_basic_auth(const HttpRequest& req, AuthInfo* auth);
 
 void do_file_response(const std::string& dir_path, HttpRequest* req);
 
-void do_dir_response(const std::string& dir_path, HttpRequest* req);
+// List the files of |dir_path|, one file per line. If |with_size| is true, every line is
+// "<file name>\t<file size>" so that the client needn't ask the size of each file.
+void do_dir_response(const std::string& dir_path, HttpRequest* req, bool with_size = false);
 
 std::string get_content_type(const std::string& file_name);
 } // namespace starrocks
@@ -0,0 +1,165 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "runtime/arrow_result_writer.h"
+
+#include <arrow/memory_pool.h>
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "common/config.h"
+#include "exprs/expr.h"
+#include "gen_cpp/InternalService_types.h"
+#include "runtime/buffer_control_block.h"
+#include "util/arrow/row_batch.h"
+#include "util/arrow/starrocks_column_to_arrow.h"
+
+namespace starrocks {
+
+ArrowResultWriter::ArrowResultWriter(BufferControlBlock* sinker, const std::vector<ExprContext*>& output_expr_ctxs,
+                                     RuntimeProfile* parent_profile)
+        : _sinker(sinker), _output_expr_ctxs(output_expr_ctxs), _parent_profile(parent_profile) {}
+
+ArrowResultWriter::~ArrowResultWriter() = default;
+
+Status ArrowResultWriter::init(RuntimeState* state) {
+    _init_profile();
+    if (nullptr == _sinker) {
+        return Status::InternalError("sinker is NULL pointer.");
+    }
+    return _init_arrow_schema();
+}
+
+void ArrowResultWriter::_init_profile() {
+    _append_chunk_timer = ADD_TIMER(_parent_profile, "AppendChunkTime");
+    _convert_arrow_timer = ADD_CHILD_TIMER(_parent_profile, "ArrowConvertTime", "AppendChunkTime");
+    _serialize_timer = ADD_CHILD_TIMER(_parent_profile, "ArrowSerializeTime", "AppendChunkTime");
+    _result_send_timer = ADD_CHILD_TIMER(_parent_profile, "ResultSendTime", "AppendChunkTime");
+    _sent_rows_counter = ADD_COUNTER(_parent_profile, "NumSentRows", TUnit::UNIT);
+    _sent_batches_counter = ADD_COUNTER(_parent_profile, "NumSentArrowBatches", TUnit::UNIT);
+}
+
+Status ArrowResultWriter::_init_arrow_schema() {
+    std::vector<std::shared_ptr<arrow::Field>> fields;
+    fields.reserve(_output_expr_ctxs.size());
+    for (int i = 0; i < _output_expr_ctxs.size(); ++i) {
+        const TypeDescriptor& type = _output_expr_ctxs[i]->root()->type();
+        std::shared_ptr<arrow::DataType> arrow_type;
+        RETURN_IF_ERROR(convert_to_arrow_type(type, &arrow_type));
+        fields.emplace_back(arrow::field(std::to_string(i), std::move(arrow_type), true));
+        // the result columns are identified by their positions in the output exprs.
+        _slot_types.emplace_back(&type);
+        _slot_ids.emplace_back(i);
+    }
+    _arrow_schema = arrow::schema(std::move(fields));
+    return Status::OK();
+}
+
+Status ArrowResultWriter::append_chunk(vectorized::Chunk* chunk) {
+    if (nullptr == chunk || 0 == chunk->num_rows()) {
+        return Status::OK();
+    }
+    ASSIGN_OR_RETURN(auto result, process_chunk(chunk));
+    if (result != nullptr) {
+        return _add_batch(std::move(result));
+    }
+    return Status::OK();
+}
+
+Status ArrowResultWriter::close() {
+    if (!_pending_batches.empty()) {
+        ASSIGN_OR_RETURN(auto result, _serialize_pending_batches());
+        RETURN_IF_ERROR(_add_batch(std::move(result)));
+    }
+    COUNTER_SET(_sent_rows_counter, _written_rows);
+    return Status::OK();
+}
+
+StatusOr<TFetchDataResultPtr> ArrowResultWriter::process_chunk(vectorized::Chunk* chunk) {
+    SCOPED_TIMER(_append_chunk_timer);
+    if (chunk->num_rows() > 0) {
+        // Step 1: compute expr
+        vectorized::Chunk result_chunk;
+        for (int i = 0; i < _output_expr_ctxs.size(); ++i) {
+            result_chunk.append_column(_output_expr_ctxs[i]->evaluate(chunk), _slot_ids[i]);
+        }
+
+        // Step 2: convert chunk to arrow record batch column by column
+        std::shared_ptr<arrow::RecordBatch> record_batch;
+        {
+            SCOPED_TIMER(_convert_arrow_timer);
+            RETURN_IF_ERROR(vectorized::convert_chunk_to_arrow_batch(&result_chunk, _slot_types, _slot_ids,
+                                                                     _arrow_schema, arrow::default_memory_pool(),
+                                                                     &record_batch));
+        }
+        _pending_rows += record_batch->num_rows();
+        _pending_batches.emplace_back(std::move(record_batch));
+    }
+
+    // Step 3: pack the pending record batches into one stream when there are enough rows
+    if (_pending_rows < config::arrow_result_batch_max_rows) {
+        return TFetchDataResultPtr();
+    }
+    return _serialize_pending_batches();
+}
+
+StatusOr<TFetchDataResultPtr> ArrowResultWriter::flush() {
+    if (_pending_batches.empty()) {
+        return TFetchDataResultPtr();
+    }
+    SCOPED_TIMER(_append_chunk_timer);
+    return _serialize_pending_batches();
+}
+
+StatusOr<TFetchDataResultPtr> ArrowResultWriter::_serialize_pending_batches() {
+    SCOPED_TIMER(_serialize_timer);
+    DCHECK(!_pending_batches.empty());
+    auto result = std::make_unique<TFetchDataResult>();
+    auto& result_batch = result->result_batch;
+    result_batch.rows.resize(1);
+    RETURN_IF_ERROR(serialize_record_batches(_pending_batches, &result_batch.rows[0]));
+    result_batch.__set_num_rows(_pending_rows);
+    _pending_batches.clear();
+    _pending_rows = 0;
+    return result;
+}
+
+Status ArrowResultWriter::_add_batch(TFetchDataResultPtr result) {
+    SCOPED_TIMER(_result_send_timer);
+    auto num_rows = result->result_batch.num_rows;
+    auto* fetch_data = result.release();
+    // Note: this method will delete result pointer if status is OK
+    auto status = _sinker->add_batch(fetch_data);
+    if (status.ok()) {
+        _written_rows += num_rows;
+        COUNTER_UPDATE(_sent_batches_counter, 1);
+        return status;
+    }
+    LOG(WARNING) << "append arrow result batch to sink failed.";
+    delete fetch_data;
+    return status;
+}
+
+StatusOr<bool> ArrowResultWriter::try_add_batch(TFetchDataResultPtr& result) {
+    SCOPED_TIMER(_result_send_timer);
+    auto num_rows = result->result_batch.num_rows;
+    auto* fetch_data = result.release();
+    auto status = _sinker->try_add_batch(fetch_data);
+
+    if (status.ok()) {
+        if (status.value()) {
+            _written_rows += num_rows;
+            COUNTER_UPDATE(_sent_batches_counter, 1);
+        } else {
+            // the result is given back to the caller and will be retried later
+            result.reset(fetch_data);
+        }
+    } else {
+        delete fetch_data;
+        LOG(WARNING) << "Append arrow result batch to sink failed: status=" << status.status().to_string();
+    }
+    return status;
+}
+
+} // namespace starrocks
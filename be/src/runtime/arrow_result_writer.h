@@ -0,0 +1,83 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "common/global_types.h"
+#include "runtime/result_writer.h"
+#include "runtime/runtime_state.h"
+
+namespace arrow {
+class RecordBatch;
+class Schema;
+} // namespace arrow
+
+namespace starrocks {
+
+class ExprContext;
+class BufferControlBlock;
+class RuntimeProfile;
+struct TypeDescriptor;
+
+// Send the result chunks to client in Arrow IPC stream format. Chunks are kept columnar and
+// converted by convert_chunk_to_arrow_batch, several chunks are packed into one stream until
+// config::arrow_result_batch_max_rows is reached, so that the client can read them as a whole.
+// NOTE: the FE doesn't plan TResultSinkType::ARROW yet, since the MySQL protocol can't carry the
+// Arrow streams, so this writer is only used by plans that ask for it explicitly.
+class ArrowResultWriter final : public ResultWriter {
+public:
+    ArrowResultWriter(BufferControlBlock* sinker, const std::vector<ExprContext*>& output_expr_ctxs,
+                      RuntimeProfile* parent_profile);
+
+    ~ArrowResultWriter() override;
+
+    Status init(RuntimeState* state) override;
+
+    Status append_chunk(vectorized::Chunk* chunk) override;
+
+    Status close() override;
+
+    StatusOr<TFetchDataResultPtr> process_chunk(vectorized::Chunk* chunk) override;
+
+    StatusOr<bool> try_add_batch(TFetchDataResultPtr& result) override;
+
+    StatusOr<TFetchDataResultPtr> flush() override;
+
+private:
+    void _init_profile();
+
+    Status _init_arrow_schema();
+
+    StatusOr<TFetchDataResultPtr> _serialize_pending_batches();
+
+    Status _add_batch(TFetchDataResultPtr result);
+
+    BufferControlBlock* _sinker;
+    const std::vector<ExprContext*>& _output_expr_ctxs;
+
+    std::shared_ptr<arrow::Schema> _arrow_schema;
+    std::vector<const TypeDescriptor*> _slot_types;
+    std::vector<SlotId> _slot_ids;
+
+    // record batches which are converted but not sent yet
+    std::vector<std::shared_ptr<arrow::RecordBatch>> _pending_batches;
+    int64_t _pending_rows = 0;
+
+    RuntimeProfile* _parent_profile; // parent profile from result sink. not owned
+    // total time cost on append chunk operation
+    RuntimeProfile::Counter* _append_chunk_timer = nullptr;
+    // arrow convert timer, child timer of _append_chunk_timer
+    RuntimeProfile::Counter* _convert_arrow_timer = nullptr;
+    // arrow serialize timer, child timer of _append_chunk_timer
+    RuntimeProfile::Counter* _serialize_timer = nullptr;
+    // result send timer, child timer of _append_chunk_timer
+    RuntimeProfile::Counter* _result_send_timer = nullptr;
+    // number of sent rows
+    RuntimeProfile::Counter* _sent_rows_counter = nullptr;
+    // number of sent arrow streams
+    RuntimeProfile::Counter* _sent_batches_counter = nullptr;
+};
+
+} // namespace starrocks
@@ -31,6 +31,13 @@
 
 namespace starrocks {
 
+// Number of result rows carried by the batch. An Arrow batch packs many rows into one element of rows,
+// so the row count recorded by the writer must be used to account the buffer limit.
+static inline int64_t num_rows_of(const TFetchDataResult* result) {
+    const auto& batch = result->result_batch;
+    return batch.__isset.num_rows ? batch.num_rows : batch.rows.size();
+}
+
 void GetResultBatchCtx::on_failure(const Status& status) {
     DCHECK(!status.ok()) << "status is ok, errmsg=" << status.get_error_msg();
     status.to_protobuf(result->mutable_status());
@@ -95,7 +102,7 @@ Status BufferControlBlock::add_batch(TFetchDataResult* result) {
         return Status::Cancelled("Cancelled BufferControlBlock::add_batch");
     }
 
-    int num_rows = result->result_batch.rows.size();
+    int64_t num_rows = num_rows_of(result);
 
     while ((!_batch_queue.empty() && (num_rows + _buffer_rows) > _buffer_limit) && !_is_cancelled) {
         _data_removal.wait(l);
@@ -126,7 +133,7 @@ StatusOr<bool> BufferControlBlock::try_add_batch(TFetchDataResult* result) {
         return Status::Cancelled("Cancelled BufferControlBlock::add_batch");
     }
 
-    int num_rows = result->result_batch.rows.size();
+    int64_t num_rows = num_rows_of(result);
 
     if ((!_batch_queue.empty() && (num_rows + _buffer_rows) > _buffer_limit) && !_is_cancelled) {
         return false;
@@ -179,7 +186,7 @@ Status BufferControlBlock::get_batch(TFetchDataResult* result) {
         // get result
         item = _batch_queue.front();
         _batch_queue.pop_front();
-        _buffer_rows -= item->result_batch.rows.size();
+        _buffer_rows -= num_rows_of(item);
         _data_removal.notify_one();
     }
     swap(*result, *item);
@@ -206,7 +213,7 @@ void BufferControlBlock::get_batch(GetResultBatchCtx* ctx) {
         // get result
         TFetchDataResult* result = _batch_queue.front();
         _batch_queue.pop_front();
-        _buffer_rows -= result->result_batch.rows.size();
+        _buffer_rows -= num_rows_of(result);
         _data_removal.notify_one();
 
         ctx->on_data(result, _packet_num);
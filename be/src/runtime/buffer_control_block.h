@@ -106,7 +106,7 @@ private:
     bool _is_close;
     bool _is_cancelled;
     Status _status;
-    int _buffer_rows;
+    int64_t _buffer_rows;
     int _buffer_limit;
     int64_t _packet_num;
 
@@ -14,6 +14,9 @@
 #define SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker) \
     auto VARNAME_LINENUM(tracker_setter) = CurrentThreadMemTrackerSetter(mem_tracker)
 
+#define SCOPED_SAMPLING_OPERATOR(name, plan_node_id) \
+    auto VARNAME_LINENUM(sampling_operator) = CurrentThreadSamplingOperatorSetter(name, plan_node_id)
+
 namespace starrocks {
 
 class TUniqueId;
@@ -22,6 +25,18 @@ inline thread_local MemTracker* tls_mem_tracker = nullptr;
 inline thread_local MemTracker* tls_exceed_mem_tracker = nullptr;
 inline thread_local bool tls_is_thread_status_init = false;
 
+// The query and the operator the thread is running, which is read by the signal handler of
+// SamplingProfiler, so it's a POD updated only by the thread itself rather than a part of CurrentThread.
+struct SamplingContext {
+    int64_t query_id_hi;
+    int64_t query_id_lo;
+    // The name of the running operator, only valid while the operator is running.
+    const char* operator_name;
+    int32_t plan_node_id;
+};
+
+inline thread_local SamplingContext tls_sampling_context;
+
 class CurrentThread {
 public:
     CurrentThread() { tls_is_thread_status_init = true; }
@@ -35,7 +50,11 @@ public:
         }
     }
 
-    void set_query_id(const starrocks::TUniqueId& query_id) { _query_id = query_id; }
+    void set_query_id(const starrocks::TUniqueId& query_id) {
+        _query_id = query_id;
+        tls_sampling_context.query_id_hi = query_id.hi;
+        tls_sampling_context.query_id_lo = query_id.lo;
+    }
 
     const starrocks::TUniqueId& query_id() { return _query_id; }
 
@@ -126,10 +145,16 @@ public:
         }
     }
 
+    // The bytes of the cached memory of another NUMA node handed out to this thread,
+    // see ChunkAllocator and ColumnPool.
+    void add_remote_numa_node_bytes(int64_t size) { _remote_numa_node_bytes += size; }
+    int64_t remote_numa_node_bytes() const { return _remote_numa_node_bytes; }
+
 private:
     const static int64_t BATCH_SIZE = 2 * 1024 * 1024;
 
     int64_t _cache_size = 0;
+    int64_t _remote_numa_node_bytes = 0;
     TUniqueId _query_id;
     bool _is_catched = false;
 };
@@ -153,6 +178,30 @@ private:
     MemTracker* _old_mem_tracker;
 };
 
+// Attribute the samples of SamplingProfiler taken in the scope to the operator.
+class CurrentThreadSamplingOperatorSetter {
+public:
+    CurrentThreadSamplingOperatorSetter(const std::string& name, int32_t plan_node_id)
+            : _old_name(tls_sampling_context.operator_name), _old_plan_node_id(tls_sampling_context.plan_node_id) {
+        tls_sampling_context.operator_name = name.c_str();
+        tls_sampling_context.plan_node_id = plan_node_id;
+    }
+
+    ~CurrentThreadSamplingOperatorSetter() {
+        tls_sampling_context.operator_name = _old_name;
+        tls_sampling_context.plan_node_id = _old_plan_node_id;
+    }
+
+    CurrentThreadSamplingOperatorSetter(const CurrentThreadSamplingOperatorSetter&) = delete;
+    void operator=(const CurrentThreadSamplingOperatorSetter&) = delete;
+    CurrentThreadSamplingOperatorSetter(CurrentThreadSamplingOperatorSetter&&) = delete;
+    void operator=(CurrentThreadSamplingOperatorSetter&&) = delete;
+
+private:
+    const char* _old_name;
+    int32_t _old_plan_node_id;
+};
+
 #define TRY_CATCH_BAD_ALLOC(stmt)                                            \
     do {                                                                     \
         try {                                                                \
@@ -0,0 +1,354 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "runtime/datetime_format.h"
+
+#include <cstring>
+
+#include "runtime/datetime_value.h"
+
+namespace starrocks::vectorized {
+
+static const char* s_month_name[] = {"",     "January", "February",  "March",   "April",    "May",      "June",
+                                     "July", "August",  "September", "October", "November", "December"};
+static const char* s_ab_month_name[] = {"",    "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                        "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+// Monday is the first day.
+static const char* s_day_name[] = {"Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday", "Sunday"};
+static const char* s_ab_day_name[] = {"Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun"};
+
+// The output of DateTimeValue::to_format_string fails if it grows beyond this length, a format that may
+// output more than it is not compiled, so the compiled one never fails for a valid datetime.
+static constexpr size_t MAX_COMPILED_OUTPUT_LENGTH = 117;
+
+// The max length of the output of a specifier.
+static size_t max_output_length(char spec) {
+    switch (spec) {
+    case 'M':
+    case 'W':
+        return 9;
+    case 'r':
+        return 11;
+    case 'T':
+        return 8;
+    case 'f':
+        return 6;
+    case 'D':
+    case 'x':
+    case 'X':
+    case 'Y':
+        return 4;
+    case 'a':
+    case 'b':
+    case 'j':
+        return 3;
+    case 'c':
+    case 'd':
+    case 'e':
+    case 'h':
+    case 'I':
+    case 'H':
+    case 'i':
+    case 'k':
+    case 'l':
+    case 'm':
+    case 'p':
+    case 's':
+    case 'S':
+    case 'u':
+    case 'U':
+    case 'v':
+    case 'V':
+    case 'y':
+        return 2;
+    default:
+        return 1;
+    }
+}
+
+// The width of a numeric field parsed by DateTimeFormat::parse, or 0 if it can't be parsed.
+static int parse_width(char spec) {
+    switch (spec) {
+    case 'Y':
+        return 4;
+    case 'c':
+    case 'm':
+    case 'd':
+    case 'e':
+    case 'H':
+    case 'k':
+    case 'i':
+    case 's':
+    case 'S':
+        return 2;
+    default:
+        return 0;
+    }
+}
+
+// Write |value| padded by '0' to at least |width| digits.
+static inline char* write_int(uint32_t value, int width, char* to) {
+    if (width == 2 && value < 100) {
+        to[0] = '0' + value / 10;
+        to[1] = '0' + value % 10;
+        return to + 2;
+    }
+    char buf[16];
+    char* end = buf + sizeof(buf);
+    char* pos = end;
+    do {
+        *--pos = '0' + value % 10;
+        value /= 10;
+    } while (value > 0);
+    for (int n = end - pos; n < width; ++n) {
+        *to++ = '0';
+    }
+    memcpy(to, pos, end - pos);
+    return to + (end - pos);
+}
+
+static inline char* write_str(const char* str, char* to) {
+    size_t len = strlen(str);
+    memcpy(to, str, len);
+    return to + len;
+}
+
+bool DateTimeFormat::compile(const char* format, size_t len) {
+    _steps.clear();
+    _literals.clear();
+    _parse_length = 0;
+    _can_parse = true;
+
+    size_t output_length = 0;
+    bool has_year = false;
+    bool has_month = false;
+    bool has_day = false;
+    const char* ptr = format;
+    const char* end = format + len;
+    while (ptr < end) {
+        char spec = 0;
+        if (*ptr == '%' && ptr + 1 < end) {
+            spec = ptr[1];
+            ptr += 2;
+        }
+        if (spec != 0 && spec != '%' && max_output_length(spec) > 1) {
+            output_length += max_output_length(spec);
+            int width = parse_width(spec);
+            if (width == 0) {
+                _can_parse = false;
+            }
+            _parse_length += width;
+            has_year |= spec == 'Y';
+            has_month |= spec == 'm' || spec == 'c';
+            has_day |= spec == 'd' || spec == 'e';
+            _steps.push_back({spec, 0, 0});
+            continue;
+        }
+        if (spec == 'w') {
+            // the only numeric specifier of one char
+            output_length += 1;
+            _can_parse = false;
+            _steps.push_back({spec, 0, 0});
+            continue;
+        }
+        // A literal char, or a specifier outputs itself, e.g. "%%".
+        char ch = spec != 0 ? spec : *ptr++;
+        if (spec != 0 && spec != '%') {
+            // it's parsed in a different way
+            _can_parse = false;
+        }
+        output_length += 1;
+        _parse_length += 1;
+        if (_steps.empty() || _steps.back().spec != 0) {
+            _steps.push_back({0, static_cast<uint16_t>(_literals.size()), 0});
+        }
+        _literals.push_back(ch);
+        _steps.back().length++;
+    }
+    _can_parse &= has_year && has_month && has_day;
+    return output_length <= MAX_COMPILED_OUTPUT_LENGTH;
+}
+
+char* DateTimeFormat::format(const TimestampValue& ts, char* to) const {
+    int year, month, day, hour, minute, second, usec;
+    ts.to_timestamp(&year, &month, &day, &hour, &minute, &second, &usec);
+    JulianDate julian = timestamp::to_julian(ts.timestamp());
+
+    for (const Step& step : _steps) {
+        switch (step.spec) {
+        case 0:
+            memcpy(to, _literals.data() + step.offset, step.length);
+            to += step.length;
+            break;
+        case 'a':
+            to = write_str(s_ab_day_name[julian % 7], to);
+            break;
+        case 'b':
+            to = write_str(s_ab_month_name[month], to);
+            break;
+        case 'c':
+        case 'e':
+            to = write_int(step.spec == 'c' ? month : day, 1, to);
+            break;
+        case 'd':
+            to = write_int(day, 2, to);
+            break;
+        case 'D':
+            to = write_int(day, 1, to);
+            if (day >= 10 && day <= 19) {
+                to = write_str("th", to);
+            } else {
+                switch (day % 10) {
+                case 1:
+                    to = write_str("st", to);
+                    break;
+                case 2:
+                    to = write_str("nd", to);
+                    break;
+                case 3:
+                    to = write_str("rd", to);
+                    break;
+                default:
+                    to = write_str("th", to);
+                    break;
+                }
+            }
+            break;
+        case 'f':
+            to = write_int(usec, 6, to);
+            break;
+        case 'h':
+        case 'I':
+            to = write_int((hour % 24 + 11) % 12 + 1, 2, to);
+            break;
+        case 'H':
+            to = write_int(hour, 2, to);
+            break;
+        case 'i':
+            to = write_int(minute, 2, to);
+            break;
+        case 'j':
+            to = write_int(julian - date::from_date(year, 1, 1) + 1, 3, to);
+            break;
+        case 'k':
+            to = write_int(hour, 1, to);
+            break;
+        case 'l':
+            to = write_int((hour % 24 + 11) % 12 + 1, 1, to);
+            break;
+        case 'm':
+            to = write_int(month, 2, to);
+            break;
+        case 'M':
+            to = write_str(s_month_name[month], to);
+            break;
+        case 'p':
+            to = write_str((hour % 24) >= 12 ? "PM" : "AM", to);
+            break;
+        case 'r':
+            to = write_int((hour + 11) % 12 + 1, 2, to);
+            *to++ = ':';
+            to = write_int(minute, 2, to);
+            *to++ = ':';
+            to = write_int(second, 2, to);
+            to = write_str((hour % 24) >= 12 ? " PM" : " AM", to);
+            break;
+        case 's':
+        case 'S':
+            to = write_int(second, 2, to);
+            break;
+        case 'T':
+            to = write_int(hour % 24, 2, to);
+            *to++ = ':';
+            to = write_int(minute, 2, to);
+            *to++ = ':';
+            to = write_int(second, 2, to);
+            break;
+        case 'w':
+            // Sunday is 0
+            to = write_int((julian + 1) % 7, 1, to);
+            break;
+        case 'W':
+            to = write_str(s_day_name[julian % 7], to);
+            break;
+        case 'y':
+            to = write_int(year % 100, 2, to);
+            break;
+        case 'Y':
+            to = write_int(year, 4, to);
+            break;
+        default: {
+            // The weeks of year are rarely used, leave them to DateTimeValue.
+            const char spec[2] = {'%', step.spec};
+            DateTimeValue dtv(TIME_DATETIME, year, month, day, hour, minute, second, usec);
+            char buf[MAX_FORMAT_LENGTH];
+            dtv.to_format_string(spec, 2, buf);
+            to = write_str(buf, to);
+            break;
+        }
+        }
+    }
+    return to;
+}
+
+bool DateTimeFormat::parse(const char* value, size_t len, int* year, int* month, int* day, int* hour, int* minute,
+                           int* second) const {
+    DCHECK(_can_parse);
+    if (len != _parse_length) {
+        return false;
+    }
+    *hour = *minute = *second = 0;
+    for (const Step& step : _steps) {
+        if (step.spec == 0) {
+            if (memcmp(value, _literals.data() + step.offset, step.length) != 0) {
+                return false;
+            }
+            value += step.length;
+            continue;
+        }
+        int width = parse_width(step.spec);
+        int v = 0;
+        for (int i = 0; i < width; ++i) {
+            uint8_t digit = value[i] - '0';
+            if (digit > 9) {
+                return false;
+            }
+            v = v * 10 + digit;
+        }
+        value += width;
+        switch (step.spec) {
+        case 'Y':
+            *year = v;
+            break;
+        case 'c':
+        case 'm':
+            *month = v;
+            break;
+        case 'd':
+        case 'e':
+            *day = v;
+            break;
+        case 'H':
+        case 'k':
+            *hour = v;
+            break;
+        case 'i':
+            *minute = v;
+            break;
+        default:
+            *second = v;
+            break;
+        }
+    }
+    return date::check(*year, *month, *day) && *hour < 24 && *minute < 60 && *second < 60;
+}
+
+bool DateTimeFormat::parse(const char* value, size_t len, TimestampValue* ts) const {
+    int year, month, day, hour, minute, second;
+    if (!parse(value, len, &year, &month, &day, &hour, &minute, &second)) {
+        return false;
+    }
+    ts->from_timestamp(year, month, day, hour, minute, second, 0);
+    return true;
+}
+
+} // namespace starrocks::vectorized
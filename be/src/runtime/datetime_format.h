@@ -0,0 +1,55 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "runtime/timestamp_value.h"
+
+namespace starrocks::vectorized {
+
+// A format string of date_format() and str_to_date() compiled into a sequence of steps, so a constant
+// format is interpreted only once rather than for every value.
+class DateTimeFormat {
+public:
+    // The size of the buffer passed to format(), including the terminating zero.
+    static constexpr size_t MAX_FORMAT_LENGTH = 128;
+
+    // Return false if |format| can't be compiled, then the values should be formatted by
+    // DateTimeValue::to_format_string and parsed by TimestampValue::from_uncommon_format_str.
+    bool compile(const char* format, size_t len);
+
+    // Same as DateTimeValue::to_format_string of the datetime |ts|, write the result into |to|,
+    // which has MAX_FORMAT_LENGTH bytes, and return the end of it, not terminated by zero.
+    char* format(const TimestampValue& ts, char* to) const;
+
+    // Whether the format consists of only the numeric fields of fixed widths and the literals,
+    // e.g. "%Y/%m/%d %H:%i", so the values can be parsed by parse().
+    bool can_parse() const { return _can_parse; }
+
+    // Parse |value| which is exactly in the layout of the format. Return false if it's not, then
+    // it should be parsed by from_uncommon_format_str, which gives the same result for the
+    // values accepted here.
+    bool parse(const char* value, size_t len, int* year, int* month, int* day, int* hour, int* minute,
+               int* second) const;
+    bool parse(const char* value, size_t len, TimestampValue* ts) const;
+
+private:
+    struct Step {
+        // The specifier of a field, or 0 for a literal.
+        char spec;
+        // The position of the literal in |_literals|.
+        uint16_t offset;
+        uint16_t length;
+    };
+
+    std::vector<Step> _steps;
+    std::string _literals;
+    // The length of the value parsed by the format.
+    size_t _parse_length = 0;
+    bool _can_parse = false;
+};
+
+} // namespace starrocks::vectorized
@@ -27,6 +27,7 @@
 #include "column/column.h"
 #include "env/env_broker.h"
 #include "exec/broker_writer.h"
+#include "exec/parquet_builder.h"
 #include "exec/plain_text_builder.h"
 #include "exprs/expr.h"
 #include "gutil/strings/substitute.h"
@@ -121,10 +122,23 @@ Status ExportSink::open_file_writer(int timeout_ms) {
         return Status::NotSupported(strings::Substitute("Unsupported file type $0", file_type));
     }
 
-    _file_builder = std::make_unique<PlainTextBuilder>(
-            PlainTextBuilderOptions{.column_terminated_by = _t_export_sink.column_separator,
-                                    .line_terminated_by = _t_export_sink.row_delimiter},
-            std::move(output_file), _output_expr_ctxs);
+    switch (_file_format()) {
+    case TFileFormatType::FORMAT_CSV_PLAIN:
+        _file_builder = std::make_unique<PlainTextBuilder>(
+                PlainTextBuilderOptions{.column_terminated_by = _t_export_sink.column_separator,
+                                        .line_terminated_by = _t_export_sink.row_delimiter},
+                std::move(output_file), _output_expr_ctxs);
+        break;
+    case TFileFormatType::FORMAT_PARQUET: {
+        ParquetBuilderOptions parquet_options;
+        parquet_options.column_names = _t_export_sink.file_column_names;
+        _file_builder = std::make_unique<ParquetBuilder>(std::move(parquet_options), std::move(output_file),
+                                                         _output_expr_ctxs);
+        break;
+    }
+    default:
+        return Status::NotSupported(strings::Substitute("Unsupported file format $0", _file_format()));
+    }
 
     _state->add_export_output_file(file_path);
     return Status::OK();
@@ -138,12 +152,17 @@ Status ExportSink::gen_file_name(std::string* file_name) {
 
     std::stringstream file_name_ss;
     // now file-number is 0.
-    // <file-name-prefix>_<file-number>.csv.<timestamp>
-    file_name_ss << _t_export_sink.file_name_prefix << "0.csv." << UnixMillis();
+    // <file-name-prefix>_<file-number>.<csv|parquet>.<timestamp>
+    const char* extension = _file_format() == TFileFormatType::FORMAT_PARQUET ? "parquet" : "csv";
+    file_name_ss << _t_export_sink.file_name_prefix << "0." << extension << "." << UnixMillis();
     *file_name = file_name_ss.str();
     return Status::OK();
 }
 
+TFileFormatType::type ExportSink::_file_format() const {
+    return _t_export_sink.__isset.file_format ? _t_export_sink.file_format : TFileFormatType::FORMAT_CSV_PLAIN;
+}
+
 Status ExportSink::send_chunk(RuntimeState*, vectorized::Chunk* chunk) {
     return _file_builder->add_chunk(chunk);
 }
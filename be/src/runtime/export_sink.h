@@ -64,6 +64,7 @@ public:
 private:
     Status open_file_writer(int timeout_ms);
     Status gen_file_name(std::string* file_name);
+    TFileFormatType::type _file_format() const;
 
     RuntimeState* _state;
 
@@ -37,6 +37,27 @@
 
 namespace starrocks {
 
+// The pages are compressed by BlockCompressionCodec, whose LZ4 and ZLIB don't match the framing
+// of the parquet codecs.
+static Status parquet_compression_codec(TCompressionType::type compression_type,
+                                        tparquet::CompressionCodec::type* codec) {
+    switch (compression_type) {
+    case TCompressionType::NO_COMPRESSION:
+        *codec = tparquet::CompressionCodec::UNCOMPRESSED;
+        return Status::OK();
+    case TCompressionType::DEFAULT_COMPRESSION:
+    case TCompressionType::SNAPPY:
+        *codec = tparquet::CompressionCodec::SNAPPY;
+        return Status::OK();
+    case TCompressionType::ZSTD:
+        *codec = tparquet::CompressionCodec::ZSTD;
+        return Status::OK();
+    default:
+        return Status::NotSupported(
+                strings::Substitute("unsupported compression type of parquet file: $0", compression_type));
+    }
+}
+
 FileResultWriter::FileResultWriter(const ResultFileOptions* file_opts,
                                    const std::vector<ExprContext*>& output_expr_ctxs, RuntimeProfile* parent_profile)
         : _file_opts(file_opts), _output_expr_ctxs(output_expr_ctxs), _parent_profile(parent_profile) {
@@ -82,9 +103,16 @@ Status FileResultWriter::_create_file_writer() {
                 PlainTextBuilderOptions{_file_opts->column_separator, _file_opts->row_delimiter},
                 std::move(writable_file), _output_expr_ctxs);
         break;
-    case TFileFormatType::FORMAT_PARQUET:
-        _file_builder = std::make_unique<ParquetBuilder>(std::move(writable_file), _output_expr_ctxs);
+    case TFileFormatType::FORMAT_PARQUET: {
+        ParquetBuilderOptions options;
+        RETURN_IF_ERROR(parquet_compression_codec(_file_opts->compression_type, &options.compression_codec));
+        options.row_group_max_size = _file_opts->parquet_max_row_group_bytes;
+        options.use_dictionary = _file_opts->parquet_use_dict;
+        options.column_names = _file_opts->file_column_names;
+        _file_builder =
+                std::make_unique<ParquetBuilder>(std::move(options), std::move(writable_file), _output_expr_ctxs);
         break;
+    }
     default:
         return Status::InternalError(strings::Substitute("unsupport file format: $0", _file_opts->file_format));
     }
@@ -113,7 +141,11 @@ std::string FileResultWriter::_file_format_to_name() {
 
 Status FileResultWriter::append_chunk(vectorized::Chunk* chunk) {
     assert(_file_builder != nullptr);
-    _file_builder->add_chunk(chunk);
+    {
+        SCOPED_TIMER(_append_row_batch_timer);
+        RETURN_IF_ERROR(_file_builder->add_chunk(chunk));
+    }
+    _written_rows += chunk->num_rows();
 
     // split file if exceed limit
     RETURN_IF_ERROR(_create_new_file_if_exceed_size());
@@ -43,6 +43,10 @@ struct ResultFileOptions {
     size_t max_file_size_bytes = 1 * 1024 * 1024 * 1024; // 1GB
     std::vector<TNetworkAddress> broker_addresses;
     std::map<std::string, std::string> broker_properties;
+    std::vector<std::string> file_column_names;
+    TCompressionType::type compression_type = TCompressionType::SNAPPY;
+    int64_t parquet_max_row_group_bytes = 128 * 1024 * 1024; // 128MB
+    bool parquet_use_dict = true;
 
     ResultFileOptions(const TResultFileSinkOptions& t_opt) {
         file_path = t_opt.file_path;
@@ -59,6 +63,18 @@ struct ResultFileOptions {
         if (t_opt.__isset.broker_properties) {
             broker_properties = t_opt.broker_properties;
         }
+        if (t_opt.__isset.file_column_names) {
+            file_column_names = t_opt.file_column_names;
+        }
+        if (t_opt.__isset.compression_type) {
+            compression_type = t_opt.compression_type;
+        }
+        if (t_opt.__isset.parquet_max_row_group_bytes) {
+            parquet_max_row_group_bytes = t_opt.parquet_max_row_group_bytes;
+        }
+        if (t_opt.__isset.parquet_use_dict) {
+            parquet_use_dict = t_opt.parquet_use_dict;
+        }
     }
     ~ResultFileOptions() = default;
 };
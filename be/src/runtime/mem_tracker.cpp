@@ -235,6 +235,9 @@ std::string MemTracker::err_msg(const std::string& msg) const {
     case MemTracker::CONSISTENCY:
         str << "Mem usage has exceed the limit of consistency";
         break;
+    case MemTracker::RESOURCE_GROUP:
+        str << "Mem usage has exceed the limit of resource group";
+        break;
     default:
         break;
     }
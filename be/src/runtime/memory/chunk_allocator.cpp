@@ -24,6 +24,7 @@
 #include <memory>
 #include <mutex>
 
+#include "common/config.h"
 #include "gutil/dynamic_annotations.h"
 #include "runtime/current_thread.h"
 #include "runtime/memory/chunk.h"
@@ -41,6 +42,7 @@ ChunkAllocator* ChunkAllocator::_s_instance = nullptr;
 
 static IntCounter local_core_alloc_count(MetricUnit::NOUNIT);
 static IntCounter other_core_alloc_count(MetricUnit::NOUNIT);
+static IntCounter other_node_alloc_count(MetricUnit::NOUNIT);
 static IntCounter system_alloc_count(MetricUnit::NOUNIT);
 static IntCounter system_free_count(MetricUnit::NOUNIT);
 static IntCounter system_alloc_cost_ns(MetricUnit::NANOSECONDS);
@@ -116,6 +118,7 @@ void ChunkAllocator::init_instance(MemTracker* mem_tracker, size_t reserve_limit
 
     REGISTER_METIRC(local_core_alloc_count);
     REGISTER_METIRC(other_core_alloc_count);
+    REGISTER_METIRC(other_node_alloc_count);
     REGISTER_METIRC(system_alloc_count);
     REGISTER_METIRC(system_free_count);
     REGISTER_METIRC(system_alloc_cost_ns);
@@ -157,18 +160,35 @@ bool ChunkAllocator::allocate(size_t size, Chunk* chunk) {
         return ret;
     }
     if (_reserved_bytes > size) {
-        // try to allocate from other core's arena
-        ++core_id;
-        for (int i = 1; i < _arenas.size(); ++i, ++core_id) {
-            if (_arenas[core_id % _arenas.size()]->pop_free_chunk(size, &chunk->data)) {
+        // try to allocate from the arenas of other cores in the same NUMA node, whose memory is as near as
+        // the current core's
+        int node = CpuInfo::get_numa_node_of_core(core_id);
+        for (int other_core_id : CpuInfo::get_cores_of_numa_node(node)) {
+            if (other_core_id != core_id && _arenas[other_core_id]->pop_free_chunk(size, &chunk->data)) {
                 _reserved_bytes.fetch_sub(size);
                 other_core_alloc_count.increment(1);
                 // reset chunk's core_id to other
-                chunk->core_id = core_id % _arenas.size();
+                chunk->core_id = other_core_id;
                 ret = true;
                 return ret;
             }
         }
+        // try to allocate from the arenas of other NUMA nodes at last
+        if (config::reuse_remote_numa_node_memory && CpuInfo::get_max_num_numa_nodes() > 1) {
+            for (int i = 1; i < _arenas.size(); ++i) {
+                int other_core_id = (core_id + i) % _arenas.size();
+                if (CpuInfo::get_numa_node_of_core(other_core_id) != node &&
+                    _arenas[other_core_id]->pop_free_chunk(size, &chunk->data)) {
+                    _reserved_bytes.fetch_sub(size);
+                    other_node_alloc_count.increment(1);
+                    tls_thread_status.add_remote_numa_node_bytes(size);
+                    // the chunk is given back to the arena of its own node when it's freed
+                    chunk->core_id = other_core_id;
+                    ret = true;
+                    return ret;
+                }
+            }
+        }
     }
 
     int64_t cost_ns = 0;
@@ -40,7 +40,8 @@ class MemTracker;
 // ChunkAllocator has one ChunkArena for each CPU core, it will try to allocate
 // memory from current core arena firstly. In this way, there will be no lock contention
 // between concurrently-running threads. If this fails, ChunkAllocator will try to allocate
-// memroy from other core's arena.
+// memroy from other core's arena, the cores in the same NUMA node are tried before the
+// cores in other nodes, so that the memory is local to the thread using it if possible.
 //
 // Memory Reservation
 // ChunkAllocator has a limit about how much free chunk bytes it can reserve, above which
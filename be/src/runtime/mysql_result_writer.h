@@ -31,7 +31,7 @@ class ExprContext;
 class MysqlRowBuffer;
 class BufferControlBlock;
 class RuntimeProfile;
-using TFetchDataResultPtr = std::unique_ptr<TFetchDataResult>;
+
 // convert the row batch to mysql protocol row
 class MysqlResultWriter final : public ResultWriter {
 public:
@@ -49,11 +49,11 @@ public:
     // decompose append_chunk into two functions: process_chunk and try_add_batch,
     // the former transform input chunk into TFetchDataResult, the latter add TFetchDataResult
     // to queue whose consumers are rpc threads that invoke fetch_data rpc.
-    StatusOr<TFetchDataResultPtr> process_chunk(vectorized::Chunk* chunk);
+    StatusOr<TFetchDataResultPtr> process_chunk(vectorized::Chunk* chunk) override;
 
     // try to add result into _sinker if ResultQueue is not full and this operation is
     // non-blocking. return true on success, false in case of that ResultQueue is full.
-    StatusOr<bool> try_add_batch(TFetchDataResultPtr& result);
+    StatusOr<bool> try_add_batch(TFetchDataResultPtr& result) override;
 
 private:
     void _init_profile();
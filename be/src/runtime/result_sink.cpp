@@ -25,6 +25,7 @@
 
 #include "common/config.h"
 #include "exprs/expr.h"
+#include "runtime/arrow_result_writer.h"
 #include "runtime/buffer_control_block.h"
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
@@ -89,6 +90,9 @@ Status ResultSink::prepare(RuntimeState* state) {
     case TResultSinkType::STATISTIC:
         _writer.reset(new (std::nothrow) vectorized::StatisticResultWriter(_sender.get(), _output_expr_ctxs, _profile));
         break;
+    case TResultSinkType::ARROW:
+        _writer.reset(new (std::nothrow) ArrowResultWriter(_sender.get(), _output_expr_ctxs, _profile));
+        break;
     default:
         return Status::InternalError("Unknown result sink type");
     }
@@ -23,6 +23,8 @@
 
 #include "column/vectorized_fwd.h"
 #include "common/status.h"
+#include "common/statusor.h"
+#include "gen_cpp/InternalService_types.h"
 #include "gen_cpp/PlanNodes_types.h"
 
 namespace starrocks {
@@ -30,6 +32,8 @@ namespace starrocks {
 class Status;
 class RuntimeState;
 
+using TFetchDataResultPtr = std::unique_ptr<TFetchDataResult>;
+
 // abstract class of the result writer
 class ResultWriter {
 public:
@@ -44,6 +48,20 @@ public:
 
     virtual Status close() = 0;
 
+    // Non-blocking interface used by pipeline engine. process_chunk transforms the input chunk into
+    // TFetchDataResult, it may return nullptr if the writer buffers the chunk to build a larger batch.
+    // try_add_batch adds the result to the sinker if its ResultQueue is not full.
+    virtual StatusOr<TFetchDataResultPtr> process_chunk(vectorized::Chunk* chunk) {
+        return Status::NotSupported("process_chunk is not supported by this result writer");
+    }
+
+    virtual StatusOr<bool> try_add_batch(TFetchDataResultPtr& result) {
+        return Status::NotSupported("try_add_batch is not supported by this result writer");
+    }
+
+    // Return the data buffered by process_chunk as a TFetchDataResult, nullptr if nothing is buffered.
+    virtual StatusOr<TFetchDataResultPtr> flush() { return TFetchDataResultPtr(); }
+
     int64_t get_written_rows() const { return _written_rows; }
 
 protected:
@@ -96,10 +96,20 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
     int64_t received_rows = 0;
     int64_t left_bytes = ctx->max_batch_size;
 
-    std::shared_ptr<KafkaConsumerPipe> kafka_pipe = std::static_pointer_cast<KafkaConsumerPipe>(ctx->body_sink);
+    // messages of one partition always go to the same pipe, so that they are parsed in order.
+    std::vector<std::shared_ptr<KafkaConsumerPipe>> kafka_pipes;
+    kafka_pipes.emplace_back(std::static_pointer_cast<KafkaConsumerPipe>(ctx->body_sink));
+    for (auto& sink : ctx->extra_body_sinks) {
+        kafka_pipes.emplace_back(std::static_pointer_cast<KafkaConsumerPipe>(sink));
+    }
+    std::unordered_map<int32_t, KafkaConsumerPipe*> partition_pipes;
+    int pipe_idx = 0;
+    for (auto& kv : ctx->kafka_info->begin_offset) {
+        partition_pipes.emplace(kv.first, kafka_pipes[pipe_idx++ % kafka_pipes.size()].get());
+    }
 
     LOG(INFO) << "start consumer group: " << _grp_id << ". max time(ms): " << left_time
-              << ", batch size: " << left_bytes << ". " << ctx->brief();
+              << ", batch size: " << left_bytes << ", pipe num: " << kafka_pipes.size() << ". " << ctx->brief();
 
     // copy one
     std::map<int32_t, int64_t> cmt_offset = ctx->kafka_info->cmt_offset;
@@ -154,11 +164,15 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
             if (left_bytes == ctx->max_batch_size) {
                 // nothing to be consumed, we have to cancel it, because
                 // we do not allow finishing stream load pipe without data
-                kafka_pipe->cancel();
+                for (auto& kafka_pipe : kafka_pipes) {
+                    kafka_pipe->cancel();
+                }
                 return Status::Cancelled("Cancelled");
             } else {
                 DCHECK(left_bytes < ctx->max_batch_size);
-                kafka_pipe->finish();
+                for (auto& kafka_pipe : kafka_pipes) {
+                    kafka_pipe->finish();
+                }
                 ctx->kafka_info->cmt_offset = std::move(cmt_offset);
                 ctx->receive_bytes = ctx->max_batch_size - left_bytes;
                 return Status::OK();
@@ -171,8 +185,10 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
             VLOG(3) << "get kafka message"
                     << ", partition: " << msg->partition() << ", offset: " << msg->offset() << ", len: " << msg->len();
 
-            (kafka_pipe.get()->*append_data)(static_cast<const char*>(msg->payload()), static_cast<size_t>(msg->len()),
-                                             row_delimiter);
+            auto iter = partition_pipes.find(msg->partition());
+            KafkaConsumerPipe* kafka_pipe = iter != partition_pipes.end() ? iter->second : kafka_pipes[0].get();
+            st = (kafka_pipe->*append_data)(static_cast<const char*>(msg->payload()), static_cast<size_t>(msg->len()),
+                                            row_delimiter);
 
             if (st.ok()) {
                 received_rows++;
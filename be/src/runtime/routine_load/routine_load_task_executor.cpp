@@ -250,6 +250,7 @@ void RoutineLoadTaskExecutor::exec_task(StreamLoadContext* ctx, DataConsumerPool
 
     // must put pipe before executing plan fragment
     HANDLE_ERROR(_exec_env->load_stream_mgr()->put(ctx->id, pipe), "failed to add pipe");
+    HANDLE_ERROR(_prepare_parallel_pipes(ctx), "failed to add parallel pipes");
 
 #ifndef BE_TEST
     // execute plan fragment, async
@@ -313,6 +314,45 @@ void RoutineLoadTaskExecutor::exec_task(StreamLoadContext* ctx, DataConsumerPool
     cb(ctx);
 }
 
+Status RoutineLoadTaskExecutor::_prepare_parallel_pipes(StreamLoadContext* ctx) {
+    if (ctx->load_src_type != TLoadSourceType::KAFKA) {
+        return Status::OK();
+    }
+    size_t pipe_num = std::min((size_t)std::max(config::max_pipe_num_per_routine_load_task, 1),
+                               ctx->kafka_info->begin_offset.size());
+    if (pipe_num <= 1) {
+        return Status::OK();
+    }
+
+    // The plan reads the pipe through a single FILE_STREAM range whose load id is the task id.
+    // Add one range per extra pipe, so that the scan node starts one scanner for each pipe.
+    auto& per_node_scan_ranges = ctx->put_result.params.params.per_node_scan_ranges;
+    if (per_node_scan_ranges.size() != 1 || per_node_scan_ranges.begin()->second.size() != 1) {
+        return Status::OK();
+    }
+    auto& scan_ranges = per_node_scan_ranges.begin()->second;
+    const TScanRangeParams origin_range = scan_ranges[0];
+    if (!origin_range.scan_range.__isset.broker_scan_range ||
+        origin_range.scan_range.broker_scan_range.ranges.size() != 1 ||
+        origin_range.scan_range.broker_scan_range.ranges[0].file_type != TFileType::FILE_STREAM) {
+        return Status::OK();
+    }
+
+    for (size_t i = 1; i < pipe_num; ++i) {
+        UniqueId pipe_id = UniqueId::gen_uid();
+        auto pipe = std::make_shared<KafkaConsumerPipe>();
+        RETURN_IF_ERROR(_exec_env->load_stream_mgr()->put(pipe_id, pipe));
+        ctx->extra_pipe_ids.emplace_back(pipe_id);
+        ctx->extra_body_sinks.emplace_back(pipe);
+
+        TScanRangeParams scan_range = origin_range;
+        scan_range.scan_range.broker_scan_range.ranges[0].__set_load_id(pipe_id.to_thrift());
+        scan_ranges.emplace_back(std::move(scan_range));
+    }
+    VLOG(1) << "routine load task uses " << pipe_num << " parallel pipes. " << ctx->brief();
+    return Status::OK();
+}
+
 void RoutineLoadTaskExecutor::err_handler(StreamLoadContext* ctx, const Status& st, const std::string& err_msg) {
     LOG(WARNING) << err_msg;
     ctx->status = st;
@@ -320,9 +360,7 @@ void RoutineLoadTaskExecutor::err_handler(StreamLoadContext* ctx, const Status&
         _exec_env->stream_load_executor()->rollback_txn(ctx);
         ctx->need_rollback = false;
     }
-    if (ctx->body_sink != nullptr) {
-        ctx->body_sink->cancel();
-    }
+    ctx->cancel_body_sinks();
 }
 
 // for test only
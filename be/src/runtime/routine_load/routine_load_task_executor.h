@@ -85,6 +85,10 @@ private:
 
     void err_handler(StreamLoadContext* ctx, const Status& st, const std::string& err_msg);
 
+    // create extra pipes for kafka partitions and the scan ranges reading them,
+    // so that the messages are parsed by multiple scanners in parallel.
+    Status _prepare_parallel_pipes(StreamLoadContext* ctx);
+
     // for test only
     Status _execute_plan_for_test(StreamLoadContext* ctx);
 
@@ -82,7 +82,8 @@ public:
     // Specific parts of the fragment (i.e. exec nodes, sinks, data stream senders, etc)
     // will add a fourth level when they are initialized.
     // This function also initializes a user function mem tracker (in the fourth level).
-    void init_mem_trackers(const TUniqueId& query_id);
+    // The query MemTracker is a child of |parent| if set, or the query pool MemTracker.
+    void init_mem_trackers(const TUniqueId& query_id, MemTracker* parent = nullptr);
 
     // for ut only
     Status init_instance_mem_tracker();
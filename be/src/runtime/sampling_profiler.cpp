@@ -0,0 +1,264 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "runtime/sampling_profiler.h"
+
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <sstream>
+#include <thread>
+
+#include "common/logging.h"
+#include "gen_cpp/Types_types.h"
+#include "gutil/strings/substitute.h"
+#include "runtime/current_thread.h"
+#include "util/uid_util.h"
+
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+namespace starrocks {
+
+namespace {
+
+// gperftools' CPU profiler takes SIGPROF.
+int sampling_signal() {
+    return SIGRTMIN + 4;
+}
+
+struct ThreadTimer {
+    ~ThreadTimer() {
+        if (created) {
+            timer_delete(id);
+        }
+    }
+
+    timer_t id;
+    bool created = false;
+};
+
+thread_local ThreadTimer tls_thread_timer;
+// The stack of the current thread, the frames out of it are not walked by the signal handler.
+thread_local uintptr_t tls_stack_low = 0;
+thread_local uintptr_t tls_stack_high = 0;
+
+} // namespace
+
+std::atomic<int64_t> SamplingProfiler::_epoch = 0;
+
+SamplingProfiler* SamplingProfiler::instance() {
+    static SamplingProfiler s_profiler;
+    return &s_profiler;
+}
+
+Status SamplingProfiler::start(int64_t interval_us) {
+    if (interval_us <= 0) {
+        return Status::InvalidArgument("sampling interval must be positive");
+    }
+    std::lock_guard lock(_mutex);
+    if (_running.load()) {
+        return Status::InternalError("sampling profiler is already running");
+    }
+    if (!_initialized) {
+        for (auto& buffer : _buffers) {
+            buffer.samples.reset(new Sample[BUFFER_CAPACITY]);
+        }
+        struct sigaction action = {};
+        action.sa_sigaction = _signal_handler;
+        action.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        if (sigaction(sampling_signal(), &action, nullptr) != 0) {
+            return Status::InternalError(strings::Substitute("failed to install signal handler: $0", errno));
+        }
+        _initialized = true;
+    }
+    _interval_us.store(interval_us);
+    _running.store(true);
+    _epoch.fetch_add(1);
+    return Status::OK();
+}
+
+void SamplingProfiler::stop() {
+    std::lock_guard lock(_mutex);
+    if (_running.exchange(false)) {
+        _epoch.fetch_add(1);
+    }
+}
+
+void SamplingProfiler::update_current_thread() {
+    auto* profiler = instance();
+    tls_sampling_profiler_epoch = _epoch.load();
+    bool running = profiler->is_running();
+
+    auto& timer = tls_thread_timer;
+    if (!timer.created) {
+        if (!running) {
+            return;
+        }
+        pthread_attr_t attr;
+        if (pthread_getattr_np(pthread_self(), &attr) == 0) {
+            void* stack_addr = nullptr;
+            size_t stack_size = 0;
+            if (pthread_attr_getstack(&attr, &stack_addr, &stack_size) == 0) {
+                tls_stack_low = reinterpret_cast<uintptr_t>(stack_addr);
+                tls_stack_high = tls_stack_low + stack_size;
+            }
+            pthread_attr_destroy(&attr);
+        }
+
+        struct sigevent event = {};
+        event.sigev_notify = SIGEV_THREAD_ID;
+        event.sigev_signo = sampling_signal();
+        event.sigev_notify_thread_id = syscall(SYS_gettid);
+        if (timer_create(CLOCK_THREAD_CPUTIME_ID, &event, &timer.id) != 0) {
+            PLOG(WARNING) << "failed to create the cpu timer of thread";
+            return;
+        }
+        timer.created = true;
+    }
+
+    int64_t interval_us = running ? profiler->_interval_us.load() : 0;
+    struct itimerspec spec = {};
+    spec.it_interval.tv_sec = interval_us / 1000000;
+    spec.it_interval.tv_nsec = (interval_us % 1000000) * 1000;
+    spec.it_value = spec.it_interval;
+    if (timer_settime(timer.id, 0, &spec, nullptr) != 0) {
+        PLOG(WARNING) << "failed to set the cpu timer of thread";
+    }
+}
+
+void SamplingProfiler::_signal_handler(int signo, siginfo_t* info, void* ucontext) {
+    int saved_errno = errno;
+    instance()->_record_sample(ucontext);
+    errno = saved_errno;
+}
+
+void SamplingProfiler::_record_sample(void* ucontext) {
+    if (!_running.load(std::memory_order_relaxed)) {
+        return;
+    }
+    while (true) {
+        int index = _active_buffer.load();
+        auto& buffer = _buffers[index];
+        buffer.num_writers.fetch_add(1);
+        // the collector has swapped the buffers and may be reading this one.
+        if (_active_buffer.load() != index) {
+            buffer.num_writers.fetch_sub(1);
+            continue;
+        }
+        size_t pos = buffer.size.fetch_add(1);
+        if (pos < BUFFER_CAPACITY) {
+            _fill_sample(&buffer.samples[pos], ucontext);
+        } else {
+            _num_dropped_samples.fetch_add(1);
+        }
+        buffer.num_writers.fetch_sub(1);
+        return;
+    }
+}
+
+void SamplingProfiler::_fill_sample(Sample* sample, void* ucontext) {
+    const auto& context = tls_sampling_context;
+    sample->query_id_hi = context.query_id_hi;
+    sample->query_id_lo = context.query_id_lo;
+    sample->plan_node_id = context.plan_node_id;
+    size_t name_size = 0;
+    if (context.operator_name != nullptr) {
+        for (; name_size < MAX_OPERATOR_NAME_SIZE - 1 && context.operator_name[name_size] != '\0'; ++name_size) {
+            sample->operator_name[name_size] = context.operator_name[name_size];
+        }
+    }
+    sample->operator_name[name_size] = '\0';
+
+    uintptr_t pc = 0;
+    uintptr_t fp = 0;
+    auto* uc = static_cast<ucontext_t*>(ucontext);
+#if defined(__x86_64__)
+    pc = uc->uc_mcontext.gregs[REG_RIP];
+    fp = uc->uc_mcontext.gregs[REG_RBP];
+#elif defined(__aarch64__)
+    pc = uc->uc_mcontext.pc;
+    fp = uc->uc_mcontext.regs[29];
+#else
+    (void)uc;
+#endif
+    int depth = 0;
+    if (pc != 0) {
+        sample->frames[depth++] = pc;
+    }
+    // BE is built with -fno-omit-frame-pointer, each frame starts with the frame pointer of its caller
+    // followed by the return address.
+    while (depth < MAX_STACK_DEPTH && fp >= tls_stack_low && fp + 2 * sizeof(uintptr_t) <= tls_stack_high &&
+           fp % sizeof(uintptr_t) == 0) {
+        const auto* frame = reinterpret_cast<const uintptr_t*>(fp);
+        uintptr_t return_address = frame[1];
+        if (return_address == 0) {
+            break;
+        }
+        // the address of the call instruction rather than the next one, to be symbolized correctly.
+        sample->frames[depth++] = return_address - 1;
+        if (frame[0] <= fp) {
+            break;
+        }
+        fp = frame[0];
+    }
+    sample->depth = depth;
+}
+
+void SamplingProfiler::collect(Samples* samples) {
+    std::lock_guard lock(_mutex);
+    if (!_initialized) {
+        return;
+    }
+    int index = _active_buffer.load();
+    _active_buffer.store(1 - index);
+    auto& buffer = _buffers[index];
+    // wait for the signal handlers which are writing to the buffer.
+    while (buffer.num_writers.load() != 0) {
+        std::this_thread::yield();
+    }
+
+    size_t size = std::min(buffer.size.load(), BUFFER_CAPACITY);
+    for (size_t i = 0; i < size; ++i) {
+        const auto& sample = buffer.samples[i];
+        StackKey key;
+        if (sample.query_id_hi != 0 || sample.query_id_lo != 0) {
+            TUniqueId query_id;
+            query_id.__set_hi(sample.query_id_hi);
+            query_id.__set_lo(sample.query_id_lo);
+            key.query_id = print_id(query_id);
+        } else {
+            key.query_id = "no_query";
+        }
+        if (sample.operator_name[0] != '\0') {
+            key.operator_name = strings::Substitute("$0 (plan_node_id=$1)", sample.operator_name, sample.plan_node_id);
+        }
+        key.frames.assign(sample.frames, sample.frames + sample.depth);
+        ++(*samples)[key];
+    }
+    buffer.size.store(0);
+}
+
+std::string SamplingProfiler::to_folded_stacks(const Samples& samples,
+                                               const std::function<std::string(uintptr_t)>& symbolize) {
+    std::ostringstream out;
+    for (const auto& [key, count] : samples) {
+        out << key.query_id;
+        if (!key.operator_name.empty()) {
+            out << ';' << key.operator_name;
+        }
+        for (auto it = key.frames.rbegin(); it != key.frames.rend(); ++it) {
+            out << ';' << symbolize(*it);
+        }
+        out << ' ' << count << '\n';
+    }
+    return out.str();
+}
+
+} // namespace starrocks
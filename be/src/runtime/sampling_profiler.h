@@ -0,0 +1,116 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <signal.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "common/compiler_util.h"
+#include "common/status.h"
+
+namespace starrocks {
+
+inline thread_local int64_t tls_sampling_profiler_epoch = 0;
+
+// A sampling CPU profiler of queries. While it's running, each thread executing pipeline drivers or
+// scan io tasks arms a timer of its own CPU time, and the signal handler of the timer records the call
+// stack of the thread, walked by the frame pointers, along with the query and the operator in
+// tls_sampling_context. The samples are aggregated per query into folded stacks, which can be rendered
+// by flamegraph.pl directly.
+//
+// The threads arm or disarm their timers in maybe_update_current_thread(), which is just a load of
+// a thread local and a relaxed atomic when nothing is changed, so the overhead is negligible when off.
+class SamplingProfiler {
+public:
+    static constexpr int MAX_STACK_DEPTH = 64;
+    static constexpr int MAX_OPERATOR_NAME_SIZE = 48;
+    // The number of samples which can be recorded between two collections.
+    static constexpr size_t BUFFER_CAPACITY = 16384;
+
+    struct StackKey {
+        std::string query_id;
+        // The operator name with the plan node id, empty if not in any operator.
+        std::string operator_name;
+        // The innermost frame first.
+        std::vector<uintptr_t> frames;
+
+        bool operator<(const StackKey& rhs) const {
+            return std::tie(query_id, operator_name, frames) < std::tie(rhs.query_id, rhs.operator_name, rhs.frames);
+        }
+    };
+    // The number of samples of each stack.
+    using Samples = std::map<StackKey, int64_t>;
+
+    static SamplingProfiler* instance();
+
+    // Sample the threads every |interval_us| microseconds of their CPU time.
+    Status start(int64_t interval_us);
+    void stop();
+    bool is_running() const { return _running.load(std::memory_order_relaxed); }
+
+    static void maybe_update_current_thread() {
+        if (UNLIKELY(tls_sampling_profiler_epoch != _epoch.load(std::memory_order_relaxed))) {
+            update_current_thread();
+        }
+    }
+
+    // Arm the timer of the current thread if the profiler is running, or disarm it.
+    static void update_current_thread();
+
+    // Move the samples recorded since the last collection into |samples|.
+    void collect(Samples* samples);
+
+    // The number of samples dropped because the buffer is full.
+    int64_t num_dropped_samples() const { return _num_dropped_samples.load(); }
+
+    // Render |samples| as folded stacks, one "query_id;operator;outermost_frame;...;innermost_frame count"
+    // per line, where the frames are translated by |symbolize|.
+    static std::string to_folded_stacks(const Samples& samples,
+                                        const std::function<std::string(uintptr_t)>& symbolize);
+
+private:
+    struct Sample {
+        int64_t query_id_hi;
+        int64_t query_id_lo;
+        int32_t plan_node_id;
+        int32_t depth;
+        char operator_name[MAX_OPERATOR_NAME_SIZE];
+        uintptr_t frames[MAX_STACK_DEPTH];
+    };
+
+    // The signal handler writes to the active buffer, while the collector swaps the buffers
+    // and waits for the writers of the inactive one to finish.
+    struct Buffer {
+        std::unique_ptr<Sample[]> samples;
+        std::atomic<size_t> size = 0;
+        std::atomic<int32_t> num_writers = 0;
+    };
+
+    SamplingProfiler() = default;
+
+    static void _signal_handler(int signo, siginfo_t* info, void* ucontext);
+    void _record_sample(void* ucontext);
+    void _fill_sample(Sample* sample, void* ucontext);
+
+    static std::atomic<int64_t> _epoch;
+
+    // Serializes start, stop and collect.
+    std::mutex _mutex;
+    std::atomic<bool> _running = false;
+    std::atomic<int64_t> _interval_us = 0;
+    bool _initialized = false;
+    Buffer _buffers[2];
+    std::atomic<int> _active_buffer = 0;
+    std::atomic<int64_t> _num_dropped_samples = 0;
+};
+
+} // namespace starrocks
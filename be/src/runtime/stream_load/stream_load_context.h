@@ -99,6 +99,19 @@ public:
         }
 
         _exec_env->load_stream_mgr()->remove(id);
+        for (auto& pipe_id : extra_pipe_ids) {
+            _exec_env->load_stream_mgr()->remove(pipe_id);
+        }
+    }
+
+    // cancel body_sink and all extra body sinks, make sender known it
+    void cancel_body_sinks() {
+        if (body_sink != nullptr) {
+            body_sink->cancel();
+        }
+        for (auto& sink : extra_body_sinks) {
+            sink->cancel();
+        }
     }
 
     std::string to_json() const;
@@ -169,6 +182,10 @@ public:
     TFileFormatType::type format = TFileFormatType::FORMAT_CSV_PLAIN;
 
     std::shared_ptr<MessageBodySink> body_sink;
+    // Routine load may fan kafka partitions out to several pipes so that they are parsed
+    // by parallel scanners. The pipes besides body_sink and their load ids are saved here.
+    std::vector<std::shared_ptr<MessageBodySink>> extra_body_sinks;
+    std::vector<UniqueId> extra_pipe_ids;
 
     TStreamLoadPutResult put_result;
 
@@ -95,9 +95,7 @@ Status StreamLoadExecutor::execute_plan_fragment(StreamLoadContext* ctx) {
                                  << ", query_id=" << UniqueId(ctx->put_result.params.params.query_id)
                                  << ", err_msg=" << status.get_error_msg() << ", " << ctx->brief();
                     // cancel body_sink, make sender known it
-                    if (ctx->body_sink != nullptr) {
-                        ctx->body_sink->cancel();
-                    }
+                    ctx->cancel_body_sinks();
 
                     switch (ctx->load_src_type) {
                     // reset the stream load ctx's kafka commit offset
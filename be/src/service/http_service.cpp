@@ -28,6 +28,7 @@
 #include "http/action/meta_action.h"
 #include "http/action/metrics_action.h"
 #include "http/action/pprof_actions.h"
+#include "http/action/query_cpu_profile_action.h"
 #include "http/action/reload_tablet_action.h"
 #include "http/action/restore_tablet_action.h"
 #include "http/action/snapshot_action.h"
@@ -126,6 +127,10 @@ Status HttpService::start() {
     _ev_http_server->register_handler(HttpMethod::POST, "/pprof/symbol", symbol_action);
     _http_handlers.emplace_back(symbol_action);
 
+    QueryCpuProfileAction* query_cpu_profile_action = new QueryCpuProfileAction(_env->bfd_parser());
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/query_cpu_profile", query_cpu_profile_action);
+    _http_handlers.emplace_back(query_cpu_profile_action);
+
     // register metrics
     {
         auto action = new MetricsAction(StarRocksMetrics::instance()->metrics());
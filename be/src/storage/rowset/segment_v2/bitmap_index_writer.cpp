@@ -24,6 +24,7 @@
 #include <map>
 #include <memory>
 #include <roaring/roaring.hh>
+#include <string>
 #include <utility>
 
 #include "env/env.h"
@@ -34,6 +35,7 @@
 #include "storage/types.h"
 #include "util/faststring.h"
 #include "util/slice.h"
+#include "util/text_tokenizer.h"
 
 namespace starrocks::segment_v2 {
 
@@ -49,6 +51,72 @@ struct BitmapIndexTraits<Slice> {
     using MemoryIndexType = std::map<Slice, Roaring, Slice::Comparator>;
 };
 
+// Write the dictionary of |mem_index| and the bitmaps, followed by |null_bitmap| if it's not empty.
+template <typename MemoryIndexType>
+Status write_bitmap_index(fs::WritableBlock* wblock, const TypeInfoPtr& typeinfo, MemoryIndexType* mem_index,
+                          Roaring* null_bitmap, BitmapIndexPB* meta) {
+    meta->set_bitmap_type(BitmapIndexPB::ROARING_BITMAP);
+    meta->set_has_null(!null_bitmap->isEmpty());
+
+    { // write dictionary
+        IndexedColumnWriterOptions options;
+        options.write_ordinal_index = false;
+        options.write_value_index = true;
+        options.encoding = EncodingInfo::get_default_encoding(typeinfo->type(), true);
+        options.compression = CompressionTypePB::LZ4_FRAME;
+
+        IndexedColumnWriter dict_column_writer(options, typeinfo, wblock);
+        RETURN_IF_ERROR(dict_column_writer.init());
+        for (auto const& it : *mem_index) {
+            RETURN_IF_ERROR(dict_column_writer.add(&(it.first)));
+        }
+        RETURN_IF_ERROR(dict_column_writer.finish(meta->mutable_dict_column()));
+    }
+    { // write bitmaps
+        std::vector<Roaring*> bitmaps;
+        for (auto& it : *mem_index) {
+            bitmaps.push_back(&(it.second));
+        }
+        if (!null_bitmap->isEmpty()) {
+            bitmaps.push_back(null_bitmap);
+        }
+
+        uint32_t max_bitmap_size = 0;
+        std::vector<uint32_t> bitmap_sizes;
+        for (auto& bitmap : bitmaps) {
+            bitmap->runOptimize();
+            uint32_t bitmap_size = bitmap->getSizeInBytes(false);
+            if (max_bitmap_size < bitmap_size) {
+                max_bitmap_size = bitmap_size;
+            }
+            bitmap_sizes.push_back(bitmap_size);
+        }
+
+        TypeInfoPtr bitmap_typeinfo = get_type_info(OLAP_FIELD_TYPE_OBJECT);
+
+        IndexedColumnWriterOptions options;
+        options.write_ordinal_index = true;
+        options.write_value_index = false;
+        options.encoding = EncodingInfo::get_default_encoding(bitmap_typeinfo->type(), false);
+        // we already store compressed bitmap, use NO_COMPRESSION to save some cpu
+        options.compression = NO_COMPRESSION;
+
+        IndexedColumnWriter bitmap_column_writer(options, bitmap_typeinfo, wblock);
+        RETURN_IF_ERROR(bitmap_column_writer.init());
+
+        faststring buf;
+        buf.reserve(max_bitmap_size);
+        for (size_t i = 0; i < bitmaps.size(); ++i) {
+            buf.resize(bitmap_sizes[i]); // so that buf[0..size) can be read and written
+            bitmaps[i]->write(reinterpret_cast<char*>(buf.data()), false);
+            Slice buf_slice(buf);
+            RETURN_IF_ERROR(bitmap_column_writer.add(&buf_slice));
+        }
+        RETURN_IF_ERROR(bitmap_column_writer.finish(meta->mutable_bitmap_column()));
+    }
+    return Status::OK();
+}
+
 // Builder for bitmap index. Bitmap index is comprised of two parts
 // - an "ordered dictionary" which contains all distinct values of a column and maps each value to an id.
 //   the smallest value mapped to 0, second value mapped to 1, ..
@@ -105,68 +173,7 @@ public:
 
     Status finish(fs::WritableBlock* wblock, ColumnIndexMetaPB* index_meta) override {
         index_meta->set_type(BITMAP_INDEX);
-        BitmapIndexPB* meta = index_meta->mutable_bitmap_index();
-
-        meta->set_bitmap_type(BitmapIndexPB::ROARING_BITMAP);
-        meta->set_has_null(!_null_bitmap.isEmpty());
-
-        { // write dictionary
-            IndexedColumnWriterOptions options;
-            options.write_ordinal_index = false;
-            options.write_value_index = true;
-            options.encoding = EncodingInfo::get_default_encoding(_typeinfo->type(), true);
-            options.compression = CompressionTypePB::LZ4_FRAME;
-
-            IndexedColumnWriter dict_column_writer(options, _typeinfo, wblock);
-            RETURN_IF_ERROR(dict_column_writer.init());
-            for (auto const& it : _mem_index) {
-                RETURN_IF_ERROR(dict_column_writer.add(&(it.first)));
-            }
-            RETURN_IF_ERROR(dict_column_writer.finish(meta->mutable_dict_column()));
-        }
-        { // write bitmaps
-            std::vector<Roaring*> bitmaps;
-            for (auto& it : _mem_index) {
-                bitmaps.push_back(&(it.second));
-            }
-            if (!_null_bitmap.isEmpty()) {
-                bitmaps.push_back(&_null_bitmap);
-            }
-
-            uint32_t max_bitmap_size = 0;
-            std::vector<uint32_t> bitmap_sizes;
-            for (auto& bitmap : bitmaps) {
-                bitmap->runOptimize();
-                uint32_t bitmap_size = bitmap->getSizeInBytes(false);
-                if (max_bitmap_size < bitmap_size) {
-                    max_bitmap_size = bitmap_size;
-                }
-                bitmap_sizes.push_back(bitmap_size);
-            }
-
-            TypeInfoPtr bitmap_typeinfo = get_type_info(OLAP_FIELD_TYPE_OBJECT);
-
-            IndexedColumnWriterOptions options;
-            options.write_ordinal_index = true;
-            options.write_value_index = false;
-            options.encoding = EncodingInfo::get_default_encoding(bitmap_typeinfo->type(), false);
-            // we already store compressed bitmap, use NO_COMPRESSION to save some cpu
-            options.compression = NO_COMPRESSION;
-
-            IndexedColumnWriter bitmap_column_writer(options, bitmap_typeinfo, wblock);
-            RETURN_IF_ERROR(bitmap_column_writer.init());
-
-            faststring buf;
-            buf.reserve(max_bitmap_size);
-            for (size_t i = 0; i < bitmaps.size(); ++i) {
-                buf.resize(bitmap_sizes[i]); // so that buf[0..size) can be read and written
-                bitmaps[i]->write(reinterpret_cast<char*>(buf.data()), false);
-                Slice buf_slice(buf);
-                RETURN_IF_ERROR(bitmap_column_writer.add(&buf_slice));
-            }
-            RETURN_IF_ERROR(bitmap_column_writer.finish(meta->mutable_bitmap_column()));
-        }
-        return Status::OK();
+        return write_bitmap_index(wblock, _typeinfo, &_mem_index, &_null_bitmap, index_meta->mutable_bitmap_index());
     }
 
     uint64_t size() const override {
@@ -189,8 +196,90 @@ private:
     MemPool _pool;
 };
 
+// Builder for the full-text inverted index. It's a bitmap index whose dictionary contains the terms
+// split from the values by TextTokenizer instead of the values, and the bitmap of a term is the list
+// of rowid where the term exists.
+//
+// E.g, if the column contains 3 rows ['GET /index', 'POST /index', 'GET /login'],
+// then the ordered dictionary would be ['get', 'index', 'login', 'post'] and the posting list would be
+//   bitmap for ID 0 : [1 0 1]
+//   bitmap for ID 1 : [1 1 0]
+//   bitmap for ID 2 : [0 0 1]
+//   bitmap for ID 3 : [0 1 0]
+//
+class InvertedIndexWriterImpl : public BitmapIndexWriter {
+public:
+    using MemoryIndexType = BitmapIndexTraits<Slice>::MemoryIndexType;
+
+    InvertedIndexWriterImpl() : _typeinfo(get_type_info(OLAP_FIELD_TYPE_VARCHAR)) {}
+
+    ~InvertedIndexWriterImpl() override = default;
+
+    void add_values(const void* values, size_t count) override {
+        auto p = reinterpret_cast<const Slice*>(values);
+        for (size_t i = 0; i < count; ++i) {
+            TextTokenizer::for_each_term(unaligned_load<Slice>(p), &_term_buf,
+                                         [this](const Slice& term) { add_term(term); });
+            p++;
+            _rid++;
+        }
+    }
+
+    void add_term(const Slice& term) {
+        auto it = _mem_index.find(term);
+        uint64_t old_size = 0;
+        if (it != _mem_index.end()) {
+            old_size = it->second.getSizeInBytes(false);
+            it->second.add(_rid);
+        } else {
+            Slice new_term;
+            _typeinfo->deep_copy(&new_term, &term, &_pool);
+            it = _mem_index.emplace(new_term, Roaring::bitmapOf(1, _rid)).first;
+        }
+        _reverted_index_size += it->second.getSizeInBytes(false) - old_size;
+    }
+
+    void add_nulls(uint32_t count) override {
+        _null_bitmap.addRange(_rid, _rid + count);
+        _rid += count;
+    }
+
+    Status finish(fs::WritableBlock* wblock, ColumnIndexMetaPB* index_meta) override {
+        index_meta->set_type(INVERTED_INDEX);
+        return write_bitmap_index(wblock, _typeinfo, &_mem_index, &_null_bitmap, index_meta->mutable_inverted_index());
+    }
+
+    uint64_t size() const override {
+        uint64_t size = 0;
+        size += _null_bitmap.getSizeInBytes(false);
+        size += _reverted_index_size;
+        size += _mem_index.size() * sizeof(Slice);
+        size += _pool.total_allocated_bytes();
+        return size;
+    }
+
+private:
+    TypeInfoPtr _typeinfo;
+    uint64_t _reverted_index_size = 0;
+    rowid_t _rid = 0;
+    Roaring _null_bitmap;
+    // unique term to its row id list
+    MemoryIndexType _mem_index;
+    MemPool _pool;
+    std::string _term_buf;
+};
+
 } // namespace
 
+Status BitmapIndexWriter::create_inverted(const TypeInfoPtr& typeinfo, std::unique_ptr<BitmapIndexWriter>* res) {
+    FieldType type = typeinfo->type();
+    if (type != OLAP_FIELD_TYPE_CHAR && type != OLAP_FIELD_TYPE_VARCHAR) {
+        return Status::NotSupported("unsupported type for inverted index: " + std::to_string(type));
+    }
+    *res = std::make_unique<InvertedIndexWriterImpl>();
+    return Status::OK();
+}
+
 Status BitmapIndexWriter::create(const TypeInfoPtr& typeinfo, std::unique_ptr<BitmapIndexWriter>* res) {
     FieldType type = typeinfo->type();
     switch (type) {
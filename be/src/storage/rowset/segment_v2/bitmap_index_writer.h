@@ -43,6 +43,10 @@ class BitmapIndexWriter {
 public:
     static Status create(const TypeInfoPtr& type_info, std::unique_ptr<BitmapIndexWriter>* res);
 
+    // Create a writer of the full-text inverted index, which maps the terms split from the values
+    // by TextTokenizer, instead of the values, to the row ids. Only CHAR and VARCHAR are supported.
+    static Status create_inverted(const TypeInfoPtr& type_info, std::unique_ptr<BitmapIndexWriter>* res);
+
     BitmapIndexWriter() = default;
     virtual ~BitmapIndexWriter() = default;
 
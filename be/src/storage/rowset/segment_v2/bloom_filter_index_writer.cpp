@@ -33,6 +33,8 @@
 #include "storage/rowset/segment_v2/encoding_info.h"
 #include "storage/rowset/segment_v2/indexed_column_writer.h"
 #include "storage/types.h"
+#include "util/murmur_hash3.h"
+#include "util/phmap/phmap.h"
 #include "util/slice.h"
 
 namespace starrocks::segment_v2 {
@@ -169,8 +171,98 @@ private:
     std::vector<std::unique_ptr<BloomFilter>> _bfs;
 };
 
+// Builder for n-gram bloom filter, which is used by LIKE '%substring%' predicates on string columns.
+// All the substrings of |gram_size| bytes of the values in a data page are added into the bloom filter
+// of the page, so a page can be skipped if any gram of the needle is not in its bloom filter. The
+// values shorter than |gram_size| are not added, because they can't contain a needle of a whole gram.
+// The bloom filters are written in the same format as the bloom filter index.
+class NGramBloomFilterIndexWriterImpl : public BloomFilterIndexWriter {
+public:
+    NGramBloomFilterIndexWriterImpl(const BloomFilterOptions& bf_options, uint32_t gram_size)
+            : _bf_options(bf_options), _gram_size(gram_size) {}
+
+    ~NGramBloomFilterIndexWriterImpl() override = default;
+
+    void add_values(const void* values, size_t count) override {
+        const auto* v = reinterpret_cast<const Slice*>(values);
+        for (size_t i = 0; i < count; ++i, ++v) {
+            for (size_t pos = 0; pos + _gram_size <= v->size; ++pos) {
+                uint64_t hash_code;
+                murmur_hash3_x64_64(v->data + pos, _gram_size, BloomFilter::DEFAULT_SEED, &hash_code);
+                _hashes.insert(hash_code);
+            }
+        }
+    }
+
+    void add_nulls(uint32_t count) override { _has_null |= (count > 0); }
+
+    Status flush() override {
+        std::unique_ptr<BloomFilter> bf;
+        RETURN_IF_ERROR(BloomFilter::create(BLOCK_BLOOM_FILTER, &bf));
+        RETURN_IF_ERROR(bf->init(_hashes.size(), _bf_options.fpp, _bf_options.strategy));
+        bf->set_has_null(_has_null);
+        for (uint64_t hash_code : _hashes) {
+            bf->add_hash(hash_code);
+        }
+        _bf_buffer_size += bf->size();
+        _bfs.push_back(std::move(bf));
+        _hashes.clear();
+        _has_null = false;
+        return Status::OK();
+    }
+
+    Status finish(fs::WritableBlock* wblock, ColumnIndexMetaPB* index_meta) override {
+        if (!_hashes.empty()) {
+            RETURN_IF_ERROR(flush());
+        }
+        index_meta->set_type(NGRAM_BLOOM_FILTER_INDEX);
+        BloomFilterIndexPB* meta = index_meta->mutable_ngram_bloom_filter_index();
+        meta->set_hash_strategy(_bf_options.strategy);
+        meta->set_algorithm(BLOCK_BLOOM_FILTER);
+        meta->set_gram_size(_gram_size);
+
+        TypeInfoPtr bf_typeinfo = get_type_info(OLAP_FIELD_TYPE_VARCHAR);
+        IndexedColumnWriterOptions options;
+        options.write_ordinal_index = true;
+        options.write_value_index = false;
+        options.encoding = PLAIN_ENCODING;
+        IndexedColumnWriter bf_writer(options, bf_typeinfo, wblock);
+        RETURN_IF_ERROR(bf_writer.init());
+        for (auto& bf : _bfs) {
+            Slice data(bf->data(), bf->size());
+            bf_writer.add(&data);
+        }
+        RETURN_IF_ERROR(bf_writer.finish(meta->mutable_bloom_filter()));
+        return Status::OK();
+    }
+
+    uint64_t size() override { return _bf_buffer_size + _hashes.size() * sizeof(uint64_t); }
+
+private:
+    BloomFilterOptions _bf_options;
+    uint32_t _gram_size;
+    bool _has_null = false;
+    uint64_t _bf_buffer_size = 0;
+    // distinct hash codes of the grams of the current page
+    phmap::flat_hash_set<uint64_t> _hashes;
+    std::vector<std::unique_ptr<BloomFilter>> _bfs;
+};
+
 } // namespace
 
+Status BloomFilterIndexWriter::create_ngram(const BloomFilterOptions& bf_options, uint32_t gram_size,
+                                            const TypeInfoPtr& typeinfo, std::unique_ptr<BloomFilterIndexWriter>* res) {
+    FieldType type = typeinfo->type();
+    if (type != OLAP_FIELD_TYPE_CHAR && type != OLAP_FIELD_TYPE_VARCHAR) {
+        return Status::NotSupported("unsupported type for n-gram bloom filter: " + std::to_string(type));
+    }
+    if (gram_size == 0) {
+        return Status::InvalidArgument("gram size of n-gram bloom filter must be positive");
+    }
+    *res = std::make_unique<NGramBloomFilterIndexWriterImpl>(bf_options, gram_size);
+    return Status::OK();
+}
+
 // TODO currently we don't support bloom filter index for tinyint/hll/float/double
 Status BloomFilterIndexWriter::create(const BloomFilterOptions& bf_options, const TypeInfoPtr& typeinfo,
                                       std::unique_ptr<BloomFilterIndexWriter>* res) {
@@ -46,6 +46,11 @@ public:
     static Status create(const BloomFilterOptions& bf_options, const TypeInfoPtr& typeinfo,
                          std::unique_ptr<BloomFilterIndexWriter>* res);
 
+    // Create a writer of the n-gram bloom filter index, which adds the substrings of |gram_size| chars
+    // of the values, instead of the values, into the bloom filters. Only CHAR and VARCHAR are supported.
+    static Status create_ngram(const BloomFilterOptions& bf_options, uint32_t gram_size, const TypeInfoPtr& typeinfo,
+                               std::unique_ptr<BloomFilterIndexWriter>* res);
+
     BloomFilterIndexWriter() = default;
     virtual ~BloomFilterIndexWriter() = default;
 
@@ -114,6 +114,13 @@ public:
         return Status::OK();
     }
 
+    // Narrow |row_ranges| by the bounds of the value blocks inside data pages, which are kept by
+    // some encodings, e.g. frame-of-reference. Unlike zone map, the data pages need to be read.
+    virtual Status get_row_ranges_by_block_bounds(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                                  vectorized::SparseRange* row_ranges) {
+        return Status::OK();
+    }
+
     // return true iff all data pages of this column are encoded as dictionary encoding.
     // NOTE: the ColumnIterator must have been initialized with `check_dict_encoding`,
     // otherwise this method will always return false.
@@ -26,6 +26,7 @@
 #include <cstddef> // for size_t
 #include <cstdint> // for uint32_t
 #include <memory>  // for unique_ptr
+#include <set>
 #include <utility>
 
 #include "column/datum.h"
@@ -111,6 +112,10 @@ public:
     // TODO: StatusOr<std::unique_ptr<ColumnIterator>> new_bitmap_index_iterator()
     Status new_bitmap_index_iterator(BitmapIndexIterator** iterator);
 
+    // Caller should free returned iterator after unused.
+    // The dictionary of the returned iterator contains the terms of the full-text inverted index.
+    Status new_inverted_index_iterator(BitmapIndexIterator** iterator);
+
     // Seek to the first entry in the column.
     Status seek_to_first(OrdinalPageIndexIterator* iter);
     Status seek_at_or_before(ordinal_t ordinal, OrdinalPageIndexIterator* iter);
@@ -128,6 +133,10 @@ public:
     bool has_bloom_filter_index() const {
         return _flags[kHasBloomFilterIndexMetaPos] || _flags[kHasBloomFilterIndexReaderPos];
     }
+    bool has_ngram_bloom_filter_index() const {
+        return _flags[kHasNGramBloomFilterIndexMetaPos] || _flags[kHasNGramBloomFilterIndexReaderPos];
+    }
+    bool has_inverted_index() const { return _flags[kHasInvertedIndexMetaPos] || _flags[kHasInvertedIndexReaderPos]; }
 
     ZoneMapPB* segment_zone_map() const { return _segment_zone_map.get(); }
 
@@ -160,6 +169,10 @@ public:
     Status bloom_filter(const std::vector<const ::starrocks::vectorized::ColumnPredicate*>& p,
                         vectorized::SparseRange* ranges);
 
+    // prerequisite: at least one predicate in |predicates| support n-gram bloom filter.
+    Status ngram_bloom_filter(const std::vector<const ::starrocks::vectorized::ColumnPredicate*>& p,
+                              vectorized::SparseRange* ranges);
+
     uint32_t version() const { return _opts.storage_format_version; }
 
     Status load_ordinal_index_once();
@@ -186,6 +199,10 @@ private:
     constexpr static size_t kIsNullablePos = 8;
     constexpr static size_t kHasAllDictEncodedPos = 9;
     constexpr static size_t kAllDictEncodedPos = 10;
+    constexpr static size_t kHasNGramBloomFilterIndexMetaPos = 11;
+    constexpr static size_t kHasNGramBloomFilterIndexReaderPos = 12;
+    constexpr static size_t kHasInvertedIndexMetaPos = 13;
+    constexpr static size_t kHasInvertedIndexReaderPos = 14;
 
     // Disable copy and assignment
     ColumnReader(const ColumnReader&) = delete;
@@ -199,11 +216,15 @@ private:
     Status _load_zone_map_index_once();
     Status _load_bitmap_index_once();
     Status _load_bloom_filter_index_once();
+    Status _load_ngram_bloom_filter_index_once();
+    Status _load_inverted_index_once();
 
     Status _load_zone_map_index(bool use_page_cache, bool kept_in_memory);
     Status _load_ordinal_index(bool use_page_cache, bool kept_in_memory);
     Status _load_bitmap_index(bool use_page_cache, bool kept_in_memory);
     Status _load_bloom_filter_index(bool use_page_cache, bool kept_in_memory);
+    Status _load_ngram_bloom_filter_index(bool use_page_cache, bool kept_in_memory);
+    Status _load_inverted_index(bool use_page_cache, bool kept_in_memory);
 
     static void _parse_zone_map(const ZoneMapPB& zone_map, WrapperField* min_value_container,
                                 WrapperField* max_value_container);
@@ -212,6 +233,9 @@ private:
 
     Status _calculate_row_ranges(const std::vector<uint32_t>& page_indexes, vectorized::SparseRange* row_ranges);
 
+    // The ids of the data pages covered by |row_ranges|.
+    void _get_page_ids(const vectorized::SparseRange& row_ranges, std::set<int32_t>* page_ids);
+
     Status _zone_map_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
                             const vectorized::ColumnPredicate* del_predicate,
                             std::unordered_set<uint32_t>* del_partial_filtered_pages, std::vector<uint32_t>* pages);
@@ -237,6 +261,8 @@ private:
     ColumnIndex<OrdinalIndexPB, OrdinalIndexReader> _ordinal_index;
     ColumnIndex<BitmapIndexPB, BitmapIndexReader> _bitmap_index;
     ColumnIndex<BloomFilterIndexPB, BloomFilterIndexReader> _bloom_filter_index;
+    ColumnIndex<BloomFilterIndexPB, BloomFilterIndexReader> _ngram_bloom_filter_index;
+    ColumnIndex<BitmapIndexPB, BitmapIndexReader> _inverted_index;
 
     std::unique_ptr<ZoneMapPB> _segment_zone_map;
 
@@ -251,6 +277,8 @@ private:
     StarRocksCallOnce<Status> _zonemap_index_once;
     StarRocksCallOnce<Status> _bitmap_index_once;
     StarRocksCallOnce<Status> _bloomfilter_index_once;
+    StarRocksCallOnce<Status> _ngram_bloomfilter_index_once;
+    StarRocksCallOnce<Status> _inverted_index_once;
 
     std::bitset<16> _flags;
 };
@@ -386,6 +386,16 @@ Status ScalarColumnWriter::init() {
         RETURN_IF_ERROR(BloomFilterIndexWriter::create(BloomFilterOptions(), get_field()->type_info(),
                                                        &_bloom_filter_index_builder));
     }
+    if (_opts.ngram_bf_gram_size > 0) {
+        _has_index_builder = true;
+        RETURN_IF_ERROR(BloomFilterIndexWriter::create_ngram(BloomFilterOptions(), _opts.ngram_bf_gram_size,
+                                                             get_field()->type_info(),
+                                                             &_ngram_bloom_filter_index_builder));
+    }
+    if (_opts.need_inverted_index) {
+        _has_index_builder = true;
+        RETURN_IF_ERROR(BitmapIndexWriter::create_inverted(get_field()->type_info(), &_inverted_index_builder));
+    }
     return Status::OK();
 }
 
@@ -409,6 +419,12 @@ uint64_t ScalarColumnWriter::estimate_buffer_size() {
     if (_bloom_filter_index_builder != nullptr) {
         size += _bloom_filter_index_builder->size();
     }
+    if (_ngram_bloom_filter_index_builder != nullptr) {
+        size += _ngram_bloom_filter_index_builder->size();
+    }
+    if (_inverted_index_builder != nullptr) {
+        size += _inverted_index_builder->size();
+    }
     return size;
 }
 
@@ -497,14 +513,20 @@ Status ScalarColumnWriter::write_zone_map() {
 
 Status ScalarColumnWriter::write_bitmap_index() {
     if (_bitmap_index_builder != nullptr) {
-        return _bitmap_index_builder->finish(_wblock, _opts.meta->add_indexes());
+        RETURN_IF_ERROR(_bitmap_index_builder->finish(_wblock, _opts.meta->add_indexes()));
+    }
+    if (_inverted_index_builder != nullptr) {
+        RETURN_IF_ERROR(_inverted_index_builder->finish(_wblock, _opts.meta->add_indexes()));
     }
     return Status::OK();
 }
 
 Status ScalarColumnWriter::write_bloom_filter_index() {
     if (_bloom_filter_index_builder != nullptr) {
-        return _bloom_filter_index_builder->finish(_wblock, _opts.meta->add_indexes());
+        RETURN_IF_ERROR(_bloom_filter_index_builder->finish(_wblock, _opts.meta->add_indexes()));
+    }
+    if (_ngram_bloom_filter_index_builder != nullptr) {
+        RETURN_IF_ERROR(_ngram_bloom_filter_index_builder->finish(_wblock, _opts.meta->add_indexes()));
     }
     return Status::OK();
 }
@@ -530,6 +552,10 @@ Status ScalarColumnWriter::finish_current_page() {
         RETURN_IF_ERROR(_bloom_filter_index_builder->flush());
     }
 
+    if (_ngram_bloom_filter_index_builder != nullptr) {
+        RETURN_IF_ERROR(_ngram_bloom_filter_index_builder->flush());
+    }
+
     // build data page body : encoded values + [nullmap]
     std::vector<Slice> body;
     faststring* encoded_values = _page_builder->finish();
@@ -729,10 +755,14 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
                     INDEX_ADD_NULLS(_zone_map_index_builder, run);
                     INDEX_ADD_NULLS(_bitmap_index_builder, run);
                     INDEX_ADD_NULLS(_bloom_filter_index_builder, run);
+                    INDEX_ADD_NULLS(_ngram_bloom_filter_index_builder, run);
+                    INDEX_ADD_NULLS(_inverted_index_builder, run);
                 } else {
                     INDEX_ADD_VALUES(_zone_map_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_bitmap_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_bloom_filter_index_builder, pdata, run);
+                    INDEX_ADD_VALUES(_ngram_bloom_filter_index_builder, pdata, run);
+                    INDEX_ADD_VALUES(_inverted_index_builder, pdata, run);
                 }
                 pdata += get_field()->size() * run;
             }
@@ -740,6 +770,8 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
             INDEX_ADD_VALUES(_zone_map_index_builder, data, num_written);
             INDEX_ADD_VALUES(_bitmap_index_builder, data, num_written);
             INDEX_ADD_VALUES(_bloom_filter_index_builder, data, num_written);
+            INDEX_ADD_VALUES(_ngram_bloom_filter_index_builder, data, num_written);
+            INDEX_ADD_VALUES(_inverted_index_builder, data, num_written);
         }
 
         _next_rowid += num_written;
@@ -63,6 +63,10 @@ struct ColumnWriterOptions {
     bool need_zone_map = false;
     bool need_bitmap_index = false;
     bool need_bloom_filter = false;
+    // build the n-gram bloom filter index of grams of |ngram_bf_gram_size| chars if it's positive.
+    uint32_t ngram_bf_gram_size = 0;
+    // build the full-text inverted index of the terms split from the values.
+    bool need_inverted_index = false;
     bool adaptive_page_format = false;
     // for char/varchar will speculate encoding in append
     // for others will decide encoding in init method
@@ -240,7 +244,9 @@ private:
     std::unique_ptr<ZoneMapIndexWriter> _zone_map_index_builder;
     std::unique_ptr<BitmapIndexWriter> _bitmap_index_builder;
     std::unique_ptr<BloomFilterIndexWriter> _bloom_filter_index_builder;
-    // _zone_map_index_builder != NULL || _bitmap_index_builder != NULL || _bloom_filter_index_builder != NULL
+    std::unique_ptr<BloomFilterIndexWriter> _ngram_bloom_filter_index_builder;
+    std::unique_ptr<BitmapIndexWriter> _inverted_index_builder;
+    // any of the index builders above is not NULL
     bool _has_index_builder = false;
     int64_t _element_ordinal = 0;
     int64_t _previous_ordinal = 0;
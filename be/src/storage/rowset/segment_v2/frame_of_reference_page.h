@@ -25,6 +25,7 @@
 #include "storage/rowset/segment_v2/options.h"      // for PageBuilderOptions/PageDecoderOptions
 #include "storage/rowset/segment_v2/page_builder.h" // for PageBuilder
 #include "storage/rowset/segment_v2/page_decoder.h" // for PageDecoder
+#include "storage/vectorized/column_predicate.h"
 #include "util/frame_of_reference_coding.h"
 
 namespace starrocks {
@@ -212,6 +213,27 @@ public:
         return Status::OK();
     }
 
+    Status get_row_ranges_by_block_bounds(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                          ordinal_t first_ordinal, vectorized::SparseRange* row_ranges) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        const uint32_t frame_size = _decoder.max_frame_size();
+        for (uint32_t i = 0; i < _decoder.frame_count(); i++) {
+            size_t begin = static_cast<size_t>(i) * frame_size;
+            size_t end = std::min(begin + frame_size, _num_elements);
+            CppType min;
+            CppType max;
+            if (_decoder.frame_bounds(i, &min, &max)) {
+                vectorized::ZoneMapDetail detail(_to_datum(min), _to_datum(max), false);
+                auto filter = [&](const vectorized::ColumnPredicate* pred) { return pred->zone_map_filter(detail); };
+                if (!std::all_of(predicates.begin(), predicates.end(), filter)) {
+                    continue;
+                }
+            }
+            row_ranges->add(vectorized::Range(first_ordinal + begin, first_ordinal + end));
+        }
+        return Status::OK();
+    }
+
     size_t count() const override { return _num_elements; }
 
     size_t current_index() const override { return _cur_index; }
@@ -221,6 +243,21 @@ public:
 private:
     typedef typename TypeTraits<Type>::CppType CppType;
 
+    // DATE_V2 and TIMESTAMP are stored as integers but held by DateValue and TimestampValue in Datum.
+    static vectorized::Datum _to_datum(CppType value) {
+        if constexpr (Type == OLAP_FIELD_TYPE_DATE_V2) {
+            vectorized::DateValue date;
+            date._julian = value;
+            return vectorized::Datum(date);
+        } else if constexpr (Type == OLAP_FIELD_TYPE_TIMESTAMP) {
+            vectorized::TimestampValue timestamp;
+            timestamp._timestamp = value;
+            return vectorized::Datum(timestamp);
+        } else {
+            return vectorized::Datum(value);
+        }
+    }
+
     bool _parsed;
     Slice _data;
     size_t _num_elements;
@@ -26,12 +26,14 @@
 #include "runtime/timestamp_value.h"
 #include "storage/column_block.h" // for ColumnBlockView
 #include "storage/fs/block_manager.h"
+#include "storage/rowset/segment_v2/common.h"
 #include "storage/rowset/segment_v2/page_pointer.h"
 #include "storage/vectorized/range.h"
 
 namespace starrocks::vectorized {
 class Column;
-}
+class ColumnPredicate;
+} // namespace starrocks::vectorized
 
 namespace starrocks {
 namespace segment_v2 {
@@ -125,6 +127,15 @@ public:
 
     virtual const PageDecoder* dict_page_decoder() const { return nullptr; }
 
+    // Add the rows of this page which may satisfy all the |predicates| into |row_ranges|, judged by
+    // the per-block metadata kept by the encoding, e.g. the reference value and bit width of each
+    // frame in frame-of-reference coding, so the values are not decoded.
+    // |first_ordinal| is the ordinal of the first row in this page.
+    virtual Status get_row_ranges_by_block_bounds(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                                  ordinal_t first_ordinal, vectorized::SparseRange* row_ranges) {
+        return Status::NotSupported("get_row_ranges_by_block_bounds() not supported");
+    }
+
 private:
     PageDecoder(const PageDecoder&) = delete;
     const PageDecoder& operator=(const PageDecoder&) = delete;
@@ -326,13 +326,55 @@ Status ScalarColumnIterator::get_row_ranges_by_zone_map(
 
 Status ScalarColumnIterator::get_row_ranges_by_bloom_filter(
         const std::vector<const vectorized::ColumnPredicate*>& predicates, vectorized::SparseRange* row_ranges) {
-    RETURN_IF(!_reader->has_bloom_filter_index(), Status::OK());
-    bool support = false;
-    for (const auto* pred : predicates) {
-        support = support | pred->support_bloom_filter();
+    if (_reader->has_bloom_filter_index()) {
+        bool support = false;
+        for (const auto* pred : predicates) {
+            support = support | pred->support_bloom_filter();
+        }
+        if (support) {
+            RETURN_IF_ERROR(_reader->bloom_filter(predicates, row_ranges));
+        }
+    }
+    if (_reader->has_ngram_bloom_filter_index()) {
+        bool support = false;
+        for (const auto* pred : predicates) {
+            support = support | pred->support_ngram_bloom_filter();
+        }
+        if (support) {
+            RETURN_IF_ERROR(_reader->ngram_bloom_filter(predicates, row_ranges));
+        }
+    }
+    return Status::OK();
+}
+
+Status ScalarColumnIterator::get_row_ranges_by_block_bounds(
+        const std::vector<const vectorized::ColumnPredicate*>& predicates, vectorized::SparseRange* row_ranges) {
+    RETURN_IF(predicates.empty() || row_ranges->empty(), Status::OK());
+    RETURN_IF(_reader->encoding_info()->encoding() != FOR_ENCODING, Status::OK());
+    // the data pages read here will be read again by the scan, which is cheap only with page cache.
+    RETURN_IF(!_opts.use_page_cache, Status::OK());
+    // the positions in page decoder are the same as the row offsets in page only if there is no null.
+    RETURN_IF(_reader->is_nullable(), Status::OK());
+
+    vectorized::SparseRange block_ranges;
+    ordinal_t handled_end = 0;
+    for (size_t i = 0; i < row_ranges->size(); ++i) {
+        vectorized::Range r = (*row_ranges)[i];
+        ordinal_t ord = std::max<ordinal_t>(r.begin(), handled_end);
+        while (ord < r.end()) {
+            if (_page == nullptr || !_page->contains(ord)) {
+                RETURN_IF_ERROR(_reader->seek_at_or_before(ord, &_page_iter));
+                RETURN_IF_ERROR(_read_data_page(_page_iter));
+            }
+            Status st = _page->data_decoder()->get_row_ranges_by_block_bounds(predicates, _page->first_ordinal(),
+                                                                              &block_ranges);
+            RETURN_IF(st.is_not_supported(), Status::OK());
+            RETURN_IF_ERROR(st);
+            handled_end = _page->first_ordinal() + _page->num_rows();
+            ord = handled_end;
+        }
     }
-    RETURN_IF(!support, Status::OK());
-    RETURN_IF_ERROR(_reader->bloom_filter(predicates, row_ranges));
+    *row_ranges = row_ranges->intersection(block_ranges);
     return Status::OK();
 }
 
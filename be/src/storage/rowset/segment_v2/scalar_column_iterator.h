@@ -60,6 +60,9 @@ public:
     Status get_row_ranges_by_bloom_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
                                           vectorized::SparseRange* range) override;
 
+    Status get_row_ranges_by_block_bounds(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                          vectorized::SparseRange* range) override;
+
     bool all_page_dict_encoded() const override { return _all_dict_encoded; }
 
     Status fetch_all_dict_words(std::vector<Slice>* words) const override;
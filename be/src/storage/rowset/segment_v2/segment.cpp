@@ -317,4 +317,11 @@ Status Segment::new_bitmap_index_iterator(uint32_t cid, BitmapIndexIterator** it
     return Status::OK();
 }
 
+Status Segment::new_inverted_index_iterator(uint32_t cid, BitmapIndexIterator** iter) {
+    if (_column_readers[cid] != nullptr && _column_readers[cid]->has_inverted_index()) {
+        return _column_readers[cid]->new_inverted_index_iterator(iter);
+    }
+    return Status::OK();
+}
+
 } // namespace starrocks::segment_v2
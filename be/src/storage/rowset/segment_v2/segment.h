@@ -100,6 +100,8 @@ public:
 
     Status new_bitmap_index_iterator(uint32_t cid, BitmapIndexIterator** iter);
 
+    Status new_inverted_index_iterator(uint32_t cid, BitmapIndexIterator** iter);
+
     size_t num_short_keys() const { return _tablet_schema->num_short_key_columns(); }
 
     uint32_t num_rows_per_block() const {
@@ -107,6 +107,8 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
         }
         opts.need_bloom_filter = column.is_bf_column();
         opts.need_bitmap_index = column.has_bitmap_index();
+        opts.ngram_bf_gram_size = column.ngram_bf_gram_size();
+        opts.need_inverted_index = column.has_inverted_index();
         if (column.type() == FieldType::OLAP_FIELD_TYPE_ARRAY) {
             if (opts.need_bloom_filter) {
                 return Status::NotSupported("Do not support bloom filter for array type");
@@ -114,6 +116,12 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
             if (opts.need_bitmap_index) {
                 return Status::NotSupported("Do not support bitmap index for array type");
             }
+            if (opts.ngram_bf_gram_size > 0) {
+                return Status::NotSupported("Do not support n-gram bloom filter for array type");
+            }
+            if (opts.need_inverted_index) {
+                return Status::NotSupported("Do not support inverted index for array type");
+            }
         }
 
         if (column.type() == FieldType::OLAP_FIELD_TYPE_CHAR && column.type() != FieldType::OLAP_FIELD_TYPE_VARCHAR,
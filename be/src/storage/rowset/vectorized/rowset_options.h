@@ -9,6 +9,7 @@
 #include "runtime/global_dicts.h"
 #include "storage/fs/fs_util.h"
 #include "storage/olap_common.h"
+#include "storage/vectorized/predicate_tree.h"
 #include "storage/vectorized/seek_range.h"
 
 namespace starrocks {
@@ -40,6 +41,9 @@ public:
 
     std::unordered_map<ColumnId, PredicateList> predicates;
 
+    // Only used to narrow the scan range by bitmap indexes, see PredicateTree.
+    std::vector<PredicateTree> predicate_trees;
+
     // whether rowset should return rows in sorted order.
     bool sorted = true;
 
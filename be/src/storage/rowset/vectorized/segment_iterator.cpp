@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <set>
 #include <unordered_map>
 
 #include "column/binary_column.h"
@@ -36,6 +37,7 @@
 #include "storage/vectorized/column_or_predicate.h"
 #include "storage/vectorized/column_predicate.h"
 #include "storage/vectorized/column_predicate_rewriter.h"
+#include "storage/vectorized/predicate_tree.h"
 #include "storage/vectorized/projection_iterator.h"
 #include "storage/vectorized/range.h"
 #include "storage/vectorized/roaring2range.h"
@@ -173,6 +175,7 @@ private:
     Status _get_row_ranges_by_keys();
     Status _get_row_ranges_by_zone_map();
     Status _get_row_ranges_by_bloom_filter();
+    Status _get_row_ranges_by_block_bounds();
 
     uint32_t segment_id() const { return _segment->id(); }
     uint32_t num_rows() const { return _segment->num_rows(); }
@@ -216,6 +219,12 @@ private:
 
     Status _apply_bitmap_index();
 
+    Status _apply_bitmap_index_trees();
+
+    Status _init_inverted_index_iterators();
+
+    Status _apply_inverted_index();
+
     Status _apply_del_vector();
 
     Status _read(Chunk* chunk, vector<rowid_t>* rowid, size_t n);
@@ -228,6 +237,7 @@ private:
     std::vector<ColumnIterator*> _column_iterators;
     std::vector<segment_v2::ColumnDecoder> _column_decoders;
     std::vector<BitmapIndexIterator*> _bitmap_index_iterators;
+    std::vector<BitmapIndexIterator*> _inverted_index_iterators;
 
     DelVectorPtr _del_vec;
     roaring_uint32_iterator_t _roaring_iter;
@@ -268,6 +278,7 @@ private:
 
     bool _inited = false;
     bool _has_bitmap_index = false;
+    bool _has_inverted_index = false;
 };
 
 SegmentIterator::SegmentIterator(std::shared_ptr<Segment> segment, vectorized::Schema schema,
@@ -315,11 +326,15 @@ Status SegmentIterator::_init() {
     // filter by index stage
     // Use indexes and predicates to filter some data page
     RETURN_IF_ERROR(_init_bitmap_index_iterators());
+    RETURN_IF_ERROR(_init_inverted_index_iterators());
     RETURN_IF_ERROR(_get_row_ranges_by_keys());
     RETURN_IF_ERROR(_apply_del_vector());
     RETURN_IF_ERROR(_apply_bitmap_index());
+    RETURN_IF_ERROR(_apply_bitmap_index_trees());
+    RETURN_IF_ERROR(_apply_inverted_index());
     RETURN_IF_ERROR(_get_row_ranges_by_zone_map());
     RETURN_IF_ERROR(_get_row_ranges_by_bloom_filter());
+    RETURN_IF_ERROR(_get_row_ranges_by_block_bounds());
     // rewrite stage
     // Rewriting predicates using segment dictionary codes
     _rewrite_predicates();
@@ -1160,9 +1175,18 @@ Status SegmentIterator::_build_final_chunk(ScanContext* ctx) {
 
 Status SegmentIterator::_init_bitmap_index_iterators() {
     DCHECK_EQ(_predicate_columns, _opts.predicates.size());
-    _bitmap_index_iterators.resize(ChunkHelper::max_column_id(_schema) + 1, nullptr);
+    std::set<ColumnId> columns;
     for (const auto& pair : _opts.predicates) {
-        ColumnId cid = pair.first;
+        columns.insert(pair.first);
+    }
+    if (config::bitmap_filter_enable_or) {
+        for (const PredicateTree& tree : _opts.predicate_trees) {
+            tree.get_column_ids(&columns);
+        }
+    }
+    size_t n = ChunkHelper::max_column_id(_schema) + 1;
+    _bitmap_index_iterators.resize(columns.empty() ? n : std::max<size_t>(n, *columns.rbegin() + 1), nullptr);
+    for (ColumnId cid : columns) {
         if (_bitmap_index_iterators[cid] == nullptr) {
             RETURN_IF_ERROR(_segment->new_bitmap_index_iterator(cid, &_bitmap_index_iterators[cid]));
             _has_bitmap_index |= (_bitmap_index_iterators[cid] != nullptr);
@@ -1266,6 +1290,203 @@ Status SegmentIterator::_apply_bitmap_index() {
     return Status::OK();
 }
 
+// The plan to evaluate a PredicateTree by bitmap indexes, which has the same shape as the tree.
+// The children that can't be evaluated by bitmap indexes are dropped from the AND nodes, so the
+// result may be a superset of the rows selected by the tree, which is fine since the tree is not
+// used to filter the rows. An OR node with such a child can't be evaluated at all.
+struct BitmapIndexPlan {
+    PredicateTree::Type type = PredicateTree::Type::kLeaf;
+    // for leaf: the bitmaps of the ordinals in |range| are unioned.
+    BitmapIndexIterator* iter = nullptr;
+    SparseRange range;
+    // the estimated ratio of the rows selected, assuming the values are evenly distributed.
+    double selectivity = 1.0;
+    // the estimated ratio of the rows in the bitmaps to read, i.e, the cost of the plan.
+    double read_ratio = 0.0;
+    // for AND node: ordered by the selectivity, so that the most selective children are read first.
+    std::vector<BitmapIndexPlan> children;
+};
+
+static Status build_bitmap_index_plan(const PredicateTree& tree, const std::vector<BitmapIndexIterator*>& iters,
+                                      BitmapIndexPlan* plan, bool* ok) {
+    plan->type = tree.type();
+    *ok = false;
+    if (tree.type() == PredicateTree::Type::kLeaf) {
+        const ColumnPredicate* pred = tree.predicate();
+        ColumnId cid = pred->column_id();
+        plan->iter = cid < iters.size() ? iters[cid] : nullptr;
+        if (plan->iter == nullptr || plan->iter->bitmap_nums() == 0) {
+            return Status::OK();
+        }
+        Status st = pred->seek_bitmap_dictionary(plan->iter, &plan->range);
+        if (!st.ok()) {
+            return st.is_cancelled() ? Status::OK() : st;
+        }
+        plan->selectivity = static_cast<double>(plan->range.span_size()) / plan->iter->bitmap_nums();
+        plan->read_ratio = plan->selectivity;
+        *ok = true;
+        return Status::OK();
+    }
+
+    bool is_and = tree.type() == PredicateTree::Type::kAnd;
+    double unselected = 1.0;
+    for (const PredicateTree& child : tree.children()) {
+        BitmapIndexPlan child_plan;
+        bool child_ok = false;
+        RETURN_IF_ERROR(build_bitmap_index_plan(child, iters, &child_plan, &child_ok));
+        if (!child_ok) {
+            if (is_and) {
+                continue;
+            }
+            return Status::OK();
+        }
+        plan->read_ratio += child_plan.read_ratio;
+        if (is_and) {
+            plan->selectivity *= child_plan.selectivity;
+        } else {
+            unselected *= 1.0 - child_plan.selectivity;
+        }
+        plan->children.emplace_back(std::move(child_plan));
+    }
+    if (plan->children.empty()) {
+        return Status::OK();
+    }
+    if (is_and) {
+        std::sort(plan->children.begin(), plan->children.end(),
+                  [](const BitmapIndexPlan& a, const BitmapIndexPlan& b) { return a.selectivity < b.selectivity; });
+    } else {
+        plan->selectivity = 1.0 - unselected;
+    }
+    *ok = true;
+    return Status::OK();
+}
+
+static Status evaluate_bitmap_index_plan(const BitmapIndexPlan& plan, Roaring* rows) {
+    switch (plan.type) {
+    case PredicateTree::Type::kLeaf:
+        return plan.iter->read_union_bitmap(plan.range, rows);
+    case PredicateTree::Type::kAnd:
+        RETURN_IF_ERROR(evaluate_bitmap_index_plan(plan.children[0], rows));
+        for (size_t i = 1; i < plan.children.size() && !rows->isEmpty(); i++) {
+            Roaring child_rows;
+            RETURN_IF_ERROR(evaluate_bitmap_index_plan(plan.children[i], &child_rows));
+            *rows &= child_rows;
+        }
+        return Status::OK();
+    case PredicateTree::Type::kOr:
+        for (const BitmapIndexPlan& child : plan.children) {
+            Roaring child_rows;
+            RETURN_IF_ERROR(evaluate_bitmap_index_plan(child, &child_rows));
+            *rows |= child_rows;
+        }
+        return Status::OK();
+    }
+    return Status::OK();
+}
+
+// narrow the scan range by evaluating the AND/OR predicate trees as unions and intersections of the bitmaps.
+// A tree is evaluated only if it's as selective as required by `bitmap_max_filter_ratio` and the bitmaps to
+// read are fewer than the rows filtered out, otherwise decoding the pages is cheaper than reading the bitmaps.
+// Unlike `_apply_bitmap_index`, no predicate is erased, since the trees are never evaluated on the rows.
+Status SegmentIterator::_apply_bitmap_index_trees() {
+    RETURN_IF(!_has_bitmap_index || !config::bitmap_filter_enable_or, Status::OK());
+    RETURN_IF(_opts.predicate_trees.empty() || _scan_range.empty(), Status::OK());
+    SCOPED_RAW_TIMER(&_opts.stats->bitmap_index_filter_timer);
+
+    std::vector<BitmapIndexPlan> plans;
+    for (const PredicateTree& tree : _opts.predicate_trees) {
+        BitmapIndexPlan plan;
+        bool ok = false;
+        RETURN_IF_ERROR(build_bitmap_index_plan(tree, _bitmap_index_iterators, &plan, &ok));
+        if (!ok || plan.selectivity * 1000 > config::bitmap_max_filter_ratio ||
+            plan.read_ratio >= 1.0 - plan.selectivity) {
+            continue;
+        }
+        plans.emplace_back(std::move(plan));
+    }
+    RETURN_IF(plans.empty(), Status::OK());
+    std::sort(plans.begin(), plans.end(),
+              [](const BitmapIndexPlan& a, const BitmapIndexPlan& b) { return a.selectivity < b.selectivity; });
+
+    Roaring row_bitmap = range2roaring(_scan_range);
+    size_t input_rows = row_bitmap.cardinality();
+    DCHECK_EQ(input_rows, _scan_range.span_size());
+    for (const BitmapIndexPlan& plan : plans) {
+        Roaring rows;
+        RETURN_IF_ERROR(evaluate_bitmap_index_plan(plan, &rows));
+        row_bitmap &= rows;
+        if (row_bitmap.isEmpty()) {
+            break;
+        }
+    }
+
+    DCHECK_LE(row_bitmap.cardinality(), _scan_range.span_size());
+    if (row_bitmap.cardinality() < _scan_range.span_size()) {
+        _scan_range = roaring2range(row_bitmap);
+    }
+    _opts.stats->rows_bitmap_index_filtered += (input_rows - _scan_range.span_size());
+    return Status::OK();
+}
+
+Status SegmentIterator::_init_inverted_index_iterators() {
+    DCHECK_EQ(_predicate_columns, _opts.predicates.size());
+    _inverted_index_iterators.resize(ChunkHelper::max_column_id(_schema) + 1, nullptr);
+    for (const auto& pair : _opts.predicates) {
+        ColumnId cid = pair.first;
+        if (_inverted_index_iterators[cid] == nullptr) {
+            RETURN_IF_ERROR(_segment->new_inverted_index_iterator(cid, &_inverted_index_iterators[cid]));
+            _has_inverted_index |= (_inverted_index_iterators[cid] != nullptr);
+        }
+    }
+    return Status::OK();
+}
+
+// filter rows by evaluating the MATCH_ANY/MATCH_ALL predicates using the full-text inverted indexes.
+// Unlike the bitmap index, the posting lists are always applied regardless of the selectivity, since
+// the predicates are expensive to evaluate on the column values.
+// upon return, predicates that have been evaluated by inverted indexes will be removed.
+Status SegmentIterator::_apply_inverted_index() {
+    RETURN_IF(!_has_inverted_index || _scan_range.empty(), Status::OK());
+    SCOPED_RAW_TIMER(&_opts.stats->inverted_index_filter_timer);
+
+    Roaring row_bitmap = range2roaring(_scan_range);
+    size_t input_rows = row_bitmap.cardinality();
+    DCHECK_EQ(input_rows, _scan_range.span_size());
+
+    std::vector<const ColumnPredicate*> erased_preds;
+    for (auto& [cid, pred_list] : _opts.predicates) {
+        BitmapIndexIterator* inverted_iter = _inverted_index_iterators[cid];
+        if (inverted_iter == nullptr) {
+            continue;
+        }
+        for (const ColumnPredicate* pred : pred_list) {
+            Roaring rows;
+            Status st = pred->seek_inverted_index(inverted_iter, &rows);
+            if (st.ok()) {
+                row_bitmap &= rows;
+                erased_preds.emplace_back(pred);
+            } else if (!st.is_cancelled()) {
+                return st;
+            }
+        }
+    }
+    if (erased_preds.empty()) {
+        return Status::OK();
+    }
+
+    DCHECK_LE(row_bitmap.cardinality(), _scan_range.span_size());
+    if (row_bitmap.cardinality() < _scan_range.span_size()) {
+        _scan_range = roaring2range(row_bitmap);
+    }
+    for (const ColumnPredicate* pred : erased_preds) {
+        PredicateList& pred_list = _opts.predicates[pred->column_id()];
+        pred_list.erase(std::find(pred_list.begin(), pred_list.end(), pred));
+    }
+
+    _opts.stats->rows_inverted_index_filtered += (input_rows - _scan_range.span_size());
+    return Status::OK();
+}
+
 Status SegmentIterator::_apply_del_vector() {
     if (_opts.is_primary_keys && _opts.version > 0 && _del_vec && !_del_vec->empty()) {
         Roaring row_bitmap = range2roaring(_scan_range);
@@ -1289,6 +1510,20 @@ Status SegmentIterator::_get_row_ranges_by_bloom_filter() {
     return Status::OK();
 }
 
+// prune the value blocks inside data pages, e.g. frames of frame-of-reference coding, whose
+// bounds do not match the predicates. It's done after all the index based filters, so only the
+// data pages still to be scanned are read.
+Status SegmentIterator::_get_row_ranges_by_block_bounds() {
+    RETURN_IF(_opts.predicates.empty() || _scan_range.empty(), Status::OK());
+    size_t prev_size = _scan_range.span_size();
+    for (const auto& [cid, preds] : _opts.predicates) {
+        ColumnIterator* column_iter = _column_iterators[cid];
+        RETURN_IF_ERROR(column_iter->get_row_ranges_by_block_bounds(preds, &_scan_range));
+    }
+    _opts.stats->rows_stats_filtered += prev_size - _scan_range.span_size();
+    return Status::OK();
+}
+
 void SegmentIterator::close() {
     _context_list[0].close();
     _context_list[1].close();
@@ -1302,6 +1537,9 @@ void SegmentIterator::close() {
     for (auto* iter : _bitmap_index_iterators) {
         delete iter;
     }
+    for (auto* iter : _inverted_index_iterators) {
+        delete iter;
+    }
 }
 
 // put the field that has predicate on it ahead of those without one, for handle late
@@ -24,6 +24,13 @@ Status SegmentReadOptions::convert_to(SegmentReadOptions* dst, const std::vector
         dst->predicates.emplace(pair.first, std::move(new_preds));
     }
 
+    // predicate trees
+    int num_trees = predicate_trees.size();
+    dst->predicate_trees.resize(num_trees);
+    for (int i = 0; i < num_trees; ++i) {
+        RETURN_IF_ERROR(predicate_trees[i].convert_to(&dst->predicate_trees[i], new_types, obj_pool));
+    }
+
     // delete predicates
     RETURN_IF_ERROR(delete_predicates.convert_to(&dst->delete_predicates, new_types, obj_pool));
 
@@ -58,6 +65,13 @@ std::string SegmentReadOptions::debug_string() const {
         }
         ss << "]}";
     }
+    ss << "],predicate_trees=[";
+    for (int j = 0; j < predicate_trees.size(); ++j) {
+        if (j != 0) {
+            ss << ",";
+        }
+        ss << predicate_trees[j].debug_string();
+    }
     ss << "],delete_predicates={";
     ss << "},tablet_schema={";
     ss << "},use_page_cache=" << use_page_cache;
@@ -9,6 +9,7 @@
 #include "runtime/global_dicts.h"
 #include "storage/fs/fs_util.h"
 #include "storage/vectorized/disjunctive_predicates.h"
+#include "storage/vectorized/predicate_tree.h"
 #include "storage/vectorized/seek_range.h"
 
 namespace starrocks {
@@ -33,6 +34,9 @@ public:
 
     std::unordered_map<ColumnId, PredicateList> predicates;
 
+    // Only used to narrow the scan range by bitmap indexes, see PredicateTree.
+    std::vector<PredicateTree> predicate_trees;
+
     DisjunctivePredicates delete_predicates;
 
     // used for updatable tablet to get delvec
@@ -6,6 +6,8 @@
 #include "storage/rowset/beta_rowset.h"
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/vectorized/rowset_options.h"
+#include "storage/storage_engine.h"
+#include "storage/update_manager.h"
 #include "storage/vectorized/chunk_helper.h"
 
 namespace starrocks {
@@ -67,15 +69,15 @@ Status RowsetUpdateState::_do_load(Rowset* rowset) {
     auto& itrs = res.value();
     CHECK(itrs.size() == rowset->num_segments()) << "itrs.size != num_segments";
     _upserts.resize(rowset->num_segments());
-    // only hold pkey, so can use larger chunk size
-    auto chunk_shared_ptr = ChunkHelper::new_chunk(pkey_schema, 4096);
-    auto chunk = chunk_shared_ptr.get();
-    for (size_t i = 0; i < itrs.size(); i++) {
+    // the segments are loaded in parallel, each into its own column
+    auto load_segment = [&](size_t i) -> Status {
         auto itr = itrs[i].get();
         if (itr == nullptr) {
-            continue;
+            return Status::OK();
         }
-        auto& dest = _upserts[i];
+        // only hold pkey, so can use larger chunk size
+        auto chunk_shared_ptr = ChunkHelper::new_chunk(pkey_schema, 4096);
+        auto chunk = chunk_shared_ptr.get();
         auto col = pk_column->clone();
         auto num_rows = beta_rowset->segments()[i]->num_rows();
         col->reserve(num_rows);
@@ -92,8 +94,10 @@ Status RowsetUpdateState::_do_load(Rowset* rowset) {
         }
         itr->close();
         CHECK(col->size() == num_rows) << "read segment: iter rows != num rows";
-        dest = std::move(col);
-    }
+        _upserts[i] = std::move(col);
+        return Status::OK();
+    };
+    RETURN_IF_ERROR(StorageEngine::instance()->update_manager()->run_in_parallel(itrs.size(), load_segment));
     for (const auto& upsert : upserts()) {
         _memory_usage += upsert != nullptr ? upsert->memory_usage() : 0;
     }
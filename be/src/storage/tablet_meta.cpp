@@ -32,6 +32,7 @@
 #include "storage/tablet_meta_manager.h"
 #include "storage/tablet_schema_map.h"
 #include "storage/tablet_updates.h"
+#include "util/string_parser.hpp"
 #include "util/uid_util.h"
 #include "util/url_coding.h"
 
@@ -60,6 +61,23 @@ static void convert_to_new_version(TColumn* tcolumn) {
     }
 }
 
+// The gram size of a NGRAMBF index, from its property "gram_num".
+static int32_t ngram_bf_gram_size(const TOlapTableIndex& index) {
+    constexpr int32_t kDefaultGramSize = 3;
+    if (index.__isset.properties) {
+        auto iter = index.properties.find("gram_num");
+        if (iter != index.properties.end()) {
+            StringParser::ParseResult result;
+            auto gram_size = StringParser::string_to_int<int32_t>(iter->second.data(), iter->second.size(), &result);
+            if (result == StringParser::PARSE_SUCCESS && gram_size > 0 && gram_size <= UINT8_MAX) {
+                return gram_size;
+            }
+            LOG(WARNING) << "invalid gram_num of index " << index.index_name << ": " << iter->second;
+        }
+    }
+    return kDefaultGramSize;
+}
+
 static FieldAggregationMethod TAggregationType2FieldAggregationMethod(TAggregationType::type agg_type) {
     switch (agg_type) {
     case TAggregationType::NONE:
@@ -312,7 +330,16 @@ TabletMeta::TabletMeta(int64_t table_id, int64_t partition_id, int64_t tablet_id
                     DCHECK_EQ(index.columns.size(), 1);
                     if (boost::iequals(tcolumn.column_name, index.columns[0])) {
                         column->set_has_bitmap_index(true);
-                        break;
+                    }
+                } else if (index.index_type == TIndexType::type::NGRAMBF) {
+                    DCHECK_EQ(index.columns.size(), 1);
+                    if (boost::iequals(tcolumn.column_name, index.columns[0])) {
+                        column->set_ngram_bf_gram_size(ngram_bf_gram_size(index));
+                    }
+                } else if (index.index_type == TIndexType::type::INVERTED) {
+                    DCHECK_EQ(index.columns.size(), 1);
+                    if (boost::iequals(tcolumn.column_name, index.columns[0])) {
+                        column->set_has_inverted_index(true);
                     }
                 }
             }
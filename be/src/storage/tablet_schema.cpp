@@ -258,6 +258,7 @@ TabletColumn::TabletColumn(const TabletColumn& rhs)
           _index_length(rhs._index_length),
           _precision(rhs._precision),
           _scale(rhs._scale),
+          _ngram_bf_gram_size(rhs._ngram_bf_gram_size),
           _flags(rhs._flags) {
     if (rhs._extra_fields != nullptr) {
         _extra_fields = new ExtraFields(*rhs._extra_fields);
@@ -273,6 +274,7 @@ TabletColumn::TabletColumn(TabletColumn&& rhs)
           _index_length(rhs._index_length),
           _precision(rhs._precision),
           _scale(rhs._scale),
+          _ngram_bf_gram_size(rhs._ngram_bf_gram_size),
           _flags(rhs._flags),
           _extra_fields(rhs._extra_fields) {
     rhs._extra_fields = nullptr;
@@ -292,6 +294,7 @@ void TabletColumn::swap(TabletColumn* rhs) {
     swap(_index_length, rhs->_index_length);
     swap(_precision, rhs->_precision);
     swap(_scale, rhs->_scale);
+    swap(_ngram_bf_gram_size, rhs->_ngram_bf_gram_size);
     swap(_flags, rhs->_flags);
     swap(_extra_fields, rhs->_extra_fields);
 }
@@ -319,6 +322,7 @@ void TabletColumn::init_from_pb(const ColumnPB& column) {
     _set_flag(kHasBitmapIndexShift, column.has_bitmap_index());
     _set_flag(kHasPrecisionShift, column.has_precision());
     _set_flag(kHasScaleShift, column.has_frac());
+    _set_flag(kHasInvertedIndexShift, column.has_inverted_index());
 
     _length = column.length();
 
@@ -338,6 +342,10 @@ void TabletColumn::init_from_pb(const ColumnPB& column) {
     if (column.has_aggregation()) {
         _aggregation = get_aggregation_type_by_string(column.aggregation());
     }
+    if (column.has_ngram_bf_gram_size()) {
+        DCHECK_LE(column.ngram_bf_gram_size(), UINT8_MAX);
+        _ngram_bf_gram_size = column.ngram_bf_gram_size();
+    }
     if (column.has_default_value()) {
         ExtraFields* extra = _get_or_alloc_extra_fields();
         extra->has_default_value = true;
@@ -370,6 +378,10 @@ void TabletColumn::to_schema_pb(ColumnPB* column) const {
     column->set_is_bf_column(is_bf_column());
     column->set_aggregation(get_string_by_aggregation_type(_aggregation));
     column->set_has_bitmap_index(has_bitmap_index());
+    if (has_ngram_bf_index()) {
+        column->set_ngram_bf_gram_size(_ngram_bf_gram_size);
+    }
+    column->set_has_inverted_index(has_inverted_index());
     for (int i = 0; i < subcolumn_count(); i++) {
         subcolumn(i).to_schema_pb(column->add_children_columns());
     }
@@ -559,6 +571,7 @@ bool operator==(const TabletColumn& a, const TabletColumn& b) {
     }
     if (a._length != b._length) return false;
     if (a._index_length != b._index_length) return false;
+    if (a._ngram_bf_gram_size != b._ngram_bf_gram_size) return false;
     return true;
 }
 
@@ -592,7 +605,8 @@ std::string TabletColumn::debug_string() const {
        << ",precision=" << (has_precision() ? std::to_string(_precision) : "N/A")
        << ",frac=" << (has_scale() ? std::to_string(_scale) : "N/A") << ",length=" << _length
        << ",index_length=" << _index_length << ",is_bf_column=" << is_bf_column()
-       << ",has_bitmap_index=" << has_bitmap_index() << ")";
+       << ",has_bitmap_index=" << has_bitmap_index() << ",ngram_bf_gram_size=" << (int)_ngram_bf_gram_size
+       << ",has_inverted_index=" << has_inverted_index() << ")";
     return ss.str();
 }
 
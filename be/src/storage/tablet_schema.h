@@ -60,6 +60,7 @@ public:
     using ColumnIndexLength = uint8_t;
     using ColumnPrecision = uint8_t;
     using ColumnScale = uint8_t;
+    using ColumnGramSize = uint8_t;
 
     TabletColumn();
     TabletColumn(FieldAggregationMethod agg, FieldType type);
@@ -100,6 +101,14 @@ public:
     bool has_bitmap_index() const { return _check_flag(kHasBitmapIndexShift); }
     void set_has_bitmap_index(bool value) { _set_flag(kHasBitmapIndexShift, value); }
 
+    // The n-gram bloom filter index is built on the grams of |ngram_bf_gram_size()| chars.
+    bool has_ngram_bf_index() const { return _ngram_bf_gram_size > 0; }
+    ColumnGramSize ngram_bf_gram_size() const { return _ngram_bf_gram_size; }
+    void set_ngram_bf_gram_size(ColumnGramSize gram_size) { _ngram_bf_gram_size = gram_size; }
+
+    bool has_inverted_index() const { return _check_flag(kHasInvertedIndexShift); }
+    void set_has_inverted_index(bool value) { _set_flag(kHasInvertedIndexShift, value); }
+
     ColumnLength length() const { return _length; }
     void set_length(ColumnLength length) { _length = length; }
 
@@ -165,6 +174,7 @@ private:
     constexpr static uint8_t kHasBitmapIndexShift = 3;
     constexpr static uint8_t kHasPrecisionShift = 4;
     constexpr static uint8_t kHasScaleShift = 5;
+    constexpr static uint8_t kHasInvertedIndexShift = 6;
 
     ExtraFields* _get_or_alloc_extra_fields() {
         if (_extra_fields == nullptr) {
@@ -198,6 +208,7 @@ private:
     ColumnIndexLength _index_length = 0;
     ColumnPrecision _precision = 0;
     ColumnScale _scale = 0;
+    ColumnGramSize _ngram_bf_gram_size = 0;
 
     uint8_t _flags = 0;
 
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <ctime>
 #include <memory>
+#include <optional>
 
 #include "common/status.h"
 #include "gen_cpp/MasterService_types.h"
@@ -630,6 +631,8 @@ void TabletUpdates::do_apply() {
     bool first = true;
     while (!_apply_stopped) {
         const EditVersionInfo* version_info_apply = nullptr;
+        // the rowset committed in the version following version_info_apply, if any
+        std::optional<uint32_t> next_rowset_id;
         {
             std::lock_guard rl(_lock);
             if (_apply_version_idx + 1 >= _edit_version_infos.size()) {
@@ -642,8 +645,22 @@ void TabletUpdates::do_apply() {
             }
             // we make sure version_info_apply will never be deleted before apply finished
             version_info_apply = _edit_version_infos[_apply_version_idx + 1].get();
+            if (_apply_version_idx + 2 < _edit_version_infos.size() &&
+                !_edit_version_infos[_apply_version_idx + 2]->deltas.empty()) {
+                next_rowset_id = _edit_version_infos[_apply_version_idx + 2]->deltas[0];
+            }
+        }
+        // the update state of this version may be still preloading
+        if (_preload_latch != nullptr) {
+            _preload_latch->wait();
+            _preload_latch.reset();
         }
         if (version_info_apply->deltas.size() > 0) {
+            if (next_rowset_id.has_value()) {
+                // load the primary keys of the next version while this version is being applied,
+                // the versions are still applied one by one in order.
+                _preload_update_state(*next_rowset_id);
+            }
             int64_t duration_ns = 0;
             {
                 StarRocksMetrics::instance()->update_rowset_commit_apply_total.increment(1);
@@ -671,6 +688,31 @@ void TabletUpdates::do_apply() {
     _apply_stopped_cond.notify_all();
 }
 
+void TabletUpdates::_preload_update_state(uint32_t rowset_id) {
+    auto manager = StorageEngine::instance()->update_manager();
+    RowsetSharedPtr rowset = _get_rowset(rowset_id);
+    if (rowset == nullptr || manager->apply_worker_thread_pool() == nullptr) {
+        return;
+    }
+    auto tablet = std::static_pointer_cast<Tablet>(_tablet.shared_from_this());
+    auto latch = std::make_shared<CountDownLatch>(1);
+    // Run by the worker pool rather than the apply pool, the apply threads wait for it.
+    auto st = manager->apply_worker_thread_pool()->submit_func([tablet, rowset, latch]() {
+        CountDownOnScopeExit<CountDownLatch> count_down(latch.get());
+        auto st = StorageEngine::instance()->update_manager()->preload_update_state(tablet.get(), rowset.get());
+        if (!st.ok()) {
+            // it's loaded again and the error is handled by the apply
+            LOG(WARNING) << "preload update state failed tablet:" << tablet->tablet_id()
+                         << " rowset:" << rowset->rowset_id().to_string() << " " << st;
+        }
+    });
+    if (st.ok()) {
+        _preload_latch = std::move(latch);
+    } else {
+        LOG(WARNING) << "submit preload update state task failed: " << st;
+    }
+}
+
 void TabletUpdates::_stop_and_wait_apply_done() {
     _apply_stopped = true;
     std::unique_lock<std::mutex> ul(_apply_running_lock);
@@ -744,41 +786,56 @@ void TabletUpdates::_apply_rowset_commit(const EditVersionInfo& version_info) {
 
     size_t ndelvec = new_deletes.size();
     vector<std::pair<uint32_t, DelVectorPtr>> new_del_vecs(ndelvec);
+    // the latest delvec of each affected segment, null for the newly added segments
+    vector<DelVectorPtr> old_del_vecs(ndelvec);
+    vector<const vector<segment_rowid_t>*> del_ids(ndelvec);
     size_t idx = 0;
+    for (auto& new_delete : new_deletes) {
+        new_del_vecs[idx].first = new_delete.first;
+        del_ids[idx] = &new_delete.second;
+        idx++;
+    }
+    // the delvecs of different segments are independent, generate them in parallel
+    st = manager->run_in_parallel(ndelvec, [&](size_t i) -> Status {
+        uint32_t rssid = new_del_vecs[i].first;
+        auto& dels = *del_ids[i];
+        if (rssid >= rowset_id && rssid < rowset_id + rowset->num_segments()) {
+            // it's newly added rowset's segment, do not have latest delvec yet
+            new_del_vecs[i].second = std::make_shared<DelVector>();
+            new_del_vecs[i].second->init(version.major(), dels.data(), dels.size());
+            return Status::OK();
+        }
+        TabletSegmentId tsid;
+        tsid.tablet_id = tablet_id;
+        tsid.segment_id = rssid;
+        // TODO(cbl): should get the version before this apply version, to be safe
+        RETURN_IF_ERROR(manager->get_latest_del_vec(_tablet.data_dir()->get_meta(), tsid, &old_del_vecs[i]));
+        old_del_vecs[i]->add_dels_as_new_version(dels, version.major(), &(new_del_vecs[i].second));
+        return Status::OK();
+    });
+    if (!st.ok()) {
+        LOG(ERROR) << "_apply_rowset_commit error: get_latest_del_vec failed: " << st << " " << debug_string();
+        _set_error();
+        return;
+    }
+
     size_t old_total_del = 0;
     size_t new_del = 0;
     size_t total_del = 0;
     string delvec_change_info;
-    for (auto& new_delete : new_deletes) {
-        uint32_t rssid = new_delete.first;
-        if (rssid >= rowset_id && rssid < rowset_id + rowset->num_segments()) {
-            // it's newly added rowset's segment, do not have latest delvec yet
-            new_del_vecs[idx].first = rssid;
-            new_del_vecs[idx].second = std::make_shared<DelVector>();
-            auto& del_ids = new_delete.second;
-            new_del_vecs[idx].second->init(version.major(), del_ids.data(), del_ids.size());
+    for (size_t i = 0; i < ndelvec; i++) {
+        uint32_t rssid = new_del_vecs[i].first;
+        size_t cur_add = del_ids[i]->size();
+        if (old_del_vecs[i] == nullptr) {
             if (VLOG_IS_ON(1)) {
-                StringAppendF(&delvec_change_info, " %u:+%zu", rssid, del_ids.size());
+                StringAppendF(&delvec_change_info, " %u:+%zu", rssid, cur_add);
             }
-            new_del += del_ids.size();
-            total_del += del_ids.size();
+            new_del += cur_add;
+            total_del += cur_add;
         } else {
-            TabletSegmentId tsid;
-            tsid.tablet_id = tablet_id;
-            tsid.segment_id = rssid;
-            DelVectorPtr old_del_vec;
-            // TODO(cbl): should get the version before this apply version, to be safe
-            st = manager->get_latest_del_vec(_tablet.data_dir()->get_meta(), tsid, &old_del_vec);
-            if (!st.ok()) {
-                LOG(ERROR) << "_apply_rowset_commit error: get_latest_del_vec failed: " << st << " " << debug_string();
-                _set_error();
-                return;
-            }
-            new_del_vecs[idx].first = rssid;
-            old_del_vec->add_dels_as_new_version(new_delete.second, version.major(), &(new_del_vecs[idx].second));
+            auto& old_del_vec = old_del_vecs[i];
             size_t cur_old = old_del_vec->cardinality();
-            size_t cur_add = new_delete.second.size();
-            size_t cur_new = new_del_vecs[idx].second->cardinality();
+            size_t cur_new = new_del_vecs[i].second->cardinality();
             if (cur_old + cur_add != cur_new) {
                 // should not happen, data inconsistent
                 LOG(FATAL) << Substitute(
@@ -795,8 +852,6 @@ void TabletUpdates::_apply_rowset_commit(const EditVersionInfo& version_info) {
             total_del += cur_new;
         }
 
-        idx++;
-
         // Update the stats of affected rowsets.
         std::lock_guard lg(_rowset_stats_lock);
         auto iter = _rowset_stats.upper_bound(rssid);
@@ -812,7 +867,7 @@ void TabletUpdates::_apply_rowset_commit(const EditVersionInfo& version_info) {
             DCHECK(false) << msg;
             LOG(ERROR) << msg;
         } else {
-            iter->second->num_dels += new_delete.second.size();
+            iter->second->num_dels += cur_add;
             _calc_compaction_score(iter->second.get());
             DCHECK_LE(iter->second->num_dels, iter->second->num_rows);
         }
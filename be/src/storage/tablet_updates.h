@@ -13,6 +13,7 @@
 #include "storage/olap_common.h"
 #include "storage/rowset/rowset_writer.h"
 #include "util/blocking_queue.hpp"
+#include "util/countdown_latch.h"
 
 namespace starrocks {
 
@@ -219,6 +220,9 @@ private:
 
     void _apply_rowset_commit(const EditVersionInfo& version_info);
 
+    // Load the RowsetUpdateState of the rowset asynchronously, sets |_preload_latch|.
+    void _preload_update_state(uint32_t rowset_id);
+
     void _apply_compaction_commit(const EditVersionInfo& version_info);
 
     RowsetSharedPtr _get_rowset(uint32_t rowset_id);
@@ -301,6 +305,10 @@ private:
     std::atomic<bool> _apply_stopped = false;
     std::condition_variable _apply_stopped_cond;
 
+    // counted down when the RowsetUpdateState of the next version is preloaded, only used by the
+    // apply thread.
+    std::shared_ptr<CountDownLatch> _preload_latch;
+
     BlockingQueue<RowsetSharedPtr> _unused_rowsets;
 
     std::atomic<bool> _compaction_running{false};
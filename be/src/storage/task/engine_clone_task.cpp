@@ -24,11 +24,14 @@
 #include <sys/stat.h>
 
 #include <filesystem>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 
 #include "env/env.h"
 #include "gen_cpp/BackendService.h"
 #include "gen_cpp/Types_constants.h"
+#include "gutil/strings/numbers.h"
 #include "gutil/strings/split.h"
 #include "gutil/strings/stringpiece.h"
 #include "gutil/strings/substitute.h"
@@ -41,6 +44,8 @@
 #include "storage/snapshot_manager.h"
 #include "storage/tablet_updates.h"
 #include "util/defer_op.h"
+#include "util/starrocks_metrics.h"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 
 using std::set;
@@ -266,7 +271,7 @@ Status EngineCloneTask::_clone_copy(DataDir& data_dir, const string& local_data_
                                                        src.http_port, HTTP_REQUEST_PREFIX, token, snapshot_path,
                                                        _clone_req.tablet_id, _clone_req.schema_hash);
 
-        st = _download_files(&data_dir, download_url, local_path);
+        st = _download_files(&data_dir, src.host, download_url, local_path);
         (void)_release_snapshot(src.host, src.be_port, snapshot_path);
         if (!st.ok()) {
             LOG(WARNING) << "Fail to download snapshot from " << download_url << ": " << st.to_string();
@@ -352,8 +357,77 @@ Status EngineCloneTask::_release_snapshot(const std::string& ip, int port, const
     return Status(result.status);
 }
 
-Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& remote_url_prefix,
-                                        const std::string& local_path) {
+// Throughput of the files cloned from a source backend.
+struct CloneSourceMetrics {
+    IntCounter download_bytes{MetricUnit::BYTES};
+    IntCounter download_files{MetricUnit::NOUNIT};
+    IntCounter download_time_ms{MetricUnit::MILLISECONDS};
+};
+
+static CloneSourceMetrics* get_clone_source_metrics(const std::string& host) {
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::unique_ptr<CloneSourceMetrics>> source_metrics;
+
+    std::lock_guard l(mutex);
+    auto& metrics = source_metrics[host];
+    if (metrics == nullptr) {
+        metrics = std::make_unique<CloneSourceMetrics>();
+        auto* registry = StarRocksMetrics::instance()->metrics();
+        auto labels = MetricLabels().add("source", host);
+        registry->register_metric("clone_download_bytes", labels, &metrics->download_bytes);
+        registry->register_metric("clone_download_files", labels, &metrics->download_files);
+        registry->register_metric("clone_download_time_ms", labels, &metrics->download_time_ms);
+    }
+    return metrics.get();
+}
+
+// Download a file of the snapshot, |file_size| is -1 if the remote backend didn't list the file sizes.
+static Status download_file(DataDir* data_dir, const std::string& remote_file_url, const std::string& local_file_path,
+                            int64_t file_size, int64_t max_speed_kbps) {
+    if (file_size < 0) {
+        auto get_file_size_cb = [&remote_file_url, &file_size](HttpClient* client) {
+            RETURN_IF_ERROR(client->init(remote_file_url));
+            client->set_timeout_ms(GET_LENGTH_TIMEOUT * 1000);
+            RETURN_IF_ERROR(client->head());
+            file_size = client->get_content_length();
+            return Status::OK();
+        };
+        RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, get_file_size_cb));
+    }
+    // check disk capacity
+    if (data_dir->reach_capacity_limit(file_size)) {
+        return Status::InternalError("Disk reach capacity limit");
+    }
+
+    uint64_t estimate_timeout = file_size / config::download_low_speed_limit_kbps / 1024;
+    if (estimate_timeout < config::download_low_speed_time) {
+        estimate_timeout = config::download_low_speed_time;
+    }
+
+    LOG(INFO) << "Downloading " << remote_file_url << " to " << local_file_path << ". bytes=" << file_size
+              << " timeout=" << estimate_timeout;
+
+    auto download_cb = [&](HttpClient* client) {
+        RETURN_IF_ERROR(client->init(remote_file_url));
+        client->set_timeout_ms(estimate_timeout * 1000);
+        client->set_max_download_speed_kbps(max_speed_kbps);
+        RETURN_IF_ERROR(client->download(local_file_path));
+
+        // Check file length
+        uint64_t local_file_size = std::filesystem::file_size(local_file_path);
+        if (local_file_size != static_cast<uint64_t>(file_size)) {
+            LOG(WARNING) << "Fail to download " << remote_file_url << ". file_size=" << local_file_size << "/"
+                         << file_size;
+            return Status::InternalError("mismatched file size");
+        }
+        chmod(local_file_path.c_str(), S_IRUSR | S_IWUSR);
+        return Status::OK();
+    };
+    return HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb);
+}
+
+Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& remote_host,
+                                        const std::string& remote_url_prefix, const std::string& local_path) {
     bool bg_worker_stopped = ExecEnv::GetInstance()->storage_engine()->bg_worker_stopped();
     if (bg_worker_stopped) {
         return Status::InternalError("Process is going to quit. The download should be stopped as soon as possible.");
@@ -368,92 +442,120 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
     RETURN_IF_ERROR(FileUtils::remove_all(local_path));
     RETURN_IF_ERROR(FileUtils::create_dir(local_path));
 
-    // Get remote dir file list
+    // Get remote dir file list, with the file sizes if the remote backend supports it,
+    // otherwise the size of each file is got by a HEAD request.
     string file_list_str;
     auto list_files_cb = [&remote_url_prefix, &file_list_str](HttpClient* client) {
-        RETURN_IF_ERROR(client->init(remote_url_prefix));
+        RETURN_IF_ERROR(client->init(remote_url_prefix + "&with_size=true"));
         client->set_timeout_ms(LIST_REMOTE_FILE_TIMEOUT * 1000);
         RETURN_IF_ERROR(client->execute(&file_list_str));
         return Status::OK();
     };
     RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, list_files_cb));
     std::vector<string> file_name_list = strings::Split(file_list_str, "\n", strings::SkipWhitespace());
+    if (file_name_list.empty()) {
+        return Status::InternalError("no file in snapshot");
+    }
+    std::vector<int64_t> file_size_list(file_name_list.size(), -1);
+    int64_t total_listed_size = 0;
+    for (int i = 0; i < file_name_list.size(); ++i) {
+        auto pos = file_name_list[i].find('\t');
+        if (pos == std::string::npos) {
+            continue;
+        }
+        if (!safe_strto64(file_name_list[i].substr(pos + 1), &file_size_list[i])) {
+            return Status::InternalError("invalid file list: " + file_name_list[i]);
+        }
+        file_name_list[i].resize(pos);
+        total_listed_size += file_size_list[i];
+    }
+    if (data_dir->reach_capacity_limit(total_listed_size)) {
+        return Status::InternalError("Disk reach capacity limit");
+    }
 
     // If the header file is not exist, the table could't loaded by olap engine.
     // Avoid of data is not complete, we copy the header file at last.
     // The header file's name is end of .hdr.
     for (int i = 0; i < file_name_list.size() - 1; ++i) {
-        bg_worker_stopped = ExecEnv::GetInstance()->storage_engine()->bg_worker_stopped();
-        if (bg_worker_stopped) {
-            return Status::InternalError(
-                    "Process is going to quit. The download should be stopped as soon as possible.");
-        }
         StringPiece sp(file_name_list[i]);
         if (sp.ends_with(".hdr")) {
             std::swap(file_name_list[i], file_name_list[file_name_list.size() - 1]);
+            std::swap(file_size_list[i], file_size_list[file_size_list.size() - 1]);
             break;
         }
     }
 
-    // Get copy from remote
-    uint64_t total_file_size = 0;
+    // Get copy from remote. The data files are downloaded concurrently, they share the
+    // download speed limit of this task, then the header file is downloaded.
     MonotonicStopWatch watch;
     watch.start();
-    for (auto& file_name : file_name_list) {
-        auto remote_file_url = remote_url_prefix + file_name;
-
-        // get file length
-        uint64_t file_size = 0;
-        auto get_file_size_cb = [&remote_file_url, &file_size](HttpClient* client) {
-            RETURN_IF_ERROR(client->init(remote_file_url));
-            client->set_timeout_ms(GET_LENGTH_TIMEOUT * 1000);
-            RETURN_IF_ERROR(client->head());
-            file_size = client->get_content_length();
-            return Status::OK();
-        };
-        RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, get_file_size_cb));
-        // check disk capacity
-        if (data_dir->reach_capacity_limit(file_size)) {
-            return Status::InternalError("Disk reach capacity limit");
+    size_t num_data_files = file_name_list.size() - 1;
+    int parallel = std::max(1, std::min<int>(config::clone_download_max_parallel, num_data_files));
+    int64_t max_speed_kbps = std::max<int64_t>(1, config::max_download_speed_kbps / parallel);
+
+    std::mutex status_lock;
+    Status download_status;
+    auto download = [&](size_t i) {
+        {
+            std::lock_guard l(status_lock);
+            if (!download_status.ok()) {
+                return;
+            }
         }
-
-        total_file_size += file_size;
-        uint64_t estimate_timeout = file_size / config::download_low_speed_limit_kbps / 1024;
-        if (estimate_timeout < config::download_low_speed_time) {
-            estimate_timeout = config::download_low_speed_time;
+        Status st;
+        if (ExecEnv::GetInstance()->storage_engine()->bg_worker_stopped()) {
+            st = Status::InternalError("Process is going to quit. The download should be stopped as soon as possible.");
+        } else {
+            st = download_file(data_dir, remote_url_prefix + file_name_list[i], local_path + file_name_list[i],
+                               file_size_list[i], max_speed_kbps);
         }
-
-        std::string local_file_path = local_path + file_name;
-
-        LOG(INFO) << "Downloading " << remote_file_url << " to " << local_file_path << ". bytes=" << file_size
-                  << " timeout=" << estimate_timeout;
-
-        auto download_cb = [&remote_file_url, estimate_timeout, &local_file_path, file_size](HttpClient* client) {
-            RETURN_IF_ERROR(client->init(remote_file_url));
-            client->set_timeout_ms(estimate_timeout * 1000);
-            RETURN_IF_ERROR(client->download(local_file_path));
-
-            // Check file length
-            uint64_t local_file_size = std::filesystem::file_size(local_file_path);
-            if (local_file_size != file_size) {
-                LOG(WARNING) << "Fail to download " << remote_file_url << ". file_size=" << local_file_size << "/"
-                             << file_size;
-                return Status::InternalError("mismatched file size");
+        if (!st.ok()) {
+            std::lock_guard l(status_lock);
+            if (download_status.ok()) {
+                download_status = st;
             }
-            chmod(local_file_path.c_str(), S_IRUSR | S_IWUSR);
-            return Status::OK();
-        };
-        RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb));
-    } // Clone files from remote backend
+        }
+    };
+    if (num_data_files > 0) {
+        std::unique_ptr<ThreadPool> download_pool;
+        RETURN_IF_ERROR(ThreadPoolBuilder("clone_download")
+                                .set_min_threads(0)
+                                .set_max_threads(parallel)
+                                .set_max_queue_size(num_data_files)
+                                .build(&download_pool));
+        for (size_t i = 0; i < num_data_files; ++i) {
+            Status st = download_pool->submit_func([&download, i]() { download(i); });
+            if (!st.ok()) {
+                std::lock_guard l(status_lock);
+                if (download_status.ok()) {
+                    download_status = st;
+                }
+                break;
+            }
+        }
+        download_pool->wait();
+    }
+    RETURN_IF_ERROR(download_status);
+    download(num_data_files);
+    RETURN_IF_ERROR(download_status);
 
+    uint64_t total_file_size = 0;
+    for (const auto& file_name : file_name_list) {
+        total_file_size += std::filesystem::file_size(local_path + file_name);
+    }
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
-    total_time_ms = total_time_ms > 0 ? total_time_ms : 0;
+    auto* source_metrics = get_clone_source_metrics(remote_host);
+    source_metrics->download_bytes.increment(total_file_size);
+    source_metrics->download_files.increment(file_name_list.size());
+    source_metrics->download_time_ms.increment(total_time_ms);
+
     double copy_rate = 0.0;
     if (total_time_ms > 0) {
         copy_rate = total_file_size / ((double)total_time_ms) / 1000;
     }
-    LOG(INFO) << "Copied tablet " << _signature << ". bytes=" << total_file_size << " cost=" << total_time_ms << " ms"
-              << " rate=" << copy_rate << " MB/s";
+    LOG(INFO) << "Copied tablet " << _signature << " from " << remote_host << ". files=" << file_name_list.size()
+              << " bytes=" << total_file_size << " cost=" << total_time_ms << " ms"
+              << " rate=" << copy_rate << " MB/s parallel=" << parallel;
     return Status::OK();
 }
 
@@ -58,8 +58,9 @@ private:
 
     void _set_tablet_info(Status status, bool is_new_tablet);
 
-    // Download tablet files from
-    Status _download_files(DataDir* data_dir, const std::string& remote_url_prefix, const std::string& local_path);
+    // Download tablet files from |remote_host|, the data files are downloaded in parallel
+    Status _download_files(DataDir* data_dir, const std::string& remote_host, const std::string& remote_url_prefix,
+                           const std::string& local_path);
 
     Status _make_snapshot(const std::string& ip, int port, TTableId tablet_id, TSchemaHash schema_hash, int timeout_s,
                           const std::vector<Version>* missed_versions, std::string* snapshot_path,
@@ -2,10 +2,15 @@
 
 #include "storage/update_manager.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <limits>
 #include <memory>
+#include <mutex>
 
+#include "common/config.h"
 #include "gutil/endian.h"
+#include "runtime/current_thread.h"
 #include "storage/del_vector.h"
 #include "storage/kv_store.h"
 #include "storage/rowset_update_state.h"
@@ -13,6 +18,7 @@
 #include "storage/tablet_meta_manager.h"
 #include "storage/vectorized/chunk_helper.h"
 #include "util/coding.h"
+#include "util/defer_op.h"
 #include "util/pretty_printer.h"
 #include "util/starrocks_metrics.h"
 #include "util/time.h"
@@ -38,6 +44,9 @@ UpdateManager::~UpdateManager() {
         // should be shutdown.
         _apply_thread_pool->shutdown();
     }
+    if (_apply_worker_thread_pool != nullptr) {
+        _apply_worker_thread_pool->shutdown();
+    }
     clear_cache();
     if (_compaction_state_mem_tracker) {
         _compaction_state_mem_tracker.reset();
@@ -54,8 +63,65 @@ UpdateManager::~UpdateManager() {
 }
 
 Status UpdateManager::init() {
-    auto st = ThreadPoolBuilder("UpdateApplyThreadPool").build(&_apply_thread_pool);
-    return st;
+    RETURN_IF_ERROR(ThreadPoolBuilder("UpdateApplyThreadPool").build(&_apply_thread_pool));
+    return ThreadPoolBuilder("UpdateApplyWorkerPool").build(&_apply_worker_thread_pool);
+}
+
+Status UpdateManager::run_in_parallel(size_t num_tasks, const std::function<Status(size_t)>& task) {
+    if (num_tasks == 0) {
+        return Status::OK();
+    }
+    // The context is shared with the worker threads, which may start after all the tasks are finished.
+    struct Context {
+        std::function<Status(size_t)> task;
+        size_t num_tasks = 0;
+        std::atomic<size_t> next_task{0};
+        std::mutex lock;
+        std::condition_variable finished_cond;
+        size_t num_finished = 0;
+        Status status;
+    };
+    auto ctx = std::make_shared<Context>();
+    ctx->task = task;
+    ctx->num_tasks = num_tasks;
+    // run tasks until all of them are taken, the tasks taken after a failure are skipped.
+    auto worker = [](Context* ctx) {
+        for (size_t i = ctx->next_task++; i < ctx->num_tasks; i = ctx->next_task++) {
+            bool failed = false;
+            {
+                std::lock_guard lg(ctx->lock);
+                failed = !ctx->status.ok();
+            }
+            Status st = failed ? Status::OK() : ctx->task(i);
+            std::lock_guard lg(ctx->lock);
+            if (!st.ok() && ctx->status.ok()) {
+                ctx->status = st;
+            }
+            if (++ctx->num_finished == ctx->num_tasks) {
+                ctx->finished_cond.notify_all();
+            }
+        }
+    };
+
+    size_t parallelism = std::min<size_t>(num_tasks, std::max(config::update_apply_parallelism, 1));
+    MemTracker* mem_tracker = tls_thread_status.mem_tracker();
+    for (size_t i = 1; i < parallelism && _apply_worker_thread_pool != nullptr; i++) {
+        auto st = _apply_worker_thread_pool->submit_func([ctx, worker, mem_tracker]() {
+            MemTracker* prev_tracker = tls_thread_status.set_mem_tracker(mem_tracker);
+            DeferOp op([&] { tls_thread_status.set_mem_tracker(prev_tracker); });
+            worker(ctx.get());
+        });
+        if (!st.ok()) {
+            LOG(WARNING) << "submit apply worker task failed: " << st;
+            break;
+        }
+    }
+    // The calling thread works too and only waits for the tasks being run by others, so the tasks
+    // are finished even if all the threads of the worker pool are busy.
+    worker(ctx.get());
+    std::unique_lock ul(ctx->lock);
+    ctx->finished_cond.wait(ul, [&] { return ctx->num_finished == ctx->num_tasks; });
+    return ctx->status;
 }
 
 Status UpdateManager::get_del_vec_in_meta(KVStore* meta, const TabletSegmentId& tsid, int64_t version,
@@ -211,15 +277,9 @@ Status UpdateManager::set_cached_del_vec(const TabletSegmentId& tsid, const DelV
     return Status::OK();
 }
 
-Status UpdateManager::on_rowset_finished(Tablet* tablet, Rowset* rowset) {
-    string rowset_unique_id = rowset->rowset_id().to_string();
-    VLOG(1) << "UpdateManager::on_rowset_finished start tablet:" << tablet->tablet_id()
-            << " rowset:" << rowset_unique_id;
-    // Prepare apply required resources, load updatestate, primary index into cache,
-    // so apply can run faster. Since those resources are in cache, they can get evicted
-    // before used in apply process, in that case, these will be loaded again in apply
-    // process.
-    auto state_entry = _update_state_cache.get_or_create(Substitute("$0_$1", tablet->tablet_id(), rowset_unique_id));
+Status UpdateManager::preload_update_state(Tablet* tablet, Rowset* rowset) {
+    auto state_entry = _update_state_cache.get_or_create(
+            Substitute("$0_$1", tablet->tablet_id(), rowset->rowset_id().to_string()));
     auto st = state_entry->value().load(tablet->tablet_id(), rowset);
     state_entry->update_expire_time(MonotonicMillis() + _cache_expire_ms);
     _update_state_cache.update_object_size(state_entry, state_entry->value().memory_usage());
@@ -228,6 +288,18 @@ Status UpdateManager::on_rowset_finished(Tablet* tablet, Rowset* rowset) {
     } else {
         _update_state_cache.remove(state_entry);
     }
+    return st;
+}
+
+Status UpdateManager::on_rowset_finished(Tablet* tablet, Rowset* rowset) {
+    string rowset_unique_id = rowset->rowset_id().to_string();
+    VLOG(1) << "UpdateManager::on_rowset_finished start tablet:" << tablet->tablet_id()
+            << " rowset:" << rowset_unique_id;
+    // Prepare apply required resources, load updatestate, primary index into cache,
+    // so apply can run faster. Since those resources are in cache, they can get evicted
+    // before used in apply process, in that case, these will be loaded again in apply
+    // process.
+    auto st = preload_update_state(tablet, rowset);
     if (st.ok()) {
         auto index_entry = _index_cache.get_or_create(tablet->tablet_id());
         st = index_entry->value().load(tablet);
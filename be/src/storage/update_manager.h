@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 #include <unordered_map>
 
@@ -53,8 +54,17 @@ public:
 
     Status on_rowset_finished(Tablet* tablet, Rowset* rowset);
 
+    // Load the RowsetUpdateState of |rowset| into cache ahead of its apply.
+    Status preload_update_state(Tablet* tablet, Rowset* rowset);
+
     ThreadPool* apply_thread_pool() { return _apply_thread_pool.get(); }
 
+    ThreadPool* apply_worker_thread_pool() { return _apply_worker_thread_pool.get(); }
+
+    // Run |task(i)| for each i in [0, num_tasks) by at most config::update_apply_parallelism threads
+    // of the apply worker thread pool, including the calling thread, and return the first error.
+    Status run_in_parallel(size_t num_tasks, const std::function<Status(size_t)>& task);
+
     DynamicCache<uint64_t, PrimaryIndex>& index_cache() { return _index_cache; }
 
     DynamicCache<string, RowsetUpdateState>& update_state_cache() { return _update_state_cache; }
@@ -93,6 +103,8 @@ private:
     std::unique_ptr<MemTracker> _del_vec_cache_mem_tracker;
 
     std::unique_ptr<ThreadPool> _apply_thread_pool;
+    // runs the segment level tasks of the apply threads
+    std::unique_ptr<ThreadPool> _apply_worker_thread_pool;
 
     UpdateManager(const UpdateManager&) = delete;
     const UpdateManager& operator=(const UpdateManager&) = delete;
@@ -11,15 +11,43 @@
 #include "runtime/descriptors.h"
 #include "runtime/primitive_type.h"
 #include "runtime/runtime_state.h"
+#include "storage/rowset/segment_v2/bloom_filter.h"
 #include "storage/vectorized/column_predicate.h"
 namespace starrocks::vectorized {
 
+std::vector<std::string> like_pattern_substrings(const Slice& pattern) {
+    std::vector<std::string> substrings;
+    std::string current;
+    bool is_escaped = false;
+    for (size_t i = 0; i < pattern.size; ++i) {
+        char c = pattern.data[i];
+        if (!is_escaped && (c == '%' || c == '_')) {
+            if (!current.empty()) {
+                substrings.emplace_back(std::move(current));
+                current.clear();
+            }
+        } else if (!is_escaped && c == '\\') {
+            is_escaped = true;
+        } else {
+            current.push_back(c);
+            is_escaped = false;
+        }
+    }
+    if (!current.empty()) {
+        substrings.emplace_back(std::move(current));
+    }
+    return substrings;
+}
+
 ColumnExprPredicate::ColumnExprPredicate(TypeInfoPtr type_info, ColumnId column_id, RuntimeState* state,
                                          ExprContext* expr_ctx, const SlotDescriptor* slot_desc)
         : ColumnPredicate(type_info, column_id), _state(state), _slot_desc(slot_desc), _monotonic(true) {
     // note: conjuncts would be shared by multiple scanners
     // so here we have to clone one to keep thread safe.
     _add_expr_ctx(expr_ctx);
+    if (!_expr_ctxs.empty()) {
+        _init_like_substrings(_expr_ctxs[0]);
+    }
     _is_expr_predicate = true;
 }
 
@@ -39,6 +67,35 @@ void ColumnExprPredicate::_add_expr_ctx(ExprContext* expr_ctx) {
     }
 }
 
+void ColumnExprPredicate::_init_like_substrings(ExprContext* expr_ctx) {
+    Expr* root = expr_ctx->root();
+    if (root->node_type() != TExprNodeType::FUNCTION_CALL || root->fn().name.function_name != "like" ||
+        root->get_num_children() != 2) {
+        return;
+    }
+    Expr* pattern = root->get_child(1);
+    if (root->get_child(0)->node_type() != TExprNodeType::SLOT_REF || !pattern->is_constant()) {
+        return;
+    }
+    // evaluate by the cloned context rather than Expr::evaluate_const, which caches the result in the shared expr.
+    ColumnPtr value = expr_ctx->evaluate(pattern, nullptr);
+    if (value == nullptr || !value->is_constant() || value->only_null()) {
+        return;
+    }
+    _like_substrings = like_pattern_substrings(ColumnHelper::get_const_value<TYPE_VARCHAR>(value));
+}
+
+bool ColumnExprPredicate::ngram_bloom_filter(const segment_v2::BloomFilter* bf, size_t gram_size) const {
+    for (const std::string& s : _like_substrings) {
+        for (size_t pos = 0; pos + gram_size <= s.size(); ++pos) {
+            if (!bf->test_bytes(s.data() + pos, gram_size)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 void ColumnExprPredicate::evaluate(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const {
     // Does not support range evaluatation.
     DCHECK(from == 0);
@@ -162,6 +219,7 @@ Status ColumnExprPredicate::convert_to(const ColumnPredicate** output, const Typ
         pred->_add_expr_ctx(ctx);
     }
     pred->_add_expr_ctx(cast_expr_ctx);
+    pred->_like_substrings = _like_substrings;
     *output = pred;
     return Status::OK();
 }
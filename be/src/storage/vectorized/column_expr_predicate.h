@@ -21,6 +21,10 @@ namespace starrocks::vectorized {
 
 class Column;
 
+// Split a LIKE pattern by the wildcards '%' and '_', with backslash as the escape character.
+// The values matched by the pattern contain all the substrings.
+std::vector<std::string> like_pattern_substrings(const Slice& pattern);
+
 // This class is a bridge to connect ColumnPredicatew which is used in scan/storage layer, and ExprContext which is
 // used in computation layer. By bridging that, we can push more predicates from computation layer onto storage layer,
 // hopefully to scan less data and boost performance.
@@ -45,6 +49,8 @@ public:
 
     bool zone_map_filter(const ZoneMapDetail& detail) const override;
     bool support_bloom_filter() const override { return false; }
+    bool support_ngram_bloom_filter() const override { return !_like_substrings.empty(); }
+    bool ngram_bloom_filter(const segment_v2::BloomFilter* bf, size_t gram_size) const override;
     PredicateType type() const override { return PredicateType::kExpr; }
     bool can_vectorized() const override { return true; }
 
@@ -56,11 +62,16 @@ public:
 
 private:
     void _add_expr_ctx(ExprContext* expr_ctx);
+    // Collect the substrings of the pattern if the expr is `column LIKE 'pattern'`.
+    void _init_like_substrings(ExprContext* expr_ctx);
+
     RuntimeState* _state;
     std::vector<ExprContext*> _expr_ctxs;
     const SlotDescriptor* _slot_desc;
     bool _monotonic;
     mutable std::vector<uint8_t> _tmp_select;
+    // The substrings between the wildcards of a LIKE pattern, which a matched value must contain.
+    std::vector<std::string> _like_substrings;
 };
 
 class ColumnTruePredicate : public ColumnPredicate {
@@ -0,0 +1,156 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include <sstream>
+
+#include "column/binary_column.h"
+#include "column/nullable_column.h"
+#include "gutil/casts.h"
+#include "roaring/roaring.hh"
+#include "storage/rowset/segment_v2/bitmap_index_reader.h"
+#include "storage/vectorized/column_predicate.h"
+#include "util/text_tokenizer.h"
+
+namespace starrocks::vectorized {
+
+// MATCH_ANY/MATCH_ALL of the terms of the queries, see TextMatcher. It's evaluated by the posting lists
+// of the terms if the column has the full-text inverted index, otherwise by tokenizing the column values.
+class ColumnMatchPredicate : public ColumnPredicate {
+public:
+    ColumnMatchPredicate(const TypeInfoPtr& type_info, ColumnId id, const std::vector<std::string>& queries,
+                         bool match_all)
+            : ColumnPredicate(type_info, id), _matcher(queries, match_all) {}
+
+    ~ColumnMatchPredicate() override = default;
+
+    template <typename Op>
+    inline void t_evaluate(const Column* column, uint8_t* sel, uint16_t from, uint16_t to) const {
+        const BinaryColumn* binary_column;
+        if (column->is_nullable()) {
+            binary_column =
+                    down_cast<const BinaryColumn*>(down_cast<const NullableColumn*>(column)->data_column().get());
+        } else {
+            binary_column = down_cast<const BinaryColumn*>(column);
+        }
+        TextMatcher::Context ctx;
+        if (!column->has_null()) {
+            for (size_t i = from; i < to; i++) {
+                sel[i] = Op::apply(sel[i], (uint8_t)_matcher.match(binary_column->get_slice(i), &ctx));
+            }
+        } else {
+            const uint8_t* null_data = down_cast<const NullableColumn*>(column)->immutable_null_column_data().data();
+            for (size_t i = from; i < to; i++) {
+                bool matched = !null_data[i] && _matcher.match(binary_column->get_slice(i), &ctx);
+                sel[i] = Op::apply(sel[i], (uint8_t)matched);
+            }
+        }
+    }
+
+    void evaluate(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const override {
+        t_evaluate<ColumnPredicateAssignOp>(column, selection, from, to);
+    }
+
+    void evaluate_and(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const override {
+        t_evaluate<ColumnPredicateAndOp>(column, selection, from, to);
+    }
+
+    void evaluate_or(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const override {
+        t_evaluate<ColumnPredicateOrOp>(column, selection, from, to);
+    }
+
+    uint16_t evaluate_branchless(const Column* column, uint16_t* sel, uint16_t sel_size) const override {
+        const BinaryColumn* binary_column;
+        if (column->is_nullable()) {
+            binary_column =
+                    down_cast<const BinaryColumn*>(down_cast<const NullableColumn*>(column)->data_column().get());
+        } else {
+            binary_column = down_cast<const BinaryColumn*>(column);
+        }
+        TextMatcher::Context ctx;
+        uint16_t new_size = 0;
+        if (!column->has_null()) {
+            for (uint16_t i = 0; i < sel_size; ++i) {
+                uint16_t data_idx = sel[i];
+                sel[new_size] = data_idx;
+                new_size += _matcher.match(binary_column->get_slice(data_idx), &ctx);
+            }
+        } else {
+            const uint8_t* null_data = down_cast<const NullableColumn*>(column)->immutable_null_column_data().data();
+            for (uint16_t i = 0; i < sel_size; ++i) {
+                uint16_t data_idx = sel[i];
+                sel[new_size] = data_idx;
+                new_size += !null_data[data_idx] && _matcher.match(binary_column->get_slice(data_idx), &ctx);
+            }
+        }
+        return new_size;
+    }
+
+    // The posting lists of the terms are intersected for MATCH_ALL and unioned for MATCH_ANY.
+    // The null rows have no term, so they are never in the result.
+    Status seek_inverted_index(segment_v2::BitmapIndexIterator* iter, Roaring* rows) const override {
+        *rows = Roaring();
+        bool first = true;
+        bool match_all = _matcher.match_all();
+        for (const std::string& term : _matcher.terms()) {
+            Slice value(term);
+            bool exact_match = false;
+            Status st = iter->seek_dictionary(&value, &exact_match);
+            if (!st.ok() && !st.is_not_found()) {
+                return st;
+            }
+            if (!st.ok() || !exact_match) {
+                if (match_all) {
+                    *rows = Roaring();
+                    return Status::OK();
+                }
+                continue;
+            }
+            Roaring posting_list;
+            RETURN_IF_ERROR(iter->read_bitmap(iter->current_ordinal(), &posting_list));
+            if (!match_all) {
+                *rows |= posting_list;
+            } else if (first) {
+                *rows = std::move(posting_list);
+            } else {
+                *rows &= posting_list;
+            }
+            first = false;
+        }
+        return Status::OK();
+    }
+
+    bool can_vectorized() const override { return false; }
+
+    PredicateType type() const override {
+        return _matcher.match_all() ? PredicateType::kMatchAll : PredicateType::kMatchAny;
+    }
+
+    Status convert_to(const ColumnPredicate** output, const TypeInfoPtr& target_type_info,
+                      ObjectPool* obj_pool) const override {
+        // The terms don't depend on the string type.
+        *output = this;
+        return Status::OK();
+    }
+
+    std::string debug_string() const override {
+        std::stringstream ss;
+        ss << (_matcher.match_all() ? "MATCH_ALL" : "MATCH_ANY") << "(column_id=" << _column_id << ", terms=[";
+        const auto& terms = _matcher.terms();
+        for (size_t i = 0; i < terms.size(); i++) {
+            ss << (i > 0 ? ", " : "") << terms[i];
+        }
+        ss << "])";
+        return ss.str();
+    }
+
+private:
+    TextMatcher _matcher;
+};
+
+ColumnPredicate* new_column_match_predicate(const TypeInfoPtr& type_info, ColumnId id,
+                                            const std::vector<std::string>& queries, bool match_all) {
+    auto type = type_info->type();
+    DCHECK(type == OLAP_FIELD_TYPE_CHAR || type == OLAP_FIELD_TYPE_VARCHAR) << "unsupported type " << type;
+    return new ColumnMatchPredicate(type_info, id, queries, match_all);
+}
+
+} // namespace starrocks::vectorized
@@ -52,6 +52,8 @@ enum class PredicateType {
     kExpr = 13,
     kTrue = 14,
     kMap = 15,
+    kMatchAny = 16,
+    kMatchAll = 17,
 };
 
 template <typename T>
@@ -126,10 +128,21 @@ public:
     // Return false to filter out a data page.
     virtual bool bloom_filter(const segment_v2::BloomFilter* bf) const { return true; }
 
+    virtual bool support_ngram_bloom_filter() const { return false; }
+
+    // Return false to filter out a data page, whose n-gram bloom filter |bf| is of the grams of |gram_size| chars.
+    virtual bool ngram_bloom_filter(const segment_v2::BloomFilter* bf, size_t gram_size) const { return true; }
+
     virtual Status seek_bitmap_dictionary(segment_v2::BitmapIndexIterator* iter, SparseRange* range) const {
         return Status::Cancelled("not implemented");
     }
 
+    // Set |rows| to the ids of the rows matching this predicate by the full-text inverted index |iter|.
+    // Return Cancelled if this predicate can't be evaluated by the inverted index.
+    virtual Status seek_inverted_index(segment_v2::BitmapIndexIterator* iter, Roaring* rows) const {
+        return Status::Cancelled("not implemented");
+    }
+
     // Indicate whether or not the evaluate can be vectorized.
     // If this function return true, evaluate function will be vectorized and can achieve
     // good performance.
@@ -300,6 +313,9 @@ ColumnPredicate* new_column_in_predicate(const TypeInfoPtr& type, ColumnId id,
 ColumnPredicate* new_column_not_in_predicate(const TypeInfoPtr& type, ColumnId id,
                                              const std::vector<std::string>& operands);
 ColumnPredicate* new_column_null_predicate(const TypeInfoPtr& type, ColumnId, bool is_null);
+// MATCH_ALL if |match_all| is true, MATCH_ANY otherwise. Only CHAR and VARCHAR are supported.
+ColumnPredicate* new_column_match_predicate(const TypeInfoPtr& type, ColumnId id,
+                                            const std::vector<std::string>& queries, bool match_all);
 
 ColumnPredicate* new_column_dict_conjuct_predicate(const TypeInfoPtr& type_info, ColumnId id,
                                                    std::vector<uint8_t> dict_mapping);
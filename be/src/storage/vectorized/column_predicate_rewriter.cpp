@@ -210,6 +210,26 @@ bool ColumnPredicateRewriter::_rewrite_predicate(ObjectPool* pool, const FieldPt
             } else {
                 preds[i] = pool->add(ptr);
             }
+        } else if (PredicateType::kMatchAny == pred->type() || PredicateType::kMatchAll == pred->type()) {
+            if (!load_seg_dict_vec) {
+                load_seg_dict_vec = true;
+                _get_segment_dict_vec(_column_iterators[cid], &dict_column, &code_column, field->is_nullable());
+            }
+            // tokenize each value of the dictionary once, instead of once per row.
+            std::vector<uint8_t> selection(dict_column->size());
+            pred->evaluate(dict_column.get(), selection.data(), 0, selection.size());
+            const auto& codes = ColumnHelper::cast_to<TYPE_INT>(code_column)->get_data();
+            std::vector<uint8_t> code_mapping(codes.size());
+            for (size_t j = 0; j < codes.size(); j++) {
+                code_mapping[codes[j]] = selection[j];
+            }
+            if (SIMD::count_zero(code_mapping) == code_mapping.size()) {
+                _scan_range = _scan_range.intersection(SparseRange());
+            } else {
+                auto ptr =
+                        new_column_dict_conjuct_predicate(get_type_info(kDictCodeType), cid, std::move(code_mapping));
+                preds[i] = pool->add(ptr);
+            }
         }
     }
 
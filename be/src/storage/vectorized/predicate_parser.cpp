@@ -53,6 +53,10 @@ ColumnPredicate* PredicateParser::parse_thrift_cond(const TCondition& condition)
                (condition.condition_op.size() == 2 && strcasecmp(condition.condition_op.c_str(), "is") == 0)) {
         bool is_null = strcasecmp(condition.condition_values[0].c_str(), "null") == 0;
         pred = new_column_null_predicate(type_info, index, is_null);
+    } else if ((condition.condition_op == "match_any" || condition.condition_op == "match_all") &&
+               (type == OLAP_FIELD_TYPE_CHAR || type == OLAP_FIELD_TYPE_VARCHAR)) {
+        bool match_all = condition.condition_op == "match_all";
+        pred = new_column_match_predicate(type_info, index, condition.condition_values, match_all);
     } else {
         LOG(WARNING) << "unknown condition: " << condition.condition_op;
         return pred;
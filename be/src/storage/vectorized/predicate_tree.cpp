@@ -0,0 +1,40 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "storage/vectorized/predicate_tree.h"
+
+#include <sstream>
+
+namespace starrocks::vectorized {
+
+Status PredicateTree::convert_to(PredicateTree* dst, const std::vector<FieldType>& new_types,
+                                 ObjectPool* obj_pool) const {
+    dst->_type = _type;
+    dst->_pred = nullptr;
+    if (_type == Type::kLeaf) {
+        ColumnId cid = _pred->column_id();
+        return _pred->convert_to(&dst->_pred, get_type_info(new_types[cid]), obj_pool);
+    }
+    dst->_children.resize(_children.size());
+    for (size_t i = 0; i < _children.size(); i++) {
+        RETURN_IF_ERROR(_children[i].convert_to(&dst->_children[i], new_types, obj_pool));
+    }
+    return Status::OK();
+}
+
+std::string PredicateTree::debug_string() const {
+    if (_type == Type::kLeaf) {
+        return _pred->debug_string();
+    }
+    std::stringstream ss;
+    ss << "(";
+    for (size_t i = 0; i < _children.size(); i++) {
+        if (i != 0) {
+            ss << (_type == Type::kAnd ? " AND " : " OR ");
+        }
+        ss << _children[i].debug_string();
+    }
+    ss << ")";
+    return ss.str();
+}
+
+} // namespace starrocks::vectorized
@@ -0,0 +1,56 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "storage/vectorized/column_predicate.h"
+
+namespace starrocks::vectorized {
+
+// PredicateTree represents an AND/OR tree of `ColumnPredicate`s on any columns, e.g,
+// `(c1 = 1 AND c2 > 10) OR c3 IN (1, 2)`.
+//
+// Unlike `ConjunctivePredicates` and `DisjunctivePredicates`, a PredicateTree is never evaluated
+// on the rows. It's only used to narrow the scan range of segments by the bitmap indexes, and the
+// expression it's built from is still evaluated by the scan node.
+class PredicateTree {
+public:
+    enum class Type { kLeaf, kAnd, kOr };
+
+    PredicateTree() = default;
+
+    // Does NOT take the ownership of |pred|.
+    explicit PredicateTree(const ColumnPredicate* pred) : _type(Type::kLeaf), _pred(pred) {}
+
+    PredicateTree(Type type, std::vector<PredicateTree> children) : _type(type), _children(std::move(children)) {}
+
+    Type type() const { return _type; }
+
+    // Only valid for leaf.
+    const ColumnPredicate* predicate() const { return _pred; }
+
+    const std::vector<PredicateTree>& children() const { return _children; }
+
+    template <typename Set>
+    void get_column_ids(Set* result) const {
+        if (_type == Type::kLeaf) {
+            result->insert(_pred->column_id());
+        }
+        for (const PredicateTree& child : _children) {
+            child.get_column_ids(result);
+        }
+    }
+
+    Status convert_to(PredicateTree* dst, const std::vector<FieldType>& new_types, ObjectPool* obj_pool) const;
+
+    std::string debug_string() const;
+
+private:
+    Type _type = Type::kLeaf;
+    const ColumnPredicate* _pred = nullptr;
+    std::vector<PredicateTree> _children;
+};
+
+} // namespace starrocks::vectorized
@@ -26,6 +26,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "runtime/current_thread.h"
@@ -40,6 +41,7 @@
 #include "storage/vectorized/chunk_aggregator.h"
 #include "storage/vectorized/convert_helper.h"
 #include "storage/wrapper_field.h"
+#include "util/threadpool.h"
 #include "util/unaligned_access.h"
 
 namespace starrocks {
@@ -1059,8 +1061,15 @@ Status SchemaChangeHandler::_do_process_alter_tablet_v2_normal(const TAlterTable
     read_params.skip_aggregation = false;
     read_params.chunk_size = config::vector_chunk_size;
 
+    // linked schema change only links the files of the rowsets, e.g. for ADD/DROP COLUMN,
+    // the rowsets needn't be read and the change finishes without rewriting any data.
+    bool need_read = sc_params.sc_sorting || sc_params.sc_directly;
     std::vector<std::unique_ptr<vectorized::TabletReader>> readers;
     for (auto rowset : rowsets_to_change) {
+        if (!need_read) {
+            readers.emplace_back(nullptr);
+            continue;
+        }
         vectorized::TabletReader* tablet_reader = new TabletReader(base_tablet, rowset->version(), base_schema);
         tablet_reader->set_delete_predicates_version(delete_predicates_version);
         RETURN_IF_ERROR(tablet_reader->prepare());
@@ -1129,92 +1138,80 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
         sc_params.new_tablet->save_meta();
     });
 
-    std::unique_ptr<SchemaChange> sc_procedure;
+    // The rowsets are converted independently, those which have to be rewritten are converted in
+    // parallel, and share the memory limitation of this schema change.
+    int parallel = 1;
+    if (sc_params.sc_sorting || sc_params.sc_directly) {
+        parallel = std::min<int>(config::schema_change_rowset_parallelism, sc_params.rowset_readers.size());
+        parallel = std::max(1, parallel);
+    }
+    size_t memory_limitation =
+            static_cast<size_t>(config::memory_limitation_per_thread_for_schema_change) * 1024 * 1024 * 1024 / parallel;
+
     auto chunk_changer = sc_params.chunk_changer.get();
+    auto create_sc_procedure = [&]() -> std::unique_ptr<SchemaChange> {
+        if (sc_params.sc_sorting) {
+            return std::make_unique<SchemaChangeWithSorting>(chunk_changer, memory_limitation);
+        } else if (sc_params.sc_directly) {
+            return std::make_unique<SchemaChangeDirectly>(chunk_changer);
+        } else {
+            return std::make_unique<LinkedSchemaChange>(chunk_changer);
+        }
+    };
     if (sc_params.sc_sorting) {
-        LOG(INFO) << "doing schema change with sorting for base_tablet " << sc_params.base_tablet->full_name();
-        sc_procedure = std::make_unique<SchemaChangeWithSorting>(
-                chunk_changer, config::memory_limitation_per_thread_for_schema_change * 1024 * 1024 * 1024);
+        LOG(INFO) << "doing schema change with sorting for base_tablet " << sc_params.base_tablet->full_name()
+                  << ", parallel=" << parallel;
     } else if (sc_params.sc_directly) {
-        sc_procedure = std::make_unique<SchemaChangeDirectly>(chunk_changer);
+        LOG(INFO) << "doing schema change directly for base_tablet " << sc_params.base_tablet->full_name()
+                  << ", parallel=" << parallel;
     } else {
         LOG(INFO) << "doing linked schema change for base_tablet " << sc_params.base_tablet->full_name();
-        sc_procedure = std::make_unique<LinkedSchemaChange>(chunk_changer);
-    }
-
-    if (sc_procedure.get() == nullptr) {
-        LOG(WARNING) << "failed to malloc SchemaChange. "
-                     << "malloc_size=" << sizeof(SchemaChangeWithSorting);
-        return Status::InternalError("failed to malloc SchemaChange");
     }
 
     Status status;
-
-    for (int i = 0; i < sc_params.rowset_readers.size(); ++i) {
-        LOG(INFO) << "begin to convert a history rowset. version=" << sc_params.rowsets_to_change[i]->version();
-
-        TabletSharedPtr new_tablet = sc_params.new_tablet;
-        TabletSharedPtr base_tablet = sc_params.base_tablet;
-        RowsetWriterContext writer_context(kDataFormatV2, config::storage_format_version);
-        writer_context.rowset_id = StorageEngine::instance()->next_rowset_id();
-        writer_context.tablet_uid = new_tablet->tablet_uid();
-        writer_context.tablet_id = new_tablet->tablet_id();
-        writer_context.partition_id = new_tablet->partition_id();
-        writer_context.tablet_schema_hash = new_tablet->schema_hash();
-        writer_context.rowset_type = sc_params.new_tablet->tablet_meta()->preferred_rowset_type();
-        writer_context.rowset_path_prefix = new_tablet->schema_hash_path();
-        writer_context.tablet_schema = &new_tablet->tablet_schema();
-        writer_context.rowset_state = VISIBLE;
-        writer_context.version = sc_params.rowsets_to_change[i]->version();
-        writer_context.segments_overlap = sc_params.rowsets_to_change[i]->rowset_meta()->segments_overlap();
-
-        if (sc_params.sc_sorting) {
-            writer_context.write_tmp = true;
+    if (parallel == 1) {
+        std::unique_ptr<SchemaChange> sc_procedure = create_sc_procedure();
+        for (int i = 0; i < sc_params.rowset_readers.size() && status.ok(); ++i) {
+            status = _convert_historical_rowset(sc_params, i, sc_procedure.get());
         }
-
-        std::unique_ptr<RowsetWriter> rowset_writer;
-        status = RowsetFactory::create_rowset_writer(writer_context, &rowset_writer);
-        if (!status.ok()) {
-            LOG(INFO) << "build rowset writer failed";
-            return Status::InternalError("build rowset writer failed");
-        }
-
-        if (!sc_procedure->process(sc_params.rowset_readers[i].get(), rowset_writer.get(), new_tablet, base_tablet,
-                                   sc_params.rowsets_to_change[i])) {
-            LOG(WARNING) << "failed to process the version."
-                         << " version=" << sc_params.version.first << "-" << sc_params.version.second;
-            return Status::InternalError("process failed");
-        }
-        // Add the new version of the data to the header,
-        // To prevent deadlocks, be sure to lock the old table first and then the new one
-        sc_params.new_tablet->obtain_push_lock();
-        DeferOp new_tablet_release_lock([&] { sc_params.new_tablet->release_push_lock(); });
-        RowsetSharedPtr new_rowset = rowset_writer->build();
-        if (new_rowset == nullptr) {
-            LOG(WARNING) << "failed to build rowset, exit alter process";
-            break;
-        }
-        LOG(INFO) << "new rowset has " << new_rowset->num_segments() << " segments";
-        status = sc_params.new_tablet->add_rowset(new_rowset, false);
-        if (status.is_already_exist()) {
-            LOG(WARNING) << "version already exist, version revert occured. "
-                         << "tablet=" << sc_params.new_tablet->full_name() << ", version='" << sc_params.version.first
-                         << "-" << sc_params.version.second;
-            StorageEngine::instance()->add_unused_rowset(new_rowset);
-            status = Status::OK();
-        } else if (!status.ok()) {
-            LOG(WARNING) << "failed to register new version. "
-                         << " tablet=" << sc_params.new_tablet->full_name() << ", version=" << sc_params.version.first
-                         << "-" << sc_params.version.second;
-            StorageEngine::instance()->add_unused_rowset(new_rowset);
-            break;
-        } else {
-            VLOG(3) << "register new version. tablet=" << sc_params.new_tablet->full_name()
-                    << ", version=" << sc_params.version.first << "-" << sc_params.version.second;
+    } else {
+        std::unique_ptr<ThreadPool> convert_pool;
+        RETURN_IF_ERROR(ThreadPoolBuilder("schema_change")
+                                .set_min_threads(0)
+                                .set_max_threads(parallel)
+                                .set_max_queue_size(sc_params.rowset_readers.size())
+                                .build(&convert_pool));
+        std::mutex status_lock;
+        MemTracker* mem_tracker = tls_thread_status.mem_tracker();
+        auto convert = [&](int i) {
+            {
+                std::lock_guard l(status_lock);
+                if (!status.ok()) {
+                    return;
+                }
+            }
+            MemTracker* prev_tracker = tls_thread_status.set_mem_tracker(mem_tracker);
+            DeferOp op([&] { tls_thread_status.set_mem_tracker(prev_tracker); });
+            std::unique_ptr<SchemaChange> sc_procedure = create_sc_procedure();
+            Status st = _convert_historical_rowset(sc_params, i, sc_procedure.get());
+            if (!st.ok()) {
+                std::lock_guard l(status_lock);
+                if (status.ok()) {
+                    status = st;
+                }
+            }
+        };
+        for (int i = 0; i < sc_params.rowset_readers.size(); ++i) {
+            Status st = convert_pool->submit_func([&convert, i]() { convert(i); });
+            if (!st.ok()) {
+                std::lock_guard l(status_lock);
+                if (status.ok()) {
+                    status = st;
+                }
+                break;
+            }
         }
-
-        VLOG(10) << "succeed to convert a history version."
-                 << " version=" << sc_params.version.first << "-" << sc_params.version.second;
+        convert_pool->wait();
     }
 
     if (status.ok()) {
@@ -1228,6 +1225,78 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
     return status;
 }
 
+Status SchemaChangeHandler::_convert_historical_rowset(SchemaChangeParams& sc_params, int index,
+                                                       SchemaChange* sc_procedure) {
+    const RowsetSharedPtr& rowset = sc_params.rowsets_to_change[index];
+    LOG(INFO) << "begin to convert a history rowset. version=" << rowset->version();
+
+    TabletSharedPtr new_tablet = sc_params.new_tablet;
+    TabletSharedPtr base_tablet = sc_params.base_tablet;
+    RowsetWriterContext writer_context(kDataFormatV2, config::storage_format_version);
+    writer_context.rowset_id = StorageEngine::instance()->next_rowset_id();
+    writer_context.tablet_uid = new_tablet->tablet_uid();
+    writer_context.tablet_id = new_tablet->tablet_id();
+    writer_context.partition_id = new_tablet->partition_id();
+    writer_context.tablet_schema_hash = new_tablet->schema_hash();
+    writer_context.rowset_type = sc_params.new_tablet->tablet_meta()->preferred_rowset_type();
+    writer_context.rowset_path_prefix = new_tablet->schema_hash_path();
+    writer_context.tablet_schema = &new_tablet->tablet_schema();
+    writer_context.rowset_state = VISIBLE;
+    writer_context.version = rowset->version();
+    writer_context.segments_overlap = rowset->rowset_meta()->segments_overlap();
+
+    if (sc_params.sc_sorting) {
+        writer_context.write_tmp = true;
+    }
+
+    std::unique_ptr<RowsetWriter> rowset_writer;
+    Status status = RowsetFactory::create_rowset_writer(writer_context, &rowset_writer);
+    if (!status.ok()) {
+        LOG(INFO) << "build rowset writer failed";
+        return Status::InternalError("build rowset writer failed");
+    }
+
+    if (!sc_procedure->process(sc_params.rowset_readers[index].get(), rowset_writer.get(), new_tablet, base_tablet,
+                               rowset)) {
+        LOG(WARNING) << "failed to process the version."
+                     << " version=" << rowset->version().first << "-" << rowset->version().second;
+        return Status::InternalError("process failed");
+    }
+    // build the rowset out of the push lock, it may merge the sorted runs, which is as heavy as the
+    // conversion itself and would serialize the rowsets converted in parallel.
+    RowsetSharedPtr new_rowset = rowset_writer->build();
+    if (new_rowset == nullptr) {
+        LOG(WARNING) << "failed to build rowset, exit alter process";
+        return Status::InternalError("build rowset failed");
+    }
+    LOG(INFO) << "new rowset has " << new_rowset->num_segments() << " segments";
+    // Add the new version of the data to the header,
+    // To prevent deadlocks, be sure to lock the old table first and then the new one
+    sc_params.new_tablet->obtain_push_lock();
+    DeferOp new_tablet_release_lock([&] { sc_params.new_tablet->release_push_lock(); });
+    status = sc_params.new_tablet->add_rowset(new_rowset, false);
+    if (status.is_already_exist()) {
+        LOG(WARNING) << "version already exist, version revert occured. "
+                     << "tablet=" << sc_params.new_tablet->full_name() << ", version='" << rowset->version().first
+                     << "-" << rowset->version().second;
+        StorageEngine::instance()->add_unused_rowset(new_rowset);
+        status = Status::OK();
+    } else if (!status.ok()) {
+        LOG(WARNING) << "failed to register new version. "
+                     << " tablet=" << sc_params.new_tablet->full_name() << ", version=" << rowset->version().first
+                     << "-" << rowset->version().second;
+        StorageEngine::instance()->add_unused_rowset(new_rowset);
+        return status;
+    } else {
+        VLOG(3) << "register new version. tablet=" << sc_params.new_tablet->full_name()
+                << ", version=" << rowset->version().first << "-" << rowset->version().second;
+    }
+
+    VLOG(10) << "succeed to convert a history version."
+             << " version=" << rowset->version().first << "-" << rowset->version().second;
+    return status;
+}
+
 Status SchemaChangeHandler::_parse_request(
         const std::shared_ptr<Tablet>& base_tablet, const std::shared_ptr<Tablet>& new_tablet,
         ChunkChanger* chunk_changer, bool* sc_sorting, bool* sc_directly,
@@ -1348,12 +1417,19 @@ Status SchemaChangeHandler::_parse_request(
             } else if (new_column.has_bitmap_index() != ref_column.has_bitmap_index()) {
                 *sc_directly = true;
                 return Status::OK();
+            } else if (new_column.ngram_bf_gram_size() != ref_column.ngram_bf_gram_size()) {
+                *sc_directly = true;
+                return Status::OK();
+            } else if (new_column.has_inverted_index() != ref_column.has_inverted_index()) {
+                *sc_directly = true;
+                return Status::OK();
             }
         }
     }
 
-    if (!base_tablet->delete_predicates().empty()) {
-        // there exists delete condition in header, can't do linked schema change
+    // The delete predicates are kept by the linked rowsets, so ADD/DROP COLUMN can still be done by
+    // linking the rowsets unless a predicate references a dropped or converted column.
+    if (!_delete_predicates_linkable(base_tablet, new_tablet, chunk_changer)) {
         *sc_directly = true;
     }
 
@@ -1365,6 +1441,34 @@ Status SchemaChangeHandler::_parse_request(
     return Status::OK();
 }
 
+bool SchemaChangeHandler::_delete_predicates_linkable(const std::shared_ptr<Tablet>& base_tablet,
+                                                      const std::shared_ptr<Tablet>& new_tablet,
+                                                      ChunkChanger* chunk_changer) {
+    auto column_kept = [&](const std::string& column_name) {
+        int32_t new_index = new_tablet->field_index(column_name);
+        if (new_index < 0) {
+            return false;
+        }
+        const ColumnMapping* column_mapping = chunk_changer->get_mutable_column_mapping(new_index);
+        return column_mapping->ref_column >= 0 && column_mapping->ref_column == base_tablet->field_index(column_name) &&
+               column_mapping->materialized_function.empty();
+    };
+    for (const auto& delete_predicate : base_tablet->delete_predicates()) {
+        for (const auto& sub_predicate : delete_predicate.sub_predicates()) {
+            TCondition condition;
+            if (!DeleteHandler::parse_condition(sub_predicate, &condition) || !column_kept(condition.column_name)) {
+                return false;
+            }
+        }
+        for (const auto& in_predicate : delete_predicate.in_predicates()) {
+            if (!column_kept(in_predicate.column_name())) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 Status SchemaChangeHandler::_init_column_mapping(ColumnMapping* column_mapping, const TabletColumn& column_schema,
                                                  const std::string& value) {
     column_mapping->default_value = WrapperField::create(column_schema);
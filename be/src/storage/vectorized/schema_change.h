@@ -177,11 +177,19 @@ private:
 
     static Status _convert_historical_rowsets(SchemaChangeParams& sc_params);
 
+    // Convert the |index|-th rowset of |sc_params| and add it into the new tablet
+    static Status _convert_historical_rowset(SchemaChangeParams& sc_params, int index, SchemaChange* sc_procedure);
+
     static Status _parse_request(
             const std::shared_ptr<Tablet>& base_tablet, const std::shared_ptr<Tablet>& new_tablet,
             ChunkChanger* chunk_changer, bool* sc_sorting, bool* sc_directly,
             const std::unordered_map<std::string, AlterMaterializedViewParam>& materialized_function_map);
 
+    // Whether the delete predicates of |base_tablet| still apply to its rowsets linked into |new_tablet|,
+    // i.e. all the columns referenced by them are kept by the new schema without any conversion.
+    static bool _delete_predicates_linkable(const std::shared_ptr<Tablet>& base_tablet,
+                                            const std::shared_ptr<Tablet>& new_tablet, ChunkChanger* chunk_changer);
+
     // default_value for new column is needed
     static Status _init_column_mapping(ColumnMapping* column_mapping, const TabletColumn& column_schema,
                                        const std::string& value);
@@ -9,6 +9,7 @@
 #include "runtime/global_dicts.h"
 #include "storage/olap_common.h"
 #include "storage/tuple.h"
+#include "storage/vectorized/predicate_tree.h"
 #include "storage/vectorized/chunk_iterator.h"
 
 namespace starrocks {
@@ -44,6 +45,9 @@ struct TabletReaderParams {
     std::vector<OlapTuple> start_key;
     std::vector<OlapTuple> end_key;
     std::vector<const ColumnPredicate*> predicates;
+    // AND/OR trees of predicates that can't be pushed down as `predicates`, e.g, `c1 = 1 OR c2 = 2`.
+    // They are only used to narrow the scan range by bitmap indexes.
+    std::vector<PredicateTree> predicate_trees;
 
     RuntimeState* runtime_state = nullptr;
 
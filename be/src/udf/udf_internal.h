@@ -25,7 +25,9 @@
 #include <cstdint>
 #include <cstring>
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "udf/udf.h"
@@ -94,6 +96,10 @@ public:
     size_t mem_usage() { return _mem_usage; }
     void add_mem_usage(size_t size) { _mem_usage += size; }
 
+    // The state shared by all the aggregate states of the aggregate function |fn|, e.g. the group-keyed
+    // hash set of multi distinct functions. It's empty at first, and lives as long as this context.
+    std::shared_ptr<void>& shared_agg_state(const void* fn) { return _shared_agg_states[fn]; }
+
     // Allocates a buffer of 'byte_size' with "local" memory management. These
     // allocations are not freed one by one but freed as a pool by FreeLocalAllocations()
     // This is used where the lifetime of the allocation is clear.
@@ -192,6 +198,8 @@ private:
 
     // this is used for count memory usage of aggregate state
     size_t _mem_usage = 0;
+
+    std::unordered_map<const void*, std::shared_ptr<void>> _shared_agg_states;
 };
 
 } // namespace starrocks
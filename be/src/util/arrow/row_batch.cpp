@@ -119,15 +119,9 @@ Status convert_to_arrow_schema(const RowDescriptor& row_desc, std::shared_ptr<ar
     return Status::OK();
 }
 
-Status serialize_record_batch(const arrow::RecordBatch& record_batch, std::string* result) {
-    // create sink memory buffer outputstream with the computed capacity
-    int64_t capacity;
-    arrow::Status a_st = arrow::ipc::GetRecordBatchSize(record_batch, &capacity);
-    if (!a_st.ok()) {
-        std::stringstream msg;
-        msg << "GetRecordBatchSize failure, reason: " << a_st.ToString();
-        return Status::InternalError(msg.str());
-    }
+static Status serialize_record_batches_with_capacity(const arrow::RecordBatch* const* record_batches,
+                                                     size_t num_batches, const std::shared_ptr<arrow::Schema>& schema,
+                                                     int64_t capacity, std::string* result) {
     auto sink_res = arrow::io::BufferOutputStream::Create(capacity, arrow::default_memory_pool());
     if (!sink_res.ok()) {
         std::stringstream msg;
@@ -136,7 +130,7 @@ Status serialize_record_batch(const arrow::RecordBatch& record_batch, std::strin
     }
     std::shared_ptr<arrow::io::BufferOutputStream> sink = sink_res.ValueOrDie();
     // create RecordBatch Writer
-    auto writer_res = arrow::ipc::MakeStreamWriter(sink.get(), record_batch.schema());
+    auto writer_res = arrow::ipc::MakeStreamWriter(sink.get(), schema);
     if (!writer_res.ok()) {
         std::stringstream msg;
         msg << "open RecordBatchStreamWriter failure, reason: " << writer_res.status().ToString();
@@ -144,11 +138,13 @@ Status serialize_record_batch(const arrow::RecordBatch& record_batch, std::strin
     }
     std::shared_ptr<arrow::ipc::RecordBatchWriter> record_batch_writer = writer_res.ValueOrDie();
     // write RecordBatch to memory buffer outputstream
-    a_st = record_batch_writer->WriteRecordBatch(record_batch);
-    if (!a_st.ok()) {
-        std::stringstream msg;
-        msg << "write record batch failure, reason: " << a_st.ToString();
-        return Status::InternalError(msg.str());
+    for (size_t i = 0; i < num_batches; ++i) {
+        arrow::Status a_st = record_batch_writer->WriteRecordBatch(*record_batches[i]);
+        if (!a_st.ok()) {
+            std::stringstream msg;
+            msg << "write record batch failure, reason: " << a_st.ToString();
+            return Status::InternalError(msg.str());
+        }
     }
     record_batch_writer->Close();
     auto finish_res = sink->Finish();
@@ -164,4 +160,41 @@ Status serialize_record_batch(const arrow::RecordBatch& record_batch, std::strin
     return Status::OK();
 }
 
+Status serialize_record_batch(const arrow::RecordBatch& record_batch, std::string* result) {
+    // create sink memory buffer outputstream with the computed capacity
+    int64_t capacity;
+    arrow::Status a_st = arrow::ipc::GetRecordBatchSize(record_batch, &capacity);
+    if (!a_st.ok()) {
+        std::stringstream msg;
+        msg << "GetRecordBatchSize failure, reason: " << a_st.ToString();
+        return Status::InternalError(msg.str());
+    }
+    return serialize_record_batches_with_capacity(&record_batch, 1, record_batch.schema(), capacity, result);
+}
+
+Status serialize_record_batches(const std::vector<std::shared_ptr<arrow::RecordBatch>>& record_batches,
+                                std::string* result) {
+    if (record_batches.empty()) {
+        return Status::InvalidArgument("no record batch to serialize");
+    }
+    int64_t capacity = 0;
+    for (const auto& record_batch : record_batches) {
+        int64_t size;
+        arrow::Status a_st = arrow::ipc::GetRecordBatchSize(*record_batch, &size);
+        if (!a_st.ok()) {
+            std::stringstream msg;
+            msg << "GetRecordBatchSize failure, reason: " << a_st.ToString();
+            return Status::InternalError(msg.str());
+        }
+        capacity += size;
+    }
+    std::vector<const arrow::RecordBatch*> batches;
+    batches.reserve(record_batches.size());
+    for (const auto& record_batch : record_batches) {
+        batches.push_back(record_batch.get());
+    }
+    return serialize_record_batches_with_capacity(batches.data(), batches.size(), record_batches[0]->schema(),
+                                                  capacity, result);
+}
+
 } // namespace starrocks
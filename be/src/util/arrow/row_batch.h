@@ -22,6 +22,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "common/status.h"
 
@@ -31,6 +32,7 @@
 
 namespace arrow {
 
+class DataType;
 class RecordBatch;
 class Schema;
 
@@ -39,10 +41,18 @@ class Schema;
 namespace starrocks {
 
 class RowDescriptor;
+struct TypeDescriptor;
+
+// Convert StarRocks TypeDescriptor to Arrow DataType.
+Status convert_to_arrow_type(const TypeDescriptor& type, std::shared_ptr<arrow::DataType>* result);
 
 // Convert StarRocks RowDescriptor to Arrow Schema.
 Status convert_to_arrow_schema(const RowDescriptor& row_desc, std::shared_ptr<arrow::Schema>* result);
 
 Status serialize_record_batch(const arrow::RecordBatch& record_batch, std::string* result);
 
+// Serialize record batches sharing the same schema into one Arrow IPC stream.
+Status serialize_record_batches(const std::vector<std::shared_ptr<arrow::RecordBatch>>& record_batches,
+                                std::string* result);
+
 } // namespace starrocks
@@ -0,0 +1,258 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "common/compiler_util.h"
+#include "util/string_parser.hpp"
+
+namespace starrocks {
+
+// Parses the strings of a column, stored as bytes and offsets like BinaryColumn, into numbers and dates.
+//
+// The strings in the plain forms, e.g. "-123", "3.14" and "2021-01-02", are validated and converted eight
+// digits at a time in a 64-bit word. If all bytes of the column are ASCII digits, which is checked by SIMD,
+// the per-string validation is skipped. The other strings fall back to StringParser, and the results are
+// always the same as StringParser's.
+class BatchStringParser {
+public:
+    // Whether all the |size| bytes of |data| are ASCII digits.
+    static bool is_all_digits(const uint8_t* data, size_t size) {
+        const uint8_t* end = data + size;
+#ifdef __SSE2__
+        const __m128i zero = _mm_set1_epi8('0');
+        const __m128i nine = _mm_set1_epi8(9);
+        for (; data + 16 <= end; data += 16) {
+            __m128i v = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), zero);
+            // v <= 9 in unsigned
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(v, nine), v)) != 0xFFFF) {
+                return false;
+            }
+        }
+#endif
+        for (; data < end; ++data) {
+            if (static_cast<uint8_t>(*data - '0') > 9) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Parse the |num_rows| strings into |values|, same as StringParser::string_to_int, and set |nulls|[i]
+    // to 1 if the i-th string is not PARSE_SUCCESS.
+    template <typename T>
+    static void parse_ints(const uint8_t* bytes, const uint32_t* offsets, size_t num_rows, T* values,
+                           uint8_t* nulls) {
+        const char* data = reinterpret_cast<const char*>(bytes);
+        constexpr size_t max_digits = _max_safe_digits<T>();
+        if (_all_lengths_in(offsets, num_rows, 1, max_digits) &&
+            is_all_digits(bytes + offsets[0], offsets[num_rows] - offsets[0])) {
+            for (size_t i = 0; i < num_rows; ++i) {
+                values[i] = static_cast<T>(_digits_to_int(data + offsets[i], offsets[i + 1] - offsets[i]));
+                nulls[i] = 0;
+            }
+            return;
+        }
+
+        for (size_t i = 0; i < num_rows; ++i) {
+            const char* s = data + offsets[i];
+            size_t len = offsets[i + 1] - offsets[i];
+            if (try_parse_int(s, len, &values[i])) {
+                nulls[i] = 0;
+            } else {
+                StringParser::ParseResult result;
+                values[i] = StringParser::string_to_int<T>(s, len, &result);
+                nulls[i] = result != StringParser::PARSE_SUCCESS;
+            }
+        }
+    }
+
+    // Parse the |num_rows| strings into |values|, same as StringParser::string_to_float, and set |nulls|[i]
+    // to 1 if the i-th string is not PARSE_SUCCESS or the value is nan or inf.
+    template <typename T>
+    static void parse_floats(const uint8_t* bytes, const uint32_t* offsets, size_t num_rows, T* values,
+                             uint8_t* nulls) {
+        const char* data = reinterpret_cast<const char*>(bytes);
+        for (size_t i = 0; i < num_rows; ++i) {
+            const char* s = data + offsets[i];
+            size_t len = offsets[i + 1] - offsets[i];
+            if (try_parse_float(s, len, &values[i])) {
+                nulls[i] = 0;
+            } else {
+                StringParser::ParseResult result;
+                values[i] = StringParser::string_to_float<T>(s, len, &result);
+                nulls[i] = result != StringParser::PARSE_SUCCESS || std::isnan(values[i]) || std::isinf(values[i]);
+            }
+        }
+    }
+
+    // Parse an integer in the form of [-]digits, which can't overflow T. Return false if |s| is not
+    // in the form, and |*value| is not changed.
+    template <typename T>
+    static bool try_parse_int(const char* s, size_t len, T* value) {
+        bool negative = len > 0 && s[0] == '-';
+        s += negative;
+        len -= negative;
+        if (len == 0 || len > _max_safe_digits<T>()) {
+            return false;
+        }
+        uint64_t v;
+        if (!_parse_digits(s, len, &v)) {
+            return false;
+        }
+        *value = negative ? -static_cast<T>(v) : static_cast<T>(v);
+        return true;
+    }
+
+    // Parse a number in the form of [-]digits[.digits] with at most 17 digits. Return false if |s| is
+    // not in the form, and |*value| is not changed.
+    template <typename T>
+    static bool try_parse_float(const char* s, size_t len, T* value) {
+        static_assert(std::is_floating_point_v<T>);
+        bool negative = len > 0 && s[0] == '-';
+        s += negative;
+        len -= negative;
+        const char* dot = static_cast<const char*>(memchr(s, '.', len));
+        size_t int_len = dot != nullptr ? dot - s : len;
+        size_t frac_len = dot != nullptr ? len - int_len - 1 : 0;
+        // The integer part is exact in double, and StringParser accumulates all the digits.
+        if (int_len == 0 || int_len > 15 || (dot != nullptr && frac_len == 0) || frac_len > 16 ||
+            int_len + frac_len > 17) {
+            return false;
+        }
+        uint64_t int_part;
+        uint64_t frac_part = 0;
+        if (!_parse_digits(s, int_len, &int_part)) {
+            return false;
+        }
+        if (frac_len > 0 && !_parse_digits(dot + 1, frac_len, &frac_part)) {
+            return false;
+        }
+        // The same operations as StringParser::string_to_float_internal.
+        double val = static_cast<double>(int_part);
+        double divide = 1;
+        for (size_t i = 0; i < frac_len; ++i) {
+            divide *= 10;
+        }
+        val += static_cast<int64_t>(frac_part) / divide;
+        *value = static_cast<T>(negative ? -val : val);
+        return true;
+    }
+
+    // Parse a date in the form of YYYY-MM-DD. Return false if |s| is not in the form. The date is not
+    // checked, e.g. the month may be 0 or 13.
+    static bool try_parse_iso_date(const char* s, size_t len, int* year, int* month, int* day) {
+        if (len != 10) {
+            return false;
+        }
+        uint64_t word;
+        memcpy(&word, s, 8);
+        // "YYYY-MM-"
+        constexpr uint64_t dash_mask = 0xFF0000FF00000000ULL;
+        if ((word & dash_mask) != 0x2D00002D00000000ULL) {
+            return false;
+        }
+        // "YYYY0MM0"
+        word = (word & ~dash_mask) | 0x3000003000000000ULL;
+        uint8_t d1 = s[8] - '0';
+        uint8_t d2 = s[9] - '0';
+        if (!_is_eight_digits(word) || d1 > 9 || d2 > 9) {
+            return false;
+        }
+        uint32_t v = _eight_digits_to_int(word);
+        *year = v / 10000;
+        *month = v / 10 % 100;
+        *day = d1 * 10 + d2;
+        return true;
+    }
+
+private:
+    // The max number of digits of a value that can't overflow T.
+    template <typename T>
+    static constexpr size_t _max_safe_digits() {
+        if constexpr (sizeof(T) == 1) {
+            return 2;
+        } else if constexpr (sizeof(T) == 2) {
+            return 4;
+        } else if constexpr (sizeof(T) == 4) {
+            return 9;
+        } else {
+            // two words
+            return 16;
+        }
+    }
+
+    static bool _all_lengths_in(const uint32_t* offsets, size_t num_rows, size_t min_len, size_t max_len) {
+        bool ok = true;
+        for (size_t i = 0; i < num_rows; ++i) {
+            size_t len = offsets[i + 1] - offsets[i];
+            ok &= (len >= min_len) & (len <= max_len);
+        }
+        return ok;
+    }
+
+    // Load the |len| (<= 8) chars of |s| into the high bytes of a word, and fill the low bytes with '0',
+    // so the word is the eight-digit string of the same number if the chars are digits.
+    static uint64_t _load_digits(const char* s, size_t len) {
+        constexpr uint64_t zeros = 0x3030303030303030ULL;
+        if (len == 8) {
+            uint64_t word;
+            memcpy(&word, s, 8);
+            return word;
+        } else if (len == 0) {
+            return zeros;
+        }
+        uint64_t word = 0;
+        memcpy(&word, s, len);
+        return (word << (8 * (8 - len))) | (zeros >> (8 * len));
+    }
+
+    static bool _is_eight_digits(uint64_t word) {
+        return ((word & 0xF0F0F0F0F0F0F0F0ULL) |
+                (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+    }
+
+    static uint32_t _eight_digits_to_int(uint64_t word) {
+        word = ((word & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+        word = ((word & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+        return static_cast<uint32_t>(((word & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32);
+    }
+
+    // Parse at most 16 digits.
+    static bool _parse_digits(const char* s, size_t len, uint64_t* value) {
+        if (len <= 8) {
+            uint64_t word = _load_digits(s, len);
+            if (!_is_eight_digits(word)) {
+                return false;
+            }
+            *value = _eight_digits_to_int(word);
+            return true;
+        }
+        uint64_t high = _load_digits(s, len - 8);
+        uint64_t low = _load_digits(s + len - 8, 8);
+        if (!_is_eight_digits(high) || !_is_eight_digits(low)) {
+            return false;
+        }
+        *value = _eight_digits_to_int(high) * 100000000ULL + _eight_digits_to_int(low);
+        return true;
+    }
+
+    // Convert at most 16 digits, which have been validated.
+    static uint64_t _digits_to_int(const char* s, size_t len) {
+        if (len <= 8) {
+            return _eight_digits_to_int(_load_digits(s, len));
+        }
+        return _eight_digits_to_int(_load_digits(s, len - 8)) * 100000000ULL +
+               _eight_digits_to_int(_load_digits(s + len - 8, 8));
+    }
+};
+
+} // namespace starrocks
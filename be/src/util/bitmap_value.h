@@ -32,7 +32,9 @@
 #include <roaring/roaring.hh>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include "common/config.h"
 #include "common/logging.h"
@@ -88,6 +90,7 @@ class Roaring64MapSetBitForwardIterator;
 // Forked from https://github.com/RoaringBitmap/CRoaring/blob/v0.2.60/cpp/roaring64map.hh
 // What we change includes
 // - added clear() and is32BitsEnough()
+// - FrozenBitmap is a friend to merge containers into roarings directly
 // - a custom serialization format is used inside read()/write()/getSizeInBytes()
 class Roaring64Map {
 public:
@@ -795,6 +798,7 @@ public:
     }
 
     friend class Roaring64MapSetBitForwardIterator;
+    friend class FrozenBitmap;
     typedef Roaring64MapSetBitForwardIterator const_iterator;
 
     /**
@@ -934,6 +938,425 @@ inline Roaring64MapSetBitForwardIterator Roaring64Map::end() const {
     return Roaring64MapSetBitForwardIterator(*this, true);
 }
 
+// A read-only view of a serialized roaring bitmap, i.e. the payload of BITMAP32, BITMAP64,
+// BITMAP32_SERIV2 and BITMAP64_SERIV2, which answers cardinality() and contains() by reading
+// the container headers of the serialized bytes, without building a Roaring64Map.
+//
+// The serialized bytes of a 32-bits roaring bitmap are in either the portable format described by
+// https://github.com/RoaringBitmap/RoaringFormatSpec/ (v1), or the native format of CRoaring (v2),
+// which is a flag byte followed by a sorted uint32 array or the portable format.
+//
+// The container headers are parsed once when the view is built, the containers themselves are
+// read in place. The view doesn't own the bytes, it's valid as long as the bytes it's built from.
+class FrozenBitmap {
+public:
+    // Build the view of the serialized bitmap at the beginning of the |size| bytes of |src|. The bytes
+    // may come from storage or network, so nothing out of them is read, and is_valid() is false if they
+    // don't start with a complete roaring bitmap.
+    FrozenBitmap(const char* src, size_t size) {
+        const auto* p = reinterpret_cast<const uint8_t*>(src);
+        const auto* begin = p;
+        const auto* end = p + size;
+        _data = src;
+        if (size == 0 || !is_roaring(*src)) {
+            return;
+        }
+        bool portable = *p == BitmapTypeCode::BITMAP32 || *p == BitmapTypeCode::BITMAP64;
+        bool is_bitmap32 = *p == BitmapTypeCode::BITMAP32 || *p == BitmapTypeCode::BITMAP32_SERIV2;
+        p++;
+        if (is_bitmap32) {
+            p = _parse_roaring(0, p, end, portable);
+        } else {
+            uint64_t map_size = 0;
+            p = decode_varint64_ptr(p, _remains(p, end, 10) ? p + 10 : end, &map_size);
+            for (uint64_t i = 0; p != nullptr && i < map_size; i++) {
+                if (!_remains(p, end, sizeof(uint32_t))) {
+                    p = nullptr;
+                    break;
+                }
+                uint32_t high = decode_fixed32_le(p);
+                p = _parse_roaring(high, p + sizeof(uint32_t), end, portable);
+            }
+        }
+        if (p == nullptr) {
+            _containers.clear();
+            return;
+        }
+        for (const auto& c : _containers) {
+            _cardinality += c.cardinality;
+        }
+        _size = p - begin;
+        _valid = true;
+    }
+
+    // Whether the serialized bitmap of |type_code| could be viewed by FrozenBitmap.
+    static bool is_roaring(char type_code) {
+        return type_code == BitmapTypeCode::BITMAP32 || type_code == BitmapTypeCode::BITMAP64 ||
+               type_code == BitmapTypeCode::BITMAP32_SERIV2 || type_code == BitmapTypeCode::BITMAP64_SERIV2;
+    }
+
+    bool is_valid() const { return _valid; }
+
+    // The serialized bitmap, including the type code.
+    const char* data() const { return _data; }
+
+    // The number of bytes of the serialized bitmap, including the type code.
+    size_t serialized_size() const { return _size; }
+
+    uint64_t cardinality() const { return _cardinality; }
+
+    bool contains(uint64_t x) const {
+        auto high = static_cast<uint32_t>(x >> 32);
+        auto low = static_cast<uint32_t>(x);
+        auto key = static_cast<uint16_t>(low >> 16);
+        auto iter = std::lower_bound(_containers.begin(), _containers.end(), high,
+                                     [](const Container& c, uint32_t h) { return c.high < h; });
+        if (iter == _containers.end() || iter->high != high) {
+            return false;
+        }
+        if (iter->type == UINT32_ARRAY) {
+            return _array_contains<uint32_t>(iter->data, iter->cardinality, low);
+        }
+        iter = std::lower_bound(iter, _containers.end(), key,
+                                [high](const Container& c, uint16_t k) { return c.high == high && c.key < k; });
+        if (iter == _containers.end() || iter->high != high || iter->key != key) {
+            return false;
+        }
+        auto v = static_cast<uint16_t>(low);
+        switch (iter->type) {
+        case ARRAY:
+            return _array_contains<uint16_t>(iter->data, iter->cardinality, v);
+        case BITSET:
+            return (iter->data[v / 8] >> (v % 8)) & 1;
+        case RUN: {
+            // the runs are sorted by their start values, find the last one starting before v.
+            uint16_t n_runs = decode_fixed16_le(iter->data);
+            const uint8_t* runs = iter->data + sizeof(uint16_t);
+            int lo = 0;
+            int hi = n_runs - 1;
+            while (lo <= hi) {
+                int mid = (lo + hi) / 2;
+                uint16_t start = decode_fixed16_le(runs + mid * 4);
+                if (start > v) {
+                    hi = mid - 1;
+                } else if (v - start <= decode_fixed16_le(runs + mid * 4 + 2)) {
+                    return true;
+                } else {
+                    lo = mid + 1;
+                }
+            }
+            return false;
+        }
+        default:
+            return false;
+        }
+    }
+
+    // Add the values of all the |bitmaps| to |to|.
+    //
+    // The containers of the same 16-bits chunk from all the bitmaps are merged into one before it's
+    // added to |to|, so that every container of the result is allocated and unioned only once,
+    // instead of once for each bitmap as `to |= Roaring64Map::read(bitmap)` does.
+    static void union_many(const std::vector<const FrozenBitmap*>& bitmaps, Roaring64Map* to) {
+        std::vector<const Container*> containers;
+        std::vector<uint64_t> values;
+        for (const FrozenBitmap* bitmap : bitmaps) {
+            for (const auto& c : bitmap->_containers) {
+                if (c.type != UINT32_ARRAY) {
+                    containers.emplace_back(&c);
+                    continue;
+                }
+                for (uint32_t i = 0; i < c.cardinality; i++) {
+                    values.emplace_back(uint64_t(c.high) << 32 | decode_fixed32_le(c.data + i * 4));
+                }
+            }
+        }
+        std::sort(containers.begin(), containers.end(), [](const Container* lhs, const Container* rhs) {
+            return std::make_pair(lhs->high, lhs->key) < std::make_pair(rhs->high, rhs->key);
+        });
+
+        std::string buffer;
+        std::vector<uint64_t> words;
+        std::vector<uint16_t> scratch;
+        size_t i = 0;
+        while (i < containers.size()) {
+            uint32_t high = containers[i]->high;
+            size_t end = i;
+            while (end < containers.size() && containers[end]->high == high) {
+                end++;
+            }
+            _build_portable(containers.data() + i, containers.data() + end, &buffer, &words, &scratch);
+            Roaring roaring = Roaring::read(buffer.data(), true);
+            auto iter = to->roarings.find(high);
+            if (iter == to->roarings.end()) {
+                to->roarings.emplace(high, std::move(roaring));
+            } else {
+                iter->second |= roaring;
+            }
+            i = end;
+        }
+        to->addMany(values.size(), values.data());
+    }
+
+private:
+    // See https://github.com/RoaringBitmap/RoaringFormatSpec/
+    static constexpr uint32_t SERIAL_COOKIE_NO_RUNCONTAINER = 12346;
+    static constexpr uint32_t SERIAL_COOKIE = 12347;
+    static constexpr uint32_t NO_OFFSET_THRESHOLD = 4;
+    static constexpr uint32_t MAX_ARRAY_SIZE = 4096;
+    static constexpr uint32_t BITSET_BYTES = 8192;
+    // The flags of the native format of CRoaring.
+    static constexpr uint8_t SERIALIZATION_ARRAY_UINT32 = 1;
+    static constexpr uint8_t SERIALIZATION_CONTAINER = 2;
+
+    enum ContainerType : uint8_t {
+        ARRAY,
+        BITSET,
+        RUN,
+        // all the values of a 32-bits roaring bitmap in the native format, key is always 0.
+        UINT32_ARRAY,
+    };
+
+    struct Container {
+        // the high 32 bits of the values
+        uint32_t high;
+        // the 16 bits following the high 32 bits of the values
+        uint16_t key;
+        ContainerType type;
+        uint32_t cardinality;
+        const uint8_t* data;
+    };
+
+    template <typename T>
+    static bool _array_contains(const uint8_t* data, uint32_t size, T v) {
+        int lo = 0;
+        int hi = static_cast<int>(size) - 1;
+        while (lo <= hi) {
+            int mid = (lo + hi) / 2;
+            T value;
+            memcpy(&value, data + mid * sizeof(T), sizeof(T));
+            if (value == v) {
+                return true;
+            }
+            if (value < v) {
+                lo = mid + 1;
+            } else {
+                hi = mid - 1;
+            }
+        }
+        return false;
+    }
+
+    static bool _remains(const uint8_t* p, const uint8_t* end, uint64_t n) {
+        return static_cast<uint64_t>(end - p) >= n;
+    }
+
+    // Parse the 32-bits roaring bitmap starting at |p| and return the end of it, or nullptr if the
+    // bitmap is corrupted or doesn't end before |end|.
+    const uint8_t* _parse_roaring(uint32_t high, const uint8_t* p, const uint8_t* end, bool portable) {
+        if (!portable) {
+            if (!_remains(p, end, 1)) {
+                return nullptr;
+            }
+            uint8_t flag = *p++;
+            if (flag == SERIALIZATION_ARRAY_UINT32) {
+                if (!_remains(p, end, sizeof(uint32_t))) {
+                    return nullptr;
+                }
+                uint32_t size = decode_fixed32_le(p);
+                p += sizeof(uint32_t);
+                if (!_remains(p, end, uint64_t(size) * sizeof(uint32_t))) {
+                    return nullptr;
+                }
+                if (size > 0) {
+                    _containers.push_back({high, 0, UINT32_ARRAY, size, p});
+                }
+                return p + size * sizeof(uint32_t);
+            }
+            if (flag != SERIALIZATION_CONTAINER) {
+                return nullptr;
+            }
+        }
+
+        if (!_remains(p, end, sizeof(uint32_t))) {
+            return nullptr;
+        }
+        uint32_t cookie = decode_fixed32_le(p);
+        p += sizeof(uint32_t);
+        uint32_t size = 0;
+        const uint8_t* run_flags = nullptr;
+        if ((cookie & 0xFFFF) == SERIAL_COOKIE) {
+            size = (cookie >> 16) + 1;
+            if (!_remains(p, end, (size + 7) / 8)) {
+                return nullptr;
+            }
+            run_flags = p;
+            p += (size + 7) / 8;
+        } else if (cookie == SERIAL_COOKIE_NO_RUNCONTAINER) {
+            if (!_remains(p, end, sizeof(uint32_t))) {
+                return nullptr;
+            }
+            size = decode_fixed32_le(p);
+            p += sizeof(uint32_t);
+        } else {
+            return nullptr;
+        }
+        // skip the offsets, the containers are read sequentially
+        bool has_offsets = run_flags == nullptr || size >= NO_OFFSET_THRESHOLD;
+        if (!_remains(p, end, uint64_t(size) * (has_offsets ? 8 : 4))) {
+            return nullptr;
+        }
+        const uint8_t* headers = p;
+        p += size * (has_offsets ? 8 : 4);
+        for (uint32_t i = 0; i < size; i++) {
+            Container c{high, decode_fixed16_le(headers + i * 4), ARRAY,
+                        decode_fixed16_le(headers + i * 4 + 2) + 1u, p};
+            uint64_t bytes = 0;
+            if (run_flags != nullptr && ((run_flags[i / 8] >> (i % 8)) & 1)) {
+                c.type = RUN;
+                if (!_remains(p, end, sizeof(uint16_t))) {
+                    return nullptr;
+                }
+                bytes = sizeof(uint16_t) + decode_fixed16_le(p) * 4;
+            } else if (c.cardinality > MAX_ARRAY_SIZE) {
+                c.type = BITSET;
+                bytes = BITSET_BYTES;
+            } else {
+                bytes = c.cardinality * sizeof(uint16_t);
+            }
+            if (!_remains(p, end, bytes)) {
+                return nullptr;
+            }
+            p += bytes;
+            _containers.push_back(c);
+        }
+        return p;
+    }
+
+    // Merge the containers in [begin, end), which have the same high 32 bits and are sorted by key,
+    // and serialize the result to |buffer| in the portable format without run containers.
+    static void _build_portable(const Container* const* begin, const Container* const* end, std::string* buffer,
+                                std::vector<uint64_t>* words, std::vector<uint16_t>* scratch) {
+        // key, cardinality and the offset of the data in |payload| of each result container
+        std::vector<std::tuple<uint16_t, uint32_t, size_t>> results;
+        std::string payload;
+        for (auto iter = begin; iter != end;) {
+            uint16_t key = (*iter)->key;
+            auto group_end = iter;
+            uint32_t total = 0;
+            bool all_arrays = true;
+            while (group_end != end && (*group_end)->key == key) {
+                total += (*group_end)->cardinality;
+                all_arrays &= (*group_end)->type == ARRAY;
+                group_end++;
+            }
+
+            size_t offset = payload.size();
+            uint32_t cardinality = 0;
+            if (group_end - iter == 1 && (*iter)->type != RUN) {
+                // a single array or bitset container is copied as it is
+                cardinality = (*iter)->cardinality;
+                size_t bytes = (*iter)->type == BITSET ? BITSET_BYTES : cardinality * sizeof(uint16_t);
+                payload.append(reinterpret_cast<const char*>((*iter)->data), bytes);
+            } else if (all_arrays && total <= MAX_ARRAY_SIZE) {
+                scratch->clear();
+                for (auto c = iter; c != group_end; c++) {
+                    for (uint32_t i = 0; i < (*c)->cardinality; i++) {
+                        scratch->emplace_back(decode_fixed16_le((*c)->data + i * sizeof(uint16_t)));
+                    }
+                }
+                std::sort(scratch->begin(), scratch->end());
+                scratch->erase(std::unique(scratch->begin(), scratch->end()), scratch->end());
+                cardinality = scratch->size();
+                _append_array(*scratch, &payload);
+            } else {
+                words->assign(BITSET_BYTES / sizeof(uint64_t), 0);
+                for (auto c = iter; c != group_end; c++) {
+                    _or_to_words(**c, words->data());
+                }
+                for (uint64_t word : *words) {
+                    cardinality += __builtin_popcountll(word);
+                }
+                if (cardinality > MAX_ARRAY_SIZE) {
+                    for (uint64_t word : *words) {
+                        payload.append(reinterpret_cast<const char*>(&word), sizeof(word));
+                    }
+                } else {
+                    scratch->clear();
+                    for (size_t w = 0; w < words->size(); w++) {
+                        for (uint64_t word = (*words)[w]; word != 0; word &= word - 1) {
+                            scratch->emplace_back(w * 64 + __builtin_ctzll(word));
+                        }
+                    }
+                    _append_array(*scratch, &payload);
+                }
+            }
+            results.emplace_back(key, cardinality, offset);
+            iter = group_end;
+        }
+
+        size_t header_size = 2 * sizeof(uint32_t) + results.size() * 8;
+        buffer->resize(header_size + payload.size());
+        auto* p = reinterpret_cast<uint8_t*>(buffer->data());
+        encode_fixed32_le(p, SERIAL_COOKIE_NO_RUNCONTAINER);
+        encode_fixed32_le(p + 4, results.size());
+        p += 8;
+        for (const auto& [key, cardinality, offset] : results) {
+            encode_fixed16_le(p, key);
+            encode_fixed16_le(p + 2, cardinality - 1);
+            p += 4;
+        }
+        for (const auto& [key, cardinality, offset] : results) {
+            encode_fixed32_le(p, header_size + offset);
+            p += 4;
+        }
+        memcpy(p, payload.data(), payload.size());
+    }
+
+    static void _append_array(const std::vector<uint16_t>& values, std::string* payload) {
+        for (uint16_t v : values) {
+            uint8_t buf[sizeof(uint16_t)];
+            encode_fixed16_le(buf, v);
+            payload->append(reinterpret_cast<const char*>(buf), sizeof(buf));
+        }
+    }
+
+    static void _or_to_words(const Container& c, uint64_t* words) {
+        switch (c.type) {
+        case ARRAY:
+            for (uint32_t i = 0; i < c.cardinality; i++) {
+                uint16_t v = decode_fixed16_le(c.data + i * sizeof(uint16_t));
+                words[v / 64] |= uint64_t(1) << (v % 64);
+            }
+            break;
+        case BITSET:
+            for (size_t i = 0; i < BITSET_BYTES / sizeof(uint64_t); i++) {
+                words[i] |= decode_fixed64_le(c.data + i * sizeof(uint64_t));
+            }
+            break;
+        case RUN: {
+            uint16_t n_runs = decode_fixed16_le(c.data);
+            for (uint16_t i = 0; i < n_runs; i++) {
+                uint32_t start = decode_fixed16_le(c.data + sizeof(uint16_t) + i * 4);
+                uint32_t last = start + decode_fixed16_le(c.data + sizeof(uint16_t) + i * 4 + 2);
+                for (uint32_t v = start; v <= last; v++) {
+                    words[v / 64] |= uint64_t(1) << (v % 64);
+                }
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    const char* _data = nullptr;
+    std::vector<Container> _containers;
+    uint64_t _cardinality = 0;
+    size_t _size = 0;
+    bool _valid = false;
+};
+
 } // namespace detail
 
 // Represent the in-memory and on-disk structure of StarRocks's BITMAP data type.
@@ -946,6 +1369,8 @@ public:
 
     BitmapValue(const BitmapValue& other)
             : _bitmap(other._bitmap == nullptr ? nullptr : std::make_shared<detail::Roaring64Map>(*other._bitmap)),
+              _frozen(other._frozen),
+              _frozen_owner(other._frozen_owner),
               _set(other._set),
               _sv(other._sv),
               _type(other._type) {}
@@ -954,6 +1379,8 @@ public:
         if (this != &other) {
             this->_bitmap =
                     (other._bitmap == nullptr ? nullptr : std::make_shared<detail::Roaring64Map>(*other._bitmap));
+            this->_frozen = other._frozen;
+            this->_frozen_owner = other._frozen_owner;
             this->_set = other._set;
             this->_sv = other._sv;
             this->_type = other._type;
@@ -962,7 +1389,12 @@ public:
     }
 
     BitmapValue(BitmapValue&& other) noexcept
-            : _bitmap(std::move(other._bitmap)), _set(std::move(other._set)), _sv(other._sv), _type(other._type) {
+            : _bitmap(std::move(other._bitmap)),
+              _frozen(std::move(other._frozen)),
+              _frozen_owner(std::move(other._frozen_owner)),
+              _set(std::move(other._set)),
+              _sv(other._sv),
+              _type(other._type) {
         other._sv = 0;
         other._type = EMPTY;
     }
@@ -970,6 +1402,8 @@ public:
     BitmapValue& operator=(BitmapValue&& other) noexcept {
         if (this != &other) {
             this->_bitmap = std::move(other._bitmap);
+            this->_frozen = std::move(other._frozen);
+            this->_frozen_owner = std::move(other._frozen_owner);
             this->_set = std::move(other._set);
             this->_sv = other._sv;
             this->_type = other._type;
@@ -988,7 +1422,28 @@ public:
         DCHECK(res);
     }
 
-    explicit BitmapValue(const Slice& src) { deserialize(src.data); }
+    // Construct a bitmap from serialized data of |src.size| bytes. A roaring bitmap is kept frozen,
+    // i.e. as its serialized bytes, which are parsed on the first modification, because most of the
+    // bitmaps read from storage or network are only counted, probed or unioned into others.
+    // The bytes are copied, because the page or the request they come from is released before
+    // the column built from them.
+    explicit BitmapValue(const Slice& src) {
+        if (src.size > 0 && detail::FrozenBitmap::is_roaring(*src.data)) {
+            auto bytes = std::make_shared<const std::string>(src.data, src.size);
+            if (_freeze(Slice(*bytes), bytes)) {
+                return;
+            }
+        }
+        deserialize(src.data);
+    }
+
+    // Same as above, but the frozen bitmap views |src| in place, which is kept alive by |owner|.
+    BitmapValue(const Slice& src, std::shared_ptr<const void> owner) {
+        if (src.size > 0 && detail::FrozenBitmap::is_roaring(*src.data) && _freeze(src, std::move(owner))) {
+            return;
+        }
+        deserialize(src.data);
+    }
 
     // Construct a bitmap from given elements.
     explicit BitmapValue(const std::vector<uint64_t>& bits) {
@@ -1023,6 +1478,7 @@ public:
             _type = SET;
             break;
         case BITMAP:
+            _thaw();
             _bitmap->add(value);
             break;
         case SET:
@@ -1051,6 +1507,18 @@ public:
     // EMPTY  -> BITMAP
     // SINGLE -> BITMAP
     BitmapValue& operator|=(const BitmapValue& rhs) {
+        if (rhs._frozen != nullptr) {
+            if (_type == EMPTY) {
+                _frozen = rhs._frozen;
+                _frozen_owner = rhs._frozen_owner;
+                _type = BITMAP;
+            } else {
+                _to_roaring();
+                detail::FrozenBitmap::union_many({rhs._frozen.get()}, _bitmap.get());
+            }
+            return *this;
+        }
+        _thaw();
         switch (rhs._type) {
         case EMPTY:
             return *this;
@@ -1120,6 +1588,10 @@ public:
     // BITMAP -> EMPTY
     // BITMAP -> SINGLE
     BitmapValue& operator&=(const BitmapValue& rhs) {
+        if (rhs._frozen != nullptr) {
+            return *this &= rhs._thawed();
+        }
+        _thaw();
         switch (rhs._type) {
         case EMPTY:
             clear();
@@ -1229,6 +1701,7 @@ public:
             }
             break;
         case BITMAP:
+            _thaw();
             _bitmap->remove(rhs);
             break;
         case SET:
@@ -1238,6 +1711,10 @@ public:
     }
 
     BitmapValue& operator-=(const BitmapValue& rhs) {
+        if (rhs._frozen != nullptr) {
+            return *this -= rhs._thawed();
+        }
+        _thaw();
         switch (rhs._type) {
         case EMPTY:
             break;
@@ -1337,6 +1814,8 @@ public:
     }
 
     BitmapValue& operator^=(BitmapValue& rhs) {
+        _thaw();
+        rhs._thaw();
         switch (rhs._type) {
         case EMPTY:
             break;
@@ -1478,6 +1957,9 @@ public:
         case SINGLE:
             return _sv == x;
         case BITMAP:
+            if (_frozen != nullptr) {
+                return _frozen->contains(x);
+            }
             return _bitmap->contains(x);
         case SET:
             return _set.contains(x);
@@ -1493,6 +1975,9 @@ public:
         case SINGLE:
             return 1;
         case BITMAP:
+            if (_frozen != nullptr) {
+                return _frozen->cardinality();
+            }
             return _bitmap->cardinality();
         case SET:
             return _set.size();
@@ -1516,6 +2001,10 @@ public:
             }
             break;
         case BITMAP:
+            if (_frozen != nullptr) {
+                res = _frozen->serialized_size();
+                break;
+            }
             DCHECK(_bitmap->cardinality() > 1);
             res = _bitmap->getSizeInBytes(config::bitmap_serialize_version);
             break;
@@ -1542,6 +2031,10 @@ public:
             }
             break;
         case BITMAP:
+            if (_frozen != nullptr) {
+                memcpy(dst, _frozen->data(), _frozen->serialized_size());
+                break;
+            }
             _bitmap->write(dst, config::bitmap_serialize_version);
             break;
         case SET:
@@ -1585,6 +2078,8 @@ public:
         case BitmapTypeCode::BITMAP64_SERIV2:
             _type = BITMAP;
             _bitmap = std::make_shared<detail::Roaring64Map>(detail::Roaring64Map::read(src));
+            _frozen = nullptr;
+            _frozen_owner = nullptr;
             break;
         case BitmapTypeCode::SET: {
             _type = SET;
@@ -1610,6 +2105,9 @@ public:
 
     // TODO limit string size to avoid OOM
     std::string to_string() const {
+        if (_frozen != nullptr) {
+            return _thawed().to_string();
+        }
         std::stringstream ss;
         switch (_type) {
         case EMPTY:
@@ -1661,6 +2159,9 @@ public:
 
     // Append values to array
     void to_array(std::vector<int64_t>* array) const {
+        if (_frozen != nullptr) {
+            return _thawed().to_array(array);
+        }
         switch (_type) {
         case EMPTY:
             break;
@@ -1690,8 +2191,9 @@ public:
 
     // When you persist bitmap value to disk, you could call this method.
     // This method should be called before `serialize_size`.
+    // The frozen bitmap is left as it is, which has been compressed when it's persisted.
     void compress() const {
-        if (_type == BITMAP) {
+        if (_type == BITMAP && _frozen == nullptr) {
             _bitmap->runOptimize();
             _bitmap->shrinkToFit();
         }
@@ -1702,15 +2204,95 @@ public:
         if (_bitmap != nullptr) {
             _bitmap->clear();
         }
+        _frozen = nullptr;
+        _frozen_owner = nullptr;
         _set.clear();
         _sv = 0;
     }
 
     std::shared_ptr<detail::Roaring64Map> getBitmap() {
+        _thaw();
         return _bitmap;
     }
 
+    bool is_frozen() const { return _frozen != nullptr; }
+
+    // Compute the union between the current bitmap and all the |values|. The frozen ones are merged
+    // together by FrozenBitmap::union_many, instead of being parsed and unioned one by one.
+    void union_many(const std::vector<const BitmapValue*>& values) {
+        std::vector<const BitmapValue*> frozen_values;
+        for (const BitmapValue* value : values) {
+            if (value->_frozen != nullptr) {
+                frozen_values.emplace_back(value);
+            } else {
+                *this |= *value;
+            }
+        }
+        if (frozen_values.size() == 1) {
+            *this |= *frozen_values[0];
+        } else if (frozen_values.size() > 1) {
+            std::vector<const detail::FrozenBitmap*> frozen_bitmaps;
+            frozen_bitmaps.reserve(frozen_values.size());
+            for (const BitmapValue* value : frozen_values) {
+                frozen_bitmaps.emplace_back(value->_frozen.get());
+            }
+            _to_roaring();
+            detail::FrozenBitmap::union_many(frozen_bitmaps, _bitmap.get());
+        }
+    }
+
 private:
+    // Keep the roaring bitmap serialized at |src| frozen, return false if it's corrupted.
+    bool _freeze(const Slice& src, std::shared_ptr<const void> owner) {
+        auto frozen = std::make_shared<const detail::FrozenBitmap>(src.data, src.size);
+        if (!frozen->is_valid()) {
+            LOG(WARNING) << "invalid serialized roaring bitmap of " << src.size << " bytes, deserialize it directly";
+            return false;
+        }
+        _frozen = std::move(frozen);
+        _frozen_owner = std::move(owner);
+        _type = BITMAP;
+        return true;
+    }
+
+    // Parse the frozen bytes, must be called before _bitmap is modified or iterated.
+    void _thaw() {
+        if (_frozen != nullptr) {
+            _bitmap = std::make_shared<detail::Roaring64Map>(detail::Roaring64Map::read(_frozen->data()));
+            _frozen = nullptr;
+            _frozen_owner = nullptr;
+        }
+    }
+
+    // Return a parsed copy of a frozen bitmap. Readers use it rather than _thaw(), because a const
+    // value may be read by multiple threads at the same time.
+    BitmapValue _thawed() const {
+        BitmapValue value(*this);
+        value._thaw();
+        return value;
+    }
+
+    // Convert the bitmap to a Roaring64Map of the same values.
+    void _to_roaring() {
+        switch (_type) {
+        case EMPTY:
+            _bitmap = std::make_shared<detail::Roaring64Map>();
+            _type = BITMAP;
+            break;
+        case SINGLE:
+            _bitmap = std::make_shared<detail::Roaring64Map>();
+            _bitmap->add(_sv);
+            _type = BITMAP;
+            break;
+        case BITMAP:
+            _thaw();
+            break;
+        case SET:
+            to_bitmap();
+            break;
+        }
+    }
+
     void _convert_to_smaller_type() {
         if (_type == BITMAP) {
             uint64_t c = _bitmap->cardinality();
@@ -1733,6 +2315,10 @@ private:
     };
     // Use shared_ptr, not unique_ptr, because we want to avoid unnecessary copy
     std::shared_ptr<detail::Roaring64Map> _bitmap = nullptr;
+    // The parsed view of a frozen BITMAP, which is immutable and shared by the copies, and the owner
+    // of the bytes it views. At most one of _bitmap and _frozen is used.
+    std::shared_ptr<const detail::FrozenBitmap> _frozen = nullptr;
+    std::shared_ptr<const void> _frozen_owner = nullptr;
     phmap::flat_hash_set<uint64_t> _set;
     uint64_t _sv = 0; // store the single value when _type == SINGLE
     BitmapDataType _type{EMPTY};
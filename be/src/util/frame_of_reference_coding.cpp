@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <type_traits>
 
 #include "util/bit_util.h"
 #include "util/coding.h"
@@ -355,6 +356,29 @@ T ForDecoder<T>::decode_frame_min_value(uint32_t frame_index) {
     return min;
 }
 
+template <typename T>
+bool ForDecoder<T>::frame_bounds(uint32_t frame_index, T* min, T* max) {
+    DCHECK_LT(frame_index, _frame_count);
+    uint8_t storage_format = _storage_formats[frame_index];
+    uint8_t bit_width = _bit_widths[frame_index];
+    if constexpr (std::is_same_v<T, uint24_t>) {
+        return false;
+    } else {
+        if (storage_format == 2 || bit_width >= 64) {
+            return false;
+        }
+        // every delta is less than 2^bit_width. for frame in ascending order, the deltas
+        // are accumulated from the first value, which is also the min value.
+        uint128_t max_delta = bit_width == 0 ? 0 : (static_cast<uint64_t>(-1) >> (64 - bit_width));
+        uint128_t span = storage_format == 1 ? max_delta * (frame_size(frame_index) - 1) : max_delta;
+        *min = decode_frame_min_value(frame_index);
+        if (__builtin_add_overflow(*min, span, max)) {
+            *max = std::numeric_limits<T>::max();
+        }
+        return true;
+    }
+}
+
 template <typename T>
 T* ForDecoder<T>::copy_value(T* val, size_t count) {
     memcpy(val, &_out_buffer[_current_index % _max_frame_size], sizeof(T) * count);
@@ -151,6 +151,15 @@ public:
 
     uint32_t count() const { return _values_num; }
 
+    uint32_t frame_count() const { return _frame_count; }
+
+    uint32_t max_frame_size() const { return _max_frame_size; }
+
+    // Get the bounds of the values in the frame from its reference value and bit width,
+    // without unpacking the values.
+    // Return false if the bounds can not be known this way, e.g. the frame keeps the original values.
+    bool frame_bounds(uint32_t frame_index, T* min, T* max);
+
 private:
     void bit_unpack(const uint8_t* input, uint8_t in_num, int bit_width, T* output);
 
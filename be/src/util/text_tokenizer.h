@@ -0,0 +1,124 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "util/slice.h"
+
+namespace starrocks {
+
+// Splits a text into the terms of the full-text inverted index.
+//
+// A term is a maximal run of ASCII letters, ASCII digits and non-ASCII bytes, with the ASCII letters
+// lowercased, e.g. "GET /api/v1/Users?id=42" is split into ["get", "api", "v1", "users", "id", "42"].
+// The bytes of multi-byte UTF-8 chars are kept as they are. Terms are truncated to kMaxTermLength bytes.
+//
+// The index writer and the MATCH_ANY/MATCH_ALL predicates must split the texts in the same way,
+// so changing the rules here makes the existing indexes return wrong results.
+class TextTokenizer {
+public:
+    static constexpr size_t kMaxTermLength = 255;
+
+    // Call |fn(const Slice& term)| on each term of |text| in order, duplicates included.
+    // |buf| holds the lowercased term, so the term is only valid during the call.
+    template <typename Fn>
+    static void for_each_term(const Slice& text, std::string* buf, Fn&& fn) {
+        const auto* p = reinterpret_cast<const uint8_t*>(text.data);
+        const auto* end = p + text.size;
+        while (p < end) {
+            while (p < end && !_is_term_char(*p)) {
+                ++p;
+            }
+            if (p == end) {
+                break;
+            }
+            buf->clear();
+            for (; p < end && _is_term_char(*p); ++p) {
+                if (buf->size() < kMaxTermLength) {
+                    buf->push_back(_to_lower(*p));
+                }
+            }
+            fn(Slice(*buf));
+        }
+    }
+
+    // The distinct terms of |text| in ascending order.
+    static std::vector<std::string> terms(const Slice& text) {
+        std::vector<std::string> res;
+        std::string buf;
+        for_each_term(text, &buf, [&](const Slice& term) { res.emplace_back(term.data, term.size); });
+        std::sort(res.begin(), res.end());
+        res.erase(std::unique(res.begin(), res.end()), res.end());
+        return res;
+    }
+
+private:
+    static bool _is_term_char(uint8_t c) {
+        return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c >= 0x80;
+    }
+
+    static char _to_lower(uint8_t c) { return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c; }
+};
+
+// MATCH_ANY is true if a text contains any term of the queries, and MATCH_ALL is true if a text contains
+// all terms of the queries. Queries without any term match nothing.
+class TextMatcher {
+public:
+    // The scratch of `match`, to avoid allocations for each text.
+    struct Context {
+        std::string term_buf;
+        std::vector<uint8_t> found;
+    };
+
+    TextMatcher(const std::vector<std::string>& queries, bool match_all) : _match_all(match_all) {
+        for (const std::string& query : queries) {
+            std::vector<std::string> terms = TextTokenizer::terms(query);
+            _terms.insert(_terms.end(), terms.begin(), terms.end());
+        }
+        std::sort(_terms.begin(), _terms.end());
+        _terms.erase(std::unique(_terms.begin(), _terms.end()), _terms.end());
+    }
+
+    bool match(const Slice& text, Context* ctx) const {
+        if (_terms.empty()) {
+            return false;
+        }
+        size_t num_found = 0;
+        if (_match_all) {
+            ctx->found.assign(_terms.size(), 0);
+        }
+        TextTokenizer::for_each_term(text, &ctx->term_buf, [&](const Slice& term) {
+            if (_match_all ? num_found == _terms.size() : num_found > 0) {
+                return;
+            }
+            std::string_view t(term.data, term.size);
+            auto iter = std::lower_bound(_terms.begin(), _terms.end(), t);
+            if (iter == _terms.end() || *iter != t) {
+                return;
+            }
+            if (!_match_all) {
+                num_found = 1;
+            } else if (!ctx->found[iter - _terms.begin()]) {
+                ctx->found[iter - _terms.begin()] = 1;
+                num_found++;
+            }
+        });
+        return _match_all ? num_found == _terms.size() : num_found > 0;
+    }
+
+    bool match_all() const { return _match_all; }
+
+    // distinct terms of the queries in ascending order
+    const std::vector<std::string>& terms() const { return _terms; }
+
+private:
+    std::vector<std::string> _terms;
+    bool _match_all;
+};
+
+} // namespace starrocks
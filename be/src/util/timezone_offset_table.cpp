@@ -0,0 +1,84 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "util/timezone_offset_table.h"
+
+#include <algorithm>
+
+#include "common/compiler_util.h"
+
+namespace starrocks {
+
+static const cctz::civil_second kCivilEpoch(1970, 1, 1, 0, 0, 0);
+
+static cctz::time_point<cctz::seconds> to_time_point(int64_t utc_seconds) {
+    return cctz::time_point<cctz::seconds>(cctz::seconds(utc_seconds));
+}
+
+void TimezoneOffsetTable::init(const cctz::time_zone& ctz) {
+    _ctz = ctz;
+    _utc_starts.clear();
+    _local_starts.clear();
+    _offsets.clear();
+
+    int64_t utc_begin = cctz::civil_second(1900, 1, 1, 0, 0, 0) - kCivilEpoch;
+    _utc_end = cctz::civil_second(2100, 1, 1, 0, 0, 0) - kCivilEpoch;
+
+    int64_t offset = ctz.lookup(to_time_point(utc_begin)).offset;
+    _utc_starts.push_back(utc_begin);
+    _local_starts.push_back(utc_begin + offset);
+    _offsets.push_back(offset);
+
+    auto tp = to_time_point(utc_begin);
+    cctz::time_zone::civil_transition trans;
+    while (ctz.next_transition(tp, &trans)) {
+        // |trans.from| is the civil time of the transition by the previous offset.
+        int64_t utc_start = (trans.from - kCivilEpoch) - offset;
+        if (utc_start >= _utc_end) {
+            break;
+        }
+        tp = to_time_point(utc_start);
+        int64_t new_offset = ctz.lookup(tp).offset;
+        if (new_offset == offset) {
+            // only the abbreviation or dst flag changes
+            continue;
+        }
+        _utc_starts.push_back(utc_start);
+        // Around the transition, the civil times in [utc_start + min(offset, new_offset),
+        // utc_start + max(offset, new_offset)) are skipped or repeated, which are converted
+        // by the previous offset like cctz, and the skipped ones are clamped to the transition.
+        _local_starts.push_back(utc_start + std::max(offset, new_offset));
+        _offsets.push_back(new_offset);
+        offset = new_offset;
+    }
+    _local_end = _utc_end + offset;
+}
+
+size_t TimezoneOffsetTable::_find(const std::vector<int64_t>& starts, int64_t value, size_t hint) {
+    if (hint < starts.size() && starts[hint] <= value && (hint + 1 == starts.size() || value < starts[hint + 1])) {
+        return hint;
+    }
+    return std::upper_bound(starts.begin(), starts.end(), value) - starts.begin() - 1;
+}
+
+int64_t TimezoneOffsetTable::utc_to_local(int64_t utc_seconds, size_t* hint) const {
+    if (UNLIKELY(utc_seconds < _utc_starts[0] || utc_seconds >= _utc_end)) {
+        return _ctz.lookup(to_time_point(utc_seconds)).offset + utc_seconds;
+    }
+    *hint = _find(_utc_starts, utc_seconds, *hint);
+    return utc_seconds + _offsets[*hint];
+}
+
+int64_t TimezoneOffsetTable::local_to_utc(int64_t local_seconds, size_t* hint) const {
+    if (UNLIKELY(local_seconds < _local_starts[0] || local_seconds >= _local_end)) {
+        return cctz::convert(kCivilEpoch + local_seconds, _ctz).time_since_epoch().count();
+    }
+    *hint = _find(_local_starts, local_seconds, *hint);
+    int64_t utc_seconds = local_seconds - _offsets[*hint];
+    if (*hint + 1 < _utc_starts.size()) {
+        // a skipped civil time
+        utc_seconds = std::min(utc_seconds, _utc_starts[*hint + 1]);
+    }
+    return utc_seconds;
+}
+
+} // namespace starrocks
@@ -0,0 +1,48 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "cctz/time_zone.h"
+
+namespace starrocks {
+
+// Converts between the unix seconds and the local civil seconds of a time zone by its utc offset
+// transitions, which are looked up in cctz only once when initialized.
+//
+// The local civil seconds are the seconds of a civil time since 1970-01-01 00:00:00, as if the civil
+// time is in UTC, e.g. TimestampValue::to_unix_second() of a local datetime.
+//
+// A conversion is a binary search of the transitions, which is skipped if the value is in the same
+// offset period as the previous one, passed by |hint|. So converting a column of values that are
+// close to each other is a tight loop of comparisons.
+class TimezoneOffsetTable {
+public:
+    // The transitions in [1900, 2100) are cached, the values out of the range are converted by cctz.
+    void init(const cctz::time_zone& ctz);
+
+    // |hint| is the index of the offset period of the previous value, it is updated to the one of
+    // the current value.
+    int64_t utc_to_local(int64_t utc_seconds, size_t* hint) const;
+
+    // Same as cctz::convert(civil_second, ctz), a repeated civil time is converted by the offset before
+    // the transition, and a skipped one is converted to the transition.
+    int64_t local_to_utc(int64_t local_seconds, size_t* hint) const;
+
+private:
+    static size_t _find(const std::vector<int64_t>& starts, int64_t value, size_t hint);
+
+    cctz::time_zone _ctz;
+
+    // The offset is _offsets[i] from _utc_starts[i] (inclusive) to _utc_starts[i + 1] (exclusive).
+    std::vector<int64_t> _utc_starts;
+    // The local civil seconds from _local_starts[i] to _local_starts[i + 1] are converted by _offsets[i].
+    std::vector<int64_t> _local_starts;
+    std::vector<int64_t> _offsets;
+    int64_t _utc_end = 0;
+    int64_t _local_end = 0;
+};
+
+} // namespace starrocks
@@ -0,0 +1,76 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "column/german_string.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace starrocks::vectorized {
+
+static int sign(int v) {
+    return (v > 0) - (v < 0);
+}
+
+// NOLINTNEXTLINE
+TEST(GermanStringTest, test_inline_and_long) {
+    std::string short_str = "abc";
+    std::string inline_str = "abcdefghijkl";
+    std::string long_str = "abcdefghijklmnopq";
+
+    GermanString s1{Slice(short_str)};
+    GermanString s2{Slice(inline_str)};
+    GermanString s3{Slice(long_str)};
+
+    ASSERT_TRUE(s1.is_inline());
+    ASSERT_TRUE(s2.is_inline());
+    ASSERT_FALSE(s3.is_inline());
+    ASSERT_EQ(Slice(short_str), s1.to_slice());
+    ASSERT_EQ(Slice(inline_str), s2.to_slice());
+    ASSERT_EQ(Slice(long_str), s3.to_slice());
+    // the long string is not copied
+    ASSERT_EQ(long_str.data(), s3.data());
+}
+
+// NOLINTNEXTLINE
+TEST(GermanStringTest, test_compare) {
+    std::vector<std::string> strs = {"",
+                                     "a",
+                                     "ab",
+                                     "abc",
+                                     "abcd",
+                                     "abcde",
+                                     "abcdf",
+                                     "abce",
+                                     "abcdefghijkl",
+                                     "abcdefghijklm",
+                                     "abcdefghijklmn",
+                                     "abcdefghijklmz",
+                                     std::string("ab\0c", 4),
+                                     "\xff",
+                                     "b"};
+    for (const auto& l : strs) {
+        for (const auto& r : strs) {
+            Slice ls(l);
+            Slice rs(r);
+            GermanString lg(ls);
+            GermanString rg(rs);
+            ASSERT_EQ(sign(ls.compare(rs)), sign(lg.compare(rg))) << l << " vs " << r;
+            ASSERT_EQ(ls == rs, lg == rg) << l << " vs " << r;
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+TEST(GermanStringTest, test_build_german_strings) {
+    std::vector<std::string> strs = {"hello", "starrocks german string"};
+    Buffer<Slice> slices = {Slice(strs[0]), Slice(strs[1])};
+    Buffer<GermanString> views;
+    build_german_strings(slices, &views);
+    ASSERT_EQ(2, views.size());
+    ASSERT_EQ(slices[0], views[0].to_slice());
+    ASSERT_EQ(slices[1], views[1].to_slice());
+}
+
+} // namespace starrocks::vectorized
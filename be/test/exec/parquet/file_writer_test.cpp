@@ -0,0 +1,208 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/parquet/file_writer.h"
+
+#include <gtest/gtest.h>
+#include <parquet/api/reader.h>
+
+#include "column/binary_column.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "env/env.h"
+#include "runtime/date_value.h"
+
+namespace starrocks::parquet {
+
+class FileWriterTest : public testing::Test {
+public:
+    void SetUp() override { _file_path = "./parquet_file_writer_test.parquet"; }
+    void TearDown() override { Env::Default()->delete_file(_file_path); }
+
+protected:
+    // Read the values of the |col|-th column of all row groups, along with the definition levels.
+    template <typename ReaderType, typename ValueType, typename Func>
+    void _read_column(::parquet::ParquetFileReader* reader, int col, std::vector<ValueType>* values,
+                      std::vector<int16_t>* def_levels, Func&& convert) {
+        for (int rg = 0; rg < reader->metadata()->num_row_groups(); ++rg) {
+            auto column = reader->RowGroup(rg)->Column(col);
+            auto* typed_reader = static_cast<ReaderType*>(column.get());
+            while (typed_reader->HasNext()) {
+                typename ReaderType::T buffer[1024];
+                int16_t levels[1024];
+                int64_t num_values = 0;
+                int64_t num_levels = typed_reader->ReadBatch(1024, levels, nullptr, buffer, &num_values);
+                for (int64_t i = 0; i < num_values; ++i) {
+                    values->emplace_back(convert(buffer[i]));
+                }
+                def_levels->insert(def_levels->end(), levels, levels + num_levels);
+            }
+        }
+    }
+
+    Status _write(const FileWriterOptions& opts, const std::vector<vectorized::Columns>& chunks,
+                  const std::vector<TypeDescriptor>& types, const std::vector<bool>& nullables) {
+        std::unique_ptr<WritableFile> file;
+        RETURN_IF_ERROR(Env::Default()->new_writable_file(_file_path, &file));
+        FileWriter writer(file.get(), opts);
+        std::vector<std::string> names;
+        for (size_t i = 0; i < types.size(); ++i) {
+            names.emplace_back("c" + std::to_string(i));
+        }
+        RETURN_IF_ERROR(writer.init(names, types, nullables));
+        for (const auto& columns : chunks) {
+            RETURN_IF_ERROR(writer.write(columns));
+        }
+        RETURN_IF_ERROR(writer.close());
+        return file->close();
+    }
+
+    std::string _file_path;
+};
+
+TEST_F(FileWriterTest, test_write_and_read) {
+    std::vector<TypeDescriptor> types = {TypeDescriptor(TYPE_INT), TypeDescriptor::create_varchar_type(32),
+                                         TypeDescriptor(TYPE_DOUBLE), TypeDescriptor(TYPE_DATE)};
+    std::vector<bool> nullables = {false, true, true, false};
+
+    const int num_chunks = 3;
+    const int chunk_size = 4096;
+    std::vector<vectorized::Columns> chunks;
+    for (int c = 0; c < num_chunks; ++c) {
+        auto c0 = vectorized::Int32Column::create();
+        auto c1 = vectorized::NullableColumn::create(vectorized::BinaryColumn::create(),
+                                                     vectorized::NullColumn::create());
+        auto c2 = vectorized::NullableColumn::create(vectorized::DoubleColumn::create(),
+                                                     vectorized::NullColumn::create());
+        auto c3 = vectorized::DateColumn::create();
+        for (int i = 0; i < chunk_size; ++i) {
+            int row = c * chunk_size + i;
+            c0->append(row);
+            if (row % 7 == 0) {
+                c1->append_nulls(1);
+            } else {
+                std::string s = "value_" + std::to_string(row % 10);
+                c1->append_datum(vectorized::Datum(Slice(s)));
+            }
+            c2->append_datum(vectorized::Datum(row * 0.5));
+            c3->append(vectorized::DateValue::create(2021, 1, 1 + row % 28));
+        }
+        chunks.push_back({c0, c1, c2, c3});
+    }
+
+    FileWriterOptions opts;
+    opts.column_chunk_options.page_size = 4096;
+    ASSERT_TRUE(_write(opts, chunks, types, nullables).ok());
+
+    auto reader = ::parquet::ParquetFileReader::OpenFile(_file_path, false);
+    auto metadata = reader->metadata();
+    const int num_rows = num_chunks * chunk_size;
+    ASSERT_EQ(num_rows, metadata->num_rows());
+    ASSERT_EQ(4, metadata->num_columns());
+    ASSERT_EQ(1, metadata->num_row_groups());
+    ASSERT_EQ(::parquet::Type::INT32, metadata->schema()->Column(0)->physical_type());
+    ASSERT_EQ(::parquet::Type::BYTE_ARRAY, metadata->schema()->Column(1)->physical_type());
+    ASSERT_EQ(::parquet::ConvertedType::DATE, metadata->schema()->Column(3)->converted_type());
+
+    // low-cardinality strings are dictionary encoded.
+    ASSERT_TRUE(metadata->RowGroup(0)->ColumnChunk(1)->has_dictionary_page());
+    auto stats =
+            std::static_pointer_cast<::parquet::Int32Statistics>(metadata->RowGroup(0)->ColumnChunk(0)->statistics());
+    ASSERT_EQ(0, stats->min());
+    ASSERT_EQ(num_rows - 1, stats->max());
+
+    std::vector<int32_t> ints;
+    std::vector<int16_t> levels;
+    _read_column<::parquet::Int32Reader>(reader.get(), 0, &ints, &levels, [](int32_t v) { return v; });
+    ASSERT_EQ(num_rows, ints.size());
+    for (int i = 0; i < num_rows; ++i) {
+        ASSERT_EQ(i, ints[i]);
+    }
+
+    std::vector<std::string> strings;
+    levels.clear();
+    _read_column<::parquet::ByteArrayReader>(reader.get(), 1, &strings, &levels, [](const ::parquet::ByteArray& v) {
+        return std::string(reinterpret_cast<const char*>(v.ptr), v.len);
+    });
+    ASSERT_EQ(num_rows, levels.size());
+    size_t idx = 0;
+    for (int i = 0; i < num_rows; ++i) {
+        if (i % 7 == 0) {
+            ASSERT_EQ(0, levels[i]);
+        } else {
+            ASSERT_EQ(1, levels[i]);
+            ASSERT_EQ("value_" + std::to_string(i % 10), strings[idx++]);
+        }
+    }
+    ASSERT_EQ(idx, strings.size());
+
+    std::vector<double> doubles;
+    levels.clear();
+    _read_column<::parquet::DoubleReader>(reader.get(), 2, &doubles, &levels, [](double v) { return v; });
+    ASSERT_EQ(num_rows, doubles.size());
+    ASSERT_DOUBLE_EQ(100.5, doubles[201]);
+
+    std::vector<int32_t> dates;
+    levels.clear();
+    _read_column<::parquet::Int32Reader>(reader.get(), 3, &dates, &levels, [](int32_t v) { return v; });
+    ASSERT_EQ(num_rows, dates.size());
+    // 2021-01-01 is the 18628th day since the unix epoch.
+    ASSERT_EQ(18628, dates[0]);
+    ASSERT_EQ(18628 + 5, dates[33]);
+}
+
+TEST_F(FileWriterTest, test_row_group_and_dictionary_fallback) {
+    std::vector<TypeDescriptor> types = {TypeDescriptor::create_varchar_type(64)};
+    std::vector<bool> nullables = {false};
+
+    const int num_chunks = 4;
+    const int chunk_size = 1000;
+    std::vector<vectorized::Columns> chunks;
+    for (int c = 0; c < num_chunks; ++c) {
+        auto column = vectorized::BinaryColumn::create();
+        for (int i = 0; i < chunk_size; ++i) {
+            std::string s = "distinct_value_" + std::to_string(c * chunk_size + i);
+            column->append(Slice(s));
+        }
+        chunks.push_back({column});
+    }
+
+    FileWriterOptions opts;
+    opts.column_chunk_options.codec = tparquet::CompressionCodec::ZSTD;
+    opts.column_chunk_options.dictionary_page_size = 4096;
+    // every two chunks make a row group.
+    opts.row_group_size = 30000;
+    ASSERT_TRUE(_write(opts, chunks, types, nullables).ok());
+
+    auto reader = ::parquet::ParquetFileReader::OpenFile(_file_path, false);
+    auto metadata = reader->metadata();
+    ASSERT_EQ(num_chunks * chunk_size, metadata->num_rows());
+    ASSERT_EQ(2, metadata->num_row_groups());
+    ASSERT_EQ(::parquet::Compression::ZSTD, metadata->RowGroup(0)->ColumnChunk(0)->compression());
+
+    std::vector<std::string> strings;
+    std::vector<int16_t> levels;
+    _read_column<::parquet::ByteArrayReader>(reader.get(), 0, &strings, &levels, [](const ::parquet::ByteArray& v) {
+        return std::string(reinterpret_cast<const char*>(v.ptr), v.len);
+    });
+    ASSERT_EQ(num_chunks * chunk_size, strings.size());
+    for (int i = 0; i < num_chunks * chunk_size; ++i) {
+        ASSERT_EQ("distinct_value_" + std::to_string(i), strings[i]);
+    }
+}
+
+TEST_F(FileWriterTest, test_null_in_required_column) {
+    std::vector<TypeDescriptor> types = {TypeDescriptor(TYPE_BIGINT)};
+    std::vector<bool> nullables = {false};
+    auto column = vectorized::NullableColumn::create(vectorized::Int64Column::create(),
+                                                     vectorized::NullColumn::create());
+    column->append_nulls(1);
+    ASSERT_FALSE(_write(FileWriterOptions(), {{column}}, types, nullables).ok());
+}
+
+TEST_F(FileWriterTest, test_not_supported_type) {
+    std::unique_ptr<ColumnChunkWriter> writer;
+    auto st = ColumnChunkWriter::create("c0", TypeDescriptor(TYPE_HLL), true, ColumnChunkWriterOptions(), &writer);
+    ASSERT_TRUE(st.is_not_supported());
+}
+
+} // namespace starrocks::parquet
@@ -370,6 +370,7 @@ static void replace_column_readers(GroupReader* group_reader, GroupReaderParam*
         group_reader->_column_readers[i] = std::move(r);
     }
     group_reader->_direct_read_columns = param->read_cols;
+    group_reader->_active_columns = param->read_cols;
 }
 
 TEST_F(GroupReaderTest, TestGetNext) {
@@ -393,6 +394,7 @@ TEST_F(GroupReaderTest, TestGetNext) {
     replace_column_readers(group_reader, param);
     // create chunk
     group_reader->_read_chunk = _create_chunk(param);
+    group_reader->_active_chunk = group_reader->_read_chunk;
 
     auto chunk = _create_chunk(param);
     // get next
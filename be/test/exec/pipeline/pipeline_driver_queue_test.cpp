@@ -0,0 +1,155 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/pipeline/pipeline_driver_queue.h"
+
+#include <gtest/gtest.h>
+
+#include "exec/pipeline/query_context.h"
+#include "exec/pipeline/resource_group.h"
+#include "runtime/mem_tracker.h"
+
+namespace starrocks::pipeline {
+
+class NoopOperator final : public Operator {
+public:
+    NoopOperator() : Operator(nullptr, 0, "noop", 0) {}
+    bool has_output() const override { return true; }
+    bool need_input() const override { return false; }
+    bool is_finished() const override { return false; }
+    StatusOr<vectorized::ChunkPtr> pull_chunk(RuntimeState* state) override { return nullptr; }
+    Status push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) override { return Status::OK(); }
+};
+
+class ResourceGroupDriverQueueTest : public ::testing::Test {
+protected:
+    QueryContext* _new_query(int64_t group_id, int32_t cpu_share) {
+        TResourceGroup t_group;
+        t_group.__set_id(group_id);
+        t_group.__set_cpu_share(cpu_share);
+        auto query_ctx = std::make_unique<QueryContext>();
+        query_ctx->set_resource_group(ResourceGroupManager::instance()->get_or_create(t_group));
+        _query_ctxs.emplace_back(std::move(query_ctx));
+        return _query_ctxs.back().get();
+    }
+
+    std::vector<DriverRawPtr> _new_drivers(QueryContext* query_ctx, size_t num_drivers) {
+        std::vector<DriverRawPtr> drivers;
+        for (size_t i = 0; i < num_drivers; ++i) {
+            Operators operators{std::make_shared<NoopOperator>()};
+            _drivers.emplace_back(
+                    std::make_shared<PipelineDriver>(operators, query_ctx, nullptr, _drivers.size(), true));
+            drivers.emplace_back(_drivers.back().get());
+        }
+        return drivers;
+    }
+
+    // Run the drivers in |queue| for |num_rounds| time slices of the same length.
+    std::unordered_map<int64_t, size_t> _run(DriverQueue* queue, size_t num_rounds) {
+        std::unordered_map<int64_t, size_t> num_rounds_of_groups;
+        for (size_t i = 0; i < num_rounds; ++i) {
+            auto maybe_driver = queue->take();
+            EXPECT_TRUE(maybe_driver.ok());
+            auto* driver = maybe_driver.value();
+            driver->driver_acct().update_last_time_spent(1000);
+            queue->update_statistics(driver);
+            ++num_rounds_of_groups[driver->query_ctx()->resource_group()->id()];
+            queue->put_back(driver);
+        }
+        return num_rounds_of_groups;
+    }
+
+    std::vector<std::unique_ptr<QueryContext>> _query_ctxs;
+    std::vector<DriverPtr> _drivers;
+};
+
+TEST_F(ResourceGroupDriverQueueTest, test_cpu_share) {
+    ResourceGroupDriverQueue queue;
+    // The large query has much more drivers than the small one.
+    queue.put_back(_new_drivers(_new_query(101, 1), 16));
+    queue.put_back(_new_drivers(_new_query(102, 3), 2));
+
+    auto num_rounds_of_groups = _run(&queue, 400);
+    ASSERT_NEAR(100, num_rounds_of_groups[101], 1);
+    ASSERT_NEAR(300, num_rounds_of_groups[102], 1);
+
+    // A new group doesn't take all the execution time to catch up with the others.
+    queue.put_back(_new_drivers(_new_query(103, 1), 4));
+    num_rounds_of_groups = _run(&queue, 500);
+    ASSERT_NEAR(100, num_rounds_of_groups[101], 2);
+    ASSERT_NEAR(300, num_rounds_of_groups[102], 2);
+    ASSERT_NEAR(100, num_rounds_of_groups[103], 2);
+
+    queue.close();
+    ASSERT_TRUE(queue.take().status().is_cancelled());
+}
+
+TEST(ResourceGroupTest, test_update) {
+    TResourceGroup t_group;
+    t_group.__set_id(201);
+    t_group.__set_name("etl");
+    t_group.__set_cpu_share(2);
+    t_group.__set_mem_limit(1024);
+    auto group = ResourceGroupManager::instance()->get_or_create(t_group);
+    ASSERT_EQ("etl", group->name());
+    ASSERT_EQ(2, group->cpu_share());
+    ASSERT_EQ(config::pipeline_default_resource_group_share, group->scan_io_share());
+    ASSERT_EQ(1024, group->mem_tracker()->limit());
+
+    t_group.__set_cpu_share(4);
+    t_group.__set_mem_limit(0);
+    ASSERT_EQ(group, ResourceGroupManager::instance()->get_or_create(t_group));
+    ASSERT_EQ(4, group->cpu_share());
+    ASSERT_EQ(-1, group->mem_tracker()->limit());
+
+    ASSERT_EQ(ResourceGroupManager::DEFAULT_GROUP_ID,
+              ResourceGroupManager::instance()->get_or_create(TResourceGroup()).get()->id());
+}
+
+TEST(ResourceGroupTest, test_update_mem_limit) {
+    MemTracker parent(-1, "parent");
+    ResourceGroup group(202, "adhoc", 1, 1, -1, &parent);
+    TResourceGroup t_group;
+
+    // the queries hold the MemTracker of the group like QueryContext
+    auto group_tracker1 = group.mem_tracker();
+    auto query1 = std::make_unique<MemTracker>(MemTracker::QUERY, -1, "query1", group_tracker1.get());
+    query1->consume(2048);
+    ASSERT_FALSE(query1->any_limit_exceeded());
+
+    // the new limit is enforced on the queries started after the update
+    t_group.__set_mem_limit(1024);
+    group.update(t_group);
+    auto group_tracker2 = group.mem_tracker();
+    ASSERT_NE(group_tracker1, group_tracker2);
+    ASSERT_EQ(1024, group_tracker2->limit());
+    auto query2 = std::make_unique<MemTracker>(MemTracker::QUERY, -1, "query2", group_tracker2.get());
+    query2->consume(512);
+    ASSERT_FALSE(query2->any_limit_exceeded());
+    query2->consume(1024);
+    ASSERT_TRUE(query2->any_limit_exceeded());
+    ASSERT_EQ(group_tracker2.get(), query2->find_limit_exceeded_tracker());
+    ASSERT_EQ(3584, parent.consumption());
+
+    // the limit is removed, the query with the old limit still works
+    t_group.__set_mem_limit(-1);
+    group.update(t_group);
+    auto group_tracker3 = group.mem_tracker();
+    ASSERT_NE(group_tracker2, group_tracker3);
+    ASSERT_FALSE(group_tracker3->has_limit());
+    auto query3 = std::make_unique<MemTracker>(MemTracker::QUERY, -1, "query3", group_tracker3.get());
+    query3->consume(4096);
+    ASSERT_FALSE(query3->any_limit_exceeded());
+    ASSERT_EQ(-1, query3->lowest_limit());
+    ASSERT_EQ(1024, query2->lowest_limit());
+
+    // the same limit doesn't create a new MemTracker
+    group.update(t_group);
+    ASSERT_EQ(group_tracker3, group.mem_tracker());
+
+    query1->release(2048);
+    query2->release(1536);
+    query3->release(4096);
+    ASSERT_EQ(0, parent.consumption());
+}
+
+} // namespace starrocks::pipeline
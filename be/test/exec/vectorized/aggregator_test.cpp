@@ -0,0 +1,78 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/vectorized/aggregator.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+class StreamingPreaggDecisionTest : public testing::Test {
+protected:
+    // The hash table memory which falls into each level of STREAMING_HT_MIN_REDUCTION.
+    static constexpr int64_t kL1Mem = 1024;
+    static constexpr int64_t kL2Mem = 1024 * 1024;
+    static constexpr int64_t kL3Mem = 16 * 1024 * 1024;
+
+    StreamingPreaggDecision _decide(int64_t aggregated_input_rows, size_t input_chunk_size, int64_t ht_mem,
+                                    int64_t ht_rows, bool allow_flush, int64_t chunk_cardinality) {
+        return Aggregator::decide_streaming_preagg_by_reduction(aggregated_input_rows, input_chunk_size, ht_mem,
+                                                                ht_rows, allow_flush, [&]() {
+                                                                    _num_estimations++;
+                                                                    return chunk_cardinality;
+                                                                });
+    }
+
+    int _num_estimations = 0;
+};
+
+TEST_F(StreamingPreaggDecisionTest, expand_without_statistics) {
+    // empty hash table
+    ASSERT_EQ(StreamingPreaggDecision::EXPAND, _decide(4096, 4096, kL3Mem, 0, true, 4096));
+    // no input rows are aggregated into the hash table, e.g. they were all passed through
+    ASSERT_EQ(StreamingPreaggDecision::EXPAND, _decide(0, 4096, kL3Mem, 100, true, 4096));
+    ASSERT_EQ(StreamingPreaggDecision::EXPAND, _decide(-10, 4096, kL3Mem, 100, true, 4096));
+    ASSERT_EQ(0, _num_estimations);
+}
+
+TEST_F(StreamingPreaggDecisionTest, expand_by_hash_table_reduction) {
+    // no reduction is required while the hash table fits in L2 cache
+    ASSERT_EQ(StreamingPreaggDecision::EXPAND, _decide(100, 4096, kL1Mem, 100, true, 4096));
+    // 1.5 > 1.1 for L2 cache
+    ASSERT_EQ(StreamingPreaggDecision::EXPAND, _decide(150, 4096, kL2Mem, 100, true, 4096));
+    // 3 > 2.0 for L3 cache
+    ASSERT_EQ(StreamingPreaggDecision::EXPAND, _decide(300, 4096, kL3Mem, 100, true, 4096));
+    // the chunk is not estimated when the hash table reduces enough
+    ASSERT_EQ(0, _num_estimations);
+}
+
+TEST_F(StreamingPreaggDecisionTest, pass_through) {
+    // neither the hash table nor the chunk reduces enough
+    ASSERT_EQ(StreamingPreaggDecision::PASS_THROUGH, _decide(100, 4096, kL2Mem, 100, true, 4096));
+    ASSERT_EQ(StreamingPreaggDecision::PASS_THROUGH, _decide(150, 4096, kL3Mem, 100, true, 4000));
+    ASSERT_EQ(2, _num_estimations);
+
+    // the chunk reduces, but the hash table is too large to expand and can't be flushed
+    const int64_t ht_rows = Aggregator::streaming_hash_table_size_threshold;
+    ASSERT_EQ(StreamingPreaggDecision::PASS_THROUGH, _decide(ht_rows, 4096, kL2Mem, ht_rows, true, 16));
+    ASSERT_EQ(StreamingPreaggDecision::PASS_THROUGH, _decide(ht_rows, 4096, kL3Mem, ht_rows, false, 16));
+}
+
+TEST_F(StreamingPreaggDecisionTest, expand_by_chunk_reduction) {
+    // the hash table doesn't reduce, but the keys of the chunk repeat
+    const int64_t ht_rows = Aggregator::streaming_hash_table_size_threshold - 1;
+    ASSERT_EQ(StreamingPreaggDecision::EXPAND, _decide(ht_rows, 4096, kL2Mem, ht_rows, true, 16));
+    // out of the last level cache, but flush is not allowed
+    ASSERT_EQ(StreamingPreaggDecision::EXPAND, _decide(ht_rows, 4096, kL3Mem, ht_rows, false, 16));
+    ASSERT_EQ(2, _num_estimations);
+}
+
+TEST_F(StreamingPreaggDecisionTest, flush) {
+    // the chunk reduces while the hash table is out of the last level cache
+    ASSERT_EQ(StreamingPreaggDecision::FLUSH, _decide(100, 4096, kL3Mem, 100, true, 16));
+    const int64_t ht_rows = Aggregator::streaming_hash_table_size_threshold;
+    ASSERT_EQ(StreamingPreaggDecision::FLUSH, _decide(ht_rows, 4096, kL3Mem, ht_rows, true, 16));
+    // the chunk doesn't reduce
+    ASSERT_EQ(StreamingPreaggDecision::PASS_THROUGH, _decide(100, 4096, kL3Mem, 100, true, 4096));
+}
+
+} // namespace starrocks
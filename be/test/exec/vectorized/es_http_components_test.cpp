@@ -0,0 +1,141 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/vectorized/es_http_components.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "gen_cpp/Descriptors_types.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
+
+namespace starrocks::vectorized {
+
+class ScrollParserTest : public ::testing::Test {
+protected:
+    const TupleDescriptor* create_tuple_desc(const std::vector<TypeDescriptor>& types,
+                                             const std::vector<std::string>& col_names,
+                                             const std::vector<bool>& nullables) {
+        TDescriptorTableBuilder desc_tbl_builder;
+        TTupleDescriptorBuilder tuple_desc_builder;
+        for (int i = 0; i < types.size(); ++i) {
+            TSlotDescriptorBuilder slot_desc_builder;
+            slot_desc_builder.type(types[i]).column_name(col_names[i]).length(types[i].len).nullable(nullables[i]);
+            tuple_desc_builder.add_slot(slot_desc_builder.build());
+        }
+        tuple_desc_builder.build(&desc_tbl_builder);
+
+        DescriptorTbl* desc_tbl = nullptr;
+        Status st = DescriptorTbl::create(&_pool, desc_tbl_builder.desc_tbl(), &desc_tbl);
+        CHECK(st.ok()) << st.to_string();
+        return desc_tbl->get_tuple_descriptor(0);
+    }
+
+    ObjectPool _pool;
+    std::map<std::string, std::string> _docvalue_context;
+};
+
+TEST_F(ScrollParserTest, test_source_mode) {
+    auto tuple_desc = create_tuple_desc({TypeDescriptor::create_varchar_type(64), TypeDescriptor(TYPE_INT),
+                                         TypeDescriptor(TYPE_DOUBLE), TypeDescriptor::create_varchar_type(64),
+                                         TypeDescriptor(TYPE_BOOLEAN)},
+                                        {"_id", "k1", "k2", "k3", "k4"}, {false, true, true, true, true});
+    ScrollParser parser(false);
+    parser.set_params(tuple_desc, &_docvalue_context);
+
+    std::string response = R"({"_scroll_id": "scroll_1", "hits": {"total": 3, "hits": [
+        {"_id": "id_1", "_source": {"k1": 1, "k2": 1.5, "k3": "a", "k4": true, "unknown": [1, 2]}},
+        {"_id": "id_2", "_source": {"k1": "2", "k2": null, "k3": {"x": 1,  "y": [1, 2]}, "k4": "false"}},
+        {"_id": "id_3", "_source": {"k3": 3 , "k1": 3.0}}
+    ]}})";
+    ASSERT_TRUE(parser.parse(&response).ok());
+    ASSERT_EQ("scroll_1", parser.get_scroll_id());
+    ASSERT_EQ(3, parser.get_size());
+
+    ChunkPtr chunk;
+    bool line_eos = false;
+    ASSERT_TRUE(parser.fill_chunk(&chunk, &line_eos).ok());
+    ASSERT_FALSE(line_eos);
+    ASSERT_EQ(3, chunk->num_rows());
+    ASSERT_EQ("['id_1', 1, 1.5, 'a', 1]", chunk->debug_row(0));
+    ASSERT_EQ("['id_2', 2, NULL, '{\"x\":1,\"y\":[1,2]}', 0]", chunk->debug_row(1));
+    // the missing fields are null
+    ASSERT_EQ("['id_3', 3, NULL, '3', NULL]", chunk->debug_row(2));
+
+    ASSERT_TRUE(parser.fill_chunk(&chunk, &line_eos).ok());
+    ASSERT_TRUE(line_eos);
+    ASSERT_TRUE(parser.current_eos());
+}
+
+TEST_F(ScrollParserTest, test_doc_value_mode) {
+    _docvalue_context = {{"k1", "k1"}, {"k2", "k2.keyword"}};
+    auto tuple_desc = create_tuple_desc({TypeDescriptor(TYPE_BIGINT), TypeDescriptor::create_varchar_type(64)},
+                                        {"k1", "k2"}, {true, true});
+    ScrollParser parser(true);
+    parser.set_params(tuple_desc, &_docvalue_context);
+
+    // only the first of the doc values is used
+    std::string response = R"({"_scroll_id": "scroll_1", "hits": {"total": 2, "hits": [
+        {"_id": "id_1", "fields": {"k1": [10, 11], "k2.keyword": ["a"]}},
+        {"_id": "id_2", "fields": {"k2.keyword": [], "k1": [20]}}
+    ]}})";
+    ASSERT_TRUE(parser.parse(&response).ok());
+    ASSERT_EQ(2, parser.get_size());
+
+    ChunkPtr chunk;
+    bool line_eos = false;
+    ASSERT_TRUE(parser.fill_chunk(&chunk, &line_eos).ok());
+    ASSERT_EQ(2, chunk->num_rows());
+    ASSERT_EQ("[10, 'a']", chunk->debug_row(0));
+    ASSERT_EQ("[20, NULL]", chunk->debug_row(1));
+}
+
+TEST_F(ScrollParserTest, test_reuse_parser) {
+    auto tuple_desc = create_tuple_desc({TypeDescriptor(TYPE_INT)}, {"k1"}, {false});
+    ScrollParser parser(false);
+    parser.set_params(tuple_desc, &_docvalue_context);
+
+    for (int i = 0; i < 3; ++i) {
+        std::string response = R"({"_scroll_id": "scroll_)" + std::to_string(i) +
+                               R"(", "hits": {"hits": [{"_source": {"k1": )" + std::to_string(i) + "}}]}}";
+        ASSERT_TRUE(parser.parse(&response).ok());
+        ASSERT_EQ("scroll_" + std::to_string(i), parser.get_scroll_id());
+
+        ChunkPtr chunk;
+        bool line_eos = false;
+        ASSERT_TRUE(parser.fill_chunk(&chunk, &line_eos).ok());
+        ASSERT_EQ(1, chunk->num_rows());
+        ASSERT_EQ("[" + std::to_string(i) + "]", chunk->debug_row(0));
+    }
+
+    // the end of scrolling
+    std::string response = R"({"_scroll_id": "scroll_3", "hits": {"hits": []}})";
+    ASSERT_TRUE(parser.parse(&response).ok());
+    ASSERT_EQ(0, parser.get_size());
+    ASSERT_TRUE(parser.current_eos());
+}
+
+TEST_F(ScrollParserTest, test_invalid_response) {
+    auto tuple_desc = create_tuple_desc({TypeDescriptor(TYPE_INT)}, {"k1"}, {false});
+    ScrollParser parser(false);
+    parser.set_params(tuple_desc, &_docvalue_context);
+
+    std::string no_scroll_id = R"({"hits": {"hits": [{"_source": {"k1": 1}}]}})";
+    ASSERT_FALSE(parser.parse(&no_scroll_id).ok());
+    no_scroll_id = R"({"hits": {"hits": [{"_source": {"k1": 1}}]}})";
+    ASSERT_TRUE(parser.parse(&no_scroll_id, true).ok());
+
+    std::string null_value = R"({"_scroll_id": "s", "hits": {"hits": [{"_source": {"k1": null}}]}})";
+    ASSERT_FALSE(parser.parse(&null_value).ok());
+
+    std::string type_mismatch = R"({"_scroll_id": "s", "hits": {"hits": [{"_source": {"k1": [1]}}]}})";
+    ASSERT_FALSE(parser.parse(&type_mismatch).ok());
+
+    std::string not_number = R"({"_scroll_id": "s", "hits": {"hits": [{"_source": {"k1": "abc"}}]}})";
+    ASSERT_FALSE(parser.parse(&not_number).ok());
+
+    std::string malformed = R"({"_scroll_id": "s", "hits": {"hits": [{"_source": {"k1": )";
+    ASSERT_FALSE(parser.parse(&malformed).ok());
+}
+
+} // namespace starrocks::vectorized
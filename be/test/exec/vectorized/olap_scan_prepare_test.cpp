@@ -0,0 +1,148 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/vectorized/olap_scan_prepare.h"
+
+#include <gtest/gtest.h>
+
+#include "common/object_pool.h"
+#include "exprs/vectorized/runtime_filter_bank.h"
+#include "gen_cpp/Descriptors_types.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
+#include "runtime/runtime_state.h"
+#include "storage/tablet_schema.h"
+
+namespace starrocks::vectorized {
+
+class OlapScanPrepareTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        TDescriptorTableBuilder desc_tbl_builder;
+        TTupleDescriptorBuilder tuple_desc_builder;
+        TSlotDescriptorBuilder slot_desc_builder;
+        slot_desc_builder.string_type(TypeDescriptor::MAX_VARCHAR_LENGTH).column_name("c0").nullable(true);
+        tuple_desc_builder.add_slot(slot_desc_builder.build());
+        tuple_desc_builder.build(&desc_tbl_builder);
+
+        DescriptorTbl* desc_tbl = nullptr;
+        Status st = DescriptorTbl::create(&_pool, desc_tbl_builder.desc_tbl(), &desc_tbl);
+        CHECK(st.ok()) << st.to_string();
+        _tuple_desc = desc_tbl->get_tuple_descriptor(0);
+    }
+
+    void TearDown() override {
+        for (ExprContext* ctx : _conjunct_ctxs) {
+            ctx->close(&_state);
+        }
+    }
+
+    // `c0 LIKE <pattern>`
+    ExprContext* create_like_expr_ctx(const std::string& pattern) {
+        TExprNode like_node;
+        like_node.__set_node_type(TExprNodeType::FUNCTION_CALL);
+        like_node.__set_type(TypeDescriptor(TYPE_BOOLEAN).to_thrift());
+        like_node.__set_num_children(2);
+        TFunctionName fn_name;
+        fn_name.__set_function_name("like");
+        TFunction fn;
+        fn.__set_name(fn_name);
+        fn.__set_binary_type(TFunctionBinaryType::BUILTIN);
+        fn.__set_fid(60010);
+        like_node.__set_fn(fn);
+        like_node.__set_use_vectorized(true);
+
+        TExprNode slot_node;
+        slot_node.__set_node_type(TExprNodeType::SLOT_REF);
+        slot_node.__set_type(TypeDescriptor::create_varchar_type(TypeDescriptor::MAX_VARCHAR_LENGTH).to_thrift());
+        slot_node.__set_num_children(0);
+        TSlotRef slot_ref;
+        slot_ref.__set_slot_id(0);
+        slot_ref.__set_tuple_id(0);
+        slot_node.__set_slot_ref(slot_ref);
+        slot_node.__set_use_vectorized(true);
+
+        TExprNode pattern_node;
+        pattern_node.__set_node_type(TExprNodeType::STRING_LITERAL);
+        pattern_node.__set_type(TypeDescriptor::create_varchar_type(TypeDescriptor::MAX_VARCHAR_LENGTH).to_thrift());
+        pattern_node.__set_num_children(0);
+        TStringLiteral string_literal;
+        string_literal.__set_value(pattern);
+        pattern_node.__set_string_literal(string_literal);
+        pattern_node.__set_use_vectorized(true);
+
+        TExpr texpr;
+        texpr.__set_nodes({like_node, slot_node, pattern_node});
+        ExprContext* ctx = nullptr;
+        CHECK(Expr::create_expr_tree(&_pool, texpr, &ctx).ok());
+        CHECK(ctx->prepare(&_state, RowDescriptor()).ok());
+        CHECK(ctx->open(&_state).ok());
+        return ctx;
+    }
+
+    static void create_tablet_schema(uint32_t ngram_bf_gram_size, TabletSchema* schema) {
+        TabletSchemaPB schema_pb;
+        schema_pb.set_keys_type(DUP_KEYS);
+        schema_pb.set_num_short_key_columns(0);
+        auto c0 = schema_pb.add_column();
+        c0->set_unique_id(1);
+        c0->set_name("c0");
+        c0->set_type("VARCHAR");
+        c0->set_length(TypeDescriptor::MAX_VARCHAR_LENGTH);
+        c0->set_is_key(false);
+        c0->set_is_nullable(true);
+        if (ngram_bf_gram_size > 0) {
+            c0->set_ngram_bf_gram_size(ngram_bf_gram_size);
+        }
+        schema->init_from_pb(schema_pb);
+    }
+
+    // Parses `c0 LIKE '%error%'` and returns the conjuncts left to the scan node.
+    std::vector<ExprContext*> parse_like(const TabletSchema* tablet_schema) {
+        _conjunct_ctxs.emplace_back(create_like_expr_ctx("%error%"));
+        std::vector<ExprContext*> conjunct_ctxs{_conjunct_ctxs.back()};
+
+        OlapScanConjunctsManager cm;
+        cm.conjunct_ctxs_ptr = &conjunct_ctxs;
+        cm.tuple_desc = _tuple_desc;
+        cm.obj_pool = &_pool;
+        cm.key_column_names = &_key_column_names;
+        cm.runtime_filters = &_runtime_filters;
+        cm.runtime_state = &_state;
+        cm.tablet_schema = tablet_schema;
+        CHECK(cm.parse_conjuncts(true, 1024).ok());
+
+        std::vector<ExprContext*> not_push_down;
+        cm.get_not_push_down_conjuncts(&not_push_down);
+        return not_push_down;
+    }
+
+    ObjectPool _pool;
+    RuntimeState _state{TQueryGlobals()};
+    const TupleDescriptor* _tuple_desc = nullptr;
+    std::vector<std::string> _key_column_names;
+    RuntimeFilterProbeCollector _runtime_filters;
+    std::vector<ExprContext*> _conjunct_ctxs;
+};
+
+// NOLINTNEXTLINE
+TEST_F(OlapScanPrepareTest, like_with_ngram_bf_index) {
+    TabletSchema schema;
+    create_tablet_schema(3, &schema);
+    ASSERT_TRUE(parse_like(&schema).empty());
+}
+
+// NOLINTNEXTLINE
+TEST_F(OlapScanPrepareTest, like_without_ngram_bf_index) {
+    TabletSchema schema;
+    create_tablet_schema(0, &schema);
+    auto conjuncts = parse_like(&schema);
+    ASSERT_EQ(1, conjuncts.size());
+    ASSERT_EQ(_conjunct_ctxs.back(), conjuncts[0]);
+
+    // no tablet schema
+    conjuncts = parse_like(nullptr);
+    ASSERT_EQ(1, conjuncts.size());
+    ASSERT_EQ(_conjunct_ctxs.back(), conjuncts[0]);
+}
+
+} // namespace starrocks::vectorized
@@ -14,6 +14,7 @@
 #include "gutil/strings/substitute.h"
 #include "runtime/descriptor_helper.h"
 #include "runtime/descriptors.h"
+#include "simd/simd.h"
 
 namespace starrocks::vectorized {
 
@@ -1086,4 +1087,138 @@ TEST_F(OrcScannerAdapterTest, TestReadPaddingChar) {
     }
 }
 
+static std::string debug_row(const Chunk& chunk, const std::vector<SlotDescriptor*>& slots, size_t row) {
+    std::string s;
+    for (SlotDescriptor* slot : slots) {
+        s.append(chunk.get_column_by_slot_id(slot->id())->debug_item(row)).append(",");
+    }
+    return s;
+}
+
+TEST_F(OrcScannerAdapterTest, TestLazyLoad) {
+    // select the first rows of each row group and the last rows of each batch, so that the lazy load
+    // columns skip rows by both decoding and seeking to row groups.
+    auto is_selected = [](size_t row) { return row % default_row_group_size < 5 || row >= 3500; };
+
+    std::vector<std::string> expected;
+    {
+        OrcScannerAdapter adapter(_src_slot_descs);
+        adapter.disable_broker_load_mode();
+        ASSERT_TRUE(adapter.init(orc::readLocalFile(input_orc_file)).ok());
+        while (adapter.read_next().ok()) {
+            ChunkPtr chunk = adapter.create_chunk();
+            ASSERT_TRUE(adapter.fill_chunk(&chunk).ok());
+            chunk = adapter.cast_chunk(&chunk);
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                if (is_selected(i)) {
+                    expected.emplace_back(debug_row(*chunk, _src_slot_descs, i));
+                }
+            }
+        }
+    }
+
+    // lo_orderpriority and lo_suppkey are lazy loaded.
+    OrcScannerAdapter adapter(_src_slot_descs);
+    adapter.disable_broker_load_mode();
+    adapter.set_lazy_load_slot_ids({_src_slot_descs[3]->id(), _src_slot_descs[5]->id()});
+    ASSERT_TRUE(adapter.init(orc::readLocalFile(input_orc_file)).ok());
+    ASSERT_TRUE(adapter.has_lazy_load_columns());
+
+    std::vector<std::string> actual;
+    size_t skip_rows = 0;
+    while (adapter.read_next().ok()) {
+        ChunkPtr chunk = adapter.create_chunk();
+        ASSERT_TRUE(adapter.fill_chunk(&chunk).ok());
+        chunk = adapter.cast_chunk(&chunk);
+        ASSERT_EQ(4, chunk->num_columns());
+
+        Column::Filter filter(chunk->num_rows());
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            filter[i] = is_selected(i);
+        }
+        chunk->filter(filter);
+        ASSERT_TRUE(adapter.lazy_read_next(&chunk, &filter).ok());
+        ASSERT_EQ(6, chunk->num_columns());
+        skip_rows += adapter.get_lazy_load_skip_rows();
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            actual.emplace_back(debug_row(*chunk, _src_slot_descs, i));
+        }
+    }
+    ASSERT_EQ(expected, actual);
+    ASSERT_GT(skip_rows, 0);
+}
+
+TEST_F(OrcScannerAdapterTest, TestLazyLoadSeekToRow) {
+    // all the rows of the file, in order
+    std::vector<std::string> expected;
+    {
+        OrcScannerAdapter adapter(_src_slot_descs);
+        adapter.disable_broker_load_mode();
+        ASSERT_TRUE(adapter.init(orc::readLocalFile(input_orc_file)).ok());
+        while (adapter.read_next().ok()) {
+            ChunkPtr chunk = adapter.create_chunk();
+            ASSERT_TRUE(adapter.fill_chunk(&chunk).ok());
+            chunk = adapter.cast_chunk(&chunk);
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                expected.emplace_back(debug_row(*chunk, _src_slot_descs, i));
+            }
+        }
+    }
+    ASSERT_EQ(total_record_num, expected.size());
+
+    // lo_orderpriority and lo_suppkey are lazy loaded.
+    const size_t batch_size = 100;
+    OrcScannerAdapter adapter(_src_slot_descs);
+    adapter.disable_broker_load_mode();
+    adapter.set_read_chunk_size(batch_size);
+    adapter.set_lazy_load_slot_ids({_src_slot_descs[3]->id(), _src_slot_descs[5]->id()});
+    ASSERT_TRUE(adapter.init(orc::readLocalFile(input_orc_file)).ok());
+
+    // read the batch starting at |first_row|, and lazy load the rows selected by |is_selected|, if any.
+    auto check_next = [&](size_t first_row, auto is_selected) {
+        ASSERT_TRUE(adapter.read_next().ok());
+        ChunkPtr chunk = adapter.create_chunk();
+        ASSERT_TRUE(adapter.fill_chunk(&chunk).ok());
+        chunk = adapter.cast_chunk(&chunk);
+        ASSERT_EQ(batch_size, chunk->num_rows());
+
+        Column::Filter filter(chunk->num_rows());
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            filter[i] = is_selected(i);
+        }
+        if (SIMD::count_nonzero(filter.data(), filter.size()) == 0) {
+            return;
+        }
+        chunk->filter(filter);
+        ASSERT_TRUE(adapter.lazy_read_next(&chunk, &filter).ok());
+        ASSERT_EQ(6, chunk->num_columns());
+        size_t j = 0;
+        for (size_t i = 0; i < batch_size; i++) {
+            if (filter[i]) {
+                ASSERT_EQ(expected[first_row + i], debug_row(*chunk, _src_slot_descs, j++)) << first_row + i;
+            }
+        }
+    };
+    auto all = [](size_t) { return true; };
+    auto none = [](size_t) { return false; };
+
+    check_next(0, [](size_t i) { return i >= 50; });
+
+    // seek forward to the middle of row group 3 of stripe 0.
+    ASSERT_TRUE(adapter.seek_to_row(3550).ok());
+    check_next(3550, all);
+    check_next(3650, [](size_t i) { return i % 2 == 0; });
+
+    // seek backward, behind the position of the lazy load columns.
+    ASSERT_TRUE(adapter.seek_to_row(120).ok());
+    check_next(120, all);
+    // the batches which are not lazy loaded are skipped.
+    check_next(220, none);
+    check_next(320, all);
+
+    // seek to the start of a row group.
+    ASSERT_TRUE(adapter.seek_to_row(4000).ok());
+    check_next(4000, [](size_t i) { return i >= 99; });
+}
+
 } // namespace starrocks::vectorized
@@ -630,6 +630,105 @@ TEST_F(AggregateTest, test_sum_distinct) {
                                                       DecimalV2Value(21));
 }
 
+TEST_F(AggregateTest, test_count_distinct_v2) {
+    const AggregateFunction* func =
+            get_aggregate_function("multi_distinct_count", TYPE_SMALLINT, TYPE_BIGINT, false, 2);
+    test_agg_function<int16_t, int64_t>(ctx, func, 1024, 1000, 2024);
+
+    func = get_aggregate_function("multi_distinct_count", TYPE_BIGINT, TYPE_BIGINT, false, 2);
+    test_agg_function<int64_t, int64_t>(ctx, func, 1024, 1000, 2024);
+
+    func = get_aggregate_function("multi_distinct_count", TYPE_LARGEINT, TYPE_BIGINT, false, 2);
+    test_agg_function<int128_t, int64_t>(ctx, func, 1024, 1000, 2024);
+
+    func = get_aggregate_function("multi_distinct_count", TYPE_DOUBLE, TYPE_BIGINT, false, 2);
+    test_agg_function<double, int64_t>(ctx, func, 1024, 1000, 2024);
+
+    func = get_aggregate_function("multi_distinct_count", TYPE_VARCHAR, TYPE_BIGINT, false, 2);
+    test_agg_function<Slice, int64_t>(ctx, func, 3, 3, 6);
+
+    func = get_aggregate_function("multi_distinct_count", TYPE_DECIMALV2, TYPE_BIGINT, false, 2);
+    test_agg_function<DecimalV2Value, int64_t>(ctx, func, 3, 3, 5);
+
+    func = get_aggregate_function("multi_distinct_count", TYPE_DATE, TYPE_BIGINT, false, 2);
+    test_agg_function<DateValue, int64_t>(ctx, func, 20, 21, 40);
+}
+
+TEST_F(AggregateTest, test_sum_distinct_v2) {
+    const AggregateFunction* func = get_aggregate_function("multi_distinct_sum", TYPE_INT, TYPE_BIGINT, false, 2);
+    test_agg_function<int32_t, int64_t>(ctx, func, 523776, 2499500, 3023276);
+
+    func = get_aggregate_function("multi_distinct_sum", TYPE_DOUBLE, TYPE_DOUBLE, false, 2);
+    test_agg_function<double, double>(ctx, func, 523776, 2499500, 3023276);
+
+    func = get_aggregate_function("multi_distinct_sum", TYPE_DECIMALV2, TYPE_DECIMALV2, false, 2);
+    test_agg_function<DecimalV2Value, DecimalV2Value>(ctx, func, DecimalV2Value(6), DecimalV2Value(18),
+                                                      DecimalV2Value(21));
+}
+
+// The distinct values of all the groups are kept in one hash set of the function context.
+TEST_F(AggregateTest, test_group_distinct) {
+    const AggregateFunction* count_func =
+            get_aggregate_function("multi_distinct_count", TYPE_INT, TYPE_BIGINT, false, 2);
+    const AggregateFunction* sum_func = get_aggregate_function("multi_distinct_sum", TYPE_INT, TYPE_BIGINT, false, 2);
+    const size_t num_groups = 100;
+
+    std::vector<std::unique_ptr<ManagedAggregateState>> count_states;
+    std::vector<std::unique_ptr<ManagedAggregateState>> sum_states;
+    std::vector<AggDataPtr> count_ptrs;
+    std::vector<AggDataPtr> sum_ptrs;
+    for (size_t i = 0; i < num_groups; i++) {
+        count_states.emplace_back(ManagedAggregateState::Make(count_func));
+        sum_states.emplace_back(ManagedAggregateState::Make(sum_func));
+    }
+
+    // row i is in group i % num_groups, with value i % 1000, so each group has 10 distinct values
+    auto column = Int32Column::create();
+    for (size_t i = 0; i < 4000; i++) {
+        column->append(i % 1000);
+        count_ptrs.emplace_back(count_states[i % num_groups]->mutable_data());
+        sum_ptrs.emplace_back(sum_states[i % num_groups]->mutable_data());
+    }
+    const Column* row_column = column.get();
+    count_func->update_batch(ctx, column->size(), 0, &row_column, count_ptrs.data());
+    sum_func->update_batch(ctx, column->size(), 0, &row_column, sum_ptrs.data());
+
+    auto count_result = Int64Column::create();
+    auto sum_result = Int64Column::create();
+    for (size_t g = 0; g < num_groups; g++) {
+        count_func->finalize_to_column(ctx, count_states[g]->data(), count_result.get());
+        sum_func->finalize_to_column(ctx, sum_states[g]->data(), sum_result.get());
+        ASSERT_EQ(10, count_result->get_data()[g]);
+        // g + (g + 100) + ... + (g + 900)
+        ASSERT_EQ(static_cast<int64_t>(10 * g + 4500), sum_result->get_data()[g]);
+    }
+
+    // serialize the groups and merge them into the groups in reversed order
+    auto serde_column = BinaryColumn::create();
+    for (size_t g = 0; g < num_groups; g++) {
+        count_func->serialize_to_column(ctx, count_states[g]->data(), serde_column.get());
+    }
+    for (size_t g = 0; g < num_groups; g++) {
+        count_func->merge(ctx, serde_column.get(), count_states[num_groups - 1 - g]->mutable_data(), g);
+    }
+    // merge the single values from convert_to_serialize_format into group 0
+    ColumnPtr single_values = BinaryColumn::create();
+    count_func->convert_to_serialize_format({column}, column->size(), &single_values);
+    for (size_t i = 0; i < single_values->size(); i++) {
+        count_func->merge(ctx, single_values.get(), count_states[0]->mutable_data(), i);
+    }
+
+    count_result = Int64Column::create();
+    for (size_t g = 0; g < num_groups; g++) {
+        count_func->finalize_to_column(ctx, count_states[g]->data(), count_result.get());
+    }
+    ASSERT_EQ(1000, count_result->get_data()[0]);
+    for (size_t g = 1; g < num_groups; g++) {
+        size_t other = num_groups - 1 - g;
+        ASSERT_EQ(g == other ? 10 : 20, count_result->get_data()[g]);
+    }
+}
+
 TEST_F(AggregateTest, test_dict_merge) {
     const AggregateFunction* func = get_aggregate_function("dict_merge", TYPE_ARRAY, TYPE_VARCHAR, false);
     ColumnBuilder<TYPE_VARCHAR> builder;
@@ -612,5 +612,58 @@ TEST_F(VectorizedArithmeticExprTest, constModN128Expr) {
     }
 }
 
+TEST_F(VectorizedArithmeticExprTest, fusedExpr) {
+    expr_node.type = gen_type_desc(TPrimitiveType::INT);
+    // (col1 * col2) + col3, evaluated with more rows than a tile
+    expr_node.opcode = TExprOpcode::MULTIPLY;
+    std::unique_ptr<Expr> mul(VectorizedArithmeticExprFactory::from_thrift(expr_node));
+    expr_node.opcode = TExprOpcode::ADD;
+    std::unique_ptr<Expr> add(VectorizedArithmeticExprFactory::from_thrift(expr_node));
+
+    MockNullVectorizedExpr<TYPE_INT> col1(expr_node, 1000, 2);
+    MockConstVectorizedExpr<TYPE_INT> col2(expr_node, 3);
+    MockVectorizedExpr<TYPE_INT> col3(expr_node, 1000, 4);
+
+    mul->_children.push_back(&col1);
+    mul->_children.push_back(&col2);
+    add->_children.push_back(mul.get());
+    add->_children.push_back(&col3);
+
+    {
+        ColumnPtr ptr = add->evaluate(nullptr, nullptr);
+        ASSERT_TRUE(ptr->is_nullable());
+        ASSERT_EQ(1000, ptr->size());
+
+        auto v = ColumnHelper::cast_to_raw<TYPE_INT>(ColumnHelper::as_raw_column<NullableColumn>(ptr)->data_column());
+        for (int j = 0; j < ptr->size(); ++j) {
+            ASSERT_EQ(j % 2 == 1, ptr->is_null(j));
+            if (!ptr->is_null(j)) {
+                ASSERT_EQ(10, v->get_data()[j]);
+            }
+        }
+    }
+
+    // only null leaf
+    {
+        MockNullVectorizedExpr<TYPE_INT> only_null(expr_node, 1000, 2, true);
+        mul->_children[0] = &only_null;
+        ColumnPtr ptr = add->evaluate(nullptr, nullptr);
+        ASSERT_EQ(1000, ptr->size());
+        for (int j = 0; j < ptr->size(); ++j) {
+            ASSERT_TRUE(ptr->is_null(j));
+        }
+    }
+
+    // all the leaves are const
+    {
+        MockConstVectorizedExpr<TYPE_INT> col4(expr_node, 5);
+        mul->_children[0] = &col2;
+        add->_children[1] = &col4;
+        ColumnPtr ptr = add->evaluate(nullptr, nullptr);
+        ASSERT_TRUE(ptr->is_constant());
+        ASSERT_EQ(14, ColumnHelper::get_const_value<TYPE_INT>(ptr));
+    }
+}
+
 } // namespace vectorized
 } // namespace starrocks
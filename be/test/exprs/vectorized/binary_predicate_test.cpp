@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 
 #include "column/fixed_length_column.h"
+#include "exprs/vectorized/arithmetic_expr.h"
 #include "exprs/vectorized/mock_vectorized_expr.h"
 
 namespace starrocks {
@@ -534,5 +535,37 @@ TEST_F(VectorizedBinaryPredicateStringTest, nullEqExpr) {
     }
 }
 
+TEST_F(VectorizedBinaryPredicateTest, fusedExpr) {
+    TExprNode arithmetic_node = expr_node;
+    arithmetic_node.opcode = TExprOpcode::ADD;
+    arithmetic_node.type = gen_type_desc(TPrimitiveType::INT);
+    std::unique_ptr<Expr> add(VectorizedArithmeticExprFactory::from_thrift(arithmetic_node));
+
+    expr_node.opcode = TExprOpcode::GT;
+    std::unique_ptr<Expr> expr(VectorizedBinaryPredicateFactory::from_thrift(expr_node));
+
+    MockNullVectorizedExpr<TYPE_INT> col1(arithmetic_node, 1000, 2);
+    MockVectorizedExpr<TYPE_INT> col2(arithmetic_node, 1000, 3);
+    MockConstVectorizedExpr<TYPE_INT> col3(arithmetic_node, 4);
+
+    // col1 + col2 > col3
+    add->_children.push_back(&col1);
+    add->_children.push_back(&col2);
+    expr->_children.push_back(add.get());
+    expr->_children.push_back(&col3);
+
+    ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+    ASSERT_TRUE(ptr->is_nullable());
+    ASSERT_EQ(1000, ptr->size());
+
+    auto v = ColumnHelper::cast_to_raw<TYPE_BOOLEAN>(ColumnHelper::as_raw_column<NullableColumn>(ptr)->data_column());
+    for (int j = 0; j < ptr->size(); ++j) {
+        ASSERT_EQ(j % 2 == 1, ptr->is_null(j));
+        if (!ptr->is_null(j)) {
+            ASSERT_EQ(1, v->get_data()[j]);
+        }
+    }
+}
+
 } // namespace vectorized
 } // namespace starrocks
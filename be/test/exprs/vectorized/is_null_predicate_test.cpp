@@ -9,6 +9,7 @@
 
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
+#include "exprs/vectorized/arithmetic_expr.h"
 #include "exprs/vectorized/mock_vectorized_expr.h"
 
 namespace starrocks {
@@ -179,5 +180,29 @@ TEST_F(VectorizedIsNullExprTest, isNotNullTest) {
         ASSERT_TRUE(v);
     }
 }
+TEST_F(VectorizedIsNullExprTest, fusedIsNullTest) {
+    TExprNode arithmetic_node = expr_node;
+    arithmetic_node.opcode = TExprOpcode::MULTIPLY;
+    std::unique_ptr<Expr> mul(VectorizedArithmeticExprFactory::from_thrift(arithmetic_node));
+
+    expr_node.fn.name.function_name = "is_not_null_pred";
+    auto expr = std::unique_ptr<Expr>(VectorizedIsNullPredicateFactory::from_thrift(expr_node));
+
+    MockNullVectorizedExpr<TYPE_BIGINT> col1(arithmetic_node, 1000, 10);
+    MockVectorizedExpr<TYPE_BIGINT> col2(arithmetic_node, 1000, 20);
+
+    // (col1 * col2) IS NOT NULL
+    mul->_children.push_back(&col1);
+    mul->_children.push_back(&col2);
+    expr->_children.push_back(mul.get());
+
+    ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+    ASSERT_EQ(1000, ptr->size());
+    auto v = ColumnHelper::cast_to_raw<TYPE_BOOLEAN>(ptr);
+    for (int j = 0; j < ptr->size(); ++j) {
+        ASSERT_EQ(j % 2 == 0, v->get_data()[j]);
+    }
+}
+
 } // namespace vectorized
 } // namespace starrocks
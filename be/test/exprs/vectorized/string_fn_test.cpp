@@ -840,6 +840,79 @@ PARALLEL_TEST(VecStringFunctionsTest, startsWithNullTest) {
     }
 }
 
+PARALLEL_TEST(VecStringFunctionsTest, matchAnyMatchAllConstQueryTest) {
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    auto str = BinaryColumn::create();
+    str->append("GET /api/v1/Users?id=42");
+    str->append("POST /api/v2/orders");
+    str->append("get users");
+    str->append("");
+    auto query = BinaryColumn::create();
+    query->append("users GET");
+
+    Columns columns;
+    columns.emplace_back(str);
+    columns.emplace_back(ConstColumn::create(query, str->size()));
+
+    auto any = ColumnHelper::cast_to<TYPE_BOOLEAN>(StringFunctions::match_any(ctx.get(), columns));
+    ASSERT_EQ(4, any->size());
+    ASSERT_TRUE(any->get_data()[0]);
+    ASSERT_FALSE(any->get_data()[1]);
+    ASSERT_TRUE(any->get_data()[2]);
+    ASSERT_FALSE(any->get_data()[3]);
+
+    auto all = ColumnHelper::cast_to<TYPE_BOOLEAN>(StringFunctions::match_all(ctx.get(), columns));
+    ASSERT_EQ(4, all->size());
+    ASSERT_TRUE(all->get_data()[0]);
+    ASSERT_FALSE(all->get_data()[1]);
+    ASSERT_TRUE(all->get_data()[2]);
+    ASSERT_FALSE(all->get_data()[3]);
+}
+
+PARALLEL_TEST(VecStringFunctionsTest, matchAnyMatchAllNullTest) {
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    auto str = BinaryColumn::create();
+    auto query = BinaryColumn::create();
+    auto null = NullColumn::create();
+    // a query of row 2 has no term, so it matches nothing
+    str->append("error: disk full");
+    query->append("disk,error");
+    null->append(false);
+    str->append("error: disk full");
+    query->append("disk memory");
+    null->append(false);
+    str->append("error: disk full");
+    query->append(" ?! ");
+    null->append(false);
+    str->append("error: disk full");
+    query->append("disk");
+    null->append(true);
+
+    Columns columns;
+    columns.emplace_back(str);
+    columns.emplace_back(NullableColumn::create(query, null));
+
+    ColumnPtr any = StringFunctions::match_any(ctx.get(), columns);
+    ASSERT_EQ(4, any->size());
+    ASSERT_TRUE(any->is_nullable());
+    auto any_data =
+            ColumnHelper::cast_to<TYPE_BOOLEAN>(ColumnHelper::as_raw_column<NullableColumn>(any)->data_column());
+    ASSERT_TRUE(any_data->get_data()[0]);
+    ASSERT_TRUE(any_data->get_data()[1]);
+    ASSERT_FALSE(any_data->get_data()[2]);
+    ASSERT_TRUE(any->is_null(3));
+
+    ColumnPtr all = StringFunctions::match_all(ctx.get(), columns);
+    ASSERT_EQ(4, all->size());
+    ASSERT_TRUE(all->is_nullable());
+    auto all_data =
+            ColumnHelper::cast_to<TYPE_BOOLEAN>(ColumnHelper::as_raw_column<NullableColumn>(all)->data_column());
+    ASSERT_TRUE(all_data->get_data()[0]);
+    ASSERT_FALSE(all_data->get_data()[1]);
+    ASSERT_FALSE(all_data->get_data()[2]);
+    ASSERT_TRUE(all->is_null(3));
+}
+
 PARALLEL_TEST(VecStringFunctionsTest, endsWithNullTest) {
     std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
     Columns columns;
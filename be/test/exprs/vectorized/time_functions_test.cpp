@@ -711,6 +711,10 @@ TEST_F(TimeFunctionsTest, toUnixFromDatetime) {
 
         columns.emplace_back(tc1);
 
+        ASSERT_TRUE(TimeFunctions::unix_timestamp_prepare(_utils->get_fn_ctx(),
+                                                          FunctionContext::FunctionStateScope::FRAGMENT_LOCAL)
+                            .ok());
+
         ColumnPtr result = TimeFunctions::to_unix_from_datetime(_utils->get_fn_ctx(), columns);
 
         ASSERT_TRUE(result->is_numeric());
@@ -718,6 +722,10 @@ TEST_F(TimeFunctionsTest, toUnixFromDatetime) {
         auto v = ColumnHelper::cast_to<TYPE_INT>(result);
         ASSERT_EQ(24 * 60 * 60, v->get_data()[0]);
         ASSERT_EQ(1565080737, v->get_data()[1]);
+
+        ASSERT_TRUE(TimeFunctions::unix_timestamp_close(_utils->get_fn_ctx(),
+                                                        FunctionContext::FunctionStateScope::FRAGMENT_LOCAL)
+                            .ok());
     }
 }
 
@@ -731,6 +739,10 @@ TEST_F(TimeFunctionsTest, toUnixFromDate) {
 
         columns.emplace_back(tc1);
 
+        ASSERT_TRUE(TimeFunctions::unix_timestamp_prepare(_utils->get_fn_ctx(),
+                                                          FunctionContext::FunctionStateScope::FRAGMENT_LOCAL)
+                            .ok());
+
         ColumnPtr result = TimeFunctions::to_unix_from_date(_utils->get_fn_ctx(), columns);
 
         ASSERT_TRUE(result->is_numeric());
@@ -738,6 +750,10 @@ TEST_F(TimeFunctionsTest, toUnixFromDate) {
         auto v = ColumnHelper::cast_to<TYPE_INT>(result);
         ASSERT_EQ(8 * 60 * 60, v->get_data()[0]);
         ASSERT_EQ(32 * 60 * 60, v->get_data()[1]);
+
+        ASSERT_TRUE(TimeFunctions::unix_timestamp_close(_utils->get_fn_ctx(),
+                                                        FunctionContext::FunctionStateScope::FRAGMENT_LOCAL)
+                            .ok());
     }
 }
 
@@ -755,6 +771,10 @@ TEST_F(TimeFunctionsTest, toUnixFromDatetimeWithFormat) {
         columns.emplace_back(tc1);
         columns.emplace_back(tc2);
 
+        ASSERT_TRUE(TimeFunctions::unix_timestamp_prepare(_utils->get_fn_ctx(),
+                                                          FunctionContext::FunctionStateScope::FRAGMENT_LOCAL)
+                            .ok());
+
         ColumnPtr result = TimeFunctions::to_unix_from_datetime_with_format(_utils->get_fn_ctx(), columns);
 
         ASSERT_TRUE(result->is_numeric());
@@ -762,6 +782,10 @@ TEST_F(TimeFunctionsTest, toUnixFromDatetimeWithFormat) {
         auto v = ColumnHelper::cast_to<TYPE_INT>(result);
         ASSERT_EQ(1565080737, v->get_data()[0]);
         ASSERT_EQ(1565080738, v->get_data()[1]);
+
+        ASSERT_TRUE(TimeFunctions::unix_timestamp_close(_utils->get_fn_ctx(),
+                                                        FunctionContext::FunctionStateScope::FRAGMENT_LOCAL)
+                            .ok());
     }
 }
 
@@ -776,6 +800,10 @@ TEST_F(TimeFunctionsTest, fromUnixToDatetime) {
 
         columns.emplace_back(tc1);
 
+        ASSERT_TRUE(TimeFunctions::from_unix_prepare(_utils->get_fn_ctx(),
+                                                     FunctionContext::FunctionStateScope::FRAGMENT_LOCAL)
+                            .ok());
+
         ColumnPtr result = TimeFunctions::from_unix_to_datetime(_utils->get_fn_ctx(), columns);
 
         //ASSERT_TRUE(result->is_numeric());
@@ -784,6 +812,10 @@ TEST_F(TimeFunctionsTest, fromUnixToDatetime) {
         ASSERT_EQ("2019-08-06 01:38:57", v->get_data()[0]);
         ASSERT_EQ("2019-08-06 01:39:57", v->get_data()[1]);
         ASSERT_EQ("2019-08-06 02:38:57", v->get_data()[2]);
+
+        ASSERT_TRUE(TimeFunctions::from_unix_close(_utils->get_fn_ctx(),
+                                                   FunctionContext::FunctionStateScope::FRAGMENT_LOCAL)
+                            .ok());
     }
 }
 
@@ -1364,6 +1396,74 @@ TEST_F(TimeFunctionsTest, date_fomrat) {
     }
 }
 
+TEST_F(TimeFunctionsTest, date_format_of_compiled_format) {
+    FunctionContext* ctx = FunctionContext::create_test_context();
+    auto ptr = std::unique_ptr<FunctionContext>(ctx);
+
+    auto dt_col = TimestampColumn::create();
+    for (int i = 0; i < 1000; ++i) {
+        // every 7 hours, 11 minutes and 13.017 seconds since 2019-12-20
+        TimestampValue ts = TimestampValue::create(2019, 12, 20, 0, 0, 0).add<TimeUnit::SECOND>(i * 25873);
+        dt_col->append(ts.add<TimeUnit::MICROSECOND>(i * 17000));
+    }
+    const char* formats[] = {"%a %b %c %D %e %f %h %I %j %k %l %M %p",
+                             "%r %S %s %T %U %u %V %v %W %w %X %x %y %Y",
+                             "%Y/%m/%d %H.%i.%s %%",
+                             "[%q%%%"};
+    for (const char* fmt : formats) {
+        // the compiled format of the const column gives the same result as the non-const one.
+        Columns const_columns{dt_col, ColumnHelper::create_const_column<TYPE_VARCHAR>(Slice(fmt), dt_col->size())};
+        ctx->impl()->set_constant_columns(const_columns);
+        TimeFunctions::format_prepare(ctx, FunctionContext::FunctionStateScope::FRAGMENT_LOCAL);
+        ColumnPtr result = TimeFunctions::datetime_format(ctx, const_columns);
+        TimeFunctions::format_close(ctx, FunctionContext::FunctionStateScope::FRAGMENT_LOCAL);
+
+        auto fmt_col = BinaryColumn::create();
+        for (int i = 0; i < dt_col->size(); ++i) {
+            fmt_col->append(Slice(fmt));
+        }
+        Columns columns{dt_col, fmt_col};
+        ctx->impl()->set_constant_columns(columns);
+        ColumnPtr expected = TimeFunctions::datetime_format(ctx, columns);
+
+        ASSERT_EQ(expected->size(), result->size());
+        for (int i = 0; i < expected->size(); ++i) {
+            ASSERT_EQ(expected->debug_item(i), result->debug_item(i)) << fmt;
+        }
+    }
+}
+
+TEST_F(TimeFunctionsTest, str_to_date_of_compiled_format) {
+    FunctionContext* ctx = FunctionContext::create_test_context();
+    auto ptr = std::unique_ptr<FunctionContext>(ctx);
+
+    const auto& varchar_type_desc = TypeDescriptor::create_varchar_type(TypeDescriptor::MAX_VARCHAR_LENGTH);
+    auto str_col = ColumnHelper::create_column(varchar_type_desc, true);
+    str_col->append_datum(Slice("20200229 235958"));
+    (void)str_col->append_nulls(1);
+    // not a leap year
+    str_col->append_datum(Slice("20210229 235958"));
+    str_col->append_datum(Slice("20201231 240000"));
+    // parsed by from_uncommon_format_str
+    str_col->append_datum(Slice("  2020121 1 0  "));
+
+    Columns columns;
+    columns.emplace_back(str_col);
+    columns.emplace_back(ColumnHelper::create_const_column<TYPE_VARCHAR>(Slice("%Y%m%d %H%i%s"), 1));
+    ctx->impl()->set_constant_columns(columns);
+    ASSERT_TRUE(TimeFunctions::str_to_date_prepare(ctx, FunctionContext::FunctionStateScope::FRAGMENT_LOCAL).ok());
+    ColumnPtr result = TimeFunctions::str_to_date(ctx, columns);
+    ASSERT_TRUE(TimeFunctions::str_to_date_close(ctx, FunctionContext::FunctionStateScope::FRAGMENT_LOCAL).ok());
+
+    NullableColumn::Ptr nullable_col = ColumnHelper::as_column<NullableColumn>(result);
+    ASSERT_EQ(5, nullable_col->size());
+    ASSERT_EQ(TimestampValue::create(2020, 2, 29, 23, 59, 58), nullable_col->get(0).get_timestamp());
+    ASSERT_TRUE(nullable_col->is_null(1));
+    ASSERT_TRUE(nullable_col->is_null(2));
+    ASSERT_TRUE(nullable_col->is_null(3));
+    ASSERT_EQ(TimestampValue::create(2020, 12, 1, 1, 0, 0), nullable_col->get(4).get_timestamp());
+}
+
 TEST_F(TimeFunctionsTest, daynameTest) {
     auto tc = TimestampColumn::create();
     tc->append(TimestampValue::create(2020, 1, 1, 21, 22, 1));
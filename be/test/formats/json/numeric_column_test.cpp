@@ -41,6 +41,39 @@ TEST_F(AddNumericColumnTest, test_add_string) {
     ASSERT_EQ("[3.14]", column->debug_string());
 }
 
+TEST_F(AddNumericColumnTest, test_add_int_string) {
+    auto column = FixedLengthColumn<int64_t>::create();
+    TypeDescriptor t(TYPE_BIGINT);
+
+    simdjson::ondemand::parser parser;
+    // the plain digits are parsed by the fast path, the others by StringParser.
+    auto json = R"(  [ "123", "-45", "1234567890123456789", " 7", "+8", "9.5" ]  )"_padded;
+    auto doc = parser.iterate(json);
+    for (auto element : doc.get_array()) {
+        simdjson::ondemand::value val = element.value();
+        auto st = add_numeric_column<int64_t>(column.get(), t, "f_bigint", &val);
+        ASSERT_TRUE(st.ok()) << st.to_string();
+    }
+
+    ASSERT_EQ("[123, -45, 1234567890123456789, 7, 8, 9]", column->debug_string());
+}
+
+TEST_F(AddNumericColumnTest, test_add_double_string) {
+    auto column = FixedLengthColumn<double>::create();
+    TypeDescriptor t(TYPE_DOUBLE);
+
+    simdjson::ondemand::parser parser;
+    auto json = R"(  [ "-2.25", "100", "1e3" ]  )"_padded;
+    auto doc = parser.iterate(json);
+    for (auto element : doc.get_array()) {
+        simdjson::ondemand::value val = element.value();
+        auto st = add_numeric_column<double>(column.get(), t, "f_double", &val);
+        ASSERT_TRUE(st.ok()) << st.to_string();
+    }
+
+    ASSERT_EQ("[-2.25, 100, 1000]", column->debug_string());
+}
+
 TEST_F(AddNumericColumnTest, test_add_invalid) {
     auto column = FixedLengthColumn<float>::create();
     TypeDescriptor t(TYPE_FLOAT);
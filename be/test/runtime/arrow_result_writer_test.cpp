@@ -0,0 +1,178 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "runtime/arrow_result_writer.h"
+
+#include <arrow/array.h>
+#include <arrow/buffer.h>
+#include <arrow/io/memory.h>
+#include <arrow/ipc/reader.h>
+#include <arrow/record_batch.h>
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/datum.h"
+#include "common/config.h"
+#include "exprs/expr_context.h"
+#include "exprs/slot_ref.h"
+#include "gen_cpp/InternalService_types.h"
+#include "runtime/buffer_control_block.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+class ArrowResultWriterTest : public testing::Test {
+public:
+    void SetUp() override {
+        _old_batch_max_rows = config::arrow_result_batch_max_rows;
+
+        TUniqueId fragment_id;
+        TQueryOptions query_options;
+        TQueryGlobals query_globals;
+        _state = std::make_shared<RuntimeState>(fragment_id, query_options, query_globals, nullptr);
+        _state->init_instance_mem_tracker();
+        _profile = std::make_unique<RuntimeProfile>("ArrowResultWriterTest");
+
+        _int_expr = std::make_unique<SlotRef>(TypeDescriptor(TYPE_INT), 0, 0);
+        _varchar_expr = std::make_unique<SlotRef>(TypeDescriptor(TYPE_VARCHAR), 0, 1);
+        _output_expr_ctxs.push_back(new ExprContext(_int_expr.get()));
+        _output_expr_ctxs.push_back(new ExprContext(_varchar_expr.get()));
+    }
+
+    void TearDown() override {
+        config::arrow_result_batch_max_rows = _old_batch_max_rows;
+        for (ExprContext* ctx : _output_expr_ctxs) {
+            delete ctx;
+        }
+    }
+
+protected:
+    // Row i in [begin, end) is (i, "s<i>") for even i and (i, NULL) for odd i.
+    vectorized::ChunkPtr _create_chunk(int32_t begin, int32_t end) {
+        auto int_column = vectorized::ColumnHelper::create_column(TypeDescriptor(TYPE_INT), false);
+        auto varchar_column = vectorized::ColumnHelper::create_column(TypeDescriptor(TYPE_VARCHAR), true);
+        std::vector<std::string> values;
+        for (int32_t i = begin; i < end; ++i) {
+            values.emplace_back("s" + std::to_string(i));
+        }
+        for (int32_t i = begin; i < end; ++i) {
+            int_column->append_datum(vectorized::Datum(i));
+            if (i % 2 == 0) {
+                varchar_column->append_datum(vectorized::Datum(Slice(values[i - begin])));
+            } else {
+                varchar_column->append_datum(vectorized::Datum());
+            }
+        }
+        auto chunk = std::make_shared<vectorized::Chunk>();
+        chunk->append_column(std::move(int_column), 0);
+        chunk->append_column(std::move(varchar_column), 1);
+        return chunk;
+    }
+
+    // Deserialize the arrow stream in |result| and check that it holds the rows [begin, end).
+    void _check_result(const TFetchDataResult& result, int32_t begin, int32_t end) {
+        ASSERT_EQ(1, result.result_batch.rows.size());
+        ASSERT_EQ(end - begin, result.result_batch.num_rows);
+
+        auto input = std::make_shared<arrow::io::BufferReader>(arrow::Buffer::FromString(result.result_batch.rows[0]));
+        auto reader_res = arrow::ipc::RecordBatchStreamReader::Open(input);
+        ASSERT_TRUE(reader_res.ok()) << reader_res.status().ToString();
+        auto reader = reader_res.ValueOrDie();
+
+        const auto& schema = reader->schema();
+        ASSERT_EQ(2, schema->num_fields());
+        ASSERT_TRUE(schema->field(0)->type()->Equals(arrow::int32()));
+        ASSERT_TRUE(schema->field(1)->type()->Equals(arrow::utf8()));
+
+        int32_t next = begin;
+        std::shared_ptr<arrow::RecordBatch> batch;
+        while (true) {
+            ASSERT_TRUE(reader->ReadNext(&batch).ok());
+            if (batch == nullptr) {
+                break;
+            }
+            auto int_array = std::static_pointer_cast<arrow::Int32Array>(batch->column(0));
+            auto string_array = std::static_pointer_cast<arrow::StringArray>(batch->column(1));
+            for (int64_t i = 0; i < batch->num_rows(); ++i, ++next) {
+                ASSERT_EQ(next, int_array->Value(i));
+                if (next % 2 == 0) {
+                    ASSERT_FALSE(string_array->IsNull(i));
+                    ASSERT_EQ("s" + std::to_string(next), string_array->GetString(i));
+                } else {
+                    ASSERT_TRUE(string_array->IsNull(i));
+                }
+            }
+        }
+        ASSERT_EQ(end, next);
+    }
+
+    int32_t _old_batch_max_rows = 0;
+    std::shared_ptr<RuntimeState> _state;
+    std::unique_ptr<RuntimeProfile> _profile;
+    std::unique_ptr<SlotRef> _int_expr;
+    std::unique_ptr<SlotRef> _varchar_expr;
+    std::vector<ExprContext*> _output_expr_ctxs;
+};
+
+TEST_F(ArrowResultWriterTest, append_and_close) {
+    config::arrow_result_batch_max_rows = 1024;
+    BufferControlBlock control_block(TUniqueId(), 1024);
+    ASSERT_TRUE(control_block.init().ok());
+
+    ArrowResultWriter writer(&control_block, _output_expr_ctxs, _profile.get());
+    ASSERT_TRUE(writer.init(_state.get()).ok());
+    // the chunks are packed into one stream until close
+    ASSERT_TRUE(writer.append_chunk(_create_chunk(0, 10).get()).ok());
+    ASSERT_TRUE(writer.append_chunk(_create_chunk(10, 25).get()).ok());
+    ASSERT_TRUE(writer.close().ok());
+    control_block.close(Status::OK());
+
+    TFetchDataResult result;
+    ASSERT_TRUE(control_block.get_batch(&result).ok());
+    ASSERT_FALSE(result.eos);
+    _check_result(result, 0, 25);
+
+    TFetchDataResult eos_result;
+    ASSERT_TRUE(control_block.get_batch(&eos_result).ok());
+    ASSERT_TRUE(eos_result.eos);
+}
+
+TEST_F(ArrowResultWriterTest, process_chunk_and_flush) {
+    config::arrow_result_batch_max_rows = 20;
+    BufferControlBlock control_block(TUniqueId(), 1024);
+    ASSERT_TRUE(control_block.init().ok());
+
+    ArrowResultWriter writer(&control_block, _output_expr_ctxs, _profile.get());
+    ASSERT_TRUE(writer.init(_state.get()).ok());
+
+    auto res = writer.process_chunk(_create_chunk(0, 10).get());
+    ASSERT_TRUE(res.ok());
+    ASSERT_EQ(nullptr, res.value());
+
+    // 20 rows are pending now, which reaches arrow_result_batch_max_rows
+    res = writer.process_chunk(_create_chunk(10, 20).get());
+    ASSERT_TRUE(res.ok());
+    TFetchDataResultPtr first = std::move(res.value());
+    ASSERT_NE(nullptr, first);
+    _check_result(*first, 0, 20);
+
+    auto add_res = writer.try_add_batch(first);
+    ASSERT_TRUE(add_res.ok());
+    ASSERT_TRUE(add_res.value());
+
+    res = writer.process_chunk(_create_chunk(20, 23).get());
+    ASSERT_TRUE(res.ok());
+    ASSERT_EQ(nullptr, res.value());
+    res = writer.flush();
+    ASSERT_TRUE(res.ok());
+    TFetchDataResultPtr second = std::move(res.value());
+    ASSERT_NE(nullptr, second);
+    _check_result(*second, 20, 23);
+
+    // nothing is pending after flush
+    res = writer.flush();
+    ASSERT_TRUE(res.ok());
+    ASSERT_EQ(nullptr, res.value());
+}
+
+} // namespace starrocks
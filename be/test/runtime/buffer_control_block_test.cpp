@@ -83,6 +83,35 @@ TEST_F(BufferControlBlockTest, get_add_after_cancel) {
     ASSERT_FALSE(control_block.get_batch(&get_result).ok());
 }
 
+TEST_F(BufferControlBlockTest, try_add_arrow_batch) {
+    BufferControlBlock control_block(TUniqueId(), 1024);
+    ASSERT_TRUE(control_block.init().ok());
+
+    // one arrow stream carries many rows, the buffer limit is accounted by num_rows
+    TFetchDataResult* add_result = new TFetchDataResult();
+    add_result->result_batch.rows.push_back("arrow stream1");
+    add_result->result_batch.__set_num_rows(1000);
+    auto st = control_block.try_add_batch(add_result);
+    ASSERT_TRUE(st.ok());
+    ASSERT_TRUE(st.value());
+
+    TFetchDataResult* add_result2 = new TFetchDataResult();
+    add_result2->result_batch.rows.push_back("arrow stream2");
+    add_result2->result_batch.__set_num_rows(1000);
+    st = control_block.try_add_batch(add_result2);
+    ASSERT_TRUE(st.ok());
+    ASSERT_FALSE(st.value());
+
+    TFetchDataResult get_result;
+    ASSERT_TRUE(control_block.get_batch(&get_result).ok());
+    ASSERT_EQ(1000, get_result.result_batch.num_rows);
+    ASSERT_STREQ("arrow stream1", get_result.result_batch.rows[0].c_str());
+
+    st = control_block.try_add_batch(add_result2);
+    ASSERT_TRUE(st.ok());
+    ASSERT_TRUE(st.value());
+}
+
 void* cancel_thread(void* param) {
     BufferControlBlock* control_block = static_cast<BufferControlBlock*>(param);
     sleep(1);
@@ -22,12 +22,24 @@
 #include "runtime/memory/chunk_allocator.h"
 
 #include <gtest/gtest.h>
+#include <pthread.h>
+#include <sched.h>
 
 #include "common/config.h"
+#include "runtime/current_thread.h"
 #include "runtime/memory/chunk.h"
+#include "util/cpu_info.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
+class CpuTestUtil {
+public:
+    static void init_fake_numa(int max_num_numa_nodes, const std::vector<int>& core_to_numa_node) {
+        CpuInfo::_init_fake_numa_for_test(max_num_numa_nodes, core_to_numa_node);
+    }
+};
+
 TEST(ChunkAllocatorTest, Normal) {
     config::use_mmap_allocate_chunk = true;
     for (size_t size = 4096; size <= 1024 * 1024; size <<= 1) {
@@ -38,4 +50,71 @@ TEST(ChunkAllocatorTest, Normal) {
         ChunkAllocator::instance()->free(chunk);
     }
 }
+
+TEST(ChunkAllocatorTest, NumaNode) {
+    // initialize CpuInfo
+    ChunkAllocator::instance();
+    int num_cores = CpuInfo::get_max_num_cores();
+    int core_id = CpuInfo::get_current_core();
+    cpu_set_t old_cpu_set;
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(core_id, &cpu_set);
+    // pin this thread to the current core, so that all the allocations are from the same core
+    if (num_cores < 2 || pthread_getaffinity_np(pthread_self(), sizeof(old_cpu_set), &old_cpu_set) != 0 ||
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0) {
+        LOG(WARNING) << "skip the test, cores: " << num_cores;
+        return;
+    }
+    // restore the global state even if an assertion fails
+    DeferOp restore_affinity([&] { pthread_setaffinity_np(pthread_self(), sizeof(old_cpu_set), &old_cpu_set); });
+
+    int old_num_nodes = CpuInfo::get_max_num_numa_nodes();
+    std::vector<int> old_nodes(num_cores);
+    for (int i = 0; i < num_cores; i++) {
+        old_nodes[i] = CpuInfo::get_numa_node_of_core(i);
+    }
+    // the current core is in node 0, and all the other cores are in node 1
+    std::vector<int> nodes(num_cores, 1);
+    nodes[core_id] = 0;
+    CpuTestUtil::init_fake_numa(2, nodes);
+    DeferOp restore_numa([&] { CpuTestUtil::init_fake_numa(old_num_nodes, old_nodes); });
+
+    bool old_use_mmap = config::use_mmap_allocate_chunk;
+    bool old_reuse_remote = config::reuse_remote_numa_node_memory;
+    DeferOp restore_config([&] {
+        config::use_mmap_allocate_chunk = old_use_mmap;
+        config::reuse_remote_numa_node_memory = old_reuse_remote;
+    });
+    config::use_mmap_allocate_chunk = false;
+    ChunkAllocator allocator(nullptr, 1024 * 1024);
+    int remote_core_id = (core_id + 1) % num_cores;
+    Chunk chunks[2];
+    for (auto& chunk : chunks) {
+        ASSERT_TRUE(allocator.allocate(4096, &chunk));
+        ASSERT_EQ(core_id, chunk.core_id);
+        // cached by the arena of the remote core
+        chunk.core_id = remote_core_id;
+        allocator.free(chunk);
+    }
+
+    int64_t remote_bytes = tls_thread_status.remote_numa_node_bytes();
+    config::reuse_remote_numa_node_memory = false;
+    Chunk local_chunk;
+    ASSERT_TRUE(allocator.allocate(4096, &local_chunk));
+    ASSERT_EQ(core_id, local_chunk.core_id);
+    ASSERT_NE(chunks[0].data, local_chunk.data);
+    ASSERT_NE(chunks[1].data, local_chunk.data);
+    ASSERT_EQ(remote_bytes, tls_thread_status.remote_numa_node_bytes());
+
+    config::reuse_remote_numa_node_memory = true;
+    Chunk remote_chunk;
+    ASSERT_TRUE(allocator.allocate(4096, &remote_chunk));
+    ASSERT_EQ(remote_core_id, remote_chunk.core_id);
+    ASSERT_TRUE(remote_chunk.data == chunks[0].data || remote_chunk.data == chunks[1].data);
+    ASSERT_EQ(remote_bytes + 4096, tls_thread_status.remote_numa_node_bytes());
+
+    allocator.free(local_chunk);
+    allocator.free(remote_chunk);
+}
 } // namespace starrocks
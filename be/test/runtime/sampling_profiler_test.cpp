@@ -0,0 +1,72 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "runtime/sampling_profiler.h"
+
+#include <gtest/gtest.h>
+#include <time.h>
+
+#include "runtime/current_thread.h"
+#include "util/uid_util.h"
+
+namespace starrocks {
+
+static int64_t thread_cpu_time_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+static void __attribute__((noinline)) burn_cpu(int64_t cpu_time_ns) {
+    int64_t deadline = thread_cpu_time_ns() + cpu_time_ns;
+    volatile uint64_t x = 0;
+    while (thread_cpu_time_ns() < deadline) {
+        for (int i = 0; i < 1000; ++i) {
+            x = x * 31 + i;
+        }
+    }
+}
+
+TEST(SamplingProfilerTest, test_sample_query_operator) {
+    auto* profiler = SamplingProfiler::instance();
+    TUniqueId query_id;
+    query_id.__set_hi(100);
+    query_id.__set_lo(200);
+    std::string operator_name = "hash_join_probe";
+
+    ASSERT_TRUE(profiler->start(1000).ok());
+    ASSERT_FALSE(profiler->start(1000).ok());
+    SamplingProfiler::maybe_update_current_thread();
+    tls_thread_status.set_query_id(query_id);
+    {
+        SCOPED_SAMPLING_OPERATOR(operator_name, 3);
+        burn_cpu(300 * 1000 * 1000L);
+    }
+    profiler->stop();
+    SamplingProfiler::maybe_update_current_thread();
+    SamplingProfiler::Samples samples;
+    profiler->collect(&samples);
+    tls_thread_status.set_query_id(TUniqueId());
+
+    int64_t num_samples = 0;
+    for (const auto& [key, count] : samples) {
+        ASSERT_EQ(print_id(query_id), key.query_id);
+        ASSERT_FALSE(key.frames.empty());
+        if (key.operator_name == "hash_join_probe (plan_node_id=3)") {
+            num_samples += count;
+        }
+    }
+    // The CPU timers expire at the ticks of the kernel, so there are less than 300 samples.
+    ASSERT_GT(num_samples, 10);
+
+    std::string folded_stacks = SamplingProfiler::to_folded_stacks(samples, [](uintptr_t) { return "f"; });
+    ASSERT_EQ(0, folded_stacks.find(print_id(query_id) + ";hash_join_probe (plan_node_id=3);f"));
+
+    // No more samples once stopped.
+    burn_cpu(20 * 1000 * 1000L);
+    samples.clear();
+    profiler->collect(&samples);
+    profiler->collect(&samples);
+    ASSERT_TRUE(samples.empty());
+}
+
+} // namespace starrocks
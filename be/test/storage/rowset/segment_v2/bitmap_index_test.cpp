@@ -32,6 +32,7 @@
 #include "storage/rowset/segment_v2/bitmap_index_reader.h"
 #include "storage/rowset/segment_v2/bitmap_index_writer.h"
 #include "storage/types.h"
+#include "storage/vectorized/column_predicate.h"
 #include "util/file_utils.h"
 
 namespace starrocks {
@@ -236,5 +237,66 @@ TEST_F(BitmapIndexTest, test_null) {
     delete[] val;
 }
 
+TEST_F(BitmapIndexTest, test_inverted_index) {
+    std::vector<std::string> strs{"GET /index.html 200", "POST /login 302", "GET /Login 200", "get /index.html 404",
+                                  "", "!!!"};
+    std::vector<Slice> values(strs.begin(), strs.end());
+
+    std::string file_name = kTestDir + "/inverted";
+    ColumnIndexMetaPB meta;
+    {
+        std::unique_ptr<fs::WritableBlock> wblock;
+        fs::CreateBlockOptions opts({file_name});
+        ASSERT_TRUE(_block_mgr->create_block(opts, &wblock).ok());
+
+        std::unique_ptr<BitmapIndexWriter> writer;
+        ASSERT_TRUE(BitmapIndexWriter::create_inverted(get_type_info(OLAP_FIELD_TYPE_VARCHAR), &writer).ok());
+        writer->add_values(values.data(), values.size());
+        writer->add_nulls(2);
+        ASSERT_TRUE(writer->finish(wblock.get(), &meta).ok());
+        ASSERT_EQ(INVERTED_INDEX, meta.type());
+        ASSERT_TRUE(wblock->close().ok());
+    }
+    {
+        auto reader = std::make_unique<BitmapIndexReader>();
+        ASSERT_TRUE(reader->load(_block_mgr, file_name, &meta.inverted_index(), true, false).ok());
+        BitmapIndexIterator* raw_iter = nullptr;
+        ASSERT_TRUE(reader->new_iterator(&raw_iter).ok());
+        std::unique_ptr<BitmapIndexIterator> iter(raw_iter);
+
+        // ["200", "302", "404", "get", "html", "index", "login", "post"] and the null bitmap
+        ASSERT_EQ(9, iter->bitmap_nums());
+        ASSERT_TRUE(iter->has_null_bitmap());
+
+        Slice term("index");
+        bool exact_match = false;
+        ASSERT_TRUE(iter->seek_dictionary(&term, &exact_match).ok());
+        ASSERT_TRUE(exact_match);
+        Roaring bitmap;
+        ASSERT_TRUE(iter->read_bitmap(iter->current_ordinal(), &bitmap).ok());
+        ASSERT_TRUE(Roaring::bitmapOf(2, 0, 3) == bitmap);
+
+        term = Slice("GET");
+        ASSERT_TRUE(iter->seek_dictionary(&term, &exact_match).ok());
+        ASSERT_FALSE(exact_match);
+
+        // the predicates are evaluated by the posting lists.
+        auto type_info = get_type_info(OLAP_FIELD_TYPE_VARCHAR);
+        auto check = [&](const std::string& query, bool match_all, const Roaring& expected) {
+            std::unique_ptr<vectorized::ColumnPredicate> pred(
+                    vectorized::new_column_match_predicate(type_info, 0, {query}, match_all));
+            Roaring rows;
+            ASSERT_TRUE(pred->seek_inverted_index(iter.get(), &rows).ok());
+            ASSERT_TRUE(expected == rows) << query << " " << match_all;
+        };
+        check("login 200", false, Roaring::bitmapOf(3, 0, 1, 2));
+        check("login 200", true, Roaring::bitmapOf(1, 2));
+        check("GET index", true, Roaring::bitmapOf(2, 0, 3));
+        check("GET nothing", true, Roaring());
+        check("nothing zzz", false, Roaring());
+        check("!!!", false, Roaring());
+    }
+}
+
 } // namespace segment_v2
 } // namespace starrocks
@@ -288,5 +288,56 @@ TEST_F(BloomFilterIndexReaderWriterTest, test_decimal) {
     delete[] val;
 }
 
+TEST_F(BloomFilterIndexReaderWriterTest, test_ngram) {
+    TypeInfoPtr type_info = get_type_info(OLAP_FIELD_TYPE_VARCHAR);
+    std::string fname = kTestDir + "/bloom_filter_ngram";
+    ColumnIndexMetaPB meta;
+    {
+        std::unique_ptr<fs::WritableBlock> wblock;
+        ASSERT_TRUE(_block_mgr->create_block(fs::CreateBlockOptions({fname}), &wblock).ok());
+        std::unique_ptr<BloomFilterIndexWriter> writer;
+        ASSERT_TRUE(BloomFilterIndexWriter::create_ngram(BloomFilterOptions(), 3, type_info, &writer).ok());
+        // page 0
+        std::vector<Slice> values{"connection timeout", "ok", "error_code=42"};
+        writer->add_values(values.data(), values.size());
+        ASSERT_TRUE(writer->flush().ok());
+        // page 1
+        values = {"request served"};
+        writer->add_values(values.data(), values.size());
+        writer->add_nulls(1);
+        ASSERT_TRUE(writer->flush().ok());
+        ASSERT_TRUE(writer->finish(wblock.get(), &meta).ok());
+        ASSERT_TRUE(wblock->close().ok());
+    }
+    ASSERT_EQ(NGRAM_BLOOM_FILTER_INDEX, meta.type());
+    ASSERT_EQ(3, meta.ngram_bloom_filter_index().gram_size());
+
+    BloomFilterIndexReader reader;
+    ASSERT_TRUE(reader.load(_block_mgr, fname, &meta.ngram_bloom_filter_index(), true, false).ok());
+    ASSERT_EQ(3, reader.gram_size());
+    std::unique_ptr<BloomFilterIndexIterator> iter;
+    ASSERT_TRUE(reader.new_iterator(&iter).ok());
+
+    std::unique_ptr<BloomFilter> bf;
+    ASSERT_TRUE(iter->read_bloom_filter(0, &bf).ok());
+    for (const char* gram : {"con", "out", "n t", "err", "=42"}) {
+        ASSERT_TRUE(bf->test_bytes(gram, 3)) << gram;
+    }
+    ASSERT_FALSE(bf->has_null());
+
+    ASSERT_TRUE(iter->read_bloom_filter(1, &bf).ok());
+    for (const char* gram : {"req", "st ", "ved"}) {
+        ASSERT_TRUE(bf->test_bytes(gram, 3)) << gram;
+    }
+    ASSERT_TRUE(bf->has_null());
+}
+
+TEST_F(BloomFilterIndexReaderWriterTest, test_ngram_not_supported_type) {
+    std::unique_ptr<BloomFilterIndexWriter> writer;
+    auto st = BloomFilterIndexWriter::create_ngram(BloomFilterOptions(), 3, get_type_info(OLAP_FIELD_TYPE_INT),
+                                                   &writer);
+    ASSERT_TRUE(st.is_not_supported());
+}
+
 } // namespace segment_v2
 } // namespace starrocks
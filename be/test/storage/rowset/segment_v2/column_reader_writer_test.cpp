@@ -31,9 +31,13 @@
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
 #include "env/env_memory.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
+#include "gen_cpp/Exprs_types.h"
 #include "gen_cpp/segment_v2.pb.h"
 #include "runtime/date_value.h"
 #include "runtime/mem_pool.h"
+#include "runtime/runtime_state.h"
 #include "storage/column_block.h"
 #include "storage/decimal12.h"
 #include "storage/field.h"
@@ -46,6 +50,8 @@
 #include "storage/tablet_schema_helper.h"
 #include "storage/types.h"
 #include "storage/vectorized/chunk_helper.h"
+#include "storage/vectorized/column_expr_predicate.h"
+#include "storage/vectorized/column_predicate.h"
 #include "storage/vectorized/range.h"
 
 using std::string;
@@ -723,4 +729,237 @@ TEST_F(ColumnReaderWriterTest, test_scalar_column_total_mem_footprint) {
     }
 }
 
+// The opened context of `slot LIKE pattern`, where the slot is a VARCHAR column.
+static ExprContext* create_like_expr_ctx(ObjectPool* pool, RuntimeState* state, const std::string& pattern) {
+    TExprNode like_node;
+    like_node.__set_node_type(TExprNodeType::FUNCTION_CALL);
+    like_node.__set_type(TypeDescriptor(TYPE_BOOLEAN).to_thrift());
+    like_node.__set_num_children(2);
+    TFunctionName fn_name;
+    fn_name.__set_function_name("like");
+    TFunction fn;
+    fn.__set_name(fn_name);
+    fn.__set_binary_type(TFunctionBinaryType::BUILTIN);
+    fn.__set_fid(60010);
+    like_node.__set_fn(fn);
+    like_node.__set_use_vectorized(true);
+
+    TExprNode slot_node;
+    slot_node.__set_node_type(TExprNodeType::SLOT_REF);
+    slot_node.__set_type(TypeDescriptor::create_varchar_type(TypeDescriptor::MAX_VARCHAR_LENGTH).to_thrift());
+    slot_node.__set_num_children(0);
+    TSlotRef slot_ref;
+    slot_ref.__set_slot_id(0);
+    slot_ref.__set_tuple_id(0);
+    slot_node.__set_slot_ref(slot_ref);
+    slot_node.__set_use_vectorized(true);
+
+    TExprNode pattern_node;
+    pattern_node.__set_node_type(TExprNodeType::STRING_LITERAL);
+    pattern_node.__set_type(TypeDescriptor::create_varchar_type(TypeDescriptor::MAX_VARCHAR_LENGTH).to_thrift());
+    pattern_node.__set_num_children(0);
+    TStringLiteral string_literal;
+    string_literal.__set_value(pattern);
+    pattern_node.__set_string_literal(string_literal);
+    pattern_node.__set_use_vectorized(true);
+
+    TExpr texpr;
+    texpr.__set_nodes({like_node, slot_node, pattern_node});
+    ExprContext* ctx = nullptr;
+    CHECK(Expr::create_expr_tree(pool, texpr, &ctx).ok());
+    CHECK(ctx->prepare(state, RowDescriptor()).ok());
+    CHECK(ctx->open(state).ok());
+    return ctx;
+}
+
+// NOLINTNEXTLINE
+TEST_F(ColumnReaderWriterTest, test_ngram_bloom_filter) {
+    ColumnMetaPB meta;
+    auto env = std::make_unique<EnvMemory>();
+    auto block_mgr = std::make_unique<fs::FileBlockManager>(env.get(), fs::BlockManagerOptions());
+    ASSERT_TRUE(env->create_dir(TEST_DIR).ok());
+    const std::string fname = strings::Substitute("$0/test_ngram_bloom_filter.data", TEST_DIR);
+
+    // page 0: rows [0, 2), page 1: rows [2, 4)
+    std::vector<std::vector<Slice>> pages = {{"connection timeout", "ok"}, {"request served", "error_code=42"}};
+    {
+        std::unique_ptr<fs::WritableBlock> wblock;
+        ASSERT_TRUE(block_mgr->create_block(fs::CreateBlockOptions({fname}), &wblock).ok());
+
+        ColumnWriterOptions writer_opts;
+        writer_opts.meta = &meta;
+        writer_opts.meta->set_column_id(0);
+        writer_opts.meta->set_unique_id(0);
+        writer_opts.meta->set_type(OLAP_FIELD_TYPE_VARCHAR);
+        writer_opts.meta->set_length(128);
+        writer_opts.meta->set_encoding(DICT_ENCODING);
+        writer_opts.meta->set_compression(starrocks::LZ4_FRAME);
+        writer_opts.meta->set_is_nullable(false);
+        writer_opts.ngram_bf_gram_size = 3;
+
+        TabletColumn column = create_varchar_key(1, false, 128);
+        std::unique_ptr<ColumnWriter> writer;
+        ASSERT_TRUE(ColumnWriter::create(writer_opts, &column, wblock.get(), &writer).ok());
+        ASSERT_TRUE(writer->init().ok());
+        for (const auto& values : pages) {
+            auto c = vectorized::BinaryColumn::create();
+            c->append_strings(values);
+            ASSERT_TRUE(writer->append(*c).ok());
+            ASSERT_TRUE(writer->finish_current_page().ok());
+        }
+        ASSERT_TRUE(writer->finish().ok());
+        ASSERT_TRUE(writer->write_data().ok());
+        ASSERT_TRUE(writer->write_ordinal_index().ok());
+        ASSERT_TRUE(writer->write_bloom_filter_index().ok());
+        ASSERT_TRUE(wblock->close().ok());
+    }
+
+    ColumnReaderOptions reader_opts;
+    reader_opts.storage_format_version = 2;
+    reader_opts.block_mgr = block_mgr.get();
+    auto res = ColumnReader::create(_tablet_meta_mem_tracker.get(), reader_opts, &meta, fname);
+    ASSERT_TRUE(res.ok());
+    auto reader = std::move(res).value();
+    ASSERT_TRUE(reader->has_ngram_bloom_filter_index());
+
+    ColumnIterator* iter = nullptr;
+    ASSERT_TRUE(reader->new_iterator(&iter).ok());
+    std::unique_ptr<ColumnIterator> guard(iter);
+    std::unique_ptr<fs::ReadableBlock> rblock;
+    ASSERT_TRUE(block_mgr->open_block(fname, &rblock).ok());
+    ColumnIteratorOptions iter_opts;
+    OlapReaderStatistics stats;
+    iter_opts.stats = &stats;
+    iter_opts.rblock = rblock.get();
+    ASSERT_TRUE(iter->init(iter_opts).ok());
+
+    RuntimeState state{TQueryGlobals()};
+    ObjectPool pool;
+    auto get_row_ranges = [&](const std::string& pattern) {
+        ExprContext* ctx = create_like_expr_ctx(&pool, &state, pattern);
+        vectorized::SparseRange row_ranges(0, 4);
+        {
+            vectorized::ColumnExprPredicate pred(get_type_info(OLAP_FIELD_TYPE_VARCHAR), 0, &state, ctx, nullptr);
+            CHECK(iter->get_row_ranges_by_bloom_filter({&pred}, &row_ranges).ok());
+        }
+        ctx->close(&state);
+        return row_ranges;
+    };
+
+    // "ser" and "ved" are missing in page 0
+    ASSERT_EQ(vectorized::SparseRange(2, 4), get_row_ranges("%served%"));
+    // "tim" and "out" are missing in page 1
+    ASSERT_EQ(vectorized::SparseRange(0, 2), get_row_ranges("%timeout"));
+    // "ode" is in page 1, but "con" is missing in page 1 and "ode" is missing in page 0
+    ASSERT_EQ(vectorized::SparseRange(), get_row_ranges("%con%ode%"));
+    // both pages contain "e", which is shorter than a gram
+    ASSERT_EQ(vectorized::SparseRange(0, 4), get_row_ranges("%e%"));
+}
+
+// NOLINTNEXTLINE
+TEST_F(ColumnReaderWriterTest, test_for_encoding_block_bounds) {
+    ColumnMetaPB meta;
+    auto env = std::make_unique<EnvMemory>();
+    auto block_mgr = std::make_unique<fs::FileBlockManager>(env.get(), fs::BlockManagerOptions());
+    ASSERT_TRUE(env->create_dir(TEST_DIR).ok());
+    const std::string fname = strings::Substitute("$0/test_for_encoding_block_bounds.data", TEST_DIR);
+
+    // 4 pages of 1024 ascending values, each page has 8 frames of 128 values.
+    const int num_pages = 4;
+    const int page_rows = 1024;
+    {
+        std::unique_ptr<fs::WritableBlock> wblock;
+        ASSERT_TRUE(block_mgr->create_block(fs::CreateBlockOptions({fname}), &wblock).ok());
+
+        ColumnWriterOptions writer_opts;
+        writer_opts.meta = &meta;
+        writer_opts.meta->set_column_id(0);
+        writer_opts.meta->set_unique_id(0);
+        writer_opts.meta->set_type(OLAP_FIELD_TYPE_INT);
+        writer_opts.meta->set_length(0);
+        writer_opts.meta->set_encoding(FOR_ENCODING);
+        writer_opts.meta->set_compression(starrocks::LZ4_FRAME);
+        writer_opts.meta->set_is_nullable(false);
+
+        TabletColumn column(OLAP_FIELD_AGGREGATION_NONE, OLAP_FIELD_TYPE_INT);
+        std::unique_ptr<ColumnWriter> writer;
+        ASSERT_TRUE(ColumnWriter::create(writer_opts, &column, wblock.get(), &writer).ok());
+        ASSERT_TRUE(writer->init().ok());
+        for (int page = 0; page < num_pages; ++page) {
+            auto col = vectorized::Int32Column::create();
+            for (int i = 0; i < page_rows; ++i) {
+                col->append(page * page_rows + i);
+            }
+            ASSERT_TRUE(writer->append(*col).ok());
+            ASSERT_TRUE(writer->finish_current_page().ok());
+        }
+        ASSERT_TRUE(writer->finish().ok());
+        ASSERT_TRUE(writer->write_data().ok());
+        ASSERT_TRUE(writer->write_ordinal_index().ok());
+        ASSERT_TRUE(wblock->close().ok());
+    }
+
+    std::unique_ptr<MemTracker> page_cache_mem_tracker = std::make_unique<MemTracker>();
+    StoragePageCache::create_global_cache(page_cache_mem_tracker.get(), 1000000000);
+    ColumnReaderOptions reader_opts;
+    reader_opts.storage_format_version = 2;
+    reader_opts.block_mgr = block_mgr.get();
+    auto res = ColumnReader::create(_tablet_meta_mem_tracker.get(), reader_opts, &meta, fname);
+    ASSERT_TRUE(res.ok());
+    auto reader = std::move(res).value();
+    ASSERT_EQ(num_pages * page_rows, reader->num_rows());
+
+    std::unique_ptr<fs::ReadableBlock> rblock;
+    ASSERT_TRUE(block_mgr->open_block(fname, &rblock).ok());
+    auto new_iterator = [&](bool use_page_cache, OlapReaderStatistics* stats) {
+        ColumnIterator* iter = nullptr;
+        CHECK(reader->new_iterator(&iter).ok());
+        ColumnIteratorOptions iter_opts;
+        iter_opts.stats = stats;
+        iter_opts.rblock = rblock.get();
+        iter_opts.use_page_cache = use_page_cache;
+        CHECK(iter->init(iter_opts).ok());
+        return std::unique_ptr<ColumnIterator>(iter);
+    };
+
+    // 1000 <= c < 1100, which spans the last frame of page 0 and the first frame of page 1.
+    auto type_info = get_type_info(OLAP_FIELD_TYPE_INT);
+    std::unique_ptr<vectorized::ColumnPredicate> ge(vectorized::new_column_ge_predicate(type_info, 0, "1000"));
+    std::unique_ptr<vectorized::ColumnPredicate> lt(vectorized::new_column_lt_predicate(type_info, 0, "1100"));
+    std::vector<const vectorized::ColumnPredicate*> preds{ge.get(), lt.get()};
+
+    OlapReaderStatistics stats;
+    auto iter = new_iterator(true, &stats);
+    vectorized::SparseRange row_ranges(0, num_pages * page_rows);
+    ASSERT_TRUE(iter->get_row_ranges_by_block_bounds(preds, &row_ranges).ok());
+    ASSERT_EQ(vectorized::SparseRange(896, 1152), row_ranges);
+
+    // the surviving rows hold all the rows matching the predicates.
+    auto col = vectorized::Int32Column::create();
+    ASSERT_TRUE(iter->seek_to_ordinal(row_ranges.begin()).ok());
+    ASSERT_TRUE(iter->next_batch(row_ranges, col.get()).ok());
+    ASSERT_EQ(row_ranges.span_size(), col->size());
+    std::vector<uint8_t> selection(col->size());
+    ge->evaluate(col.get(), selection.data(), 0, selection.size());
+    lt->evaluate_and(col.get(), selection.data(), 0, selection.size());
+    for (size_t i = 0; i < col->size(); ++i) {
+        int32_t value = col->get_data()[i];
+        ASSERT_EQ(static_cast<int32_t>(896 + i), value);
+        ASSERT_EQ(value >= 1000 && value < 1100, static_cast<bool>(selection[i]));
+    }
+
+    // a predicate that no frame matches prunes every row.
+    std::unique_ptr<vectorized::ColumnPredicate> gt(vectorized::new_column_gt_predicate(type_info, 0, "5000"));
+    row_ranges = vectorized::SparseRange(0, num_pages * page_rows);
+    ASSERT_TRUE(iter->get_row_ranges_by_block_bounds({gt.get()}, &row_ranges).ok());
+    ASSERT_TRUE(row_ranges.empty());
+
+    // nothing is pruned without page cache, since the pages would be read from disk twice.
+    OlapReaderStatistics no_cache_stats;
+    auto no_cache_iter = new_iterator(false, &no_cache_stats);
+    row_ranges = vectorized::SparseRange(0, num_pages * page_rows);
+    ASSERT_TRUE(no_cache_iter->get_row_ranges_by_block_bounds(preds, &row_ranges).ok());
+    ASSERT_EQ(vectorized::SparseRange(0, num_pages * page_rows), row_ranges);
+}
+
 } // namespace starrocks::segment_v2
@@ -23,11 +23,15 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <functional>
 #include <iostream>
+#include <set>
 
 #include "column/datum_tuple.h"
+#include "column/fixed_length_column.h"
 #include "common/logging.h"
+#include "common/object_pool.h"
 #include "env/env_memory.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/mem_pool.h"
@@ -44,6 +48,9 @@
 #include "storage/tablet_schema_helper.h"
 #include "storage/vectorized/chunk_helper.h"
 #include "storage/vectorized/chunk_iterator.h"
+#include "storage/vectorized/column_predicate.h"
+#include "storage/vectorized/column_predicate_rewriter.h"
+#include "storage/vectorized/predicate_tree.h"
 #include "util/file_utils.h"
 
 #define ASSERT_OK(expr)                                   \
@@ -496,5 +503,210 @@ TEST_F(SegmentReaderWriterTest, TestReadMultipleTypesColumn) {
     EXPECT_EQ(count, num_rows);
 }
 
+TEST_F(SegmentReaderWriterTest, TestBitmapIndexPredicateTree) {
+    // c1 = rid, c2 = 10000 - rid, both have bitmap index.
+    TabletColumn c1 = create_int_key(1, true, false, true);
+    TabletColumn c2 = create_int_value(2, OLAP_FIELD_AGGREGATION_NONE, true, "", false, true);
+    TabletSchema tablet_schema = create_schema({c1, c2});
+    size_t num_rows = 10000;
+    shared_ptr<Segment> segment;
+    build_segment(
+            SegmentWriterOptions(), tablet_schema, tablet_schema, num_rows,
+            [&](size_t rid, int cid, int block_id) {
+                return vectorized::Datum(static_cast<int32_t>(cid == 0 ? rid : num_rows - rid));
+            },
+            &segment);
+
+    // (c1 < 20 AND c2 > 9985) OR c2 = 100
+    auto type_info = get_type_info(OLAP_FIELD_TYPE_INT);
+    std::unique_ptr<vectorized::ColumnPredicate> lt(vectorized::new_column_lt_predicate(type_info, 0, "20"));
+    std::unique_ptr<vectorized::ColumnPredicate> gt(vectorized::new_column_gt_predicate(type_info, 1, "9985"));
+    std::unique_ptr<vectorized::ColumnPredicate> eq(vectorized::new_column_eq_predicate(type_info, 1, "100"));
+    std::vector<vectorized::PredicateTree> and_children{vectorized::PredicateTree(lt.get()),
+                                                        vectorized::PredicateTree(gt.get())};
+    std::vector<vectorized::PredicateTree> or_children{
+            vectorized::PredicateTree(vectorized::PredicateTree::Type::kAnd, std::move(and_children)),
+            vectorized::PredicateTree(eq.get())};
+    vectorized::PredicateTree tree(vectorized::PredicateTree::Type::kOr, std::move(or_children));
+    std::set<ColumnId> cids;
+    tree.get_column_ids(&cids);
+    ASSERT_EQ(2, cids.size());
+
+    auto read_c1 = [&](const vectorized::PredicateTree& pred_tree, OlapReaderStatistics* stats) {
+        vectorized::SegmentReadOptions seg_options;
+        seg_options.block_mgr = _block_mgr;
+        seg_options.stats = stats;
+        seg_options.predicate_trees.emplace_back(pred_tree);
+        auto schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema);
+        auto res = segment->new_iterator(schema, seg_options);
+        EXPECT_TRUE(res.ok());
+        auto seg_iterator = res.value();
+        auto chunk = vectorized::ChunkHelper::new_chunk(schema, config::vector_chunk_size);
+        std::vector<int32_t> values;
+        while (seg_iterator->get_next(chunk.get()).ok()) {
+            for (auto i = 0; i < chunk->num_rows(); ++i) {
+                values.emplace_back(chunk->get(i)[0].get_int32());
+            }
+            chunk->reset();
+        }
+        return values;
+    };
+
+    // rows 0~14 and 9900
+    OlapReaderStatistics stats;
+    std::vector<int32_t> values = read_c1(tree, &stats);
+    ASSERT_EQ(16, values.size());
+    for (int i = 0; i < 15; ++i) {
+        ASSERT_EQ(i, values[i]);
+    }
+    ASSERT_EQ(9900, values[15]);
+    ASSERT_EQ(num_rows - 16, stats.rows_bitmap_index_filtered);
+
+    // NE can't be evaluated by bitmap index, so the OR can't either, all rows are read.
+    std::unique_ptr<vectorized::ColumnPredicate> ne(vectorized::new_column_ne_predicate(type_info, 0, "1"));
+    std::vector<vectorized::PredicateTree> ne_children{vectorized::PredicateTree(eq.get()),
+                                                       vectorized::PredicateTree(ne.get())};
+    OlapReaderStatistics ne_stats;
+    values = read_c1(vectorized::PredicateTree(vectorized::PredicateTree::Type::kOr, std::move(ne_children)),
+                     &ne_stats);
+    ASSERT_EQ(num_rows, values.size());
+    ASSERT_EQ(0, ne_stats.rows_bitmap_index_filtered);
+}
+
+TEST_F(SegmentReaderWriterTest, TestInvertedIndexMatchPredicate) {
+    // c1 = rid, c2 = kTexts[rid % 4], the segments are built with and without the inverted index on c2.
+    const std::vector<std::string> kTexts = {"error: disk full", "Disk OK", "memory error", "ok"};
+    TabletColumn c1 = create_int_key(1);
+    TabletColumn c2 = create_varchar_key(2, false, 64);
+    TabletSchema plain_schema = create_schema({c1, c2});
+    c2.set_has_inverted_index(true);
+    TabletSchema tablet_schema = create_schema({c1, c2});
+    size_t num_rows = 10000;
+    auto generator = [&](size_t rid, int cid, int block_id) {
+        return cid == 0 ? vectorized::Datum(static_cast<int32_t>(rid))
+                        : vectorized::Datum(Slice(kTexts[rid % kTexts.size()]));
+    };
+    shared_ptr<Segment> indexed_segment;
+    build_segment(SegmentWriterOptions(), tablet_schema, tablet_schema, num_rows, generator, &indexed_segment);
+    shared_ptr<Segment> plain_segment;
+    build_segment(SegmentWriterOptions(), plain_schema, plain_schema, num_rows, generator, &plain_segment);
+
+    auto read_c1 = [&](const shared_ptr<Segment>& segment, const vectorized::ColumnPredicate* pred,
+                       OlapReaderStatistics* stats) {
+        vectorized::SegmentReadOptions seg_options;
+        seg_options.block_mgr = _block_mgr;
+        seg_options.stats = stats;
+        seg_options.predicates[1].push_back(pred);
+        auto schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema);
+        auto res = segment->new_iterator(schema, seg_options);
+        EXPECT_TRUE(res.ok());
+        auto seg_iterator = res.value();
+        auto chunk = vectorized::ChunkHelper::new_chunk(schema, config::vector_chunk_size);
+        std::vector<int32_t> values;
+        while (seg_iterator->get_next(chunk.get()).ok()) {
+            for (auto i = 0; i < chunk->num_rows(); ++i) {
+                values.emplace_back(chunk->get(i)[0].get_int32());
+            }
+            chunk->reset();
+        }
+        return values;
+    };
+    auto expected_c1 = [&](const std::vector<size_t>& matched_texts) {
+        std::vector<int32_t> values;
+        for (size_t rid = 0; rid < num_rows; ++rid) {
+            if (std::find(matched_texts.begin(), matched_texts.end(), rid % kTexts.size()) != matched_texts.end()) {
+                values.emplace_back(rid);
+            }
+        }
+        return values;
+    };
+
+    auto type_info = get_type_info(OLAP_FIELD_TYPE_VARCHAR);
+    std::unique_ptr<vectorized::ColumnPredicate> any(
+            vectorized::new_column_match_predicate(type_info, 1, {"DISK"}, false));
+    std::unique_ptr<vectorized::ColumnPredicate> all(
+            vectorized::new_column_match_predicate(type_info, 1, {"error disk"}, true));
+    std::unique_ptr<vectorized::ColumnPredicate> none(
+            vectorized::new_column_match_predicate(type_info, 1, {"disk memory"}, true));
+    for (auto& [pred, matched_texts] : std::vector<std::pair<const vectorized::ColumnPredicate*, std::vector<size_t>>>{
+                 {any.get(), {0, 1}}, {all.get(), {0}}, {none.get(), {}}}) {
+        std::vector<int32_t> expected = expected_c1(matched_texts);
+        // the posting lists answer the predicate
+        OlapReaderStatistics stats;
+        ASSERT_EQ(expected, read_c1(indexed_segment, pred, &stats));
+        ASSERT_EQ(num_rows - expected.size(), stats.rows_inverted_index_filtered);
+
+        // the values are tokenized without the index
+        OlapReaderStatistics plain_stats;
+        ASSERT_EQ(expected, read_c1(plain_segment, pred, &plain_stats));
+        ASSERT_EQ(0, plain_stats.rows_inverted_index_filtered);
+    }
+}
+
+TEST_F(SegmentReaderWriterTest, TestRewriteMatchPredicateToDictCode) {
+    const std::vector<std::string> kTexts = {"error: disk full", "Disk OK", "memory error", "ok"};
+    TabletColumn c1 = create_int_key(1);
+    TabletColumn c2 = create_varchar_key(2, false, 64);
+    TabletSchema tablet_schema = create_schema({c1, c2});
+    size_t num_rows = 1000;
+    shared_ptr<Segment> segment;
+    build_segment(
+            SegmentWriterOptions(), tablet_schema, tablet_schema, num_rows,
+            [&](size_t rid, int cid, int block_id) {
+                return cid == 0 ? vectorized::Datum(static_cast<int32_t>(rid))
+                                : vectorized::Datum(Slice(kTexts[rid % kTexts.size()]));
+            },
+            &segment);
+
+    std::unique_ptr<fs::ReadableBlock> rblock;
+    ASSERT_OK(_block_mgr->open_block(segment->file_name(), &rblock));
+    ColumnIterator* c2_iter = nullptr;
+    ASSERT_OK(segment->new_column_iterator(1, &c2_iter));
+    std::unique_ptr<ColumnIterator> c2_iter_guard(c2_iter);
+    OlapReaderStatistics stats;
+    ColumnIteratorOptions iter_opts;
+    iter_opts.stats = &stats;
+    iter_opts.rblock = rblock.get();
+    iter_opts.check_dict_encoding = true;
+    ASSERT_OK(c2_iter->init(iter_opts));
+    ASSERT_TRUE(c2_iter->all_page_dict_encoded());
+
+    vectorized::ColumnPredicateRewriter::ColumnIterators column_iterators{nullptr, c2_iter};
+    std::vector<uint8_t> need_rewrite{0, 1};
+    auto schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema, {1});
+    auto type_info = get_type_info(OLAP_FIELD_TYPE_VARCHAR);
+    ObjectPool pool;
+
+    // MATCH_ANY is rewritten to a predicate on the dict codes
+    std::unique_ptr<vectorized::ColumnPredicate> any(
+            vectorized::new_column_match_predicate(type_info, 1, {"disk"}, false));
+    vectorized::ColumnPredicateRewriter::PushDownPredicates predicates;
+    predicates[1].push_back(any.get());
+    vectorized::SparseRange scan_range(0, num_rows);
+    vectorized::ColumnPredicateRewriter(column_iterators, predicates, schema, need_rewrite, 1, scan_range)
+            .rewrite_predicate(&pool);
+    ASSERT_EQ(vectorized::SparseRange(0, num_rows), scan_range);
+    ASSERT_EQ(1, predicates[1].size());
+    const vectorized::ColumnPredicate* rewritten = predicates[1][0];
+    ASSERT_EQ(vectorized::PredicateType::kMap, rewritten->type());
+    auto codes = vectorized::Int32Column::create();
+    for (const auto& text : kTexts) {
+        int code = c2_iter->dict_lookup(Slice(text));
+        ASSERT_GE(code, 0);
+        codes->append(code);
+    }
+    std::vector<uint8_t> selection(codes->size());
+    rewritten->evaluate(codes.get(), selection.data(), 0, selection.size());
+    ASSERT_EQ(std::vector<uint8_t>({1, 1, 0, 0}), selection);
+
+    // no word of the dictionary matches, so no row is read
+    std::unique_ptr<vectorized::ColumnPredicate> all(
+            vectorized::new_column_match_predicate(type_info, 1, {"disk memory"}, true));
+    predicates[1] = {all.get()};
+    vectorized::ColumnPredicateRewriter(column_iterators, predicates, schema, need_rewrite, 1, scan_range)
+            .rewrite_predicate(&pool);
+    ASSERT_TRUE(scan_range.empty());
+}
+
 } // namespace segment_v2
 } // namespace starrocks
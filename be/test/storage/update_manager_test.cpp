@@ -145,6 +145,32 @@ TEST_F(UpdateManagerTest, testDelVec) {
     ASSERT_EQ(5, tmp->version());
 }
 
+TEST_F(UpdateManagerTest, testRunInParallel) {
+    ASSERT_TRUE(_update_manager->init().ok());
+    const size_t N = 1000;
+    std::vector<int> results(N, 0);
+    auto st = _update_manager->run_in_parallel(N, [&](size_t i) {
+        results[i]++;
+        return Status::OK();
+    });
+    ASSERT_TRUE(st.ok());
+    for (size_t i = 0; i < N; i++) {
+        ASSERT_EQ(1, results[i]);
+    }
+
+    // the first error is returned, and the other tasks are either run or skipped
+    std::atomic<size_t> num_run{0};
+    st = _update_manager->run_in_parallel(N, [&](size_t i) {
+        num_run++;
+        return i == 10 ? Status::InternalError("task failed") : Status::OK();
+    });
+    ASSERT_FALSE(st.ok());
+    ASSERT_NE(std::string::npos, st.to_string().find("task failed"));
+    ASSERT_LE(num_run, N);
+
+    ASSERT_TRUE(_update_manager->run_in_parallel(0, [](size_t i) { return Status::InternalError(""); }).ok());
+}
+
 TEST_F(UpdateManagerTest, testExpireEntry) {
     srand(time(NULL));
     create_tablet(rand(), rand());
@@ -4,8 +4,14 @@
 
 #include <vector>
 
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
+#include "gen_cpp/Exprs_types.h"
 #include "gtest/gtest.h"
+#include "runtime/runtime_state.h"
+#include "storage/rowset/segment_v2/bloom_filter.h"
 #include "storage/vectorized/chunk_helper.h"
+#include "storage/vectorized/column_expr_predicate.h"
 #include "storage/vectorized/column_or_predicate.h"
 
 namespace starrocks::vectorized {
@@ -1947,6 +1953,110 @@ TEST(ColumnPredicateTest, test_or) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST(ColumnPredicateTest, like_pattern_substrings) {
+    using Substrings = std::vector<std::string>;
+    ASSERT_EQ(Substrings({"abc"}), like_pattern_substrings("abc"));
+    ASSERT_EQ(Substrings({"abc", "de"}), like_pattern_substrings("%abc%de%"));
+    ASSERT_EQ(Substrings({"a", "bc"}), like_pattern_substrings("a_bc"));
+    ASSERT_EQ(Substrings({"a", "b"}), like_pattern_substrings("__a%%_b"));
+    ASSERT_EQ(Substrings({}), like_pattern_substrings("%_%"));
+    ASSERT_EQ(Substrings({}), like_pattern_substrings(""));
+    // the escaped wildcards and backslashes are literal chars
+    ASSERT_EQ(Substrings({"100%", "off"}), like_pattern_substrings("100\\%%off"));
+    ASSERT_EQ(Substrings({"a_b"}), like_pattern_substrings("a\\_b"));
+    ASSERT_EQ(Substrings({"a\\b"}), like_pattern_substrings("a\\\\b"));
+}
+
+// The opened context of `slot LIKE pattern`, where the slot is a VARCHAR column.
+static ExprContext* create_like_expr_ctx(ObjectPool* pool, RuntimeState* state, const std::string& pattern) {
+    TExprNode like_node;
+    like_node.__set_node_type(TExprNodeType::FUNCTION_CALL);
+    like_node.__set_type(TypeDescriptor(TYPE_BOOLEAN).to_thrift());
+    like_node.__set_num_children(2);
+    TFunctionName fn_name;
+    fn_name.__set_function_name("like");
+    TFunction fn;
+    fn.__set_name(fn_name);
+    fn.__set_binary_type(TFunctionBinaryType::BUILTIN);
+    fn.__set_fid(60010);
+    like_node.__set_fn(fn);
+    like_node.__set_use_vectorized(true);
+
+    TExprNode slot_node;
+    slot_node.__set_node_type(TExprNodeType::SLOT_REF);
+    slot_node.__set_type(TypeDescriptor::create_varchar_type(TypeDescriptor::MAX_VARCHAR_LENGTH).to_thrift());
+    slot_node.__set_num_children(0);
+    TSlotRef slot_ref;
+    slot_ref.__set_slot_id(0);
+    slot_ref.__set_tuple_id(0);
+    slot_node.__set_slot_ref(slot_ref);
+    slot_node.__set_use_vectorized(true);
+
+    TExprNode pattern_node;
+    pattern_node.__set_node_type(TExprNodeType::STRING_LITERAL);
+    pattern_node.__set_type(TypeDescriptor::create_varchar_type(TypeDescriptor::MAX_VARCHAR_LENGTH).to_thrift());
+    pattern_node.__set_num_children(0);
+    TStringLiteral string_literal;
+    string_literal.__set_value(pattern);
+    pattern_node.__set_string_literal(string_literal);
+    pattern_node.__set_use_vectorized(true);
+
+    TExpr texpr;
+    texpr.__set_nodes({like_node, slot_node, pattern_node});
+    ExprContext* ctx = nullptr;
+    CHECK(Expr::create_expr_tree(pool, texpr, &ctx).ok());
+    CHECK(ctx->prepare(state, RowDescriptor()).ok());
+    CHECK(ctx->open(state).ok());
+    return ctx;
+}
+
+// NOLINTNEXTLINE
+TEST(ColumnPredicateTest, ngram_bloom_filter_of_like) {
+    RuntimeState state{TQueryGlobals()};
+    ObjectPool pool;
+    const size_t gram_size = 3;
+
+    // the grams of "connection timeout"
+    std::unique_ptr<segment_v2::BloomFilter> bf;
+    ASSERT_TRUE(segment_v2::BloomFilter::create(segment_v2::BLOCK_BLOOM_FILTER, &bf).ok());
+    ASSERT_TRUE(bf->init(64, 0.01, segment_v2::HASH_MURMUR3_X64_64).ok());
+    std::string value = "connection timeout";
+    for (size_t pos = 0; pos + gram_size <= value.size(); ++pos) {
+        bf->add_bytes(value.data() + pos, gram_size);
+    }
+
+    std::vector<ExprContext*> ctxs;
+    auto new_like_predicate = [&](const std::string& pattern) {
+        ctxs.push_back(create_like_expr_ctx(&pool, &state, pattern));
+        return std::make_unique<ColumnExprPredicate>(get_type_info(OLAP_FIELD_TYPE_VARCHAR), 0, &state, ctxs.back(),
+                                                     nullptr);
+    };
+
+    auto p = new_like_predicate("%ction t%out");
+    ASSERT_TRUE(p->support_ngram_bloom_filter());
+    ASSERT_TRUE(p->ngram_bloom_filter(bf.get(), gram_size));
+
+    // "ser" and "ved" are not in the page.
+    p = new_like_predicate("%connection%served%");
+    ASSERT_TRUE(p->support_ngram_bloom_filter());
+    ASSERT_FALSE(p->ngram_bloom_filter(bf.get(), gram_size));
+
+    // the substrings shorter than a gram can't filter pages.
+    p = new_like_predicate("%xy_z%");
+    ASSERT_TRUE(p->support_ngram_bloom_filter());
+    ASSERT_TRUE(p->ngram_bloom_filter(bf.get(), gram_size));
+
+    // only wildcards
+    p = new_like_predicate("%_%");
+    ASSERT_FALSE(p->support_ngram_bloom_filter());
+
+    p.reset();
+    for (ExprContext* ctx : ctxs) {
+        ctx->close(&state);
+    }
+}
+
 #define ZMF(min, max) zone_map_filter(ZoneMapDetail(min, max))
 
 // NOLINTNEXTLINE
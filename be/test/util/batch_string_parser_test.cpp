@@ -0,0 +1,167 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "util/batch_string_parser.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace starrocks {
+
+class BatchStringParserTest : public testing::Test {
+protected:
+    void _add(const std::string& s) {
+        _bytes.insert(_bytes.end(), s.begin(), s.end());
+        _offsets.push_back(_bytes.size());
+        _strings.push_back(s);
+    }
+
+    void _clear() {
+        _bytes.clear();
+        _offsets.assign(1, 0);
+        _strings.clear();
+    }
+
+    // Check the results of the batch parsing are the same as StringParser's.
+    template <typename T>
+    void _check_ints() {
+        size_t num_rows = _strings.size();
+        std::vector<T> values(num_rows);
+        std::vector<uint8_t> nulls(num_rows);
+        BatchStringParser::parse_ints(_bytes.data(), _offsets.data(), num_rows, values.data(), nulls.data());
+        for (size_t i = 0; i < num_rows; ++i) {
+            StringParser::ParseResult result;
+            T expected = StringParser::string_to_int<T>(_strings[i].data(), _strings[i].size(), &result);
+            ASSERT_EQ(result != StringParser::PARSE_SUCCESS, nulls[i]) << _strings[i];
+            if (!nulls[i]) {
+                ASSERT_TRUE(expected == values[i]) << _strings[i];
+            }
+        }
+    }
+
+    template <typename T>
+    void _check_floats() {
+        size_t num_rows = _strings.size();
+        std::vector<T> values(num_rows);
+        std::vector<uint8_t> nulls(num_rows);
+        BatchStringParser::parse_floats(_bytes.data(), _offsets.data(), num_rows, values.data(), nulls.data());
+        for (size_t i = 0; i < num_rows; ++i) {
+            StringParser::ParseResult result;
+            T expected = StringParser::string_to_float<T>(_strings[i].data(), _strings[i].size(), &result);
+            bool is_null = result != StringParser::PARSE_SUCCESS || std::isnan(expected) || std::isinf(expected);
+            ASSERT_EQ(is_null, nulls[i]) << _strings[i];
+            if (!nulls[i]) {
+                // bitwise equal
+                ASSERT_EQ(0, memcmp(&expected, &values[i], sizeof(T))) << _strings[i];
+            }
+        }
+    }
+
+    std::vector<uint8_t> _bytes;
+    std::vector<uint32_t> _offsets{0};
+    std::vector<std::string> _strings;
+};
+
+TEST_F(BatchStringParserTest, test_is_all_digits) {
+    std::string s = "0123456789012345678901234567890123456789";
+    ASSERT_TRUE(BatchStringParser::is_all_digits(reinterpret_cast<const uint8_t*>(s.data()), s.size()));
+    ASSERT_TRUE(BatchStringParser::is_all_digits(nullptr, 0));
+    for (size_t i = 0; i < s.size(); ++i) {
+        for (char c : {'/', ':', ' ', '-', '\0', '\xff'}) {
+            std::string t = s;
+            t[i] = c;
+            ASSERT_FALSE(BatchStringParser::is_all_digits(reinterpret_cast<const uint8_t*>(t.data()), t.size()));
+        }
+    }
+}
+
+TEST_F(BatchStringParserTest, test_all_digits_column) {
+    for (int len = 1; len <= 18; ++len) {
+        _clear();
+        std::mt19937_64 rng(len);
+        for (int i = 0; i < 1000; ++i) {
+            std::string s;
+            for (int j = 0; j < len; ++j) {
+                s.push_back('0' + rng() % 10);
+            }
+            _add(s);
+        }
+        _check_ints<int8_t>();
+        _check_ints<int16_t>();
+        _check_ints<int32_t>();
+        _check_ints<int64_t>();
+        _check_ints<__int128>();
+    }
+}
+
+TEST_F(BatchStringParserTest, test_ints) {
+    for (const char* s : {"0", "-0", "1", "-1", "127", "-128", "128", "-129", "32767", "-32768", "99999",
+                          "2147483647", "-2147483648", "2147483648", "999999999", "-999999999",
+                          "9223372036854775807", "-9223372036854775808", "9223372036854775808", "00000000000000001",
+                          "+12", " 12", "12 ", "1a", "", "-", "1.5", "abc", "１２"}) {
+        _add(s);
+    }
+    _check_ints<int8_t>();
+    _check_ints<int16_t>();
+    _check_ints<int32_t>();
+    _check_ints<int64_t>();
+    _check_ints<__int128>();
+
+    int32_t v = 0;
+    ASSERT_TRUE(BatchStringParser::try_parse_int("-123456789", 10, &v));
+    ASSERT_EQ(-123456789, v);
+    ASSERT_FALSE(BatchStringParser::try_parse_int("1234567890", 10, &v));
+    ASSERT_FALSE(BatchStringParser::try_parse_int("12:4", 4, &v));
+}
+
+TEST_F(BatchStringParserTest, test_floats) {
+    for (const char* s : {"0", "-0", "0.0", "1.5", "-1.5", "3.14159", "0.1", "0.30000000000000004",
+                          "123456789012345.67", "1234567890123456", "9007199254740993", "0.0000000000000001",
+                          "1e10", "1.5E-3", "inf", "-nan", ".5", "5.", "1..2", "1.2.3", " 1.5", "1.5 ", "", "-",
+                          "abc", "1,5", "+1.5"}) {
+        _add(s);
+    }
+    std::mt19937_64 rng(0);
+    for (int i = 0; i < 10000; ++i) {
+        std::string s = rng() % 2 ? "-" : "";
+        int int_len = 1 + rng() % 18;
+        int frac_len = rng() % 18;
+        for (int j = 0; j < int_len; ++j) {
+            s.push_back('0' + rng() % 10);
+        }
+        if (frac_len > 0) {
+            s.push_back('.');
+            for (int j = 0; j < frac_len; ++j) {
+                s.push_back('0' + rng() % 10);
+            }
+        }
+        _add(s);
+    }
+    _check_floats<float>();
+    _check_floats<double>();
+}
+
+TEST_F(BatchStringParserTest, test_iso_date) {
+    int year, month, day;
+    ASSERT_TRUE(BatchStringParser::try_parse_iso_date("2021-01-02", 10, &year, &month, &day));
+    ASSERT_EQ(2021, year);
+    ASSERT_EQ(1, month);
+    ASSERT_EQ(2, day);
+    ASSERT_TRUE(BatchStringParser::try_parse_iso_date("0000-12-31", 10, &year, &month, &day));
+    ASSERT_EQ(0, year);
+    ASSERT_EQ(12, month);
+    ASSERT_EQ(31, day);
+    // not checked
+    ASSERT_TRUE(BatchStringParser::try_parse_iso_date("9999-99-99", 10, &year, &month, &day));
+    ASSERT_EQ(99, month);
+
+    for (const char* s : {"2021-1-02", "2021/01/02", "20210102", "2021-01-0a", "2021-0a-02", "a021-01-02",
+                          "2021-01-02 ", " 2021-01-02", "2021-01--2", "2021_01_02"}) {
+        ASSERT_FALSE(BatchStringParser::try_parse_iso_date(s, strlen(s), &year, &month, &day)) << s;
+    }
+}
+
+} // namespace starrocks
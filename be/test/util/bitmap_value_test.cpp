@@ -22,6 +22,8 @@
 #include <gtest/gtest.h>
 
 #include <cstdint>
+#include <cstring>
+#include <memory>
 #include <string>
 
 #include "util/coding.h"
@@ -219,6 +221,162 @@ TEST(BitmapValueTest, bitmap_serde) {
     }
 }
 
+TEST(BitmapValueTest, frozen_bitmap) {
+    auto old_version = config::bitmap_serialize_version;
+    for (int version : {1, 2}) {
+        config::bitmap_serialize_version = version;
+
+        // sparse values, dense values, runs and values beyond UINT32_MAX
+        std::vector<std::vector<uint64_t>> inputs(4);
+        for (uint64_t i = 0; i < 100; i++) {
+            inputs[0].push_back(i * 1000);
+            inputs[3].push_back((i << 32) + i);
+        }
+        for (uint64_t i = 0; i < 20000; i++) {
+            inputs[1].push_back(i * 3);
+            inputs[2].push_back(65536 * 3 + i);
+        }
+
+        std::vector<std::string> buffers;
+        std::vector<BitmapValue> frozen_bitmaps;
+        BitmapValue expect;
+        for (const auto& input : inputs) {
+            BitmapValue bitmap(input);
+            bitmap.compress();
+            expect |= bitmap;
+            buffers.emplace_back(convert_bitmap_to_string(bitmap));
+
+            BitmapValue frozen(Slice(buffers.back()));
+            ASSERT_TRUE(frozen.is_frozen());
+            ASSERT_EQ(input.size(), frozen.cardinality());
+            for (uint64_t v : input) {
+                ASSERT_TRUE(frozen.contains(v));
+            }
+            ASSERT_FALSE(frozen.contains(1));
+            ASSERT_FALSE(frozen.contains((1ul << 32) + 2));
+            // a frozen bitmap is serialized as it is
+            ASSERT_EQ(buffers.back(), convert_bitmap_to_string(frozen));
+            frozen_bitmaps.emplace_back(std::move(frozen));
+        }
+
+        // union one by one
+        BitmapValue actual;
+        for (const auto& bitmap : frozen_bitmaps) {
+            actual |= bitmap;
+        }
+        ASSERT_EQ(expect.to_string(), actual.to_string());
+
+        // union at once
+        std::vector<const BitmapValue*> values;
+        for (const auto& bitmap : frozen_bitmaps) {
+            values.emplace_back(&bitmap);
+        }
+        BitmapValue single(5);
+        values.emplace_back(&single);
+        BitmapValue result(std::vector<uint64_t>{1, (1ul << 32) + 2});
+        result.union_many(values);
+        expect.add(1);
+        expect.add((1ul << 32) + 2);
+        expect.add(5);
+        ASSERT_EQ(expect.cardinality(), result.cardinality());
+        ASSERT_EQ(expect.to_string(), result.to_string());
+
+        // the frozen bitmap is parsed when modified
+        BitmapValue bitmap(frozen_bitmaps[0]);
+        bitmap.add(1);
+        ASSERT_FALSE(bitmap.is_frozen());
+        ASSERT_TRUE(frozen_bitmaps[0].is_frozen());
+        ASSERT_EQ(inputs[0].size() + 1, bitmap.cardinality());
+        ASSERT_EQ(inputs[0].size(), frozen_bitmaps[0].cardinality());
+
+        // reading or using a frozen bitmap as the operand doesn't parse it
+        const BitmapValue& frozen = frozen_bitmaps[1];
+        std::vector<int64_t> array;
+        frozen.to_array(&array);
+        ASSERT_EQ(inputs[1].size(), array.size());
+        ASSERT_FALSE(frozen.to_string().empty());
+        BitmapValue intersection(inputs[1]);
+        intersection &= frozen;
+        ASSERT_EQ(inputs[1].size(), intersection.cardinality());
+        intersection -= frozen;
+        ASSERT_EQ(0, intersection.cardinality());
+        ASSERT_TRUE(frozen.is_frozen());
+    }
+    config::bitmap_serialize_version = old_version;
+}
+
+TEST(BitmapValueTest, frozen_bitmap_corrupted) {
+    auto old_version = config::bitmap_serialize_version;
+    for (int version : {1, 2}) {
+        config::bitmap_serialize_version = version;
+        std::vector<uint64_t> values;
+        for (uint64_t i = 0; i < 10000; i++) {
+            values.push_back(i * 7);
+            values.push_back((2ul << 32) + i);
+        }
+        BitmapValue bitmap(values);
+        bitmap.compress();
+        std::string buffer = convert_bitmap_to_string(bitmap);
+
+        // trailing bytes are not part of the bitmap
+        std::string padded = buffer + "xyz";
+        detail::FrozenBitmap frozen(padded.data(), padded.size());
+        ASSERT_TRUE(frozen.is_valid());
+        ASSERT_EQ(buffer.size(), frozen.serialized_size());
+        ASSERT_EQ(values.size(), frozen.cardinality());
+
+        // truncated anywhere, the bytes out of range are never read
+        for (size_t size = 0; size < buffer.size(); size += std::max<size_t>(1, size / 16)) {
+            std::unique_ptr<char[]> truncated(new char[size + 1]);
+            memcpy(truncated.get(), buffer.data(), size);
+            ASSERT_FALSE(detail::FrozenBitmap(truncated.get(), size).is_valid()) << size;
+        }
+
+        // not a roaring bitmap
+        BitmapValue single_value(1);
+        std::string single = convert_bitmap_to_string(single_value);
+        ASSERT_FALSE(detail::FrozenBitmap(single.data(), single.size()).is_valid());
+    }
+    config::bitmap_serialize_version = old_version;
+}
+
+TEST(BitmapValueTest, frozen_bitmap_owned_bytes) {
+    std::vector<uint64_t> values;
+    for (uint64_t i = 0; i < 10000; i++) {
+        values.push_back(i * 3);
+    }
+    BitmapValue bitmap(values);
+    bitmap.compress();
+    auto buffer = std::make_shared<std::string>(convert_bitmap_to_string(bitmap));
+
+    // the bitmap views the buffer in place and keeps it alive
+    BitmapValue frozen(Slice(*buffer), buffer);
+    ASSERT_EQ(buffer->data(), frozen._frozen->data());
+    const std::string expect = *buffer;
+    buffer.reset();
+    ASSERT_TRUE(frozen.is_frozen());
+    ASSERT_EQ(values.size(), frozen.cardinality());
+    ASSERT_TRUE(frozen.contains(2997));
+    ASSERT_FALSE(frozen.contains(2998));
+    ASSERT_EQ(expect, convert_bitmap_to_string(frozen));
+
+    // copies share the view
+    BitmapValue copy(frozen);
+    frozen.clear();
+    ASSERT_TRUE(copy.is_frozen());
+    ASSERT_EQ(values.size(), copy.cardinality());
+    copy.add(1);
+    ASSERT_FALSE(copy.is_frozen());
+    ASSERT_EQ(values.size() + 1, copy.cardinality());
+
+    // a corrupted buffer is deserialized directly
+    BitmapValue single_value(7);
+    auto single = std::make_shared<std::string>(convert_bitmap_to_string(single_value));
+    BitmapValue not_frozen(Slice(*single), single);
+    ASSERT_FALSE(not_frozen.is_frozen());
+    ASSERT_EQ(1, not_frozen.cardinality());
+}
+
 // Forked from CRoaring's UT of Roaring64Map
 TEST(BitmapValueTest, Roaring64Map) {
     using starrocks::detail::Roaring64Map;
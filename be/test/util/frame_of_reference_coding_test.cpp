@@ -247,4 +247,47 @@ TEST_F(TestForCoding, TestValueSeek) {
     ASSERT_EQ(found, false);
 }
 
+TEST_F(TestForCoding, TestFrameBounds) {
+    faststring buffer(1);
+    ForEncoder<int32_t> encoder(&buffer);
+
+    std::vector<int32_t> data;
+    // frame 0: ascending
+    for (int32_t i = 0; i < 128; ++i) {
+        data.push_back(i);
+    }
+    // frame 1: unordered
+    for (int32_t i = 0; i < 128; ++i) {
+        data.push_back(1000 + (i * 37) % 101);
+    }
+    // frame 2: original values
+    for (int32_t i = 0; i < 64; ++i) {
+        data.push_back(i % 2 == 0 ? std::numeric_limits<int32_t>::max() : std::numeric_limits<int32_t>::min());
+    }
+    encoder.put_batch(data.data(), data.size());
+    encoder.flush();
+
+    ForDecoder<int32_t> decoder(buffer.data(), buffer.length());
+    decoder.init();
+    ASSERT_EQ(3, decoder.frame_count());
+
+    int32_t min = 0;
+    int32_t max = 0;
+    ASSERT_TRUE(decoder.frame_bounds(0, &min, &max));
+    ASSERT_EQ(0, min);
+    ASSERT_EQ(127, max);
+
+    ASSERT_TRUE(decoder.frame_bounds(1, &min, &max));
+    ASSERT_EQ(1000, min);
+    ASSERT_GE(max, 1100);
+    ASSERT_EQ(1127, max);
+
+    ASSERT_FALSE(decoder.frame_bounds(2, &min, &max));
+
+    // the values are still decoded correctly
+    std::vector<int32_t> actual_result(data.size());
+    decoder.get_batch(actual_result.data(), data.size());
+    ASSERT_EQ(data, actual_result);
+}
+
 } // namespace starrocks
@@ -0,0 +1,76 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "util/text_tokenizer.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace starrocks {
+
+class TextTokenizerTest : public testing::Test {
+protected:
+    std::vector<std::string> _split(const std::string& text) {
+        std::vector<std::string> res;
+        std::string buf;
+        TextTokenizer::for_each_term(Slice(text), &buf,
+                                     [&](const Slice& term) { res.emplace_back(term.data, term.size); });
+        return res;
+    }
+
+    bool _match(const std::vector<std::string>& queries, bool match_all, const std::string& text) {
+        TextMatcher matcher(queries, match_all);
+        TextMatcher::Context ctx;
+        return matcher.match(Slice(text), &ctx);
+    }
+};
+
+TEST_F(TextTokenizerTest, test_split) {
+    ASSERT_EQ((std::vector<std::string>{"get", "api", "v1", "users", "id", "42"}),
+              _split("GET /api/v1/Users?id=42"));
+    ASSERT_EQ((std::vector<std::string>{"a", "b", "a"}), _split("  a,b;;A  "));
+    ASSERT_TRUE(_split("").empty());
+    ASSERT_TRUE(_split(" !@#$%^&*()-_=+ ").empty());
+    // the bytes of non-ASCII chars are kept as they are
+    ASSERT_EQ((std::vector<std::string>{"数据库", "starrocks"}), _split("数据库 StarRocks"));
+
+    std::string long_term(TextTokenizer::kMaxTermLength + 10, 'x');
+    std::vector<std::string> terms = _split(long_term + " y");
+    ASSERT_EQ(2, terms.size());
+    ASSERT_EQ(TextTokenizer::kMaxTermLength, terms[0].size());
+    ASSERT_EQ("y", terms[1]);
+
+    ASSERT_EQ((std::vector<std::string>{"a", "b", "c"}), TextTokenizer::terms(Slice("c b A a B")));
+}
+
+TEST_F(TextTokenizerTest, test_match) {
+    const std::string text = "ERROR: connection to Backend-3 refused";
+
+    ASSERT_TRUE(_match({"error"}, false, text));
+    ASSERT_TRUE(_match({"warn refused"}, false, text));
+    ASSERT_FALSE(_match({"warn timeout"}, false, text));
+    ASSERT_TRUE(_match({"backend 3"}, true, text));
+    ASSERT_TRUE(_match({"Backend", "Error"}, true, text));
+    ASSERT_FALSE(_match({"backend 4"}, true, text));
+    // terms must match completely
+    ASSERT_FALSE(_match({"connect"}, false, text));
+    // duplicated terms
+    ASSERT_TRUE(_match({"error error", "ERROR"}, true, text));
+    ASSERT_TRUE(_match({"refused"}, true, "refused refused"));
+
+    // queries without any term match nothing
+    ASSERT_FALSE(_match({}, false, text));
+    ASSERT_FALSE(_match({"", "--"}, true, text));
+    ASSERT_FALSE(_match({"error"}, false, ""));
+
+    // the context is reusable
+    TextMatcher matcher({"a b"}, true);
+    TextMatcher::Context ctx;
+    ASSERT_TRUE(matcher.match(Slice("b a"), &ctx));
+    ASSERT_FALSE(matcher.match(Slice("a"), &ctx));
+    ASSERT_FALSE(matcher.match(Slice("b"), &ctx));
+    ASSERT_TRUE(matcher.match(Slice("c B A"), &ctx));
+}
+
+} // namespace starrocks
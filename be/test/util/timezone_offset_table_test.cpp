@@ -0,0 +1,80 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "util/timezone_offset_table.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace starrocks {
+
+class TimezoneOffsetTableTest : public testing::Test {
+protected:
+    static int64_t _utc_to_local(const cctz::time_zone& ctz, int64_t utc_seconds) {
+        auto tp = cctz::time_point<cctz::seconds>(cctz::seconds(utc_seconds));
+        return utc_seconds + ctz.lookup(tp).offset;
+    }
+
+    static int64_t _local_to_utc(const cctz::time_zone& ctz, int64_t local_seconds) {
+        return cctz::convert(_epoch + local_seconds, ctz).time_since_epoch().count();
+    }
+
+    static const cctz::civil_second _epoch;
+};
+
+const cctz::civil_second TimezoneOffsetTableTest::_epoch(1970, 1, 1, 0, 0, 0);
+
+TEST_F(TimezoneOffsetTableTest, test_same_as_cctz) {
+    const char* zones[] = {"UTC",           "Asia/Shanghai",     "America/Los_Angeles", "Europe/London",
+                           "Asia/Kolkata",  "America/Sao_Paulo", "Australia/Lord_Howe", "Pacific/Apia"};
+    std::mt19937_64 rng(0);
+    // including the values out of the cached range.
+    const int64_t lo = cctz::civil_second(1800, 1, 1, 0, 0, 0) - _epoch;
+    const int64_t hi = cctz::civil_second(2200, 1, 1, 0, 0, 0) - _epoch;
+    for (const char* zone : zones) {
+        cctz::time_zone ctz;
+        ASSERT_TRUE(cctz::load_time_zone(zone, &ctz)) << zone;
+        TimezoneOffsetTable table;
+        table.init(ctz);
+
+        size_t utc_hint = 0;
+        size_t local_hint = 0;
+        for (int i = 0; i < 100000; ++i) {
+            int64_t value = lo + rng() % (hi - lo);
+            ASSERT_EQ(_utc_to_local(ctz, value), table.utc_to_local(value, &utc_hint)) << zone << " " << value;
+            ASSERT_EQ(_local_to_utc(ctz, value), table.local_to_utc(value, &local_hint)) << zone << " " << value;
+        }
+
+        // the repeated and skipped civil times around the transitions.
+        auto tp = cctz::time_point<cctz::seconds>(cctz::seconds(cctz::civil_second(1990, 1, 1, 0, 0, 0) - _epoch));
+        cctz::time_zone::civil_transition trans;
+        for (int n = 0; n < 20 && ctz.next_transition(tp, &trans); ++n) {
+            int64_t local = trans.from - _epoch;
+            for (int64_t value = local - 7200; value < local + 7200; value += 59) {
+                ASSERT_EQ(_utc_to_local(ctz, value), table.utc_to_local(value, &utc_hint)) << zone << " " << value;
+                ASSERT_EQ(_local_to_utc(ctz, value), table.local_to_utc(value, &local_hint)) << zone << " " << value;
+            }
+            tp = cctz::convert(trans.to, ctz) + cctz::seconds(1);
+        }
+    }
+}
+
+TEST_F(TimezoneOffsetTableTest, test_daylight_saving_time) {
+    cctz::time_zone ctz;
+    ASSERT_TRUE(cctz::load_time_zone("America/Los_Angeles", &ctz));
+    TimezoneOffsetTable table;
+    table.init(ctz);
+    size_t hint = 0;
+
+    // 2021-03-14 02:30:00 is skipped, converted to the transition 2021-03-14 10:00:00 UTC.
+    int64_t skipped = cctz::civil_second(2021, 3, 14, 2, 30, 0) - _epoch;
+    ASSERT_EQ(cctz::civil_second(2021, 3, 14, 10, 0, 0) - _epoch, table.local_to_utc(skipped, &hint));
+    // 2021-11-07 01:30:00 is repeated, converted by the offset of the daylight saving time.
+    int64_t repeated = cctz::civil_second(2021, 11, 7, 1, 30, 0) - _epoch;
+    ASSERT_EQ(cctz::civil_second(2021, 11, 7, 8, 30, 0) - _epoch, table.local_to_utc(repeated, &hint));
+
+    int64_t utc = cctz::civil_second(2021, 7, 1, 12, 0, 0) - _epoch;
+    ASSERT_EQ(cctz::civil_second(2021, 7, 1, 5, 0, 0) - _epoch, table.utc_to_local(utc, &hint));
+}
+
+} // namespace starrocks
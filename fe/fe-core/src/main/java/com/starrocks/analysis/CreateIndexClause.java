@@ -74,7 +74,7 @@ public class CreateIndexClause extends AlterTableClause {
         }
         indexDef.analyze();
         this.index = new Index(indexDef.getIndexName(), indexDef.getColumns(), indexDef.getIndexType(),
-                indexDef.getComment());
+                indexDef.getProperties(), indexDef.getComment());
     }
 
     @Override
@@ -41,6 +41,7 @@ import com.starrocks.common.util.PrintableMap;
 import com.starrocks.common.util.PropertyAnalyzer;
 import com.starrocks.mysql.privilege.PrivPredicate;
 import com.starrocks.qe.ConnectContext;
+import com.starrocks.thrift.TFileFormatType;
 import org.apache.logging.log4j.LogManager;
 import org.apache.logging.log4j.Logger;
 
@@ -62,6 +63,7 @@ public class ExportStmt extends StatementBase {
     private static final Logger LOG = LogManager.getLogger(ExportStmt.class);
 
     private static final String INCLUDE_QUERY_ID_PROP = "include_query_id";
+    private static final String FORMAT_PROP = "format";
 
     private static final String DEFAULT_COLUMN_SEPARATOR = "\t";
     private static final String DEFAULT_LINE_DELIMITER = "\n";
@@ -81,6 +83,7 @@ public class ExportStmt extends StatementBase {
     private String columnSeparator;
     private String rowDelimiter;
     private boolean includeQueryId = true;
+    private TFileFormatType fileFormatType = TFileFormatType.FORMAT_CSV_PLAIN;
 
     private TableRef tableRef;
     private long exportStartTime;
@@ -147,6 +150,10 @@ public class ExportStmt extends StatementBase {
         return includeQueryId;
     }
 
+    public TFileFormatType getFileFormatType() {
+        return fileFormatType;
+    }
+
     @Override
     public boolean needAuditEncryption() {
         if (brokerDesc != null) {
@@ -336,6 +343,18 @@ public class ExportStmt extends StatementBase {
             }
             includeQueryId = Boolean.parseBoolean(properties.get(INCLUDE_QUERY_ID_PROP));
         }
+
+        // format, the separators are only for csv
+        if (properties.containsKey(FORMAT_PROP)) {
+            String format = properties.get(FORMAT_PROP);
+            if (format.equalsIgnoreCase("csv")) {
+                fileFormatType = TFileFormatType.FORMAT_CSV_PLAIN;
+            } else if (format.equalsIgnoreCase("parquet")) {
+                fileFormatType = TFileFormatType.FORMAT_PARQUET;
+            } else {
+                throw new AnalysisException("Invalid format value: " + format + ", only support csv and parquet");
+            }
+        }
     }
 
     @Override
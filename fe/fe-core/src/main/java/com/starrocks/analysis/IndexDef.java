@@ -26,19 +26,33 @@ import com.starrocks.catalog.Column;
 import com.starrocks.catalog.KeysType;
 import com.starrocks.catalog.PrimitiveType;
 import com.starrocks.common.AnalysisException;
+import com.starrocks.common.util.PrintableMap;
 import com.starrocks.sql.analyzer.SemanticException;
 
 import java.util.List;
+import java.util.Map;
 import java.util.TreeSet;
 
 public class IndexDef {
+    // the length of the grams of NGRAMBF index, which is 3 in BE if it's not set
+    public static final String GRAM_NUM = "gram_num";
+    // BE stores the gram size in one byte
+    private static final int MAX_GRAM_NUM = 255;
+
     private String indexName;
     private List<String> columns;
     private IndexType indexType;
     private String comment;
+    private Map<String, String> properties;
 
     public IndexDef(String indexName, List<String> columns, IndexType indexType, String comment) {
+        this(indexName, columns, indexType, null, comment);
+    }
+
+    public IndexDef(String indexName, List<String> columns, IndexType indexType, Map<String, String> properties,
+                    String comment) {
         this.indexName = indexName;
+        this.properties = properties;
         this.columns = columns;
         if (indexType == null) {
             this.indexType = IndexType.BITMAP;
@@ -53,9 +67,11 @@ public class IndexDef {
     }
 
     public void analyze() throws AnalysisException {
-        if (indexType == IndexDef.IndexType.BITMAP) {
+        if (indexType == IndexDef.IndexType.BITMAP || indexType == IndexDef.IndexType.INVERTED ||
+                indexType == IndexDef.IndexType.NGRAMBF) {
             if (columns == null || columns.size() != 1) {
-                throw new AnalysisException("bitmap index can only apply to a single column.");
+                throw new AnalysisException(
+                        indexType.name().toLowerCase() + " index can only apply to a single column.");
             }
             if (Strings.isNullOrEmpty(indexName)) {
                 throw new AnalysisException("index name cannot be blank.");
@@ -69,6 +85,36 @@ public class IndexDef {
                 throw new AnalysisException("columns of index has duplicated.");
             }
         }
+        try {
+            verifyProperties();
+        } catch (SemanticException e) {
+            throw new AnalysisException(e.getMessage());
+        }
+    }
+
+    // Only NGRAMBF index has a property, "gram_num".
+    public void verifyProperties() {
+        if (properties == null || properties.isEmpty()) {
+            return;
+        }
+        if (indexType != IndexType.NGRAMBF) {
+            throw new SemanticException(indexType + " index does not support properties.");
+        }
+        for (Map.Entry<String, String> entry : properties.entrySet()) {
+            if (!entry.getKey().equals(GRAM_NUM)) {
+                throw new SemanticException("Unknown property of NGRAMBF index: " + entry.getKey());
+            }
+            int gramNum = -1;
+            try {
+                gramNum = Integer.parseInt(entry.getValue());
+            } catch (NumberFormatException e) {
+                // reported below
+            }
+            if (gramNum < 1 || gramNum > MAX_GRAM_NUM) {
+                throw new SemanticException("Invalid gram_num: " + entry.getValue()
+                        + ", it should be an integer in [1, " + MAX_GRAM_NUM + "].");
+            }
+        }
     }
 
     public String toSql() {
@@ -95,6 +141,9 @@ public class IndexDef {
         if (indexType != null) {
             sb.append(" USING ").append(indexType.toString());
         }
+        if (properties != null && !properties.isEmpty()) {
+            sb.append(" PROPERTIES (").append(new PrintableMap<>(properties, " = ", true, false)).append(")");
+        }
         if (comment != null) {
             sb.append(" COMMENT '" + comment + "'");
         }
@@ -122,6 +171,10 @@ public class IndexDef {
         return comment;
     }
 
+    public Map<String, String> getProperties() {
+        return properties;
+    }
+
     // new planner framework use SemanticException instead of AnalysisException, this code will remove in future
     @Deprecated
     public void checkColumn(Column column, KeysType keysType) throws AnalysisException {
@@ -137,6 +190,28 @@ public class IndexDef {
                         "BITMAP index only used in columns of DUP_KEYS/PRIMARY_KEYS table or key columns of"
                                 + " UNIQUE_KEYS/AGG_KEYS table. invalid column: " + indexColName);
             }
+        } else if (indexType == IndexType.INVERTED) {
+            String indexColName = column.getName();
+            PrimitiveType colType = column.getPrimitiveType();
+            if (!colType.isCharFamily()) {
+                throw new AnalysisException(colType + " is not supported in inverted index. "
+                        + "invalid column: " + indexColName);
+            } else if ((keysType == KeysType.AGG_KEYS || keysType == KeysType.UNIQUE_KEYS) && !column.isKey()) {
+                throw new AnalysisException(
+                        "INVERTED index only used in columns of DUP_KEYS/PRIMARY_KEYS table or key columns of"
+                                + " UNIQUE_KEYS/AGG_KEYS table. invalid column: " + indexColName);
+            }
+        } else if (indexType == IndexType.NGRAMBF) {
+            String indexColName = column.getName();
+            PrimitiveType colType = column.getPrimitiveType();
+            if (!colType.isCharFamily()) {
+                throw new AnalysisException(colType + " is not supported in ngrambf index. "
+                        + "invalid column: " + indexColName);
+            } else if ((keysType == KeysType.AGG_KEYS || keysType == KeysType.UNIQUE_KEYS) && !column.isKey()) {
+                throw new AnalysisException(
+                        "NGRAMBF index only used in columns of DUP_KEYS/PRIMARY_KEYS table or key columns of"
+                                + " UNIQUE_KEYS/AGG_KEYS table. invalid column: " + indexColName);
+            }
         } else {
             throw new AnalysisException("Unsupported index type: " + indexType);
         }
@@ -155,6 +230,28 @@ public class IndexDef {
                         "BITMAP index only used in columns of DUP_KEYS/PRIMARY_KEYS table or key columns of"
                                 + " UNIQUE_KEYS/AGG_KEYS table. invalid column: " + indexColName);
             }
+        } else if (indexType == IndexType.INVERTED) {
+            String indexColName = column.getName();
+            PrimitiveType colType = column.getPrimitiveType();
+            if (!colType.isCharFamily()) {
+                throw new SemanticException(colType + " is not supported in inverted index. "
+                        + "invalid column: " + indexColName);
+            } else if ((keysType == KeysType.AGG_KEYS || keysType == KeysType.UNIQUE_KEYS) && !column.isKey()) {
+                throw new SemanticException(
+                        "INVERTED index only used in columns of DUP_KEYS/PRIMARY_KEYS table or key columns of"
+                                + " UNIQUE_KEYS/AGG_KEYS table. invalid column: " + indexColName);
+            }
+        } else if (indexType == IndexType.NGRAMBF) {
+            String indexColName = column.getName();
+            PrimitiveType colType = column.getPrimitiveType();
+            if (!colType.isCharFamily()) {
+                throw new SemanticException(colType + " is not supported in ngrambf index. "
+                        + "invalid column: " + indexColName);
+            } else if ((keysType == KeysType.AGG_KEYS || keysType == KeysType.UNIQUE_KEYS) && !column.isKey()) {
+                throw new SemanticException(
+                        "NGRAMBF index only used in columns of DUP_KEYS/PRIMARY_KEYS table or key columns of"
+                                + " UNIQUE_KEYS/AGG_KEYS table. invalid column: " + indexColName);
+            }
         } else {
             throw new SemanticException("Unsupported index type: " + indexType);
         }
@@ -162,5 +259,9 @@ public class IndexDef {
 
     public enum IndexType {
         BITMAP,
+        // full-text index of the terms in CHAR/VARCHAR values, used by MATCH_ANY/MATCH_ALL
+        INVERTED,
+        // bloom filters of the n-grams in the CHAR/VARCHAR values of each page, used by LIKE
+        NGRAMBF,
     }
 }
@@ -27,12 +27,14 @@ import com.google.common.collect.Sets;
 import com.starrocks.common.AnalysisException;
 import com.starrocks.common.util.ParseUtil;
 import com.starrocks.common.util.PrintableMap;
+import com.starrocks.thrift.TCompressionType;
 import com.starrocks.thrift.TFileFormatType;
 import com.starrocks.thrift.TResultFileSinkOptions;
 import org.apache.logging.log4j.LogManager;
 import org.apache.logging.log4j.Logger;
 
 import java.util.Iterator;
+import java.util.List;
 import java.util.Map;
 import java.util.Set;
 import java.util.stream.Collectors;
@@ -46,10 +48,14 @@ public class OutFileClause {
     private static final String PROP_COLUMN_SEPARATOR = "column_separator";
     private static final String PROP_LINE_DELIMITER = "line_delimiter";
     private static final String PROP_MAX_FILE_SIZE = "max_file_size";
+    private static final String PROP_COMPRESSION = "compression";
+    private static final String PROP_MAX_ROW_GROUP_SIZE = "max_row_group_size";
+    private static final String PROP_USE_DICTIONARY = "use_dictionary";
 
     private static final long DEFAULT_MAX_FILE_SIZE_BYTES = 1 * 1024 * 1024 * 1024; // 1GB
     private static final long MIN_FILE_SIZE_BYTES = 5 * 1024 * 1024L; // 5MB
     private static final long MAX_FILE_SIZE_BYTES = 2 * 1024 * 1024 * 1024L; // 2GB
+    private static final long DEFAULT_MAX_ROW_GROUP_SIZE_BYTES = 128 * 1024 * 1024L; // 128MB
 
     private String filePath;
     private String format;
@@ -61,6 +67,10 @@ public class OutFileClause {
     private TFileFormatType fileFormatType;
     private long maxFileSizeBytes = DEFAULT_MAX_FILE_SIZE_BYTES;
     private BrokerDesc brokerDesc = null;
+    // only for parquet
+    private TCompressionType compressionType = TCompressionType.SNAPPY;
+    private long maxRowGroupSizeBytes = DEFAULT_MAX_ROW_GROUP_SIZE_BYTES;
+    private boolean useDictionary = true;
 
     public OutFileClause(String filePath, String format, Map<String, String> properties) {
         this.filePath = filePath;
@@ -99,10 +109,13 @@ public class OutFileClause {
             throw new AnalysisException("Must specify file in OUTFILE clause");
         }
 
-        if (!format.equals("csv")) {
-            throw new AnalysisException("Only support CSV format");
+        if (format.equals("csv")) {
+            fileFormatType = TFileFormatType.FORMAT_CSV_PLAIN;
+        } else if (format.equals("parquet")) {
+            fileFormatType = TFileFormatType.FORMAT_PARQUET;
+        } else {
+            throw new AnalysisException("Only support CSV and PARQUET format");
         }
-        fileFormatType = TFileFormatType.FORMAT_CSV_PLAIN;
 
         analyzeProperties();
 
@@ -146,6 +159,34 @@ public class OutFileClause {
             processedPropKeys.add(PROP_MAX_FILE_SIZE);
         }
 
+        if (properties.containsKey(PROP_COMPRESSION)) {
+            if (!isParquetFormat()) {
+                throw new AnalysisException(PROP_COMPRESSION + " is only for PARQUET format");
+            }
+            compressionType = analyzeCompressionType(properties.get(PROP_COMPRESSION));
+            processedPropKeys.add(PROP_COMPRESSION);
+        }
+
+        if (properties.containsKey(PROP_MAX_ROW_GROUP_SIZE)) {
+            if (!isParquetFormat()) {
+                throw new AnalysisException(PROP_MAX_ROW_GROUP_SIZE + " is only for PARQUET format");
+            }
+            maxRowGroupSizeBytes = ParseUtil.analyzeDataVolumn(properties.get(PROP_MAX_ROW_GROUP_SIZE));
+            processedPropKeys.add(PROP_MAX_ROW_GROUP_SIZE);
+        }
+
+        if (properties.containsKey(PROP_USE_DICTIONARY)) {
+            if (!isParquetFormat()) {
+                throw new AnalysisException(PROP_USE_DICTIONARY + " is only for PARQUET format");
+            }
+            String useDict = properties.get(PROP_USE_DICTIONARY);
+            if (!useDict.equalsIgnoreCase("true") && !useDict.equalsIgnoreCase("false")) {
+                throw new AnalysisException(PROP_USE_DICTIONARY + " should be true or false. Given: " + useDict);
+            }
+            useDictionary = Boolean.parseBoolean(useDict);
+            processedPropKeys.add(PROP_USE_DICTIONARY);
+        }
+
         if (processedPropKeys.size() != properties.size()) {
             LOG.debug("{} vs {}", processedPropKeys, properties);
             throw new AnalysisException("Unknown properties: " + properties.keySet().stream()
@@ -173,6 +214,25 @@ public class OutFileClause {
         brokerDesc = new BrokerDesc(brokerName, brokerProps);
     }
 
+    // The parquet writer of BE only supports the codecs whose framing matches parquet.
+    private static TCompressionType analyzeCompressionType(String compression) throws AnalysisException {
+        switch (compression.toLowerCase()) {
+            case "uncompressed":
+                return TCompressionType.NO_COMPRESSION;
+            case "snappy":
+                return TCompressionType.SNAPPY;
+            case "zstd":
+                return TCompressionType.ZSTD;
+            default:
+                throw new AnalysisException(PROP_COMPRESSION +
+                        " should be one of uncompressed, snappy and zstd. Given: " + compression);
+        }
+    }
+
+    private boolean isParquetFormat() {
+        return fileFormatType == TFileFormatType.FORMAT_PARQUET;
+    }
+
     private boolean isCsvFormat() {
         return fileFormatType == TFileFormatType.FORMAT_CSV_BZ2
                 || fileFormatType == TFileFormatType.FORMAT_CSV_DEFLATE
@@ -197,12 +257,18 @@ public class OutFileClause {
         return sb.toString();
     }
 
-    public TResultFileSinkOptions toSinkOptions() {
+    public TResultFileSinkOptions toSinkOptions(List<String> columnNames) {
         TResultFileSinkOptions sinkOptions = new TResultFileSinkOptions(filePath, fileFormatType);
         if (isCsvFormat()) {
             sinkOptions.setColumn_separator(columnSeparator);
             sinkOptions.setRow_delimiter(rowDelimiter);
         }
+        if (isParquetFormat()) {
+            sinkOptions.setFile_column_names(columnNames);
+            sinkOptions.setCompression_type(compressionType);
+            sinkOptions.setParquet_max_row_group_bytes(maxRowGroupSizeBytes);
+            sinkOptions.setParquet_use_dict(useDictionary);
+        }
         sinkOptions.setMax_file_size_bytes(maxFileSizeBytes);
         if (brokerDesc != null) {
             sinkOptions.setBroker_properties(brokerDesc.getProperties());
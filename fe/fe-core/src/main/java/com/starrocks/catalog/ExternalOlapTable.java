@@ -330,7 +330,8 @@ public class ExternalOlapTable extends OlapTable {
                 List<Index> indexList = new ArrayList<>();
                 for (TIndexInfo indexInfo : meta.getIndex_infos()) {
                     Index index = new Index(indexInfo.getIndex_name(), indexInfo.getColumns(),
-                                            IndexDef.IndexType.valueOf(indexInfo.getIndex_type()), indexInfo.getComment());
+                                            IndexDef.IndexType.valueOf(indexInfo.getIndex_type()),
+                                            indexInfo.getProperties(), indexInfo.getComment());
                     indexList.add(index);
                 }
                 indexes = new TableIndexes(indexList);
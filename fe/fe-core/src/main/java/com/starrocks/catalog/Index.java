@@ -24,6 +24,7 @@ package com.starrocks.catalog;
 import com.google.gson.annotations.SerializedName;
 import com.starrocks.analysis.IndexDef;
 import com.starrocks.common.io.Text;
+import com.starrocks.common.util.PrintableMap;
 import com.starrocks.common.io.Writable;
 import com.starrocks.persist.gson.GsonUtils;
 import com.starrocks.thrift.TIndexType;
@@ -33,7 +34,9 @@ import java.io.DataInput;
 import java.io.DataOutput;
 import java.io.IOException;
 import java.util.ArrayList;
+import java.util.HashMap;
 import java.util.List;
+import java.util.Map;
 
 /**
  * Internal representation of index, including index type, name, columns and comments.
@@ -48,11 +51,20 @@ public class Index implements Writable {
     private IndexDef.IndexType indexType;
     @SerializedName(value = "comment")
     private String comment;
+    // e.g. "gram_num" of NGRAMBF index
+    @SerializedName(value = "properties")
+    private Map<String, String> properties;
 
     public Index(String indexName, List<String> columns, IndexDef.IndexType indexType, String comment) {
+        this(indexName, columns, indexType, null, comment);
+    }
+
+    public Index(String indexName, List<String> columns, IndexDef.IndexType indexType, Map<String, String> properties,
+                 String comment) {
         this.indexName = indexName;
         this.columns = columns;
         this.indexType = indexType;
+        this.properties = properties;
         this.comment = comment;
     }
 
@@ -95,6 +107,10 @@ public class Index implements Writable {
         this.comment = comment;
     }
 
+    public Map<String, String> getProperties() {
+        return properties;
+    }
+
     @Override
     public void write(DataOutput out) throws IOException {
         Text.writeString(out, GsonUtils.GSON.toJson(this));
@@ -111,7 +127,8 @@ public class Index implements Writable {
     }
 
     public Index clone() {
-        return new Index(indexName, new ArrayList<>(columns), indexType, comment);
+        return new Index(indexName, new ArrayList<>(columns), indexType,
+                properties == null ? null : new HashMap<>(properties), comment);
     }
 
     @Override
@@ -136,6 +153,9 @@ public class Index implements Writable {
         if (indexType != null) {
             sb.append(" USING ").append(indexType.toString());
         }
+        if (properties != null && !properties.isEmpty()) {
+            sb.append(" PROPERTIES (").append(new PrintableMap<>(properties, " = ", true, false)).append(")");
+        }
         if (comment != null) {
             sb.append(" COMMENT '" + comment + "'");
         }
@@ -147,6 +167,9 @@ public class Index implements Writable {
         tIndex.setIndex_name(indexName);
         tIndex.setColumns(columns);
         tIndex.setIndex_type(TIndexType.valueOf(indexType.toString()));
+        if (properties != null && !properties.isEmpty()) {
+            tIndex.setProperties(properties);
+        }
         if (columns != null) {
             tIndex.setComment(comment);
         }
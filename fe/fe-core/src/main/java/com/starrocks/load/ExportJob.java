@@ -71,6 +71,7 @@ import com.starrocks.qe.Coordinator;
 import com.starrocks.system.Backend;
 import com.starrocks.task.AgentClient;
 import com.starrocks.thrift.TAgentResult;
+import com.starrocks.thrift.TFileFormatType;
 import com.starrocks.thrift.TNetworkAddress;
 import com.starrocks.thrift.TScanRangeLocation;
 import com.starrocks.thrift.TScanRangeLocations;
@@ -96,8 +97,8 @@ import java.util.concurrent.atomic.AtomicInteger;
 //       because we may change job's member concurrently.
 //
 // export file name format:
-// <prefix>_<task-number>_<instance-number>_<file-number>.csv  (if include_query_id is false)
-// <prefix>_<query-id>_<task-number>_<instance-number>_<file-number>.csv
+// <prefix>_<task-number>_<instance-number>_<file-number>.<csv|parquet>  (if include_query_id is false)
+// <prefix>_<query-id>_<task-number>_<instance-number>_<file-number>.<csv|parquet>
 public class ExportJob implements Writable {
     private static final Logger LOG = LogManager.getLogger(ExportJob.class);
     // descriptor used to register all column and table need
@@ -121,6 +122,8 @@ public class ExportJob implements Writable {
     private String columnSeparator;
     private String rowDelimiter;
     private boolean includeQueryId;
+    // only used to plan the job, it's kept in the properties as well
+    private TFileFormatType fileFormatType = TFileFormatType.FORMAT_CSV_PLAIN;
     private Map<String, String> properties = Maps.newHashMap();
     private List<String> partitions;
     private TableName tableName;
@@ -179,6 +182,7 @@ public class ExportJob implements Writable {
         this.columnSeparator = stmt.getColumnSeparator();
         this.rowDelimiter = stmt.getRowDelimiter();
         this.includeQueryId = stmt.isIncludeQueryId();
+        this.fileFormatType = stmt.getFileFormatType();
         this.properties = stmt.getProperties();
 
         exportPath = stmt.getPath();
@@ -351,8 +355,14 @@ public class ExportJob implements Writable {
         fragment.setOutputExprs(createOutputExprs());
 
         scanNode.setFragmentId(fragment.getFragmentId());
-        fragment.setSink(new ExportSink(exportTempPath, fileNamePrefix + taskIdx + "_", columnSeparator,
-                rowDelimiter, brokerDesc));
+        List<String> exportColumnNames = Lists.newArrayList();
+        for (SlotDescriptor slotDesc : exportTupleDesc.getSlots()) {
+            exportColumnNames.add(slotDesc.getColumn().getName());
+        }
+        ExportSink exportSink = new ExportSink(exportTempPath, fileNamePrefix + taskIdx + "_", columnSeparator,
+                rowDelimiter, brokerDesc);
+        exportSink.setFileFormat(fileFormatType, exportColumnNames);
+        fragment.setSink(exportSink);
         try {
             fragment.finalize(analyzer, false);
         } catch (Exception e) {
@@ -1079,6 +1079,9 @@ public class MasterImpl {
                 indexInfo.setIndex_name(index.getIndexName());
                 indexInfo.setIndex_type(index.getIndexType().name());
                 indexInfo.setComment(index.getComment());
+                if (index.getProperties() != null && !index.getProperties().isEmpty()) {
+                    indexInfo.setProperties(index.getProperties());
+                }
                 for (String column : index.getColumns()) {
                     indexInfo.addToColumns(column);
                 }
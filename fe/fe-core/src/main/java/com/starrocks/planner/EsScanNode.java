@@ -343,4 +343,10 @@ public class EsScanNode extends ScanNode {
                 .append("\n");
         return output.toString();
     }
+
+    @Override
+    public boolean canUsePipeLine() {
+        // Only the http transport is implemented by the pipeline engine.
+        return EsTable.TRANSPORT_HTTP.equals(table.getTransport());
+    }
 }
@@ -29,16 +29,22 @@ import com.starrocks.thrift.TDataSink;
 import com.starrocks.thrift.TDataSinkType;
 import com.starrocks.thrift.TExplainLevel;
 import com.starrocks.thrift.TExportSink;
+import com.starrocks.thrift.TFileFormatType;
 import com.starrocks.thrift.TFileType;
 import com.starrocks.thrift.TNetworkAddress;
 import org.apache.commons.lang.StringEscapeUtils;
 
+import java.util.List;
+
 public class ExportSink extends DataSink {
     private final String exportPath;
     private String fileNamePrefix;
     private final String columnSeparator;
     private final String rowDelimiter;
     private final BrokerDesc brokerDesc;
+    private TFileFormatType fileFormatType = TFileFormatType.FORMAT_CSV_PLAIN;
+    // only for parquet
+    private List<String> columnNames;
 
     public ExportSink(String exportPath, String fileNamePrefix, String columnSeparator,
                       String rowDelimiter, BrokerDesc brokerDesc) {
@@ -63,11 +69,19 @@ public class ExportSink extends DataSink {
         this.fileNamePrefix = fileNamePrefix;
     }
 
+    public void setFileFormat(TFileFormatType fileFormatType, List<String> columnNames) {
+        this.fileFormatType = fileFormatType;
+        this.columnNames = columnNames;
+    }
+
     @Override
     public String getExplainString(String prefix, TExplainLevel explainLevel) {
         StringBuilder sb = new StringBuilder();
         sb.append(prefix + "EXPORT SINK\n");
         sb.append(prefix + "  path=" + exportPath + "\n");
+        if (fileFormatType == TFileFormatType.FORMAT_PARQUET) {
+            sb.append(prefix + "  format=parquet\n");
+        }
         sb.append(prefix + "  columnSeparator="
                 + StringEscapeUtils.escapeJava(columnSeparator) + "\n");
         sb.append(prefix + "  rowDelimiter="
@@ -94,6 +108,10 @@ public class ExportSink extends DataSink {
         if (fileNamePrefix != null) {
             tExportSink.setFile_name_prefix(fileNamePrefix);
         }
+        tExportSink.setFile_format(fileFormatType);
+        if (fileFormatType == TFileFormatType.FORMAT_PARQUET && columnNames != null) {
+            tExportSink.setFile_column_names(columnNames);
+        }
 
         result.setExport_sink(tExportSink);
         return result;
@@ -33,6 +33,8 @@ import com.starrocks.thrift.TResultFileSinkOptions;
 import com.starrocks.thrift.TResultSink;
 import com.starrocks.thrift.TResultSinkType;
 
+import java.util.List;
+
 /**
  * Result sink that forwards data to
  * 1. the FE data receiver, which result the final query result to user client. Or,
@@ -90,9 +92,9 @@ public class ResultSink extends DataSink {
         return brokerName;
     }
 
-    public void setOutfileInfo(OutFileClause outFileClause) {
+    public void setOutfileInfo(OutFileClause outFileClause, List<String> columnNames) {
         sinkType = TResultSinkType.FILE;
-        fileSinkOptions = outFileClause.toSinkOptions();
+        fileSinkOptions = outFileClause.toSinkOptions(columnNames);
         brokerName = outFileClause.getBrokerDesc() == null ? null : outFileClause.getBrokerDesc().getName();
     }
 
@@ -21,6 +21,8 @@
 
 package com.starrocks.qe;
 
+import com.google.common.base.Strings;
+import com.google.common.hash.Hashing;
 import com.starrocks.catalog.Catalog;
 import com.starrocks.common.FeMetaVersion;
 import com.starrocks.common.io.Text;
@@ -31,6 +33,7 @@ import com.starrocks.qe.VariableMgr.VarAttr;
 import com.starrocks.thrift.TCompressionType;
 import com.starrocks.thrift.TPipelineProfileMode;
 import com.starrocks.thrift.TQueryOptions;
+import com.starrocks.thrift.TResourceGroup;
 import org.json.JSONObject;
 
 import java.io.DataInput;
@@ -38,6 +41,7 @@ import java.io.DataOutput;
 import java.io.IOException;
 import java.io.Serializable;
 import java.lang.reflect.Field;
+import java.nio.charset.StandardCharsets;
 
 // System variable
 public class SessionVariable implements Serializable, Writable, Cloneable {
@@ -116,6 +120,16 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
 
     public static final String PIPELINE_PROFILE_MODE = "pipeline_profile_mode";
 
+    // the resource group of the queries of the session, which shares the execution time and the scan io time
+    // of the pipeline engine with the other groups in proportion to its shares, if BE config
+    // enable_pipeline_resource_group is true. The queries without resource group belong to the default group.
+    // The shares and the memory limit of a group are updated by every query of the group, 0 means the default
+    // shares of BE and no memory limit.
+    public static final String RESOURCE_GROUP = "resource_group";
+    public static final String RESOURCE_GROUP_CPU_SHARE = "resource_group_cpu_share";
+    public static final String RESOURCE_GROUP_SCAN_IO_SHARE = "resource_group_scan_io_share";
+    public static final String RESOURCE_GROUP_MEM_LIMIT = "resource_group_mem_limit";
+
     // hash join right table push down
     public static final String HASH_JOIN_PUSH_DOWN_RIGHT_TABLE = "hash_join_push_down_right_table";
 
@@ -312,6 +326,18 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     @VariableMgr.VarAttr(name = PIPELINE_PROFILE_MODE)
     private String pipelineProfileMode = "brief";
 
+    @VariableMgr.VarAttr(name = RESOURCE_GROUP)
+    private String resourceGroup = "";
+
+    @VariableMgr.VarAttr(name = RESOURCE_GROUP_CPU_SHARE)
+    private int resourceGroupCpuShare = 0;
+
+    @VariableMgr.VarAttr(name = RESOURCE_GROUP_SCAN_IO_SHARE)
+    private int resourceGroupScanIoShare = 0;
+
+    @VariableMgr.VarAttr(name = RESOURCE_GROUP_MEM_LIMIT)
+    private long resourceGroupMemLimit = 0L;
+
     @VariableMgr.VarAttr(name = ENABLE_INSERT_STRICT)
     private boolean enableInsertStrict = true;
 
@@ -704,6 +730,36 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
         return this.pipelineDop;
     }
 
+    public String getResourceGroup() {
+        return resourceGroup;
+    }
+
+    public void setResourceGroup(String resourceGroup) {
+        this.resourceGroup = resourceGroup;
+    }
+
+    // BE identifies a resource group by its id, which is derived from the name, so that all the FEs
+    // send the same id for the same group without sharing any metadata.
+    public static long getResourceGroupId(String name) {
+        long id = Hashing.murmur3_128().hashString(name, StandardCharsets.UTF_8).asLong() & Long.MAX_VALUE;
+        // 0 is the id of the default group in BE
+        return id == 0 ? 1 : id;
+    }
+
+    private TResourceGroup toResourceGroupThrift() {
+        TResourceGroup group = new TResourceGroup();
+        group.setId(getResourceGroupId(resourceGroup));
+        group.setName(resourceGroup);
+        if (resourceGroupCpuShare > 0) {
+            group.setCpu_share(resourceGroupCpuShare);
+        }
+        if (resourceGroupScanIoShare > 0) {
+            group.setScan_io_share(resourceGroupScanIoShare);
+        }
+        group.setMem_limit(resourceGroupMemLimit);
+        return group;
+    }
+
     public boolean isEnableReplicationJoin() {
         return enableReplicationJoin;
     }
@@ -800,6 +856,9 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
         } else {
             tResult.setPipeline_profile_mode(TPipelineProfileMode.DETAIL);
         }
+        if (!Strings.isNullOrEmpty(resourceGroup)) {
+            tResult.setResource_group(toResourceGroupThrift());
+        }
         return tResult;
     }
 
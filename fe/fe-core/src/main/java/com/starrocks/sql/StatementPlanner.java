@@ -127,6 +127,6 @@ public class StatementPlanner {
         }
 
         ResultSink resultSink = (ResultSink) topFragment.getSink();
-        resultSink.setOutfileInfo(queryStmt.getOutFileClause());
+        resultSink.setOutfileInfo(queryStmt.getOutFileClause(), plan.getColNames());
     }
 }
@@ -292,7 +292,7 @@ public class CreateTableAnalyzer {
                     }
                 }
                 indexes.add(new Index(indexDef.getIndexName(), indexDef.getColumns(), indexDef.getIndexType(),
-                        indexDef.getComment()));
+                        indexDef.getProperties(), indexDef.getComment()));
                 distinct.add(indexDef.getIndexName());
                 distinctCol.add(indexDef.getColumns().stream().map(String::toUpperCase).collect(Collectors.toList()));
             }
@@ -310,9 +310,11 @@ public class CreateTableAnalyzer {
         IndexDef.IndexType indexType = indexDef.getIndexType();
         List<String> columns = indexDef.getColumns();
         String indexName = indexDef.getIndexName();
-        if (indexType == IndexDef.IndexType.BITMAP) {
+        if (indexType == IndexDef.IndexType.BITMAP || indexType == IndexDef.IndexType.INVERTED ||
+                indexType == IndexDef.IndexType.NGRAMBF) {
             if (columns == null || columns.size() != 1) {
-                throw new SemanticException("bitmap index can only apply to a single column.");
+                throw new SemanticException(
+                        indexType.name().toLowerCase() + " index can only apply to a single column.");
             }
             if (Strings.isNullOrEmpty(indexName)) {
                 throw new SemanticException("index name cannot be blank.");
@@ -326,6 +328,7 @@ public class CreateTableAnalyzer {
                 throw new SemanticException("columns of index has duplicated.");
             }
         }
+        indexDef.verifyProperties();
     }
 
 
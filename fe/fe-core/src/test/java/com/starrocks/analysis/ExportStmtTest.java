@@ -24,11 +24,13 @@ import mockit.Mocked;
 import mockit.MockUp;
 
 import com.starrocks.qe.SessionVariable;
+import com.starrocks.thrift.TFileFormatType;
 import org.junit.Assert;
 import org.junit.Before;
 import org.junit.Test;
 
 import java.util.List;
+import java.util.Map;
 
 public class ExportStmtTest {
     private String path;
@@ -133,4 +135,27 @@ public class ExportStmtTest {
         stmt.analyze(analyzer);
         Assert.fail("No exception throws.");
     }
+
+    @Test
+    public void testExportFormat() throws UserException {
+        List<String> columnNames = Lists.newArrayList("k1", "k2");
+        ExportStmt stmt = new ExportStmt(tableRef, columnNames, path, Maps.newHashMap(), brokerDesc);
+        stmt.analyze(analyzer);
+        Assert.assertEquals(TFileFormatType.FORMAT_CSV_PLAIN, stmt.getFileFormatType());
+
+        Map<String, String> properties = Maps.newHashMap();
+        properties.put("format", "Parquet");
+        stmt = new ExportStmt(tableRef, columnNames, path, properties, brokerDesc);
+        stmt.analyze(analyzer);
+        Assert.assertEquals(TFileFormatType.FORMAT_PARQUET, stmt.getFileFormatType());
+    }
+
+    @Test(expected = AnalysisException.class)
+    public void testExportInvalidFormat() throws UserException {
+        Map<String, String> properties = Maps.newHashMap();
+        properties.put("format", "orc");
+        ExportStmt stmt = new ExportStmt(tableRef, Lists.newArrayList("k1"), path, properties, brokerDesc);
+        stmt.analyze(analyzer);
+        Assert.fail("No exception throws.");
+    }
 }
\ No newline at end of file
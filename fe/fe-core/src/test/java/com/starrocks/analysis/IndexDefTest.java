@@ -21,8 +21,15 @@
 
 package com.starrocks.analysis;
 
+import com.google.common.collect.ImmutableMap;
 import com.google.common.collect.Lists;
+import com.starrocks.catalog.Column;
+import com.starrocks.catalog.Index;
+import com.starrocks.catalog.KeysType;
+import com.starrocks.catalog.Type;
 import com.starrocks.common.AnalysisException;
+import com.starrocks.thrift.TIndexType;
+import com.starrocks.thrift.TOlapTableIndex;
 import org.junit.Assert;
 import org.junit.Before;
 import org.junit.Test;
@@ -65,6 +72,87 @@ public class IndexDefTest {
         }
     }
 
+    @Test
+    public void testInverted() throws AnalysisException {
+        def = new IndexDef("index1", Lists.newArrayList("col1"), IndexDef.IndexType.INVERTED, "");
+        def.analyze();
+        Assert.assertEquals("INDEX index1 (`col1`) USING INVERTED COMMENT ''", def.toSql());
+
+        def.checkColumn(new Column("col1", Type.VARCHAR), KeysType.DUP_KEYS);
+        try {
+            def.checkColumn(new Column("col1", Type.INT), KeysType.DUP_KEYS);
+            Assert.fail("No exception throws.");
+        } catch (AnalysisException e) {
+            Assert.assertTrue(e.getMessage().contains("not supported in inverted index"));
+        }
+        try {
+            def = new IndexDef("index1", Lists.newArrayList("col1", "col2"), IndexDef.IndexType.INVERTED, "");
+            def.analyze();
+            Assert.fail("No exception throws.");
+        } catch (AnalysisException e) {
+            Assert.assertEquals("inverted index can only apply to a single column.", e.getMessage());
+        }
+    }
+
+    @Test
+    public void testNgramBf() throws AnalysisException {
+        def = new IndexDef("index1", Lists.newArrayList("col1"), IndexDef.IndexType.NGRAMBF,
+                ImmutableMap.of(IndexDef.GRAM_NUM, "4"), "");
+        def.analyze();
+        Assert.assertEquals("INDEX index1 (`col1`) USING NGRAMBF PROPERTIES (\"gram_num\" = \"4\") COMMENT ''",
+                def.toSql());
+
+        def.checkColumn(new Column("col1", Type.VARCHAR), KeysType.DUP_KEYS);
+        try {
+            def.checkColumn(new Column("col1", Type.INT), KeysType.DUP_KEYS);
+            Assert.fail("No exception throws.");
+        } catch (AnalysisException e) {
+            Assert.assertTrue(e.getMessage().contains("not supported in ngrambf index"));
+        }
+
+        // BE gets the gram size from the properties
+        Index index = new Index(def.getIndexName(), def.getColumns(), def.getIndexType(), def.getProperties(),
+                def.getComment());
+        TOlapTableIndex tIndex = index.toThrift();
+        Assert.assertEquals(TIndexType.NGRAMBF, tIndex.getIndex_type());
+        Assert.assertEquals("4", tIndex.getProperties().get(IndexDef.GRAM_NUM));
+        Assert.assertEquals("4", index.clone().toThrift().getProperties().get(IndexDef.GRAM_NUM));
+
+        // BE uses the default gram size
+        def = new IndexDef("index1", Lists.newArrayList("col1"), IndexDef.IndexType.NGRAMBF, "");
+        def.analyze();
+        index = new Index(def.getIndexName(), def.getColumns(), def.getIndexType(), def.getProperties(),
+                def.getComment());
+        Assert.assertFalse(index.toThrift().isSetProperties());
+
+        for (String gramNum : Lists.newArrayList("0", "256", "abc")) {
+            try {
+                def = new IndexDef("index1", Lists.newArrayList("col1"), IndexDef.IndexType.NGRAMBF,
+                        ImmutableMap.of(IndexDef.GRAM_NUM, gramNum), "");
+                def.analyze();
+                Assert.fail("No exception throws.");
+            } catch (AnalysisException e) {
+                Assert.assertTrue(e.getMessage().contains("Invalid gram_num: " + gramNum));
+            }
+        }
+        try {
+            def = new IndexDef("index1", Lists.newArrayList("col1"), IndexDef.IndexType.NGRAMBF,
+                    ImmutableMap.of("bloom_filter_fpp", "0.05"), "");
+            def.analyze();
+            Assert.fail("No exception throws.");
+        } catch (AnalysisException e) {
+            Assert.assertEquals("Unknown property of NGRAMBF index: bloom_filter_fpp", e.getMessage());
+        }
+        try {
+            def = new IndexDef("index1", Lists.newArrayList("col1"), IndexDef.IndexType.BITMAP,
+                    ImmutableMap.of(IndexDef.GRAM_NUM, "4"), "");
+            def.analyze();
+            Assert.fail("No exception throws.");
+        } catch (AnalysisException e) {
+            Assert.assertEquals("BITMAP index does not support properties.", e.getMessage());
+        }
+    }
+
     @Test
     public void toSql() {
         Assert.assertEquals("INDEX index1 (`col1`) USING BITMAP COMMENT 'balabala'", def.toSql());
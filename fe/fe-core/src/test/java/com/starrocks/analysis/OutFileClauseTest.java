@@ -0,0 +1,79 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+package com.starrocks.analysis;
+
+import com.google.common.collect.Lists;
+import com.google.common.collect.Maps;
+import com.starrocks.common.AnalysisException;
+import com.starrocks.thrift.TCompressionType;
+import com.starrocks.thrift.TFileFormatType;
+import com.starrocks.thrift.TResultFileSinkOptions;
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.util.Map;
+
+public class OutFileClauseTest {
+    private Map<String, String> brokerProperties() {
+        Map<String, String> properties = Maps.newHashMap();
+        properties.put("broker.name", "my_broker");
+        return properties;
+    }
+
+    @Test
+    public void testCsv() throws AnalysisException {
+        Map<String, String> properties = brokerProperties();
+        properties.put("column_separator", ",");
+        OutFileClause clause = new OutFileClause("hdfs://path/to/result_", null, properties);
+        clause.analyze();
+        Assert.assertEquals(TFileFormatType.FORMAT_CSV_PLAIN, clause.getFileFormatType());
+
+        TResultFileSinkOptions options = clause.toSinkOptions(Lists.newArrayList("k1"));
+        Assert.assertEquals(",", options.getColumn_separator());
+        Assert.assertFalse(options.isSetFile_column_names());
+        Assert.assertFalse(options.isSetCompression_type());
+    }
+
+    @Test
+    public void testParquet() throws AnalysisException {
+        OutFileClause clause = new OutFileClause("hdfs://path/to/result_", "PARQUET", brokerProperties());
+        clause.analyze();
+        Assert.assertEquals(TFileFormatType.FORMAT_PARQUET, clause.getFileFormatType());
+        TResultFileSinkOptions options = clause.toSinkOptions(Lists.newArrayList("k1", "v1"));
+        Assert.assertEquals(Lists.newArrayList("k1", "v1"), options.getFile_column_names());
+        Assert.assertEquals(TCompressionType.SNAPPY, options.getCompression_type());
+        Assert.assertEquals(128 * 1024 * 1024L, options.getParquet_max_row_group_bytes());
+        Assert.assertTrue(options.isParquet_use_dict());
+        Assert.assertFalse(options.isSetColumn_separator());
+
+        Map<String, String> properties = brokerProperties();
+        properties.put("compression", "zstd");
+        properties.put("max_row_group_size", "64MB");
+        properties.put("use_dictionary", "false");
+        clause = new OutFileClause("hdfs://path/to/result_", "parquet", properties);
+        clause.analyze();
+        options = clause.toSinkOptions(Lists.newArrayList("k1"));
+        Assert.assertEquals(TCompressionType.ZSTD, options.getCompression_type());
+        Assert.assertEquals(64 * 1024 * 1024L, options.getParquet_max_row_group_bytes());
+        Assert.assertFalse(options.isParquet_use_dict());
+    }
+
+    @Test(expected = AnalysisException.class)
+    public void testUnsupportedFormat() throws AnalysisException {
+        new OutFileClause("hdfs://path/to/result_", "orc", brokerProperties()).analyze();
+    }
+
+    @Test(expected = AnalysisException.class)
+    public void testUnsupportedCompression() throws AnalysisException {
+        Map<String, String> properties = brokerProperties();
+        properties.put("compression", "lz4");
+        new OutFileClause("hdfs://path/to/result_", "parquet", properties).analyze();
+    }
+
+    @Test(expected = AnalysisException.class)
+    public void testParquetPropertyForCsv() throws AnalysisException {
+        Map<String, String> properties = brokerProperties();
+        properties.put("compression", "zstd");
+        new OutFileClause("hdfs://path/to/result_", "csv", properties).analyze();
+    }
+}
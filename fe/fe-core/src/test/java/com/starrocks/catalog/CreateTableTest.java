@@ -23,11 +23,13 @@ package com.starrocks.catalog;
 
 import com.starrocks.analysis.CreateDbStmt;
 import com.starrocks.analysis.CreateTableStmt;
+import com.starrocks.analysis.IndexDef;
 import com.starrocks.common.AnalysisException;
 import com.starrocks.common.ConfigBase;
 import com.starrocks.common.DdlException;
 import com.starrocks.common.ExceptionChecker;
 import com.starrocks.qe.ConnectContext;
+import com.starrocks.thrift.TOlapTableIndex;
 import com.starrocks.utframe.UtFrameUtils;
 import org.junit.AfterClass;
 import org.junit.Assert;
@@ -118,6 +120,25 @@ public class CreateTableTest {
         Assert.assertTrue(tbl7.getColumn("k2").getAggregationType() == AggregateType.NONE);
     }
 
+    @Test
+    public void testNgramBfIndex() throws DdlException {
+        ExceptionChecker.expectThrowsNoException(() -> createTable(
+                "create table test.ngram_tbl\n" + "(k1 int, msg varchar(1024),\n"
+                        + "index idx_msg (msg) using ngrambf properties('gram_num' = '4') comment 'ngram')\n"
+                        + "duplicate key(k1)\n" + "distributed by hash(k1) buckets 1\n"
+                        + "properties('replication_num' = '1');"));
+
+        Database db = Catalog.getCurrentCatalog().getDb("default_cluster:test");
+        OlapTable table = (OlapTable) db.getTable("ngram_tbl");
+        Assert.assertEquals(1, table.getIndexes().size());
+        Index index = table.getIndexes().get(0);
+        Assert.assertEquals(IndexDef.IndexType.NGRAMBF, index.getIndexType());
+        TOlapTableIndex tIndex = index.toThrift();
+        Assert.assertEquals("4", tIndex.getProperties().get(IndexDef.GRAM_NUM));
+        Assert.assertEquals("INDEX idx_msg (`msg`) USING NGRAMBF PROPERTIES (\"gram_num\" = \"4\") COMMENT 'ngram'",
+                index.toSql());
+    }
+
     @Test
     public void testAbormal() throws DdlException {
         ExceptionChecker.expectThrowsWithMsg(DdlException.class,
@@ -0,0 +1,35 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+package com.starrocks.planner;
+
+import com.google.common.collect.Lists;
+import com.starrocks.analysis.BrokerDesc;
+import com.starrocks.catalog.Catalog;
+import com.starrocks.thrift.TExportSink;
+import com.starrocks.thrift.TFileFormatType;
+import mockit.Mocked;
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.util.List;
+
+public class ExportSinkTest {
+    @Mocked
+    private Catalog catalog;
+
+    @Test
+    public void testFileFormat() {
+        BrokerDesc brokerDesc = new BrokerDesc("broker", null);
+        ExportSink sink = new ExportSink("hdfs://127.0.0.1:9002/export/", "data_0_", "\t", "\n", brokerDesc);
+        TExportSink tSink = sink.toThrift().getExport_sink();
+        Assert.assertEquals(TFileFormatType.FORMAT_CSV_PLAIN, tSink.getFile_format());
+        Assert.assertFalse(tSink.isSetFile_column_names());
+
+        List<String> columnNames = Lists.newArrayList("k1", "k2");
+        sink.setFileFormat(TFileFormatType.FORMAT_PARQUET, columnNames);
+        tSink = sink.toThrift().getExport_sink();
+        Assert.assertEquals(TFileFormatType.FORMAT_PARQUET, tSink.getFile_format());
+        Assert.assertEquals(columnNames, tSink.getFile_column_names());
+        Assert.assertEquals("data_0_", tSink.getFile_name_prefix());
+    }
+}
@@ -0,0 +1,70 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+package com.starrocks.qe;
+
+import com.starrocks.analysis.IntLiteral;
+import com.starrocks.analysis.SetType;
+import com.starrocks.analysis.SetVar;
+import com.starrocks.analysis.StringLiteral;
+import com.starrocks.common.UserException;
+import com.starrocks.thrift.TQueryOptions;
+import com.starrocks.thrift.TResourceGroup;
+import org.junit.Assert;
+import org.junit.Test;
+
+public class SessionVariableTest {
+    private static void setVar(SessionVariable var, String name, String value) throws UserException {
+        SetVar setVar = new SetVar(SetType.SESSION, name, new StringLiteral(value));
+        setVar.analyze(null);
+        VariableMgr.setVar(var, setVar);
+    }
+
+    private static void setVar(SessionVariable var, String name, long value) throws UserException {
+        SetVar setVar = new SetVar(SetType.SESSION, name, new IntLiteral(value));
+        setVar.analyze(null);
+        VariableMgr.setVar(var, setVar);
+    }
+
+    @Test
+    public void testResourceGroup() throws UserException {
+        // no resource group by default, the queries belong to the default group of BE
+        SessionVariable var = VariableMgr.newSessionVariable();
+        Assert.assertFalse(var.toThrift().isSetResource_group());
+
+        setVar(var, SessionVariable.RESOURCE_GROUP, "etl");
+        setVar(var, SessionVariable.RESOURCE_GROUP_CPU_SHARE, 100);
+        setVar(var, SessionVariable.RESOURCE_GROUP_MEM_LIMIT, 1L << 30);
+        TQueryOptions options = var.toThrift();
+        Assert.assertTrue(options.isSetResource_group());
+        TResourceGroup etl = options.getResource_group();
+        Assert.assertEquals("etl", etl.getName());
+        Assert.assertEquals(SessionVariable.getResourceGroupId("etl"), etl.getId());
+        Assert.assertTrue(etl.getId() > 0);
+        Assert.assertEquals(100, etl.getCpu_share());
+        // the default share of BE is used if it's not set
+        Assert.assertFalse(etl.isSetScan_io_share());
+        Assert.assertEquals(1L << 30, etl.getMem_limit());
+
+        // another session of another group
+        SessionVariable var2 = VariableMgr.newSessionVariable();
+        setVar(var2, SessionVariable.RESOURCE_GROUP, "adhoc");
+        setVar(var2, SessionVariable.RESOURCE_GROUP_CPU_SHARE, 400);
+        setVar(var2, SessionVariable.RESOURCE_GROUP_SCAN_IO_SHARE, 200);
+        TResourceGroup adhoc = var2.toThrift().getResource_group();
+        Assert.assertEquals("adhoc", adhoc.getName());
+        Assert.assertNotEquals(etl.getId(), adhoc.getId());
+        Assert.assertEquals(400, adhoc.getCpu_share());
+        Assert.assertEquals(200, adhoc.getScan_io_share());
+        // no memory limit
+        Assert.assertEquals(0, adhoc.getMem_limit());
+
+        // the same group has the same id in all the sessions, and on all the FEs
+        SessionVariable var3 = VariableMgr.newSessionVariable();
+        setVar(var3, SessionVariable.RESOURCE_GROUP, "etl");
+        Assert.assertEquals(etl.getId(), var3.toThrift().getResource_group().getId());
+
+        // back to the default group
+        setVar(var, SessionVariable.RESOURCE_GROUP, "");
+        Assert.assertFalse(var.toThrift().isSetResource_group());
+    }
+}
@@ -197,6 +197,8 @@ vectorized_functions = [
 
     [30040, 'ends_with', 'BOOLEAN', ['VARCHAR', 'VARCHAR'], 'StringFunctions::ends_with'],
     [30050, 'starts_with', 'BOOLEAN', ['VARCHAR', 'VARCHAR'], 'StringFunctions::starts_with'],
+    [30051, 'match_any', 'BOOLEAN', ['VARCHAR', 'VARCHAR'], 'StringFunctions::match_any'],
+    [30052, 'match_all', 'BOOLEAN', ['VARCHAR', 'VARCHAR'], 'StringFunctions::match_all'],
 
     [30060, 'null_or_empty', 'BOOLEAN', ['VARCHAR'], 'StringFunctions::null_or_empty'],
 
@@ -330,10 +332,14 @@ vectorized_functions = [
     [50250, 'time_to_sec', 'BIGINT', ['TIME'], 'TimeFunctions::time_to_sec'],
 
     [50300, 'unix_timestamp', 'INT', [], 'TimeFunctions::to_unix_for_now'],
-    [50301, 'unix_timestamp', 'INT', ['DATETIME'], 'TimeFunctions::to_unix_from_datetime'],
-    [50302, 'unix_timestamp', 'INT', ['DATE'], 'TimeFunctions::to_unix_from_date'],
-    [50303, 'unix_timestamp', 'INT', ['VARCHAR', 'VARCHAR'], 'TimeFunctions::to_unix_from_datetime_with_format'],
-    [50304, 'from_unixtime', 'VARCHAR', ['INT'], 'TimeFunctions::from_unix_to_datetime'],
+    [50301, 'unix_timestamp', 'INT', ['DATETIME'], 'TimeFunctions::to_unix_from_datetime',
+     'TimeFunctions::unix_timestamp_prepare', 'TimeFunctions::unix_timestamp_close'],
+    [50302, 'unix_timestamp', 'INT', ['DATE'], 'TimeFunctions::to_unix_from_date',
+     'TimeFunctions::unix_timestamp_prepare', 'TimeFunctions::unix_timestamp_close'],
+    [50303, 'unix_timestamp', 'INT', ['VARCHAR', 'VARCHAR'], 'TimeFunctions::to_unix_from_datetime_with_format',
+     'TimeFunctions::unix_timestamp_prepare', 'TimeFunctions::unix_timestamp_close'],
+    [50304, 'from_unixtime', 'VARCHAR', ['INT'], 'TimeFunctions::from_unix_to_datetime',
+     'TimeFunctions::from_unix_prepare', 'TimeFunctions::from_unix_close'],
     [50305, 'from_unixtime', 'VARCHAR', ['INT', 'VARCHAR'], 'TimeFunctions::from_unix_to_datetime_with_format', 'TimeFunctions::from_unix_prepare', 'TimeFunctions::from_unix_close'],
 
     [50310, 'dayname', 'VARCHAR', ['DATETIME'], 'TimeFunctions::day_name'],
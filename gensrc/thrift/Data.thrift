@@ -77,6 +77,10 @@ struct TResultBatch {
   
   // For mark statistic data version
   10: optional i32 statistic_version
+
+  // Set when the result is sent in Arrow IPC stream format instead of mysql rows,
+  // each element of rows is then a serialized stream and num_rows is the total row count
+  11: optional i64 num_rows
 }
 
 struct TGlobalDict {
@@ -42,7 +42,9 @@ enum TDataSinkType {
 enum TResultSinkType {
     MYSQL_PROTOCAL,
     FILE,
-    STATISTIC
+    STATISTIC,
+    // Arrow IPC streams, only handled by BE, the FE doesn't plan it yet
+    ARROW
 }
 
 struct TResultFileSinkOptions {
@@ -53,6 +55,10 @@ struct TResultFileSinkOptions {
     5: optional i64 max_file_size_bytes
     6: optional list<Types.TNetworkAddress> broker_addresses; // only for remote file
     7: optional map<string, string> broker_properties // only for remote file
+    8: optional list<string> file_column_names
+    9: optional Types.TCompressionType compression_type // only for parquet
+    10: optional i64 parquet_max_row_group_bytes // only for parquet
+    11: optional bool parquet_use_dict // only for parquet
 }
 
 struct TMemoryScratchSink {
@@ -118,6 +124,9 @@ struct TExportSink {
     // properties need to access broker.
     5: optional list<Types.TNetworkAddress> broker_addresses
     6: optional map<string, string> properties
+    // FORMAT_CSV_PLAIN if not set
+    7: optional PlanNodes.TFileFormatType file_format
+    8: optional list<string> file_column_names // only for parquet
 
     // export file name prefix
     30: optional string file_name_prefix
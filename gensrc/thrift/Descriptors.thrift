@@ -105,7 +105,9 @@ enum THdfsCompression {
 }
 
 enum TIndexType {
-  BITMAP
+  BITMAP,
+  NGRAMBF,
+  INVERTED
 }
 
 // Mapping from names defined by Avro to the enum.
@@ -199,6 +201,8 @@ struct TOlapTableIndex {
   2: optional list<string> columns
   3: optional TIndexType index_type
   4: optional string comment
+  // e.g. "gram_num" of NGRAMBF index
+  5: optional map<string, string> properties
 }
 
 struct TTabletLocation {
@@ -729,6 +729,7 @@ struct TIndexInfo {
     2: optional list<string> columns
     3: optional string index_type
     4: optional string comment
+    5: optional map<string, string> properties
 }
 
 struct TColumnMeta {
@@ -85,6 +85,19 @@ enum TPipelineProfileMode {
   DETAIL
 }
 
+// The resource group a query belongs to. The pipeline engine shares the execution time and
+// the scan io time among the groups by their shares, and limits the memory of each group.
+struct TResourceGroup {
+  1: optional i64 id
+  2: optional string name
+  // relative weight of the execution time of the pipeline engine
+  3: optional i32 cpu_share
+  // relative weight of the scan io time of the pipeline engine
+  4: optional i32 scan_io_share
+  // memory limit in bytes of all the queries in the group, no limit if not positive
+  5: optional i64 mem_limit
+}
+
 // Query options with their respective defaults
 struct TQueryOptions {
   1: optional bool abort_on_error = 0
@@ -157,6 +170,8 @@ struct TQueryOptions {
   54: optional i32 pipeline_dop;
   // For pipeline query engine
   55: optional TPipelineProfileMode pipeline_profile_mode;
+  // For pipeline query engine
+  56: optional TResourceGroup resource_group;
 }
 
 